@@ -0,0 +1,229 @@
+/**************************************************************************/
+/*  file_access_async.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "file_access_async.h"
+
+#include "core/config/project_settings.h"
+
+bool FileAccessAsync::Request::claim() {
+	MutexLock lock(mutex);
+	if (state != STATE_PENDING) {
+		return false;
+	}
+	state = STATE_READING;
+	return true;
+}
+
+void FileAccessAsync::Request::read() {
+	Error err = OK;
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ, &err);
+	if (f.is_valid()) {
+		const uint64_t length = f->get_length();
+		if (max_length > 0 && length > max_length) {
+			err = ERR_UNAVAILABLE;
+		} else if (data.resize(length) != OK) {
+			err = ERR_OUT_OF_MEMORY;
+		} else if (f->get_buffer(data.ptrw(), length) != length) {
+			err = ERR_FILE_CANT_READ;
+		}
+	}
+	if (err != OK) {
+		data.clear();
+	}
+
+	MutexLock lock(mutex);
+	error = err;
+	state = STATE_DONE;
+	ready.set();
+	done_cond.notify_all();
+}
+
+void FileAccessAsync::_skip_request(Request *p_request) {
+	MutexLock lock(p_request->mutex);
+	if (p_request->state == STATE_PENDING) {
+		// Dropped before anyone needed it, so don't read it at all.
+		p_request->state = STATE_DONE;
+		p_request->error = ERR_SKIP;
+		p_request->ready.set();
+	}
+}
+
+void FileAccessAsync::Batch::_read_task(void *p_userdata, uint32_t p_index) {
+	Request *request = ((Batch *)p_userdata)->requests[p_index];
+	if (request->claim()) {
+		request->read();
+	}
+}
+
+FileAccessAsync::Batch *FileAccessAsync::open_async_batch(const Vector<String> &p_paths, uint64_t p_max_length) {
+	Batch *batch = memnew(Batch);
+	batch->files.resize(p_paths.size());
+	batch->requests.resize(p_paths.size());
+	for (int i = 0; i < p_paths.size(); i++) {
+		Request *request = memnew(Request);
+		request->refcount.init(2); // The handle and the batch.
+		request->path = p_paths[i];
+		request->max_length = p_max_length;
+		batch->requests[i] = request;
+
+		batch->files[i].instantiate();
+		batch->files[i]->request = request;
+	}
+
+	if (!batch->requests.is_empty()) {
+		// High priority, the reads are short and someone is expected to need the data soon.
+		batch->group_id = WorkerThreadPool::get_singleton()->add_native_group_task(&Batch::_read_task, batch, batch->requests.size(), -1, true, SNAME("FileAccessAsync"));
+	}
+	return batch;
+}
+
+void FileAccessAsync::finish_batch(Batch *p_batch) {
+	ERR_FAIL_NULL(p_batch);
+
+	p_batch->files.clear();
+	for (Request *request : p_batch->requests) {
+		_skip_request(request);
+	}
+
+	if (p_batch->group_id != -1) {
+		// Only the reads already in progress are left, every other element of the group returns right away.
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(p_batch->group_id);
+	}
+
+	for (Request *request : p_batch->requests) {
+		if (request->refcount.unref()) {
+			memdelete(request);
+		}
+	}
+	memdelete(p_batch);
+}
+
+Error FileAccessAsync::wait() const {
+	if (!request->ready.is_set()) {
+		if (request->claim()) {
+			// No thread picked it up yet, reading it here is faster than waiting for one.
+			request->read();
+		} else {
+			MutexLock lock(request->mutex);
+			while (request->state != STATE_DONE) {
+				request->done_cond.wait(lock);
+			}
+		}
+	}
+	return request->error;
+}
+
+const Vector<uint8_t> &FileAccessAsync::get_data() const {
+	wait();
+	return request->data;
+}
+
+String FileAccessAsync::get_path_absolute() const {
+	return ProjectSettings::get_singleton() ? ProjectSettings::get_singleton()->globalize_path(request->path) : request->path;
+}
+
+void FileAccessAsync::seek(uint64_t p_position) {
+	pos = p_position;
+	eof = false;
+}
+
+void FileAccessAsync::seek_end(int64_t p_position) {
+	wait();
+	pos = request->data.size() + p_position;
+	eof = false;
+}
+
+uint64_t FileAccessAsync::get_position() const {
+	return pos;
+}
+
+uint64_t FileAccessAsync::get_length() const {
+	wait();
+	return request->data.size();
+}
+
+bool FileAccessAsync::eof_reached() const {
+	return eof;
+}
+
+uint64_t FileAccessAsync::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
+	if (!p_length) {
+		return 0;
+	}
+
+	ERR_FAIL_NULL_V(p_dst, -1);
+	wait();
+
+	const uint64_t length = request->data.size();
+	const uint64_t read = pos < length ? MIN(p_length, length - pos) : 0;
+	if (read > 0) {
+		memcpy(p_dst, request->data.ptr() + pos, read);
+		pos += read;
+	}
+	eof = read < p_length;
+
+	return read;
+}
+
+Error FileAccessAsync::get_error() const {
+	const Error err = wait();
+	if (err != OK) {
+		return err;
+	}
+	return eof ? ERR_FILE_EOF : OK;
+}
+
+bool FileAccessAsync::file_exists(const String &p_name) {
+	return FileAccess::exists(p_name);
+}
+
+uint64_t FileAccessAsync::_get_modified_time(const String &p_file) {
+	return FileAccess::get_modified_time(p_file);
+}
+
+uint64_t FileAccessAsync::_get_access_time(const String &p_file) {
+	return FileAccess::get_access_time(p_file);
+}
+
+int64_t FileAccessAsync::_get_size(const String &p_file) {
+	return FileAccess::get_size(p_file);
+}
+
+FileAccessAsync::~FileAccessAsync() {
+	if (!request) {
+		return;
+	}
+
+	// The batch keeps the request alive until its group task is done, so there's nothing to wait for here.
+	_skip_request(request);
+	if (request->refcount.unref()) {
+		memdelete(request);
+	}
+}
@@ -0,0 +1,140 @@
+/**************************************************************************/
+/*  file_access_async.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/condition_variable.h"
+
+// A read-only file whose contents are read in the background by the WorkerThreadPool.
+// It works as a handle on the pending read: is_ready() polls it and wait() blocks until it completes.
+// Any read through the FileAccess interface waits implicitly, so it can be handed to code expecting a regular file.
+// If nothing has started reading it by the time it's awaited, the waiting thread reads it itself instead of sleeping.
+// Files are read in batches by a single group task, so the pool is awaited once per batch rather than once per file.
+class FileAccessAsync : public FileAccess {
+	GDSOFTCLASS(FileAccessAsync, FileAccess);
+
+	enum State {
+		STATE_PENDING,
+		STATE_READING,
+		STATE_DONE,
+	};
+
+	// Shared with the batch, so dropping the handle never leaves the group task with a dangling pointer.
+	struct Request {
+		SafeRefCount refcount;
+		String path;
+		uint64_t max_length = 0;
+		Vector<uint8_t> data;
+		Error error = OK;
+
+		BinaryMutex mutex;
+		ConditionVariable done_cond;
+		State state = STATE_PENDING;
+		SafeFlag ready;
+
+		bool claim();
+		void read();
+	};
+
+	Request *request = nullptr;
+
+	mutable uint64_t pos = 0;
+	// Set by a read that came up short, like `feof()`. Reading exactly up to the end doesn't set it.
+	mutable bool eof = false;
+
+	static void _skip_request(Request *p_request);
+
+public:
+	// The files are only handles, they can be dropped at any time without waiting for anything.
+	// The batch itself must be passed to finish_batch() exactly once, which releases the group task.
+	struct Batch {
+		LocalVector<Ref<FileAccessAsync>> files;
+
+	private:
+		friend class FileAccessAsync;
+
+		LocalVector<Request *> requests;
+		WorkerThreadPool::GroupID group_id = -1;
+
+		static void _read_task(void *p_userdata, uint32_t p_index);
+	};
+
+	// Starts reading the whole files, in the same order as the paths.
+	// Files longer than p_max_length (if not zero) are not read and fail with ERR_UNAVAILABLE.
+	static Batch *open_async_batch(const Vector<String> &p_paths, uint64_t p_max_length = 0);
+	// Skips the files nobody started reading yet and waits for the ones being read, then frees the batch.
+	static void finish_batch(Batch *p_batch);
+
+	bool is_ready() const { return request->ready.is_set(); }
+	Error wait() const;
+	const Vector<uint8_t> &get_data() const;
+
+	virtual Error open_internal(const String &p_path, int p_mode_flags) override { return ERR_UNAVAILABLE; } // Use open_async().
+	virtual bool is_open() const override { return request != nullptr; }
+
+	virtual String get_path() const override { return request->path; }
+	virtual String get_path_absolute() const override;
+
+	virtual void seek(uint64_t p_position) override;
+	virtual void seek_end(int64_t p_position = 0) override;
+	virtual uint64_t get_position() const override;
+	virtual uint64_t get_length() const override;
+
+	virtual bool eof_reached() const override;
+
+	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+
+	virtual Error get_error() const override;
+
+	virtual Error resize(int64_t p_length) override { return ERR_UNAVAILABLE; }
+	virtual void flush() override {}
+	virtual bool store_buffer(const uint8_t *p_src, uint64_t p_length) override { return false; }
+
+	virtual bool file_exists(const String &p_name) override;
+
+	virtual uint64_t _get_modified_time(const String &p_file) override;
+	virtual uint64_t _get_access_time(const String &p_file) override;
+	virtual int64_t _get_size(const String &p_file) override;
+
+	virtual BitField<FileAccess::UnixPermissionFlags> _get_unix_permissions(const String &p_file) override { return 0; }
+	virtual Error _set_unix_permissions(const String &p_file, BitField<FileAccess::UnixPermissionFlags> p_permissions) override { return ERR_UNAVAILABLE; }
+
+	virtual bool _get_hidden_attribute(const String &p_file) override { return false; }
+	virtual Error _set_hidden_attribute(const String &p_file, bool p_hidden) override { return ERR_UNAVAILABLE; }
+	virtual bool _get_read_only_attribute(const String &p_file) override { return true; }
+	virtual Error _set_read_only_attribute(const String &p_file, bool p_ro) override { return ERR_UNAVAILABLE; }
+
+	virtual void close() override {}
+
+	FileAccessAsync() {}
+	~FileAccessAsync();
+};
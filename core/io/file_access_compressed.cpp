@@ -30,6 +30,9 @@
 
 #include "file_access_compressed.h"
 
+#include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
+
 void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
 	magic = p_magic.ascii().get_data();
 	magic = (magic + "    ").substr(0, 4);
@@ -38,6 +41,79 @@ void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_
 	block_size = p_block_size;
 }
 
+bool FileAccessCompressed::_can_use_thread_pool() {
+	// Blocking a pool thread on more pool work could starve the pool, so stay serial there.
+	const WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	return pool && pool->get_thread_count() > 1 && pool->get_thread_index() == -1;
+}
+
+void FileAccessCompressed::_compress_block(void *p_userdata, uint32_t p_index) {
+	CompressJob *job = (CompressJob *)p_userdata;
+	const uint64_t from = (uint64_t)p_index * job->block_size;
+	const uint32_t length = MIN(job->length - from, (uint64_t)job->block_size);
+
+	Vector<uint8_t> &block = job->blocks[p_index];
+	block.resize(Compression::get_max_compressed_buffer_size(length, job->mode));
+	const int size = Compression::compress(block.ptrw(), job->src + from, length, job->mode);
+	if (size < 0) {
+		job->failed.set();
+		return;
+	}
+	block.resize(size);
+}
+
+Vector<uint8_t> FileAccessCompressed::compress_buffer(const uint8_t *p_src, uint64_t p_length, const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
+	ERR_FAIL_COND_V(!p_src && p_length > 0, Vector<uint8_t>());
+	ERR_FAIL_COND_V(p_block_size == 0, Vector<uint8_t>());
+	CharString mgc = p_magic.utf8();
+	ERR_FAIL_COND_V_MSG(mgc.length() != 4, Vector<uint8_t>(), "Compressed file magic must be 4 bytes long.");
+
+	const uint32_t bc = (p_length / p_block_size) + 1;
+
+	CompressJob job;
+	job.src = p_src;
+	job.length = p_length;
+	job.block_size = p_block_size;
+	job.mode = p_mode;
+	job.blocks.resize(bc);
+
+	if (bc >= PARALLEL_MIN_BLOCKS && _can_use_thread_pool()) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&FileAccessCompressed::_compress_block, &job, bc, -1, true, SNAME("FileAccessCompressedCompress"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < bc; i++) {
+			_compress_block(&job, i);
+		}
+	}
+	ERR_FAIL_COND_V_MSG(job.failed.is_set(), Vector<uint8_t>(), "Failed to compress file block.");
+
+	// Header, block table, blocks and the magic again at the end.
+	uint64_t total = 4 + 4 * 3 + bc * 4 + 4;
+	for (const Vector<uint8_t> &block : job.blocks) {
+		total += block.size();
+	}
+
+	Vector<uint8_t> image;
+	ERR_FAIL_COND_V(image.resize(total) != OK, Vector<uint8_t>());
+	uint8_t *w = image.ptrw();
+
+	memcpy(w, mgc.get_data(), 4);
+	w += 4;
+	w += encode_uint32(p_mode, w);
+	w += encode_uint32(p_block_size, w);
+	w += encode_uint32(uint32_t(p_length), w);
+	for (const Vector<uint8_t> &block : job.blocks) {
+		w += encode_uint32(uint32_t(block.size()), w);
+	}
+	for (const Vector<uint8_t> &block : job.blocks) {
+		memcpy(w, block.ptr(), block.size());
+		w += block.size();
+	}
+	memcpy(w, mgc.get_data(), 4);
+
+	return image;
+}
+
 Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	f = p_base;
 	cmode = (Compression::Mode)f->get_32();
@@ -68,6 +144,13 @@ Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	read_block_count = bc;
 	read_block_size = read_blocks.size() == 1 ? read_total : block_size;
 
+	read_ahead_blocks = 0;
+	if (bc >= PARALLEL_MIN_BLOCKS && _can_use_thread_pool()) {
+		read_ahead_blocks = MAX(READ_AHEAD_SIZE / block_size, 2u);
+	}
+	read_ahead_from = 0;
+	read_ahead_count = 0;
+
 	int ret = Compression::decompress(buffer.ptrw(), read_block_size, comp_buffer.ptr(), read_blocks[0].csize, cmode);
 	read_block = 0;
 	read_pos = 0;
@@ -117,42 +200,19 @@ void FileAccessCompressed::_close() {
 	}
 
 	if (writing) {
-		//save block table and all compressed blocks
-
-		CharString mgc = magic.utf8();
-		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //write header 4
-		f->store_32(cmode); //write compression mode 4
-		f->store_32(block_size); //write block size 4
-		f->store_32(uint32_t(write_max)); //max amount of data written 4
-		uint32_t bc = (write_max / block_size) + 1;
-
-		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(0); //compressed sizes, will update later
-		}
-
-		Vector<int> block_sizes;
-		for (uint32_t i = 0; i < bc; i++) {
-			uint32_t bl = i == (bc - 1) ? write_max % block_size : block_size;
-			uint8_t *bp = &write_ptr[i * block_size];
-
-			Vector<uint8_t> cblock;
-			cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
-			int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
-
-			f->store_buffer(cblock.ptr(), s);
-			block_sizes.push_back(s);
-		}
-
-		f->seek(16); //ok write block sizes
-		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(uint32_t(block_sizes[i]));
-		}
-		f->seek_end();
-		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //magic at the end too
+		//save block table and all compressed blocks, with the magic at the end too
+		Vector<uint8_t> image = compress_buffer(write_ptr, write_max, magic, cmode, block_size);
+		f->store_buffer(image);
 
 		buffer.clear();
 
 	} else {
+		_read_ahead_wait();
+		read_ahead_count = 0;
+		read_ahead_comp.clear();
+		read_ahead_buffer.clear();
+		read_ahead_results.clear();
+
 		comp_buffer.clear();
 		buffer.clear();
 		read_blocks.clear();
@@ -197,12 +257,7 @@ void FileAccessCompressed::seek(uint64_t p_position) {
 			read_eof = false;
 			uint32_t block_idx = p_position / block_size;
 			if (block_idx != read_block) {
-				read_block = block_idx;
-				f->seek(read_blocks[read_block].offset);
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_MSG(ret == -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+				ERR_FAIL_COND(!_read_block(block_idx));
 			}
 
 			read_pos = p_position % block_size;
@@ -287,16 +342,76 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 		}
 
 		// Read the next block of compressed data.
-		f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-		int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-		ERR_FAIL_COND_V_MSG(ret == -1, -1, "Compressed file is corrupt.");
-		read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+		ERR_FAIL_COND_V(!_read_block(read_block), -1);
 		read_pos = 0;
+
+		// Reading is sequential, keep decompressing ahead once the blocks in flight run out.
+		if (read_ahead_blocks > 0 && read_block + 1 >= read_ahead_from + read_ahead_count) {
+			_read_ahead(read_block + 1);
+		}
 	}
 
 	return p_length;
 }
 
+bool FileAccessCompressed::_read_block(uint32_t p_block) const {
+	read_block = p_block;
+	read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+
+	if (p_block >= read_ahead_from && p_block < read_ahead_from + read_ahead_count) {
+		_read_ahead_wait();
+		const uint32_t index = p_block - read_ahead_from;
+		ERR_FAIL_COND_V_MSG(read_ahead_results[index] == -1, false, "Compressed file is corrupt.");
+		memcpy(buffer.ptrw(), read_ahead_buffer.ptr() + (uint64_t)index * block_size, read_block_size);
+		return true;
+	}
+
+	f->seek(read_blocks[p_block].offset);
+	f->get_buffer(comp_buffer.ptrw(), read_blocks[p_block].csize);
+	int ret = Compression::decompress(buffer.ptrw(), _get_decompressed_max_size(), comp_buffer.ptr(), read_blocks[p_block].csize, cmode);
+	ERR_FAIL_COND_V_MSG(ret == -1, false, "Compressed file is corrupt.");
+	return true;
+}
+
+void FileAccessCompressed::_read_ahead(uint32_t p_from) const {
+	_read_ahead_wait();
+	read_ahead_count = 0;
+	if (p_from >= read_block_count) {
+		return;
+	}
+
+	const uint32_t count = MIN(read_ahead_blocks, read_block_count - p_from);
+	const ReadBlock &last = read_blocks[p_from + count - 1];
+	const uint64_t comp_size = last.offset + last.csize - read_blocks[p_from].offset;
+
+	// Blocks are stored back to back, so all of them are read in one go.
+	read_ahead_comp.resize(comp_size);
+	f->seek(read_blocks[p_from].offset);
+	if (f->get_buffer(read_ahead_comp.ptr(), comp_size) != comp_size) {
+		return;
+	}
+
+	read_ahead_buffer.resize((uint64_t)count * block_size);
+	read_ahead_results.resize(count);
+	read_ahead_from = p_from;
+	read_ahead_count = count;
+	read_ahead_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &FileAccessCompressed::_decompress_read_ahead_block, (void *)nullptr, count, -1, false, SNAME("FileAccessCompressedReadAhead"));
+}
+
+void FileAccessCompressed::_read_ahead_wait() const {
+	if (read_ahead_task == -1) {
+		return;
+	}
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(read_ahead_task);
+	read_ahead_task = -1;
+}
+
+void FileAccessCompressed::_decompress_read_ahead_block(uint32_t p_index, void *p_userdata) const {
+	const ReadBlock &rb = read_blocks[read_ahead_from + p_index];
+	const uint64_t comp_offset = rb.offset - read_blocks[read_ahead_from].offset;
+	read_ahead_results[p_index] = Compression::decompress(read_ahead_buffer.ptr() + (uint64_t)p_index * block_size, _get_decompressed_max_size(), read_ahead_comp.ptr() + comp_offset, rb.csize, cmode);
+}
+
 Error FileAccessCompressed::get_error() const {
 	return read_eof ? ERR_FILE_EOF : OK;
 }
@@ -32,6 +32,7 @@
 
 #include "core/io/compression.h"
 #include "core/io/file_access.h"
+#include "core/templates/local_vector.h"
 
 class FileAccessCompressed : public FileAccess {
 	GDSOFTCLASS(FileAccessCompressed, FileAccess);
@@ -59,6 +60,38 @@ class FileAccessCompressed : public FileAccess {
 	Vector<ReadBlock> read_blocks;
 	uint64_t read_total = 0;
 
+	// While reading sequentially, the blocks after the current one are decompressed
+	// in parallel on the WorkerThreadPool, ahead of being needed.
+	static constexpr uint32_t READ_AHEAD_SIZE = 256 * 1024;
+	// Files with fewer blocks aren't worth dispatching to the thread pool.
+	static constexpr uint32_t PARALLEL_MIN_BLOCKS = 4;
+
+	uint32_t read_ahead_blocks = 0;
+	mutable uint32_t read_ahead_from = 0;
+	mutable uint32_t read_ahead_count = 0;
+	mutable int64_t read_ahead_task = -1; // WorkerThreadPool::GroupID, -1 if none is pending.
+	mutable LocalVector<uint8_t> read_ahead_comp;
+	mutable LocalVector<uint8_t> read_ahead_buffer;
+	mutable LocalVector<int> read_ahead_results;
+
+	struct CompressJob {
+		const uint8_t *src = nullptr;
+		uint64_t length = 0;
+		uint32_t block_size = 0;
+		Compression::Mode mode = Compression::MODE_ZSTD;
+		LocalVector<Vector<uint8_t>> blocks;
+		SafeFlag failed;
+	};
+
+	static bool _can_use_thread_pool();
+	static void _compress_block(void *p_userdata, uint32_t p_index);
+
+	uint32_t _get_decompressed_max_size() const { return read_blocks.size() == 1 ? read_total : block_size; }
+	bool _read_block(uint32_t p_block) const;
+	void _read_ahead(uint32_t p_from) const;
+	void _read_ahead_wait() const;
+	void _decompress_read_ahead_block(uint32_t p_index, void *p_userdata) const;
+
 	String magic = "GCMP";
 	mutable Vector<uint8_t> buffer;
 	Ref<FileAccess> f;
@@ -68,6 +101,9 @@ class FileAccessCompressed : public FileAccess {
 public:
 	void configure(const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096);
 
+	// Returns the contents of a file written with the given settings, compressing blocks in parallel.
+	static Vector<uint8_t> compress_buffer(const uint8_t *p_src, uint64_t p_length, const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096);
+
 	Error open_after_magic(Ref<FileAccess> p_base);
 
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override; ///< open a file
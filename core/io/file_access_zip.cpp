@@ -144,6 +144,16 @@ unzFile ZipArchive::get_file_handle(const String &p_file) const {
 	return pkg;
 }
 
+String ZipArchive::get_package_path(const String &p_file) const {
+	ERR_FAIL_COND_V_MSG(!file_exists(p_file), String(), vformat("File '%s' doesn't exist.", p_file));
+	return packages[files[p_file].package].filename;
+}
+
+ZipArchive::InflateIndex *ZipArchive::get_inflate_index(const String &p_file) const {
+	ERR_FAIL_COND_V_MSG(!file_exists(p_file), nullptr, vformat("File '%s' doesn't exist.", p_file));
+	return files[p_file].inflate_index;
+}
+
 bool ZipArchive::try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset = 0) {
 	// load with offset feature only supported for PCK files
 	ERR_FAIL_COND_V_MSG(p_offset != 0, false, "Invalid PCK data. Note that loading files with a non-zero offset isn't supported with ZIP archives.");
@@ -189,6 +199,12 @@ bool ZipArchive::try_open_pack(const String &p_path, bool p_replace_files, uint6
 		f.package = pkg_num;
 		unzGetFilePos(zfile, &f.file_pos);
 
+		// Encrypted entries are left to minizip, which can't resume from a checkpoint.
+		if (file_info.compression_method == Z_DEFLATED && !(file_info.flag & 1)) {
+			f.inflate_index = memnew(InflateIndex);
+			inflate_indices.push_back(f.inflate_index);
+		}
+
 		String fname = String("res://") + String::utf8(filename_inzip);
 		files[fname] = f;
 
@@ -230,6 +246,11 @@ ZipArchive::~ZipArchive() {
 	}
 
 	packages.clear();
+
+	for (InflateIndex *index : inflate_indices) {
+		memdelete(index);
+	}
+	inflate_indices.clear();
 }
 
 Error FileAccessZip::open_internal(const String &p_path, int p_mode_flags) {
@@ -244,10 +265,181 @@ Error FileAccessZip::open_internal(const String &p_path, int p_mode_flags) {
 	int err = unzGetCurrentFileInfo64(zfile, &file_info, nullptr, 0, nullptr, 0, nullptr, 0);
 	ERR_FAIL_COND_V(err != UNZ_OK, FAILED);
 
+	inflate_index = arch->get_inflate_index(p_path);
+	if (inflate_index) {
+		// Minizip is only needed to locate the compressed data, the entry is inflated from the package directly.
+		data_offset = unzGetCurrentFileZStreamPos64(zfile);
+		arch->close_handle(zfile);
+		zfile = nullptr;
+
+		package = FileAccess::open(arch->get_package_path(p_path), FileAccess::READ);
+		if (package.is_null()) {
+			inflate_index = nullptr;
+			ERR_FAIL_V_MSG(FAILED, vformat("Cannot open package of file '%s'.", p_path));
+		}
+
+		in_buffer.resize(INFLATE_BUFFER_SIZE);
+		window.resize(INFLATE_WINDOW_SIZE);
+		if (!_inflate_restart(nullptr)) {
+			_close();
+			ERR_FAIL_V(FAILED);
+		}
+	}
+
 	return OK;
 }
 
+bool FileAccessZip::_inflate_restart(const ZipArchive::InflateCheckpoint *p_checkpoint) const {
+	if (stream_initialized) {
+		inflateEnd(&stream);
+		stream_initialized = false;
+	}
+
+	memset(&stream, 0, sizeof(stream));
+	stream.zalloc = godot_alloc;
+	stream.zfree = godot_free;
+	int err = inflateInit2(&stream, -MAX_WBITS);
+	ERR_FAIL_COND_V(err != Z_OK, false);
+	stream_initialized = true;
+
+	stream_end = false;
+	stream_error = false;
+	position = 0;
+	compressed_position = 0;
+	window_pos = 0;
+
+	if (!p_checkpoint) {
+		return true;
+	}
+
+	position = p_checkpoint->uncompressed_offset;
+	compressed_position = p_checkpoint->compressed_offset;
+
+	if (p_checkpoint->bits) {
+		// The checkpoint falls inside a byte, feed its remaining bits first.
+		package->seek(data_offset + compressed_position - 1);
+		const int value = package->get_8() >> (8 - p_checkpoint->bits);
+		err = inflatePrime(&stream, p_checkpoint->bits, value);
+		ERR_FAIL_COND_V(err != Z_OK, false);
+	}
+
+	err = inflateSetDictionary(&stream, p_checkpoint->window.ptr(), p_checkpoint->window.size());
+	ERR_FAIL_COND_V(err != Z_OK, false);
+
+	memcpy(window.ptr(), p_checkpoint->window.ptr(), p_checkpoint->window.size());
+	window_pos = p_checkpoint->window.size() % INFLATE_WINDOW_SIZE;
+
+	return true;
+}
+
+uint64_t FileAccessZip::_inflate(uint8_t *p_dst, uint64_t p_length) const {
+	uint64_t total = 0;
+
+	while (total < p_length && !stream_end && !stream_error) {
+		if (stream.avail_in == 0) {
+			const uint64_t to_read = MIN(file_info.compressed_size - compressed_position, (uint64_t)INFLATE_BUFFER_SIZE);
+			package->seek(data_offset + compressed_position);
+			const uint64_t read = to_read > 0 ? package->get_buffer(in_buffer.ptr(), to_read) : 0;
+			if (read == 0) {
+				stream_error = true;
+				ERR_FAIL_V_MSG(total, "Unexpected end of compressed data in ZIP entry.");
+			}
+			compressed_position += read;
+			stream.next_in = in_buffer.ptr();
+			stream.avail_in = read;
+		}
+
+		// Output always goes through the window, so it holds the history a checkpoint needs.
+		const uint32_t chunk = MIN((uint64_t)(INFLATE_WINDOW_SIZE - window_pos), p_length - total);
+		stream.next_out = window.ptr() + window_pos;
+		stream.avail_out = chunk;
+
+		const int err = inflate(&stream, Z_BLOCK);
+		if (err != Z_OK && err != Z_STREAM_END) {
+			stream_error = true;
+			ERR_FAIL_V_MSG(total, vformat("Error inflating ZIP entry (zlib error %d).", err));
+		}
+
+		const uint32_t produced = chunk - stream.avail_out;
+		if (p_dst) {
+			memcpy(p_dst + total, window.ptr() + window_pos, produced);
+		}
+		window_pos = (window_pos + produced) % INFLATE_WINDOW_SIZE;
+		position += produced;
+		total += produced;
+
+		if (err == Z_STREAM_END) {
+			stream_end = true;
+		} else if ((stream.data_type & 128) && !(stream.data_type & 64)) {
+			// At the end of a deflate block which isn't the last one.
+			_inflate_add_checkpoint();
+		}
+	}
+
+	return total;
+}
+
+void FileAccessZip::_inflate_add_checkpoint() const {
+	MutexLock lock(inflate_index->mutex);
+
+	LocalVector<ZipArchive::InflateCheckpoint> &checkpoints = inflate_index->checkpoints;
+	const uint64_t last_offset = checkpoints.is_empty() ? 0 : checkpoints[checkpoints.size() - 1].uncompressed_offset;
+	if (position < last_offset + INFLATE_CHECKPOINT_SPAN) {
+		return;
+	}
+
+	// The span is larger than the window, so the window is always full here.
+	ZipArchive::InflateCheckpoint checkpoint;
+	checkpoint.uncompressed_offset = position;
+	checkpoint.compressed_offset = compressed_position - stream.avail_in;
+	checkpoint.bits = stream.data_type & 7;
+	checkpoint.window.resize(INFLATE_WINDOW_SIZE);
+	memcpy(checkpoint.window.ptr(), window.ptr() + window_pos, INFLATE_WINDOW_SIZE - window_pos);
+	memcpy(checkpoint.window.ptr() + INFLATE_WINDOW_SIZE - window_pos, window.ptr(), window_pos);
+	checkpoints.push_back(std::move(checkpoint));
+}
+
+void FileAccessZip::_inflate_seek(uint64_t p_position) {
+	bool restart = p_position < position || stream_error;
+	bool has_checkpoint = false;
+	ZipArchive::InflateCheckpoint checkpoint;
+	{
+		// Only held while looking up the checkpoint, other readers add checkpoints while this one inflates.
+		MutexLock lock(inflate_index->mutex);
+
+		const LocalVector<ZipArchive::InflateCheckpoint> &checkpoints = inflate_index->checkpoints;
+		for (int64_t i = (int64_t)checkpoints.size() - 1; i >= 0; i--) {
+			if (checkpoints[i].uncompressed_offset > p_position) {
+				continue;
+			}
+			// Keep inflating from the current position when no checkpoint is closer to the target.
+			if (restart || checkpoints[i].uncompressed_offset > position) {
+				checkpoint = checkpoints[i];
+				has_checkpoint = true;
+				restart = true;
+			}
+			break;
+		}
+	}
+
+	if (restart && !_inflate_restart(has_checkpoint ? &checkpoint : nullptr)) {
+		stream_error = true;
+		return;
+	}
+
+	if (p_position > position) {
+		_inflate(nullptr, p_position - position);
+	}
+}
+
 void FileAccessZip::_close() {
+	if (stream_initialized) {
+		inflateEnd(&stream);
+		stream_initialized = false;
+	}
+	package.unref();
+	inflate_index = nullptr;
+
 	if (!zfile) {
 		return;
 	}
@@ -259,39 +451,60 @@ void FileAccessZip::_close() {
 }
 
 bool FileAccessZip::is_open() const {
-	return zfile != nullptr;
+	return zfile != nullptr || package.is_valid();
 }
 
 void FileAccessZip::seek(uint64_t p_position) {
-	ERR_FAIL_NULL(zfile);
+	ERR_FAIL_COND(!is_open());
+
+	at_eof = false;
+	if (package.is_valid()) {
+		_inflate_seek(p_position);
+		return;
+	}
 
 	unzSeekCurrentFile(zfile, p_position);
 }
 
 void FileAccessZip::seek_end(int64_t p_position) {
-	ERR_FAIL_NULL(zfile);
-	unzSeekCurrentFile(zfile, get_length() + p_position);
+	ERR_FAIL_COND(!is_open());
+	seek(get_length() + p_position);
 }
 
 uint64_t FileAccessZip::get_position() const {
-	ERR_FAIL_NULL_V(zfile, 0);
+	ERR_FAIL_COND_V(!is_open(), 0);
+	if (package.is_valid()) {
+		return position;
+	}
 	return unztell64(zfile);
 }
 
 uint64_t FileAccessZip::get_length() const {
-	ERR_FAIL_NULL_V(zfile, 0);
+	ERR_FAIL_COND_V(!is_open(), 0);
 	return file_info.uncompressed_size;
 }
 
 bool FileAccessZip::eof_reached() const {
-	ERR_FAIL_NULL_V(zfile, true);
+	ERR_FAIL_COND_V(!is_open(), true);
 
 	return at_eof;
 }
 
 uint64_t FileAccessZip::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
-	ERR_FAIL_NULL_V(zfile, -1);
+	ERR_FAIL_COND_V(!is_open(), -1);
+
+	if (package.is_valid()) {
+		at_eof = position >= file_info.uncompressed_size;
+		if (at_eof) {
+			return 0;
+		}
+		const uint64_t read = _inflate(p_dst, p_length);
+		if (read < p_length) {
+			at_eof = true;
+		}
+		return read;
+	}
 
 	at_eof = unzeof(zfile);
 	if (at_eof) {
@@ -306,7 +519,7 @@ uint64_t FileAccessZip::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 }
 
 Error FileAccessZip::get_error() const {
-	if (!zfile) {
+	if (!is_open()) {
 		return ERR_UNCONFIGURED;
 	}
 	if (eof_reached()) {
@@ -33,14 +33,32 @@
 #ifdef MINIZIP_ENABLED
 
 #include "core/io/file_access_pack.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 
 #include "thirdparty/minizip/unzip.h"
 
 class ZipArchive : public PackSource {
 public:
+	// Point at a deflate block boundary where inflating can restart, so seeking
+	// backwards doesn't inflate the entry from its start again.
+	struct InflateCheckpoint {
+		uint64_t uncompressed_offset = 0;
+		uint64_t compressed_offset = 0;
+		uint8_t bits = 0; // Bits of the byte before `compressed_offset` that belong to the next block.
+		LocalVector<uint8_t> window; // Output preceding the checkpoint, up to the deflate window size.
+	};
+
+	// Checkpoints of one deflated entry, built lazily while it's read and shared by all its readers.
+	struct InflateIndex {
+		Mutex mutex;
+		LocalVector<InflateCheckpoint> checkpoints; // Sorted by offset.
+	};
+
 	struct File {
 		int package = -1;
 		unz_file_pos file_pos;
+		InflateIndex *inflate_index = nullptr; // Only for deflated entries.
 		File() {}
 	};
 
@@ -52,12 +70,15 @@ private:
 	Vector<Package> packages;
 
 	HashMap<String, File> files;
+	LocalVector<InflateIndex *> inflate_indices;
 
 	static inline ZipArchive *instance = nullptr;
 
 public:
 	void close_handle(unzFile p_file) const;
 	unzFile get_file_handle(const String &p_file) const;
+	String get_package_path(const String &p_file) const;
+	InflateIndex *get_inflate_index(const String &p_file) const;
 
 	Error add_package(const String &p_name);
 
@@ -79,6 +100,29 @@ class FileAccessZip : public FileAccess {
 
 	mutable bool at_eof = false;
 
+	static constexpr uint32_t INFLATE_WINDOW_SIZE = 32768;
+	static constexpr uint32_t INFLATE_BUFFER_SIZE = 16384;
+	static constexpr uint64_t INFLATE_CHECKPOINT_SPAN = 1024 * 1024;
+
+	// Deflated entries are inflated here from the package file instead of by minizip.
+	ZipArchive::InflateIndex *inflate_index = nullptr;
+	Ref<FileAccess> package;
+	uint64_t data_offset = 0;
+	mutable z_stream stream;
+	mutable bool stream_initialized = false;
+	mutable bool stream_end = false;
+	mutable bool stream_error = false;
+	mutable uint64_t position = 0;
+	mutable uint64_t compressed_position = 0; // Relative to `data_offset`.
+	mutable LocalVector<uint8_t> in_buffer;
+	mutable LocalVector<uint8_t> window;
+	mutable uint32_t window_pos = 0;
+
+	bool _inflate_restart(const ZipArchive::InflateCheckpoint *p_checkpoint) const;
+	uint64_t _inflate(uint8_t *p_dst, uint64_t p_length) const;
+	void _inflate_add_checkpoint() const;
+	void _inflate_seek(uint64_t p_position);
+
 	void _close();
 
 public:
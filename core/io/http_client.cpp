@@ -57,6 +57,11 @@ void HTTPClient::set_https_proxy(const String &p_host, int p_port) {
 	WARN_PRINT("HTTPS proxy feature is not available");
 }
 
+Error HTTPClient::read_response_body_chunk_into(uint8_t *p_buffer, int p_size, int &r_received) {
+	r_received = 0;
+	return ERR_UNAVAILABLE;
+}
+
 Error HTTPClient::_request_raw(Method p_method, const String &p_url, const Vector<String> &p_headers, const Vector<uint8_t> &p_body) {
 	int size = p_body.size();
 	return request(p_method, p_url, p_headers, size > 0 ? p_body.ptr() : nullptr, size);
@@ -184,6 +184,10 @@ public:
 	virtual int64_t get_response_body_length() const = 0;
 
 	virtual PackedByteArray read_response_body_chunk() = 0; // Can't get body as partial text because of most encodings UTF8, gzip, etc.
+	// Reads up to p_size bytes of the body straight into p_buffer, without allocating an intermediate array.
+	// Returns ERR_UNAVAILABLE when the current response can't be streamed this way (e.g. chunked transfer),
+	// in which case read_response_body_chunk() must be used instead. Connection errors are reported via get_status().
+	virtual Error read_response_body_chunk_into(uint8_t *p_buffer, int p_size, int &r_received);
 
 	virtual void set_blocking_mode(bool p_enable) = 0; // Useful mostly if running in a thread
 	virtual bool is_blocking_mode_enabled() const = 0;
@@ -679,36 +679,58 @@ PackedByteArray HTTPClientTCP::read_response_body_chunk() {
 		}
 
 	} else {
-		int to_read = !read_until_eof ? MIN(body_left, read_chunk_size) : read_chunk_size;
-		ret.resize(to_read);
-		int _offset = 0;
-		while (to_read > 0) {
-			int rec = 0;
-			{
-				uint8_t *w = ret.ptrw();
-				err = _get_http_data(w + _offset, to_read, rec);
-			}
-			if (rec <= 0) { // Ended up reading less.
-				ret.resize(_offset);
-				break;
-			} else {
-				_offset += rec;
-				to_read -= rec;
-				if (!read_until_eof) {
-					body_left -= rec;
-				}
-			}
-			if (err != OK) {
-				ret.resize(_offset);
-				break;
-			}
+		ret.resize(!read_until_eof ? MIN(body_left, read_chunk_size) : read_chunk_size);
+		int rec = 0;
+		err = _read_body_data(ret.ptrw(), ret.size(), rec);
+		ret.resize(rec);
+	}
+
+	_body_read_done(err);
+
+	return ret;
+}
+
+Error HTTPClientTCP::read_response_body_chunk_into(uint8_t *p_buffer, int p_size, int &r_received) {
+	r_received = 0;
+	ERR_FAIL_COND_V(status != STATUS_BODY, ERR_UNCONFIGURED);
+	ERR_FAIL_COND_V(p_size <= 0, ERR_INVALID_PARAMETER);
+	if (chunked) {
+		// Chunks must be reassembled first, so there is nothing to gain over read_response_body_chunk().
+		return ERR_UNAVAILABLE;
+	}
+
+	Error err = _read_body_data(p_buffer, p_size, r_received);
+	_body_read_done(err);
+	return OK;
+}
+
+Error HTTPClientTCP::_read_body_data(uint8_t *p_buffer, int p_size, int &r_received) {
+	Error err = OK;
+	int to_read = !read_until_eof ? MIN(body_left, p_size) : p_size;
+	r_received = 0;
+	while (to_read > 0) {
+		int rec = 0;
+		err = _get_http_data(p_buffer + r_received, to_read, rec);
+		if (rec <= 0) { // Ended up reading less.
+			break;
+		}
+		r_received += rec;
+		to_read -= rec;
+		if (!read_until_eof) {
+			body_left -= rec;
+		}
+		if (err != OK) {
+			break;
 		}
 	}
+	return err;
+}
 
-	if (err != OK) {
+void HTTPClientTCP::_body_read_done(Error p_err) {
+	if (p_err != OK) {
 		close();
 
-		if (err == ERR_FILE_EOF) {
+		if (p_err == ERR_FILE_EOF) {
 			status = STATUS_DISCONNECTED; // Server disconnected.
 		} else {
 			status = STATUS_CONNECTION_ERROR;
@@ -716,8 +738,6 @@ PackedByteArray HTTPClientTCP::read_response_body_chunk() {
 	} else if (body_left == 0 && !chunked && !read_until_eof) {
 		status = STATUS_CONNECTED;
 	}
-
-	return ret;
 }
 
 HTTPClientTCP::Status HTTPClientTCP::get_status() const {
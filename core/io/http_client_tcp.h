@@ -73,6 +73,8 @@ private:
 	int read_chunk_size = 65536;
 
 	Error _get_http_data(uint8_t *p_buffer, int p_bytes, int &r_received);
+	Error _read_body_data(uint8_t *p_buffer, int p_size, int &r_received);
+	void _body_read_done(Error p_err);
 
 public:
 	static HTTPClient *_create_func(bool p_notify_postinitialize);
@@ -90,6 +92,7 @@ public:
 	Error get_response_headers(List<String> *r_response) override;
 	int64_t get_response_body_length() const override;
 	PackedByteArray read_response_body_chunk() override;
+	Error read_response_body_chunk_into(uint8_t *p_buffer, int p_size, int &r_received) override;
 	void set_blocking_mode(bool p_enable) override;
 	bool is_blocking_mode_enabled() const override;
 	void set_read_chunk_size(int p_size) override;
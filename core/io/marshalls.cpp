@@ -2130,6 +2130,729 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 	return OK;
 }
 
+// Compact encoding: a tag byte holding the type in the low 6 bits and two flags,
+// followed by the payload without padding. Integers and lengths are LEB128 varints
+// (zigzag for signed values). Packed arrays keep their raw elements so they can be
+// viewed in place. Types without a compact form use the regular encoding after the tag.
+// With a schema type, the tag is omitted for the types which don't use the flags.
+#define COMPACT_TYPE_MASK 0x3F
+// BOOL: the value.
+#define COMPACT_FLAG_TRUE (1 << 7)
+// FLOAT: stored as 32-bit without loss.
+#define COMPACT_FLAG_FLOAT32 (1 << 7)
+// Math types and packed arrays with `real_t` components: components are 64-bit.
+#define COMPACT_FLAG_64 (1 << 7)
+// ARRAY: typed with a builtin type, stored in the byte after the tag.
+#define COMPACT_FLAG_TYPED (1 << 7)
+// ARRAY, DICTIONARY: the regular encoding follows the tag.
+#define COMPACT_FLAG_REGULAR (1 << 6)
+
+static bool _compact_has_flags(Variant::Type p_type) {
+	switch (p_type) {
+		case Variant::BOOL:
+		case Variant::FLOAT:
+		case Variant::VECTOR2:
+		case Variant::RECT2:
+		case Variant::VECTOR3:
+		case Variant::TRANSFORM2D:
+		case Variant::VECTOR4:
+		case Variant::PLANE:
+		case Variant::QUATERNION:
+		case Variant::AABB:
+		case Variant::BASIS:
+		case Variant::TRANSFORM3D:
+		case Variant::PROJECTION:
+		case Variant::ARRAY:
+		case Variant::DICTIONARY:
+		case Variant::PACKED_VECTOR2_ARRAY:
+		case Variant::PACKED_VECTOR3_ARRAY:
+		case Variant::PACKED_VECTOR4_ARRAY:
+			return true;
+		default:
+			return false;
+	}
+}
+
+static _FORCE_INLINE_ uint64_t _zigzag_encode(int64_t p_value) {
+	return (uint64_t(p_value) << 1) ^ uint64_t(p_value >> 63);
+}
+
+static _FORCE_INLINE_ int64_t _zigzag_decode(uint64_t p_value) {
+	return int64_t(p_value >> 1) ^ -int64_t(p_value & 1);
+}
+
+static void _compact_put_varint(uint64_t p_value, uint8_t *&buf, int &r_len) {
+	do {
+		uint8_t byte = p_value & 0x7F;
+		p_value >>= 7;
+		if (p_value) {
+			byte |= 0x80;
+		}
+		if (buf) {
+			*(buf++) = byte;
+		}
+		r_len++;
+	} while (p_value);
+}
+
+static void _compact_put_bytes(const void *p_data, uint64_t p_size, uint8_t *&buf, int &r_len) {
+	if (buf) {
+		memcpy(buf, p_data, p_size);
+		buf += p_size;
+	}
+	r_len += p_size;
+}
+
+static void _compact_put_string(const String &p_string, uint8_t *&buf, int &r_len) {
+	CharString utf8 = p_string.utf8();
+	_compact_put_varint(utf8.length(), buf, r_len);
+	_compact_put_bytes(utf8.get_data(), utf8.length(), buf, r_len);
+}
+
+template <typename T>
+static void _compact_put_reals(const T &p_value, uint8_t *&buf, int &r_len) {
+	static_assert(sizeof(T) % sizeof(real_t) == 0);
+	const real_t *reals = reinterpret_cast<const real_t *>(&p_value);
+	for (uint32_t i = 0; i < sizeof(T) / sizeof(real_t); i++) {
+		if (buf) {
+			buf += encode_real(reals[i], buf);
+		}
+		r_len += sizeof(real_t);
+	}
+}
+
+template <typename T>
+static void _compact_put_ints(const T &p_value, uint8_t *&buf, int &r_len) {
+	static_assert(sizeof(T) % sizeof(int32_t) == 0);
+	const int32_t *ints = reinterpret_cast<const int32_t *>(&p_value);
+	for (uint32_t i = 0; i < sizeof(T) / sizeof(int32_t); i++) {
+		_compact_put_varint(_zigzag_encode(ints[i]), buf, r_len);
+	}
+}
+
+// Elements are stored in memory order, which is little-endian on all supported platforms.
+template <typename T>
+static void _compact_put_packed(const Vector<T> &p_array, uint8_t *&buf, int &r_len) {
+	_compact_put_varint(p_array.size(), buf, r_len);
+	_compact_put_bytes(p_array.ptr(), p_array.size() * sizeof(T), buf, r_len);
+}
+
+static Error _compact_get_varint(const uint8_t *&buf, int &len, uint64_t &r_value) {
+	r_value = 0;
+	for (int i = 0; i < len && i < 10; i++) {
+		r_value |= uint64_t(buf[i] & 0x7F) << (7 * i);
+		if (!(buf[i] & 0x80)) {
+			buf += i + 1;
+			len -= i + 1;
+			return OK;
+		}
+	}
+	ERR_FAIL_V(ERR_INVALID_DATA);
+}
+
+// Reads a count of elements which take at least `p_element_size` bytes each.
+static Error _compact_get_count(const uint8_t *&buf, int &len, uint64_t p_element_size, int &r_count) {
+	uint64_t count = 0;
+	Error err = _compact_get_varint(buf, len, count);
+	ERR_FAIL_COND_V(err != OK, err);
+	ERR_FAIL_COND_V(p_element_size > 0 && count > (uint64_t)len / p_element_size, ERR_INVALID_DATA);
+	ERR_FAIL_COND_V(count > INT32_MAX, ERR_INVALID_DATA);
+	r_count = count;
+	return OK;
+}
+
+static Error _compact_get_string(const uint8_t *&buf, int &len, String &r_string) {
+	int size = 0;
+	Error err = _compact_get_count(buf, len, 1, size);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	String str;
+	ERR_FAIL_COND_V(str.append_utf8((const char *)buf, size) != OK, ERR_INVALID_DATA);
+	r_string = str;
+	buf += size;
+	len -= size;
+	return OK;
+}
+
+template <typename T>
+static Error _compact_get_reals(T &r_value, bool p_64, const uint8_t *&buf, int &len) {
+	constexpr int count = sizeof(T) / sizeof(real_t);
+	const int size = p_64 ? 8 : 4;
+	ERR_FAIL_COND_V(len < count * size, ERR_INVALID_DATA);
+
+	real_t *reals = reinterpret_cast<real_t *>(&r_value);
+	for (int i = 0; i < count; i++) {
+		reals[i] = p_64 ? (real_t)decode_double(buf) : (real_t)decode_float(buf);
+		buf += size;
+	}
+	len -= count * size;
+	return OK;
+}
+
+template <typename T>
+static Error _compact_get_ints(T &r_value, const uint8_t *&buf, int &len) {
+	int32_t *ints = reinterpret_cast<int32_t *>(&r_value);
+	for (uint32_t i = 0; i < sizeof(T) / sizeof(int32_t); i++) {
+		uint64_t value = 0;
+		Error err = _compact_get_varint(buf, len, value);
+		ERR_FAIL_COND_V(err != OK, err);
+		ints[i] = _zigzag_decode(value);
+	}
+	return OK;
+}
+
+template <typename T>
+static Error _compact_get_packed(Variant &r_variant, const uint8_t *&buf, int &len) {
+	int count = 0;
+	Error err = _compact_get_count(buf, len, sizeof(T), count);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	Vector<T> array;
+	ERR_FAIL_COND_V(array.resize(count) != OK, ERR_OUT_OF_MEMORY);
+	memcpy(array.ptrw(), buf, count * sizeof(T));
+	buf += count * sizeof(T);
+	len -= count * sizeof(T);
+	r_variant = array;
+	return OK;
+}
+
+template <typename T>
+static Error _compact_get_packed_reals(Variant &r_variant, bool p_64, const uint8_t *&buf, int &len) {
+	if (p_64 == (sizeof(real_t) == 8)) {
+		return _compact_get_packed<T>(r_variant, buf, len);
+	}
+
+	// Encoded with another `real_t` precision, convert each component.
+	int count = 0;
+	Error err = _compact_get_count(buf, len, (sizeof(T) / sizeof(real_t)) * (p_64 ? 8 : 4), count);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	Vector<T> array;
+	ERR_FAIL_COND_V(array.resize(count) != OK, ERR_OUT_OF_MEMORY);
+	T *w = array.ptrw();
+	for (int i = 0; i < count; i++) {
+		_compact_get_reals(w[i], p_64, buf, len);
+	}
+	r_variant = array;
+	return OK;
+}
+
+static Error _compact_get_tag(const uint8_t *&buf, int &len, Variant::Type p_schema, Variant::Type &r_type, uint8_t &r_flags) {
+	r_flags = 0;
+	if (p_schema != Variant::VARIANT_MAX && !_compact_has_flags(p_schema)) {
+		r_type = p_schema;
+		return OK;
+	}
+
+	ERR_FAIL_COND_V(len < 1, ERR_INVALID_DATA);
+	const uint8_t tag = *(buf++);
+	len--;
+	ERR_FAIL_COND_V((tag & COMPACT_TYPE_MASK) >= Variant::VARIANT_MAX, ERR_INVALID_DATA);
+	r_type = Variant::Type(tag & COMPACT_TYPE_MASK);
+	r_flags = tag & ~COMPACT_TYPE_MASK;
+	ERR_FAIL_COND_V(p_schema != Variant::VARIANT_MAX && r_type != p_schema, ERR_INVALID_DATA);
+	return OK;
+}
+
+Error encode_variant_compact(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects, Variant::Type p_schema, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Potential infinite recursion detected. Bailing.");
+	const Variant::Type type = p_variant.get_type();
+	ERR_FAIL_COND_V_MSG(p_schema != Variant::VARIANT_MAX && type != p_schema, ERR_INVALID_PARAMETER, vformat("Value of type %s doesn't match the schema type %s.", Variant::get_type_name(type), Variant::get_type_name(p_schema)));
+
+	uint8_t *buf = r_buffer;
+	r_len = 0;
+
+	uint8_t tag = type;
+	uint8_t *tag_ptr = nullptr;
+	if (p_schema == Variant::VARIANT_MAX || _compact_has_flags(type)) {
+		tag_ptr = buf;
+		_compact_put_bytes(&tag, 1, buf, r_len);
+	}
+
+	switch (type) {
+		case Variant::NIL: {
+		} break;
+		case Variant::BOOL: {
+			if (p_variant.operator bool()) {
+				tag |= COMPACT_FLAG_TRUE;
+			}
+		} break;
+		case Variant::INT: {
+			_compact_put_varint(_zigzag_encode(p_variant.operator int64_t()), buf, r_len);
+		} break;
+		case Variant::FLOAT: {
+			const double d = p_variant;
+			const float f = d;
+			if ((double)f == d) {
+				tag |= COMPACT_FLAG_FLOAT32;
+				if (buf) {
+					buf += encode_float(f, buf);
+				}
+				r_len += 4;
+			} else {
+				if (buf) {
+					buf += encode_double(d, buf);
+				}
+				r_len += 8;
+			}
+		} break;
+		case Variant::STRING: {
+			_compact_put_string(p_variant, buf, r_len);
+		} break;
+		case Variant::STRING_NAME: {
+			_compact_put_string(String(p_variant.operator StringName()), buf, r_len);
+		} break;
+
+		// Math types.
+		case Variant::VECTOR2: {
+			_compact_put_reals(p_variant.operator Vector2(), buf, r_len);
+		} break;
+		case Variant::RECT2: {
+			_compact_put_reals(p_variant.operator Rect2(), buf, r_len);
+		} break;
+		case Variant::VECTOR3: {
+			_compact_put_reals(p_variant.operator Vector3(), buf, r_len);
+		} break;
+		case Variant::TRANSFORM2D: {
+			_compact_put_reals(p_variant.operator Transform2D(), buf, r_len);
+		} break;
+		case Variant::VECTOR4: {
+			_compact_put_reals(p_variant.operator Vector4(), buf, r_len);
+		} break;
+		case Variant::PLANE: {
+			_compact_put_reals(p_variant.operator Plane(), buf, r_len);
+		} break;
+		case Variant::QUATERNION: {
+			_compact_put_reals(p_variant.operator Quaternion(), buf, r_len);
+		} break;
+		case Variant::AABB: {
+			_compact_put_reals(p_variant.operator ::AABB(), buf, r_len);
+		} break;
+		case Variant::BASIS: {
+			_compact_put_reals(p_variant.operator Basis(), buf, r_len);
+		} break;
+		case Variant::TRANSFORM3D: {
+			_compact_put_reals(p_variant.operator Transform3D(), buf, r_len);
+		} break;
+		case Variant::PROJECTION: {
+			_compact_put_reals(p_variant.operator Projection(), buf, r_len);
+		} break;
+		case Variant::VECTOR2I: {
+			_compact_put_ints(p_variant.operator Vector2i(), buf, r_len);
+		} break;
+		case Variant::RECT2I: {
+			_compact_put_ints(p_variant.operator Rect2i(), buf, r_len);
+		} break;
+		case Variant::VECTOR3I: {
+			_compact_put_ints(p_variant.operator Vector3i(), buf, r_len);
+		} break;
+		case Variant::VECTOR4I: {
+			_compact_put_ints(p_variant.operator Vector4i(), buf, r_len);
+		} break;
+		case Variant::COLOR: {
+			const Color color = p_variant;
+			_compact_put_bytes(&color, sizeof(Color), buf, r_len);
+		} break;
+
+		// Containers.
+		case Variant::ARRAY: {
+			const Array array = p_variant;
+			if (array.is_typed() && (array.get_typed_class_name() != StringName() || array.get_typed_script() != Variant())) {
+				tag |= COMPACT_FLAG_REGULAR;
+				int size = 0;
+				Error err = encode_variant(p_variant, buf, size, p_full_objects, p_depth + 1);
+				ERR_FAIL_COND_V(err != OK, err);
+				if (buf) {
+					buf += size;
+				}
+				r_len += size;
+				break;
+			}
+
+			Variant::Type element_schema = Variant::VARIANT_MAX;
+			if (array.is_typed()) {
+				tag |= COMPACT_FLAG_TYPED;
+				element_schema = Variant::Type(array.get_typed_builtin());
+				const uint8_t element_type = element_schema;
+				_compact_put_bytes(&element_type, 1, buf, r_len);
+			}
+
+			_compact_put_varint(array.size(), buf, r_len);
+			for (const Variant &element : array) {
+				int size = 0;
+				Error err = encode_variant_compact(element, buf, size, p_full_objects, element_schema, p_depth + 1);
+				ERR_FAIL_COND_V(err != OK, err);
+				if (buf) {
+					buf += size;
+				}
+				r_len += size;
+			}
+		} break;
+		case Variant::DICTIONARY: {
+			const Dictionary dict = p_variant;
+			if (dict.is_typed()) {
+				tag |= COMPACT_FLAG_REGULAR;
+				int size = 0;
+				Error err = encode_variant(p_variant, buf, size, p_full_objects, p_depth + 1);
+				ERR_FAIL_COND_V(err != OK, err);
+				if (buf) {
+					buf += size;
+				}
+				r_len += size;
+				break;
+			}
+
+			_compact_put_varint(dict.size(), buf, r_len);
+			for (const KeyValue<Variant, Variant> &kv : dict) {
+				int size = 0;
+				Error err = encode_variant_compact(kv.key, buf, size, p_full_objects, Variant::VARIANT_MAX, p_depth + 1);
+				ERR_FAIL_COND_V(err != OK, err);
+				if (buf) {
+					buf += size;
+				}
+				r_len += size;
+				err = encode_variant_compact(kv.value, buf, size, p_full_objects, Variant::VARIANT_MAX, p_depth + 1);
+				ERR_FAIL_COND_V(err != OK, err);
+				if (buf) {
+					buf += size;
+				}
+				r_len += size;
+			}
+		} break;
+
+		// Packed arrays.
+		case Variant::PACKED_BYTE_ARRAY: {
+			_compact_put_packed(p_variant.operator PackedByteArray(), buf, r_len);
+		} break;
+		case Variant::PACKED_INT32_ARRAY: {
+			_compact_put_packed(p_variant.operator PackedInt32Array(), buf, r_len);
+		} break;
+		case Variant::PACKED_INT64_ARRAY: {
+			_compact_put_packed(p_variant.operator PackedInt64Array(), buf, r_len);
+		} break;
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			_compact_put_packed(p_variant.operator PackedFloat32Array(), buf, r_len);
+		} break;
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			_compact_put_packed(p_variant.operator PackedFloat64Array(), buf, r_len);
+		} break;
+		case Variant::PACKED_STRING_ARRAY: {
+			const PackedStringArray array = p_variant;
+			_compact_put_varint(array.size(), buf, r_len);
+			for (const String &str : array) {
+				_compact_put_string(str, buf, r_len);
+			}
+		} break;
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			_compact_put_packed(p_variant.operator PackedVector2Array(), buf, r_len);
+		} break;
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			_compact_put_packed(p_variant.operator PackedVector3Array(), buf, r_len);
+		} break;
+		case Variant::PACKED_COLOR_ARRAY: {
+			_compact_put_packed(p_variant.operator PackedColorArray(), buf, r_len);
+		} break;
+		case Variant::PACKED_VECTOR4_ARRAY: {
+			_compact_put_packed(p_variant.operator PackedVector4Array(), buf, r_len);
+		} break;
+
+		default: {
+			// Objects, node paths, RIDs, callables and signals have no compact form.
+			int size = 0;
+			Error err = encode_variant(p_variant, buf, size, p_full_objects, p_depth + 1);
+			ERR_FAIL_COND_V(err != OK, err);
+			r_len += size;
+		} break;
+	}
+
+	if (sizeof(real_t) == 8) {
+		switch (type) {
+			case Variant::VECTOR2:
+			case Variant::RECT2:
+			case Variant::VECTOR3:
+			case Variant::TRANSFORM2D:
+			case Variant::VECTOR4:
+			case Variant::PLANE:
+			case Variant::QUATERNION:
+			case Variant::AABB:
+			case Variant::BASIS:
+			case Variant::TRANSFORM3D:
+			case Variant::PROJECTION:
+			case Variant::PACKED_VECTOR2_ARRAY:
+			case Variant::PACKED_VECTOR3_ARRAY:
+			case Variant::PACKED_VECTOR4_ARRAY:
+				tag |= COMPACT_FLAG_64;
+				break;
+			default:
+				break;
+		}
+	}
+
+	if (tag_ptr) {
+		*tag_ptr = tag;
+	}
+
+	return OK;
+}
+
+Error decode_variant_compact(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects, Variant::Type p_schema, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Variant is too deep. Bailing.");
+	const uint8_t *buf = p_buffer;
+	int len = p_len;
+
+	Variant::Type type = Variant::NIL;
+	uint8_t flags = 0;
+	Error err = _compact_get_tag(buf, len, p_schema, type, flags);
+	ERR_FAIL_COND_V(err != OK, err);
+	const bool is_64 = flags & COMPACT_FLAG_64;
+
+	switch (type) {
+		case Variant::NIL: {
+			r_variant = Variant();
+		} break;
+		case Variant::BOOL: {
+			r_variant = bool(flags & COMPACT_FLAG_TRUE);
+		} break;
+		case Variant::INT: {
+			uint64_t value = 0;
+			err = _compact_get_varint(buf, len, value);
+			r_variant = _zigzag_decode(value);
+		} break;
+		case Variant::FLOAT: {
+			if (flags & COMPACT_FLAG_FLOAT32) {
+				ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
+				r_variant = decode_float(buf);
+				buf += 4;
+				len -= 4;
+			} else {
+				ERR_FAIL_COND_V(len < 8, ERR_INVALID_DATA);
+				r_variant = decode_double(buf);
+				buf += 8;
+				len -= 8;
+			}
+		} break;
+		case Variant::STRING: {
+			String str;
+			err = _compact_get_string(buf, len, str);
+			r_variant = str;
+		} break;
+		case Variant::STRING_NAME: {
+			String str;
+			err = _compact_get_string(buf, len, str);
+			r_variant = StringName(str);
+		} break;
+
+		// Math types.
+		case Variant::VECTOR2: {
+			Vector2 value;
+			err = _compact_get_reals(value, is_64, buf, len);
+			r_variant = value;
+		} break;
+		case Variant::RECT2: {
+			Rect2 value;
+			err = _compact_get_reals(value, is_64, buf, len);
+			r_variant = value;
+		} break;
+		case Variant::VECTOR3: {
+			Vector3 value;
+			err = _compact_get_reals(value, is_64, buf, len);
+			r_variant = value;
+		} break;
+		case Variant::TRANSFORM2D: {
+			Transform2D value;
+			err = _compact_get_reals(value, is_64, buf, len);
+			r_variant = value;
+		} break;
+		case Variant::VECTOR4: {
+			Vector4 value;
+			err = _compact_get_reals(value, is_64, buf, len);
+			r_variant = value;
+		} break;
+		case Variant::PLANE: {
+			Plane value;
+			err = _compact_get_reals(value, is_64, buf, len);
+			r_variant = value;
+		} break;
+		case Variant::QUATERNION: {
+			Quaternion value;
+			err = _compact_get_reals(value, is_64, buf, len);
+			r_variant = value;
+		} break;
+		case Variant::AABB: {
+			::AABB value;
+			err = _compact_get_reals(value, is_64, buf, len);
+			r_variant = value;
+		} break;
+		case Variant::BASIS: {
+			Basis value;
+			err = _compact_get_reals(value, is_64, buf, len);
+			r_variant = value;
+		} break;
+		case Variant::TRANSFORM3D: {
+			Transform3D value;
+			err = _compact_get_reals(value, is_64, buf, len);
+			r_variant = value;
+		} break;
+		case Variant::PROJECTION: {
+			Projection value;
+			err = _compact_get_reals(value, is_64, buf, len);
+			r_variant = value;
+		} break;
+		case Variant::VECTOR2I: {
+			Vector2i value;
+			err = _compact_get_ints(value, buf, len);
+			r_variant = value;
+		} break;
+		case Variant::RECT2I: {
+			Rect2i value;
+			err = _compact_get_ints(value, buf, len);
+			r_variant = value;
+		} break;
+		case Variant::VECTOR3I: {
+			Vector3i value;
+			err = _compact_get_ints(value, buf, len);
+			r_variant = value;
+		} break;
+		case Variant::VECTOR4I: {
+			Vector4i value;
+			err = _compact_get_ints(value, buf, len);
+			r_variant = value;
+		} break;
+		case Variant::COLOR: {
+			ERR_FAIL_COND_V(len < (int)sizeof(Color), ERR_INVALID_DATA);
+			Color color;
+			memcpy(&color, buf, sizeof(Color));
+			buf += sizeof(Color);
+			len -= sizeof(Color);
+			r_variant = color;
+		} break;
+
+		// Containers.
+		case Variant::ARRAY: {
+			if (flags & COMPACT_FLAG_REGULAR) {
+				int size = 0;
+				err = decode_variant(r_variant, buf, len, &size, p_allow_objects, p_depth + 1);
+				buf += size;
+				len -= size;
+				break;
+			}
+
+			Array array;
+			Variant::Type element_schema = Variant::VARIANT_MAX;
+			if (flags & COMPACT_FLAG_TYPED) {
+				ERR_FAIL_COND_V(len < 1, ERR_INVALID_DATA);
+				ERR_FAIL_COND_V(*buf == Variant::NIL || *buf == Variant::OBJECT || *buf >= Variant::VARIANT_MAX, ERR_INVALID_DATA);
+				element_schema = Variant::Type(*buf);
+				buf++;
+				len--;
+				array.set_typed(element_schema, StringName(), Variant());
+			}
+
+			int count = 0;
+			err = _compact_get_count(buf, len, 1, count);
+			ERR_FAIL_COND_V(err != OK, err);
+			array.resize(count);
+			for (int i = 0; i < count; i++) {
+				int size = 0;
+				Variant element;
+				err = decode_variant_compact(element, buf, len, &size, p_allow_objects, element_schema, p_depth + 1);
+				ERR_FAIL_COND_V(err != OK, err);
+				array[i] = element;
+				buf += size;
+				len -= size;
+			}
+			r_variant = array;
+		} break;
+		case Variant::DICTIONARY: {
+			if (flags & COMPACT_FLAG_REGULAR) {
+				int size = 0;
+				err = decode_variant(r_variant, buf, len, &size, p_allow_objects, p_depth + 1);
+				buf += size;
+				len -= size;
+				break;
+			}
+
+			int count = 0;
+			err = _compact_get_count(buf, len, 2, count);
+			ERR_FAIL_COND_V(err != OK, err);
+			Dictionary dict;
+			for (int i = 0; i < count; i++) {
+				int size = 0;
+				Variant key;
+				err = decode_variant_compact(key, buf, len, &size, p_allow_objects, Variant::VARIANT_MAX, p_depth + 1);
+				ERR_FAIL_COND_V(err != OK, err);
+				buf += size;
+				len -= size;
+
+				Variant value;
+				err = decode_variant_compact(value, buf, len, &size, p_allow_objects, Variant::VARIANT_MAX, p_depth + 1);
+				ERR_FAIL_COND_V(err != OK, err);
+				buf += size;
+				len -= size;
+
+				dict[key] = value;
+			}
+			r_variant = dict;
+		} break;
+
+		// Packed arrays.
+		case Variant::PACKED_BYTE_ARRAY: {
+			err = _compact_get_packed<uint8_t>(r_variant, buf, len);
+		} break;
+		case Variant::PACKED_INT32_ARRAY: {
+			err = _compact_get_packed<int32_t>(r_variant, buf, len);
+		} break;
+		case Variant::PACKED_INT64_ARRAY: {
+			err = _compact_get_packed<int64_t>(r_variant, buf, len);
+		} break;
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			err = _compact_get_packed<float>(r_variant, buf, len);
+		} break;
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			err = _compact_get_packed<double>(r_variant, buf, len);
+		} break;
+		case Variant::PACKED_STRING_ARRAY: {
+			int count = 0;
+			err = _compact_get_count(buf, len, 1, count);
+			ERR_FAIL_COND_V(err != OK, err);
+			PackedStringArray array;
+			ERR_FAIL_COND_V(array.resize(count) != OK, ERR_OUT_OF_MEMORY);
+			String *w = array.ptrw();
+			for (int i = 0; i < count; i++) {
+				err = _compact_get_string(buf, len, w[i]);
+				ERR_FAIL_COND_V(err != OK, err);
+			}
+			r_variant = array;
+		} break;
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			err = _compact_get_packed_reals<Vector2>(r_variant, is_64, buf, len);
+		} break;
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			err = _compact_get_packed_reals<Vector3>(r_variant, is_64, buf, len);
+		} break;
+		case Variant::PACKED_COLOR_ARRAY: {
+			err = _compact_get_packed<Color>(r_variant, buf, len);
+		} break;
+		case Variant::PACKED_VECTOR4_ARRAY: {
+			err = _compact_get_packed_reals<Vector4>(r_variant, is_64, buf, len);
+		} break;
+
+		default: {
+			int size = 0;
+			err = decode_variant(r_variant, buf, len, &size, p_allow_objects, p_depth + 1);
+			ERR_FAIL_COND_V(err == OK && Variant::Type(decode_uint32(buf) & HEADER_TYPE_MASK) != type, ERR_INVALID_DATA);
+			buf += size;
+			len -= size;
+		} break;
+	}
+
+	ERR_FAIL_COND_V(err != OK, err);
+	if (r_len) {
+		*r_len = buf - p_buffer;
+	}
+	return OK;
+}
+
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count) {
 	// We always allocate a new array, and we don't `memcpy()`.
 	// We also don't consider returning a pointer to the passed vectors when `sizeof(real_t) == 4`.
@@ -224,4 +224,9 @@ public:
 Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false, int p_depth = 0);
 Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false, int p_depth = 0);
 
+// Compact encoding with varint integers and no padding. When `p_schema` is a type known to both
+// ends, the value must be of that type and its type tag is omitted where possible.
+Error encode_variant_compact(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false, Variant::Type p_schema = Variant::VARIANT_MAX, int p_depth = 0);
+Error decode_variant_compact(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false, Variant::Type p_schema = Variant::VARIANT_MAX, int p_depth = 0);
+
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count);
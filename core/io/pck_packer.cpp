@@ -29,9 +29,11 @@
 /**************************************************************************/
 
 #include "pck_packer.h"
+#include "pck_packer.compat.inc"
 
 #include "core/crypto/crypto_core.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/version.h"
@@ -46,9 +48,12 @@ static int _get_pad(int p_alignment, int p_n) {
 	return pad;
 }
 
+// Large enough for zstd to find redundancy, small enough to keep seeking cheap.
+static const uint32_t COMPRESSED_FILE_BLOCK_SIZE = 65536;
+
 void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_path", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(32), DEFVAL("0000000000000000000000000000000000000000000000000000000000000000"), DEFVAL(false));
-	ClassDB::bind_method(D_METHOD("add_file", "target_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("add_file", "target_path", "source_path", "encrypt", "compress"), &PCKPacker::add_file, DEFVAL(false), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file_removal", "target_path"), &PCKPacker::add_file_removal);
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
 }
@@ -125,7 +130,7 @@ Error PCKPacker::add_file_removal(const String &p_target_path) {
 	return OK;
 }
 
-Error PCKPacker::add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt) {
+Error PCKPacker::add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt, bool p_compress) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
 	Ref<FileAccess> f = FileAccess::open(p_source_path, FileAccess::READ);
@@ -153,6 +158,13 @@ Error PCKPacker::add_file(const String &p_target_path, const String &p_source_pa
 	pf.encrypted = p_encrypt;
 
 	uint64_t _size = pf.size;
+	if (p_compress) {
+		// Compressed now, the offsets of the following files depend on the compressed size.
+		pf.compressed_data = FileAccessCompressed::compress_buffer(data.ptr(), data.size(), PACK_FILE_COMPRESSED_MAGIC, Compression::MODE_ZSTD, COMPRESSED_FILE_BLOCK_SIZE);
+		ERR_FAIL_COND_V_MSG(pf.compressed_data.is_empty(), ERR_CANT_CREATE, vformat("Can't compress file '%s'.", p_source_path));
+		pf.compressed = true;
+		_size = pf.compressed_data.size();
+	}
 	if (p_encrypt) { // Add encryption overhead.
 		if (_size % 16) { // Pad to encryption block size.
 			_size += 16 - (_size % 16);
@@ -218,6 +230,9 @@ Error PCKPacker::flush(bool p_verbose) {
 		if (files[i].removal) {
 			flags |= PACK_FILE_REMOVAL;
 		}
+		if (files[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 	}
 
@@ -245,9 +260,6 @@ Error PCKPacker::flush(bool p_verbose) {
 			continue;
 		}
 
-		Ref<FileAccess> src = FileAccess::open(files[i].src_path, FileAccess::READ);
-		uint64_t to_write = files[i].size;
-
 		Ref<FileAccess> ftmp = file;
 		if (files[i].encrypted) {
 			fae.instantiate();
@@ -258,10 +270,16 @@ Error PCKPacker::flush(bool p_verbose) {
 			ftmp = fae;
 		}
 
-		while (to_write > 0) {
-			uint64_t read = src->get_buffer(buf, MIN(to_write, buf_max));
-			ftmp->store_buffer(buf, read);
-			to_write -= read;
+		if (files[i].compressed) {
+			ftmp->store_buffer(files[i].compressed_data);
+		} else {
+			Ref<FileAccess> src = FileAccess::open(files[i].src_path, FileAccess::READ);
+			uint64_t to_write = files[i].size;
+			while (to_write > 0) {
+				uint64_t read = src->get_buffer(buf, MIN(to_write, buf_max));
+				ftmp->store_buffer(buf, read);
+				to_write -= read;
+			}
 		}
 
 		if (fae.is_valid()) {
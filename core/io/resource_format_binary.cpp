@@ -694,17 +694,34 @@ Error ResourceLoaderBinary::load() {
 		}
 
 		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
+	}
+
+	FileAccessAsync::Batch *prefetched = nullptr;
+	if (!use_sub_threads && external_resources.size() > 1) {
+		// Dependencies are loaded one after another on this thread, so read their files ahead of time.
+		Vector<String> paths;
+		for (const ExtResource &er : external_resources) {
+			paths.push_back(er.path);
+		}
+		prefetched = ResourceLoader::prefetch_files(paths);
+	}
+
+	for (int i = 0; i < external_resources.size(); i++) {
+		const String path = external_resources[i].path;
 		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
 		if (external_resources[i].load_token.is_null()) {
 			if (!ResourceLoader::get_abort_on_missing_resources()) {
 				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
 			} else {
+				ResourceLoader::release_prefetched_files(prefetched);
 				error = ERR_FILE_MISSING_DEPENDENCIES;
 				ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
 			}
 		}
 	}
 
+	ResourceLoader::release_prefetched_files(prefetched);
+
 	for (int i = 0; i < internal_resources.size(); i++) {
 		bool main = i == (internal_resources.size() - 1);
 
@@ -1214,7 +1231,7 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 	}
 
 	Error err;
-	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	Ref<FileAccess> f = ResourceLoader::open_prefetched(p_path, &err);
 
 	ERR_FAIL_COND_V_MSG(err != OK, Ref<Resource>(), vformat("Cannot open file '%s'.", p_path));
 
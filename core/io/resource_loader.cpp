@@ -34,6 +34,7 @@
 #include "core/core_bind.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_async.h"
 #include "core/io/resource_importer.h"
 #include "core/object/script_language.h"
 #include "core/os/condition_variable.h"
@@ -513,6 +514,90 @@ String ResourceLoader::_validate_local_path(const String &p_path) {
 	}
 }
 
+FileAccessAsync::Batch *ResourceLoader::prefetch_files(const Vector<String> &p_paths) {
+#ifdef THREADS_ENABLED
+	Vector<String> remapped_paths;
+	for (const String &path : p_paths) {
+		const String local_path = _validate_local_path(path);
+		if (ResourceCache::has(local_path)) {
+			continue;
+		}
+
+		// Only the resource formats reading their own file consume prefetched files,
+		// for imported resources this would read the source asset for nothing.
+		const String remapped_path = _path_remap(local_path);
+		const String extension = remapped_path.get_extension().to_lower();
+		if (extension != "res" && extension != "scn" && extension != "tres" && extension != "tscn") {
+			continue;
+		}
+		remapped_paths.push_back(remapped_path);
+	}
+
+	MutexLock lock(prefetch_mutex);
+	Vector<String> paths;
+	for (const String &path : remapped_paths) {
+		if (prefetched_files.size() + paths.size() >= MAX_PREFETCHED_FILES) {
+			break;
+		}
+		if (!prefetched_files.has(path) && !paths.has(path)) {
+			paths.push_back(path);
+		}
+	}
+	if (paths.is_empty()) {
+		return nullptr;
+	}
+
+	FileAccessAsync::Batch *batch = FileAccessAsync::open_async_batch(paths, MAX_PREFETCHED_FILE_SIZE);
+	for (const Ref<FileAccessAsync> &f : batch->files) {
+		prefetched_files.insert(f->get_path(), f);
+	}
+	return batch;
+#else
+	return nullptr;
+#endif
+}
+
+void ResourceLoader::release_prefetched_files(FileAccessAsync::Batch *p_prefetched) {
+	if (!p_prefetched) {
+		return;
+	}
+
+	{
+		MutexLock lock(prefetch_mutex);
+		for (const Ref<FileAccessAsync> &f : p_prefetched->files) {
+			HashMap<String, Ref<FileAccessAsync>>::Iterator E = prefetched_files.find(f->get_path());
+			if (E && E->value == f) {
+				prefetched_files.remove(E);
+			}
+		}
+	}
+
+	// Outside of the lock, since this waits for the reads in progress.
+	FileAccessAsync::finish_batch(p_prefetched);
+}
+
+Ref<FileAccess> ResourceLoader::open_prefetched(const String &p_path, Error *r_error) {
+	Ref<FileAccessAsync> prefetched;
+	{
+		MutexLock lock(prefetch_mutex);
+		HashMap<String, Ref<FileAccessAsync>>::Iterator E = prefetched_files.find(p_path);
+		if (E) {
+			prefetched = E->value;
+			prefetched_files.remove(E);
+		}
+	}
+
+	if (prefetched.is_valid() && prefetched->wait() == OK) {
+		if (r_error) {
+			*r_error = OK;
+		}
+		return prefetched;
+	}
+
+	// Opening it again also reports the actual error if the background read failed.
+	return FileAccess::open(p_path, FileAccess::READ, r_error);
+}
+
 Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, ResourceFormatLoader::CacheMode p_cache_mode) {
 	Ref<ResourceLoader::LoadToken> token = _load_start(p_path, p_type_hint, p_use_sub_threads ? LOAD_THREAD_DISTRIBUTE : LOAD_THREAD_SPAWN_SINGLE, p_cache_mode, true);
 	return token.is_valid() ? OK : FAILED;
@@ -1549,7 +1634,10 @@ Vector<String> ResourceLoader::list_directory(const String &p_directory) {
 
 void ResourceLoader::initialize() {}
 
-void ResourceLoader::finalize() {}
+void ResourceLoader::finalize() {
+	MutexLock lock(prefetch_mutex);
+	prefetched_files.clear();
+}
 
 ResourceLoadErrorNotify ResourceLoader::err_notify = nullptr;
 DependencyErrorNotify ResourceLoader::dep_err_notify = nullptr;
@@ -1576,6 +1664,9 @@ bool ResourceLoader::cleaning_tasks = false;
 
 HashMap<String, ResourceLoader::LoadToken *> ResourceLoader::user_load_tokens;
 
+BinaryMutex ResourceLoader::prefetch_mutex;
+HashMap<String, Ref<FileAccessAsync>> ResourceLoader::prefetched_files;
+
 SelfList<Resource>::List ResourceLoader::remapped_list;
 HashMap<String, Vector<String>> ResourceLoader::translation_remaps;
 
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/io/file_access_async.h"
 #include "core/io/resource.h"
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/worker_thread_pool.h"
@@ -102,6 +103,7 @@ typedef void (*DependencyErrorNotify)(const String &p_loading, const String &p_w
 typedef Error (*ResourceLoaderImport)(const String &p_path);
 typedef void (*ResourceLoadedCallback)(Ref<Resource> p_resource, const String &p_path);
 
+
 class ResourceLoader {
 	friend class LoadToken;
 	friend class CoreBind::ResourceLoader;
@@ -223,6 +225,13 @@ private:
 
 	static String _validate_local_path(const String &p_path);
 
+	// Files of upcoming loads being read in the background, keyed by remapped path.
+	static constexpr int MAX_PREFETCHED_FILES = 16;
+	static constexpr uint64_t MAX_PREFETCHED_FILE_SIZE = 4 * 1024 * 1024;
+
+	static BinaryMutex prefetch_mutex;
+	static HashMap<String, Ref<FileAccessAsync>> prefetched_files;
+
 public:
 	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
 	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr);
@@ -230,6 +239,13 @@ public:
 
 	static bool is_within_load() { return load_nesting > 0; }
 
+	// Loaders that are about to load several dependencies in a row can have their files read in the background,
+	// so the I/O for the next ones overlaps with decoding the current one. Loaders consume them with open_prefetched().
+	// Returns null if there is nothing to read, otherwise it must be passed to release_prefetched_files() once the dependencies are loaded.
+	static FileAccessAsync::Batch *prefetch_files(const Vector<String> &p_paths);
+	static void release_prefetched_files(FileAccessAsync::Batch *p_prefetched);
+	static Ref<FileAccess> open_prefetched(const String &p_path, Error *r_error = nullptr);
+
 	static void resource_changed_connect(Resource *p_source, const Callable &p_callable, uint32_t p_flags);
 	static void resource_changed_disconnect(Resource *p_source, const Callable &p_callable);
 	static void resource_changed_emit(Resource *p_source);
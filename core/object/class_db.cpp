@@ -1784,6 +1784,32 @@ StringName ClassDB::get_property_getter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+// Returns the MethodBind that `set_property()` or `get_property()` would call directly, if any.
+MethodBind *ClassDB::get_property_accessor_bind(const StringName &p_class, const StringName &p_property, bool p_setter) {
+	Locker::Lock lock(Locker::STATE_READ);
+
+	ClassInfo *check = classes.getptr(p_class);
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			// Indexed properties pass the index as argument.
+			if (psg->index >= 0) {
+				return nullptr;
+			}
+			return p_setter ? psg->_setptr : psg->_getptr;
+		}
+
+		// Constants, methods and signals are gettable too and shadow properties of parent classes.
+		if (!p_setter && (check->constant_map.has(p_property) || check->method_map.has(p_property) || check->signal_map.has(p_property))) {
+			return nullptr;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
 bool ClassDB::has_property(const StringName &p_class, const StringName &p_property, bool p_no_inheritance) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
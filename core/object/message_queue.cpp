@@ -67,6 +67,99 @@ void CallQueue::_add_page() {
 	pages_used++;
 }
 
+static SafeNumeric<uint64_t> last_queue_id;
+
+// Producer buffer last used by this thread, for the queue with this ID.
+static thread_local uint64_t producer_hint_queue_id = 0;
+static thread_local void *producer_hint = nullptr;
+
+CallQueue::ProducerBuffer *CallQueue::_acquire_producer_buffer() {
+	if (producer_hint_queue_id == queue_id) {
+		ProducerBuffer *producer = (ProducerBuffer *)producer_hint;
+		if (likely(producer->try_acquire())) {
+			return producer;
+		}
+	}
+
+	// Any free buffer will do, the sequence numbers keep the push order.
+	for (ProducerBuffer *producer = producers.load(std::memory_order_acquire); producer; producer = producer->next) {
+		if (producer->try_acquire()) {
+			producer_hint_queue_id = queue_id;
+			producer_hint = producer;
+			return producer;
+		}
+	}
+
+	ProducerBuffer *producer = memnew(ProducerBuffer);
+	producer->busy.store(true, std::memory_order_relaxed);
+	producer->next = producers.load(std::memory_order_relaxed);
+	while (!producers.compare_exchange_weak(producer->next, producer, std::memory_order_release, std::memory_order_relaxed)) {
+	}
+
+	producer_hint_queue_id = queue_id;
+	producer_hint = producer;
+	return producer;
+}
+
+uint8_t *CallQueue::_producer_reserve(ProducerBuffer *p_producer, uint32_t p_room_needed) {
+	if (p_producer->pages.is_empty() || (p_producer->page_bytes[p_producer->pages.size() - 1] + p_room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
+		Page *page = nullptr;
+		if (!p_producer->free_pages.is_empty()) {
+			page = p_producer->free_pages[p_producer->free_pages.size() - 1];
+			p_producer->free_pages.resize(p_producer->free_pages.size() - 1);
+		} else {
+			if (producer_pages.postincrement() >= max_pages) {
+				producer_pages.decrement();
+				return nullptr;
+			}
+			page = allocator->alloc();
+		}
+		p_producer->pages.push_back(page);
+		p_producer->page_bytes.push_back(0);
+	}
+
+	uint32_t last = p_producer->pages.size() - 1;
+	return &p_producer->pages[last]->data[p_producer->page_bytes[last]];
+}
+
+uint8_t *CallQueue::_reserve(uint32_t p_room_needed, ProducerBuffer *&r_producer) {
+	if (multi_producer) {
+		r_producer = _acquire_producer_buffer();
+		uint8_t *buffer_end = _producer_reserve(r_producer, SEQUENCE_BYTES + p_room_needed);
+		if (unlikely(!buffer_end)) {
+			r_producer->release();
+			return nullptr;
+		}
+		return buffer_end + SEQUENCE_BYTES;
+	}
+
+	LOCK_MUTEX;
+
+	_ensure_first_page();
+
+	if ((page_bytes[pages_used - 1] + p_room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
+		if (pages_used == max_pages) {
+			UNLOCK_MUTEX;
+			return nullptr;
+		}
+		_add_page();
+	}
+
+	return &pages[pages_used - 1]->data[page_bytes[pages_used - 1]];
+}
+
+void CallQueue::_commit(uint32_t p_room_needed, ProducerBuffer *p_producer, Message *p_message) {
+	if (p_producer) {
+		*(uint64_t *)((uint8_t *)p_message - SEQUENCE_BYTES) = next_sequence.postincrement();
+		p_producer->page_bytes[p_producer->pages.size() - 1] += SEQUENCE_BYTES + p_room_needed;
+		p_producer->release();
+		return;
+	}
+
+	page_bytes[pages_used - 1] += p_room_needed;
+	UNLOCK_MUTEX;
+}
+
 Error CallQueue::push_callp(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
 	return push_callablep(Callable(p_id, p_method), p_args, p_argcount, p_show_error);
 }
@@ -88,24 +181,14 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 
 	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
 
-	LOCK_MUTEX;
-
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
-		}
-		_add_page();
+	ProducerBuffer *producer = nullptr;
+	uint8_t *buffer_end = _reserve(room_needed, producer);
+	if (unlikely(!buffer_end)) {
+		fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 	msg->args = p_argcount;
 	msg->callable = p_callable;
@@ -126,37 +209,26 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 		*v = *p_args[i];
 	}
 
-	page_bytes[pages_used - 1] += room_needed;
-
-	UNLOCK_MUTEX;
+	_commit(room_needed, producer, msg);
 
 	return OK;
 }
 
 Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
-	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant);
 
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			String type;
-			if (ObjectDB::get_instance(p_id)) {
-				type = ObjectDB::get_instance(p_id)->get_class();
-			}
-			fprintf(stderr, "Failed set: %s: %s target ID: %s. Message queue out of memory. %s\n", type.utf8().get_data(), String(p_prop).utf8().get_data(), itos(p_id).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
+	ProducerBuffer *producer = nullptr;
+	uint8_t *buffer_end = _reserve(room_needed, producer);
+	if (unlikely(!buffer_end)) {
+		String type;
+		if (ObjectDB::get_instance(p_id)) {
+			type = ObjectDB::get_instance(p_id)->get_class();
 		}
-		_add_page();
+		fprintf(stderr, "Failed set: %s: %s target ID: %s. Message queue out of memory. %s\n", type.utf8().get_data(), String(p_prop).utf8().get_data(), itos(p_id).utf8().get_data(), error_text.utf8().get_data());
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 	msg->args = 1;
 	msg->callable = Callable(p_id, p_prop);
@@ -167,32 +239,23 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 	Variant *v = memnew_placement(buffer_end, Variant);
 	*v = p_value;
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	_commit(room_needed, producer, msg);
 
 	return OK;
 }
 
 Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
-	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message);
 
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			fprintf(stderr, "Failed notification: %d target ID: %s. Message queue out of memory. %s\n", p_notification, itos(p_id).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
-		}
-		_add_page();
+	ProducerBuffer *producer = nullptr;
+	uint8_t *buffer_end = _reserve(room_needed, producer);
+	if (unlikely(!buffer_end)) {
+		fprintf(stderr, "Failed notification: %d target ID: %s. Message queue out of memory. %s\n", p_notification, itos(p_id).utf8().get_data(), error_text.utf8().get_data());
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 
 	msg->type = TYPE_NOTIFICATION;
@@ -200,8 +263,7 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	//msg->target;
 	msg->notification = p_notification;
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	_commit(room_needed, producer, msg);
 
 	return OK;
 }
@@ -223,7 +285,151 @@ void CallQueue::_call_function(const Callable &p_callable, const Variant *p_args
 	}
 }
 
+uint32_t CallQueue::_get_message_size(const Message *p_message) {
+	uint32_t size = sizeof(Message);
+	if ((p_message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+		size += sizeof(Variant) * p_message->args;
+	}
+	return size;
+}
+
+void CallQueue::_destroy_message(Message *p_message) {
+	if ((p_message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+		Variant *args = (Variant *)(p_message + 1);
+		for (int k = 0; k < p_message->args; k++) {
+			args[k].~Variant();
+		}
+	}
+
+	p_message->~Message();
+}
+
+void CallQueue::_execute_message(Message *p_message) {
+	Object *target = p_message->callable.get_object();
+
+	switch (p_message->type & FLAG_MASK) {
+		case TYPE_CALL: {
+			if (target || (p_message->type & FLAG_NULL_IS_OK)) {
+				Variant *args = (Variant *)(p_message + 1);
+				_call_function(p_message->callable, args, p_message->args, p_message->type & FLAG_SHOW_ERROR);
+			}
+		} break;
+		case TYPE_NOTIFICATION: {
+			if (target) {
+				target->notification(p_message->notification);
+			}
+		} break;
+		case TYPE_SET: {
+			if (target) {
+				Variant *arg = (Variant *)(p_message + 1);
+				target->set(p_message->callable.get_method(), *arg);
+			}
+		} break;
+	}
+
+	_destroy_message(p_message);
+}
+
+Error CallQueue::_flush_producers() {
+	if (!has_messages()) {
+		return OK;
+	}
+
+	mutex.lock();
+	if (flushing) {
+		mutex.unlock();
+		return ERR_BUSY;
+	}
+	flushing = true;
+	mutex.unlock();
+
+	struct Batch {
+		ProducerBuffer *producer = nullptr;
+		LocalVector<Page *> pages;
+		LocalVector<uint32_t> page_bytes;
+		uint32_t page = 0;
+		uint32_t offset = 0;
+	};
+
+	LocalVector<Batch> batches;
+
+	while (consumed_sequence.get() != next_sequence.get()) {
+		// Every message numbered below the cutoff was committed before any
+		// message pushed after it started, so running only those in sequence
+		// order can never overtake a message that was pushed earlier.
+		uint64_t cutoff = next_sequence.get();
+
+		for (ProducerBuffer *producer = producers.load(std::memory_order_acquire); producer; producer = producer->next) {
+			producer->acquire();
+			if (!producer->pages.is_empty()) {
+				batches.push_back(Batch());
+				Batch &batch = batches[batches.size() - 1];
+				batch.producer = producer;
+				batch.pages = std::move(producer->pages);
+				batch.page_bytes = std::move(producer->page_bytes);
+			}
+			producer->release();
+		}
+
+		while (true) {
+			Batch *next = nullptr;
+			Message *message = nullptr;
+			uint64_t sequence = 0;
+			for (Batch &batch : batches) {
+				if (batch.page == batch.pages.size()) {
+					continue;
+				}
+				const uint8_t *head = &batch.pages[batch.page]->data[batch.offset];
+				const uint64_t head_sequence = *(const uint64_t *)head;
+				if (head_sequence < cutoff && (!message || head_sequence < sequence)) {
+					next = &batch;
+					message = (Message *)(head + SEQUENCE_BYTES);
+					sequence = head_sequence;
+				}
+			}
+
+			if (!message) {
+				break;
+			}
+
+			// Pre-advance, calls may push new messages while running.
+			next->offset += SEQUENCE_BYTES + _get_message_size(message);
+			if (next->offset == next->page_bytes[next->page]) {
+				next->page++;
+				next->offset = 0;
+			}
+
+			_execute_message(message);
+			consumed_sequence.increment();
+		}
+
+		// Give the pages of finished batches back to their producers.
+		for (uint32_t i = 0; i < batches.size();) {
+			Batch &batch = batches[i];
+			if (batch.page < batch.pages.size()) {
+				i++;
+				continue;
+			}
+			batch.producer->acquire();
+			for (Page *page : batch.pages) {
+				batch.producer->free_pages.push_back(page);
+			}
+			batch.producer->release();
+			batches.remove_at_unordered(i);
+		}
+	}
+
+	mutex.lock();
+	flushing = false;
+	mutex.unlock();
+	return OK;
+}
+
 Error CallQueue::flush() {
+	if (multi_producer) {
+		return _flush_producers();
+	}
+
 	LOCK_MUTEX;
 
 	if (pages.is_empty()) {
@@ -249,46 +455,12 @@ Error CallQueue::flush() {
 
 		Message *message = (Message *)&page->data[offset];
 
-		uint32_t advance = sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			advance += sizeof(Variant) * message->args;
-		}
-
 		//pre-advance so this function is reentrant
-		offset += advance;
-
-		Object *target = message->callable.get_object();
+		offset += _get_message_size(message);
 
 		UNLOCK_MUTEX;
 
-		switch (message->type & FLAG_MASK) {
-			case TYPE_CALL: {
-				if (target || (message->type & FLAG_NULL_IS_OK)) {
-					Variant *args = (Variant *)(message + 1);
-					_call_function(message->callable, args, message->args, message->type & FLAG_SHOW_ERROR);
-				}
-			} break;
-			case TYPE_NOTIFICATION: {
-				if (target) {
-					target->notification(message->notification);
-				}
-			} break;
-			case TYPE_SET: {
-				if (target) {
-					Variant *arg = (Variant *)(message + 1);
-					target->set(message->callable.get_method(), *arg);
-				}
-			} break;
-		}
-
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			Variant *args = (Variant *)(message + 1);
-			for (int k = 0; k < message->args; k++) {
-				args[k].~Variant();
-			}
-		}
-
-		message->~Message();
+		_execute_message(message);
 
 		LOCK_MUTEX;
 		if (offset == page_bytes[i]) {
@@ -305,7 +477,31 @@ Error CallQueue::flush() {
 	return OK;
 }
 
+void CallQueue::_clear_producers() {
+	for (ProducerBuffer *producer = producers.load(std::memory_order_acquire); producer; producer = producer->next) {
+		producer->acquire();
+		for (uint32_t i = 0; i < producer->pages.size(); i++) {
+			uint32_t offset = 0;
+			while (offset < producer->page_bytes[i]) {
+				Message *message = (Message *)&producer->pages[i]->data[offset + SEQUENCE_BYTES];
+				offset += SEQUENCE_BYTES + _get_message_size(message);
+				_destroy_message(message);
+				consumed_sequence.increment();
+			}
+			producer->free_pages.push_back(producer->pages[i]);
+		}
+		producer->pages.clear();
+		producer->page_bytes.clear();
+		producer->release();
+	}
+}
+
 void CallQueue::clear() {
+	if (multi_producer) {
+		_clear_producers();
+		return;
+	}
+
 	LOCK_MUTEX;
 
 	if (pages.is_empty()) {
@@ -318,25 +514,11 @@ void CallQueue::clear() {
 		while (offset < page_bytes[i]) {
 			Page *page = pages[i];
 
-			//lock on each iteration, so a call can re-add itself to the message queue
-
 			Message *message = (Message *)&page->data[offset];
 
-			uint32_t advance = sizeof(Message);
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				advance += sizeof(Variant) * message->args;
-			}
-
-			offset += advance;
-
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				Variant *args = (Variant *)(message + 1);
-				for (int k = 0; k < message->args; k++) {
-					args[k].~Variant();
-				}
-			}
+			offset += _get_message_size(message);
 
-			message->~Message();
+			_destroy_message(message);
 		}
 	}
 
@@ -346,99 +528,101 @@ void CallQueue::clear() {
 	UNLOCK_MUTEX;
 }
 
-void CallQueue::statistics() {
-	LOCK_MUTEX;
+struct CallQueue::Statistics {
 	HashMap<StringName, int> set_count;
 	HashMap<int, int> notify_count;
 	HashMap<Callable, int> call_count;
 	int null_count = 0;
+};
 
-	for (uint32_t i = 0; i < pages_used; i++) {
-		uint32_t offset = 0;
-		while (offset < page_bytes[i]) {
-			Page *page = pages[i];
-
-			//lock on each iteration, so a call can re-add itself to the message queue
-
-			Message *message = (Message *)&page->data[offset];
-
-			uint32_t advance = sizeof(Message);
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				advance += sizeof(Variant) * message->args;
-			}
-
-			Object *target = message->callable.get_object();
+void CallQueue::_count_page_messages(const Page *p_page, uint32_t p_bytes, uint32_t p_header_bytes, Statistics &r_statistics) {
+	uint32_t offset = 0;
+	while (offset < p_bytes) {
+		const Message *message = (const Message *)&p_page->data[offset + p_header_bytes];
 
-			bool null_target = true;
-			switch (message->type & FLAG_MASK) {
-				case TYPE_CALL: {
-					if (target || (message->type & FLAG_NULL_IS_OK)) {
-						if (!call_count.has(message->callable)) {
-							call_count[message->callable] = 0;
-						}
+		Object *target = message->callable.get_object();
 
-						call_count[message->callable]++;
-						null_target = false;
+		bool null_target = true;
+		switch (message->type & FLAG_MASK) {
+			case TYPE_CALL: {
+				if (target || (message->type & FLAG_NULL_IS_OK)) {
+					if (!r_statistics.call_count.has(message->callable)) {
+						r_statistics.call_count[message->callable] = 0;
 					}
-				} break;
-				case TYPE_NOTIFICATION: {
-					if (target) {
-						if (!notify_count.has(message->notification)) {
-							notify_count[message->notification] = 0;
-						}
-
-						notify_count[message->notification]++;
-						null_target = false;
+
+					r_statistics.call_count[message->callable]++;
+					null_target = false;
+				}
+			} break;
+			case TYPE_NOTIFICATION: {
+				if (target) {
+					if (!r_statistics.notify_count.has(message->notification)) {
+						r_statistics.notify_count[message->notification] = 0;
 					}
-				} break;
-				case TYPE_SET: {
-					if (target) {
-						StringName t = message->callable.get_method();
-						if (!set_count.has(t)) {
-							set_count[t] = 0;
-						}
-
-						set_count[t]++;
-						null_target = false;
+
+					r_statistics.notify_count[message->notification]++;
+					null_target = false;
+				}
+			} break;
+			case TYPE_SET: {
+				if (target) {
+					StringName t = message->callable.get_method();
+					if (!r_statistics.set_count.has(t)) {
+						r_statistics.set_count[t] = 0;
 					}
-				} break;
-			}
-			if (null_target) {
-				// Object was deleted.
-				fprintf(stdout, "Object was deleted while awaiting a callback.\n");
 
-				null_count++;
-			}
+					r_statistics.set_count[t]++;
+					null_target = false;
+				}
+			} break;
+		}
+		if (null_target) {
+			// Object was deleted.
+			fprintf(stdout, "Object was deleted while awaiting a callback.\n");
 
-			offset += advance;
+			r_statistics.null_count++;
+		}
 
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				Variant *args = (Variant *)(message + 1);
-				for (int k = 0; k < message->args; k++) {
-					args[k].~Variant();
-				}
-			}
+		offset += p_header_bytes + _get_message_size(message);
+	}
+}
 
-			message->~Message();
+void CallQueue::statistics() {
+	Statistics statistics;
+	uint32_t total_pages = 0;
+
+	if (multi_producer) {
+		for (ProducerBuffer *producer = producers.load(std::memory_order_acquire); producer; producer = producer->next) {
+			producer->acquire();
+			for (uint32_t i = 0; i < producer->pages.size(); i++) {
+				_count_page_messages(producer->pages[i], producer->page_bytes[i], SEQUENCE_BYTES, statistics);
+			}
+			total_pages += producer->pages.size();
+			producer->release();
+		}
+	} else {
+		LOCK_MUTEX;
+		for (uint32_t i = 0; i < pages_used; i++) {
+			_count_page_messages(pages[i], page_bytes[i], 0, statistics);
 		}
+		total_pages = pages_used;
+		UNLOCK_MUTEX;
 	}
 
-	fprintf(stdout, "TOTAL PAGES: %d (%d bytes).\n", pages_used, pages_used * PAGE_SIZE_BYTES);
-	fprintf(stdout, "NULL count: %d.\n", null_count);
+	fprintf(stdout, "TOTAL PAGES: %d (%d bytes).\n", total_pages, total_pages * PAGE_SIZE_BYTES);
+	fprintf(stdout, "NULL count: %d.\n", statistics.null_count);
 
-	for (const KeyValue<StringName, int> &E : set_count) {
+	for (const KeyValue<StringName, int> &E : statistics.set_count) {
 		fprintf(stdout, "SET %s: %d.\n", String(E.key).utf8().get_data(), E.value);
 	}
 
-	for (const KeyValue<Callable, int> &E : call_count) {
+	for (const KeyValue<Callable, int> &E : statistics.call_count) {
 		fprintf(stdout, "CALL %s: %d.\n", String(E.key).utf8().get_data(), E.value);
 	}
 
-	for (const KeyValue<int, int> &E : notify_count) {
+	for (const KeyValue<int, int> &E : statistics.notify_count) {
 		fprintf(stdout, "NOTIFY %d: %d.\n", E.key, E.value);
 	}
-
-	UNLOCK_MUTEX;
 }
 
 bool CallQueue::is_flushing() const {
@@ -446,6 +630,10 @@ bool CallQueue::is_flushing() const {
 }
 
 bool CallQueue::has_messages() const {
+	if (multi_producer) {
+		return consumed_sequence.get() != next_sequence.get();
+	}
+
 	if (pages_used == 0) {
 		return false;
 	}
@@ -457,10 +645,13 @@ bool CallQueue::has_messages() const {
 }
 
 int CallQueue::get_max_buffer_usage() const {
+	if (multi_producer) {
+		return producer_pages.get() * PAGE_SIZE_BYTES;
+	}
 	return pages.size() * PAGE_SIZE_BYTES;
 }
 
-CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const String &p_error_text) {
+CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const String &p_error_text, bool p_multi_producer) {
 	if (p_custom_allocator) {
 		allocator = p_custom_allocator;
 		allocator_is_custom = true;
@@ -470,6 +661,8 @@ CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const
 	}
 	max_pages = p_max_pages;
 	error_text = p_error_text;
+	multi_producer = p_multi_producer;
+	queue_id = last_queue_id.increment();
 }
 
 CallQueue::~CallQueue() {
@@ -478,6 +671,15 @@ CallQueue::~CallQueue() {
 	for (uint32_t i = 0; i < pages.size(); i++) {
 		allocator->free(pages[i]);
 	}
+	ProducerBuffer *producer = producers.load(std::memory_order_acquire);
+	while (producer) {
+		ProducerBuffer *next = producer->next;
+		for (Page *page : producer->free_pages) {
+			allocator->free(page);
+		}
+		memdelete(producer);
+		producer = next;
+	}
 	if (!allocator_is_custom) {
 		memdelete(allocator);
 	}
@@ -506,7 +708,8 @@ void MessageQueue::set_thread_singleton_override(CallQueue *p_thread_singleton)
 MessageQueue::MessageQueue() :
 		CallQueue(nullptr,
 				int(GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "memory/limits/message_queue/max_size_mb", PROPERTY_HINT_RANGE, "1,512,1,or_greater"), 32)) * 1024 * 1024 / PAGE_SIZE_BYTES,
-				"Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_mb' in project settings.") {
+				"Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_mb' in project settings.",
+				true) {
 	ERR_FAIL_COND_MSG(main_singleton != nullptr, "A MessageQueue singleton already exists.");
 	main_singleton = this;
 }
@@ -31,9 +31,11 @@
 #pragma once
 
 #include "core/object/object_id.h"
+#include "core/os/spin_lock.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 
 class Object;
@@ -99,8 +101,66 @@ private:
 
 	void _add_page();
 
+	// Multi-producer queues give every pushing thread a buffer of its own, so
+	// pushes never wait on the mutex or on each other. flush() merges the
+	// buffers back in push order using the message sequence numbers, which
+	// keeps calls made on the same object in the order they were pushed.
+	// Those numbers are stored right before each message in producer pages.
+	static constexpr uint32_t SEQUENCE_BYTES = sizeof(uint64_t);
+
+	struct ProducerBuffer {
+		std::atomic<bool> busy = { false };
+		LocalVector<Page *> pages;
+		LocalVector<uint32_t> page_bytes;
+		LocalVector<Page *> free_pages;
+		ProducerBuffer *next = nullptr;
+
+		_FORCE_INLINE_ bool try_acquire() {
+			return !busy.exchange(true, std::memory_order_acquire);
+		}
+		// Producers only hold their buffer while writing a message, so spin for a
+		// bit before giving the time slice away.
+		_FORCE_INLINE_ void acquire() {
+			uint32_t spins = 0;
+			while (!try_acquire()) {
+				while (busy.load(std::memory_order_relaxed)) {
+					if (++spins < 64) {
+						_cpu_pause();
+					} else {
+						Thread::yield();
+					}
+				}
+			}
+		}
+		_FORCE_INLINE_ void release() {
+			busy.store(false, std::memory_order_release);
+		}
+	};
+
+	bool multi_producer = false;
+	uint64_t queue_id = 0;
+	std::atomic<ProducerBuffer *> producers = { nullptr };
+	SafeNumeric<uint64_t> next_sequence;
+	SafeNumeric<uint64_t> consumed_sequence;
+	SafeNumeric<uint32_t> producer_pages;
+
+	ProducerBuffer *_acquire_producer_buffer();
+	uint8_t *_producer_reserve(ProducerBuffer *p_producer, uint32_t p_room_needed);
+	Error _flush_producers();
+	void _clear_producers();
+
+	// Returns nullptr when the queue is out of memory, with nothing left locked.
+	uint8_t *_reserve(uint32_t p_room_needed, ProducerBuffer *&r_producer);
+	void _commit(uint32_t p_room_needed, ProducerBuffer *p_producer, Message *p_message);
+
+	static uint32_t _get_message_size(const Message *p_message);
+	static void _destroy_message(Message *p_message);
+	void _execute_message(Message *p_message);
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
+	struct Statistics;
+	static void _count_page_messages(const Page *p_page, uint32_t p_bytes, uint32_t p_header_bytes, Statistics &r_statistics);
+
 	String error_text;
 
 public:
@@ -152,7 +212,7 @@ public:
 	bool is_flushing() const;
 	int get_max_buffer_usage() const;
 
-	CallQueue(Allocator *p_custom_allocator = nullptr, uint32_t p_max_pages = 8192, const String &p_error_text = String());
+	CallQueue(Allocator *p_custom_allocator = nullptr, uint32_t p_max_pages = 8192, const String &p_error_text = String(), bool p_multi_producer = false);
 	virtual ~CallQueue();
 };
 
@@ -407,6 +407,9 @@ public:
 	}                                                                                                            \
 	virtual bool is_class_ptr(void *p_ptr) const override {                                                      \
 		return (p_ptr == get_class_ptr_static()) || m_inherits::is_class_ptr(p_ptr);                             \
+	}                                                                                                            \
+	virtual bool _has_custom_callp() const override {                                                            \
+		return !std::is_same_v<decltype(&m_class::callp), decltype(&Object::callp)>;                             \
 	}                                                                                                            \
                                                                                                                  \
 protected:                                                                                                       \
@@ -689,6 +692,8 @@ protected:
 	}
 
 	friend class GDExtensionMethodBind;
+	friend class VariantCallSite;
+	friend class VariantPropertySite;
 	_ALWAYS_INLINE_ const ObjectGDExtension *_get_extension() const { return _extension; }
 	_ALWAYS_INLINE_ GDExtensionClassInstancePtr _get_extension_instance() const { return _extension_instance; }
 	virtual void _initialize_classv() { initialize_class(); }
@@ -860,6 +865,11 @@ public:
 	Variant callv(const StringName &p_method, const Array &p_args);
 	virtual Variant callp(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	virtual Variant call_const(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
+	Variant callp_method_bind(MethodBind *p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
+
+	// True when the class or one of its parents overrides callp(), so call sites don't
+	// bypass it with a cached MethodBind. GDSOFTCLASS and GDCLASS implement it.
+	virtual bool _has_custom_callp() const { return false; }
 
 	template <typename... VarArgs>
 	Variant call(const StringName &p_method, VarArgs... p_args) {
@@ -0,0 +1,114 @@
+/**************************************************************************/
+/*  frame_arena.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "frame_arena.h"
+
+thread_local FrameArena FrameArena::thread_arena;
+
+void FrameArena::_add_block(size_t p_min_size) {
+	size_t size = MAX(MIN_BLOCK_SIZE, p_min_size);
+	Block *block = (Block *)Memory::alloc_static(BLOCK_HEADER_SIZE + size);
+	CRASH_COND_MSG(!block, "Out of memory");
+	memnew_placement(block, Block);
+	block->prev = current;
+	block->size = size;
+	current = block;
+	total_size += size;
+}
+
+void FrameArena::_free_blocks() {
+	while (current) {
+		Block *prev = current->prev;
+		Memory::free_static(current);
+		current = prev;
+	}
+	total_size = 0;
+}
+
+FrameArena::Block *FrameArena::_find_block(const void *p_memory) const {
+	for (Block *block = current; block; block = block->prev) {
+		if (_block_has(block, p_memory)) {
+			return block;
+		}
+	}
+	return nullptr;
+}
+
+void *FrameArena::realloc(void *p_memory, size_t p_old_bytes, size_t p_bytes) {
+	if (!p_memory) {
+		return alloc(p_bytes);
+	}
+
+	if (_is_top(p_memory, p_old_bytes)) {
+		size_t used = current->used - _align(p_old_bytes) + _align(p_bytes);
+		if (used <= current->size) {
+			current->used = used;
+			return p_memory;
+		}
+	}
+
+	void *ptr = alloc(p_bytes);
+	memcpy(ptr, p_memory, MIN(p_old_bytes, p_bytes));
+	free(p_memory, p_old_bytes);
+	return ptr;
+}
+
+void FrameArena::reset() {
+	if (!current) {
+		return;
+	}
+
+	if (live_allocations > 0) {
+		size_t size = 0;
+		while (current->live_allocations == 0) {
+			Block *prev = current->prev;
+			size += current->size;
+			total_size -= current->size;
+			Memory::free_static(current);
+			current = prev;
+		}
+		if (size > 0) {
+			_add_block(size);
+		}
+		return;
+	}
+
+	if (current->prev) {
+		// The frame needed several blocks, replace them with a single one that fits them all.
+		size_t size = total_size;
+		_free_blocks();
+		_add_block(size);
+	}
+	current->used = 0;
+}
+
+FrameArena::~FrameArena() {
+	_free_blocks();
+}
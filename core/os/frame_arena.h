@@ -0,0 +1,117 @@
+/**************************************************************************/
+/*  frame_arena.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/memory.h"
+
+// Per-thread bump allocator for temporary storage that never outlives the
+// frame it was allocated in, such as cull or pair lists built every frame.
+// Memory released in reverse allocation order is reclaimed immediately, and a
+// block is reused as soon as everything allocated in it is released. The
+// remaining blocks are merged into one when the thread calls reset() with
+// nothing allocated, so a thread reaches a steady state without mallocs.
+class FrameArena {
+	struct Block {
+		Block *prev = nullptr;
+		size_t size = 0;
+		size_t used = 0;
+		uint32_t live_allocations = 0;
+	};
+
+	static constexpr size_t ALIGNMENT = alignof(max_align_t);
+	static constexpr size_t BLOCK_HEADER_SIZE = (sizeof(Block) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+	static constexpr size_t MIN_BLOCK_SIZE = 64 * 1024;
+
+	Block *current = nullptr;
+	size_t total_size = 0;
+	uint32_t live_allocations = 0;
+
+	static thread_local FrameArena thread_arena;
+
+	_FORCE_INLINE_ static size_t _align(size_t p_bytes) { return (p_bytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1); }
+	_FORCE_INLINE_ static uint8_t *_get_block_data(Block *p_block) { return (uint8_t *)p_block + BLOCK_HEADER_SIZE; }
+	_FORCE_INLINE_ bool _is_top(const void *p_memory, size_t p_bytes) const {
+		return current && (const uint8_t *)p_memory + _align(p_bytes) == _get_block_data(current) + current->used;
+	}
+	_FORCE_INLINE_ static bool _block_has(Block *p_block, const void *p_memory) {
+		return (const uint8_t *)p_memory >= _get_block_data(p_block) && (const uint8_t *)p_memory < _get_block_data(p_block) + p_block->size;
+	}
+
+	void _add_block(size_t p_min_size);
+	void _free_blocks();
+	Block *_find_block(const void *p_memory) const;
+
+public:
+	_FORCE_INLINE_ static FrameArena &get_thread_arena() { return thread_arena; }
+
+	_FORCE_INLINE_ void *alloc(size_t p_bytes) {
+		size_t size = _align(p_bytes);
+		if (unlikely(!current || current->used + size > current->size)) {
+			_add_block(size);
+		}
+		void *ptr = _get_block_data(current) + current->used;
+		current->used += size;
+		current->live_allocations++;
+		live_allocations++;
+		return ptr;
+	}
+
+	// Grows in place when p_memory is the latest allocation.
+	void *realloc(void *p_memory, size_t p_old_bytes, size_t p_bytes);
+
+	_FORCE_INLINE_ void free(void *p_memory, size_t p_bytes) {
+		if (!p_memory) {
+			return;
+		}
+		Block *block = likely(_block_has(current, p_memory)) ? current : _find_block(p_memory);
+		ERR_FAIL_NULL_MSG(block, "Memory was not allocated by this FrameArena.");
+		DEV_ASSERT(block->live_allocations > 0);
+		block->live_allocations--;
+		live_allocations--;
+		if (block->live_allocations == 0) {
+			block->used = 0;
+		} else if (_is_top(p_memory, p_bytes)) {
+			current->used -= _align(p_bytes);
+		}
+	}
+
+	_FORCE_INLINE_ uint32_t get_live_allocations() const { return live_allocations; }
+	_FORCE_INLINE_ size_t get_total_size() const { return total_size; }
+
+	// Called at frame end by the thread owning the arena. Allocations still
+	// alive, e.g. when called from inside a nested loop or when something kept
+	// a list past the frame, keep their blocks. The blocks after the last one of
+	// them are merged and reused, so the arena doesn't grow every frame.
+	void reset();
+
+	FrameArena() {}
+	~FrameArena();
+};
@@ -59,11 +59,16 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
+SafeNumeric<uint64_t> Memory::alloc_count;
 #endif
 
 void *Memory::alloc_aligned_static(size_t p_bytes, size_t p_alignment) {
 	DEV_ASSERT(is_power_of_2(p_alignment));
 
+#ifdef DEBUG_ENABLED
+	alloc_count.increment();
+#endif
+
 	void *p1, *p2;
 	if ((p1 = (void *)malloc(p_bytes + p_alignment - 1 + sizeof(uint32_t))) == nullptr) {
 		return nullptr;
@@ -101,6 +106,10 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
+#ifdef DEBUG_ENABLED
+	alloc_count.increment();
+#endif
+
 	void *mem;
 	if constexpr (p_ensure_zero) {
 		mem = calloc(1, p_bytes + (prepad ? DATA_OFFSET : 0));
@@ -137,6 +146,7 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 	uint8_t *mem = (uint8_t *)p_memory;
 
 #ifdef DEBUG_ENABLED
+	alloc_count.increment();
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
@@ -224,6 +234,14 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+uint64_t Memory::get_alloc_count() {
+#ifdef DEBUG_ENABLED
+	return alloc_count.get();
+#else
+	return 0;
+#endif
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
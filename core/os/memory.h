@@ -40,6 +40,7 @@ class Memory {
 #ifdef DEBUG_ENABLED
 	static SafeNumeric<uint64_t> mem_usage;
 	static SafeNumeric<uint64_t> max_usage;
+	static SafeNumeric<uint64_t> alloc_count;
 #endif
 
 public:
@@ -87,6 +88,7 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+	static uint64_t get_alloc_count(); // Number of heap (re)allocations so far, debug builds only.
 };
 
 class DefaultAllocator {
@@ -0,0 +1,612 @@
+/**************************************************************************/
+/*  dense_hash_map.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+
+/**
+ * An insertion-ordered hash map that stores its entries densely instead of
+ * allocating one element per key.
+ *
+ * Entries are appended to pages that double in size (8, 16, 32... entries),
+ * so growing never moves existing entries and pointers to keys and values
+ * stay valid across insertions, like with `HashMap`. Lookups go through an
+ * open-addressing index of (hash, entry index) pairs with linear probing.
+ * Maps that never held more than `LINEAR_SCAN_LIMIT` entries don't allocate
+ * the index at all and are searched linearly, which is faster for the many
+ * small maps created when parsing JSON or decoding network messages.
+ *
+ * Erasing leaves a hole that iteration skips. Once holes outnumber the
+ * remaining entries, the storage is compacted, which invalidates pointers to
+ * the remaining entries.
+ */
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class DenseHashMap {
+public:
+	static constexpr uint32_t LINEAR_SCAN_LIMIT = 8;
+	static constexpr uint32_t EMPTY_HASH = 0;
+
+private:
+	typedef KeyValue<TKey, TValue> MapKeyValue;
+
+	// Must be a power of two, it's also the capacity of the first page.
+	static constexpr uint32_t FIRST_PAGE_SHIFT = 3;
+	static_assert((1 << FIRST_PAGE_SHIFT) == LINEAR_SCAN_LIMIT);
+
+	struct Entry {
+		uint32_t hash; // EMPTY_HASH if the entry was erased.
+		union {
+			MapKeyValue data;
+		};
+		Entry() {}
+		~Entry() {}
+	};
+
+	struct Slot {
+		uint32_t hash;
+		uint32_t index;
+	};
+
+	Entry **pages = nullptr;
+	uint32_t page_count = 0;
+
+	Slot *slots = nullptr;
+	uint32_t slot_mask = 0; // Slot capacity - 1.
+
+	uint32_t used = 0; // Entries in use, including erased ones.
+	uint32_t num_elements = 0;
+
+	static _FORCE_INLINE_ uint32_t _get_page(uint32_t p_index) {
+		const uint32_t v = (p_index >> FIRST_PAGE_SHIFT) + 1;
+#if defined(__GNUC__) || defined(__clang__)
+		return 31 - __builtin_clz(v);
+#else
+		return nearest_shift(v) - 1;
+#endif
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_page_start(uint32_t p_page) {
+		return ((1u << p_page) - 1) << FIRST_PAGE_SHIFT;
+	}
+
+	_FORCE_INLINE_ Entry &_get_entry(uint32_t p_index) const {
+		const uint32_t page = _get_page(p_index);
+		return pages[page][p_index - _get_page_start(page)];
+	}
+
+	_FORCE_INLINE_ uint32_t _get_capacity() const {
+		return _get_page_start(page_count);
+	}
+
+	uint32_t _hash(const TKey &p_key) const {
+		uint32_t hash = Hasher::hash(p_key);
+
+		if (unlikely(hash == EMPTY_HASH)) {
+			hash = EMPTY_HASH + 1;
+		}
+
+		return hash;
+	}
+
+	// Returns the entry index, or `used` if not found. Also returns the index slot position if there is an index.
+	uint32_t _lookup(const TKey &p_key, uint32_t p_hash, uint32_t *r_slot = nullptr) const {
+		if (slots == nullptr) {
+			for (uint32_t i = 0; i < used; i++) {
+				const Entry &entry = _get_entry(i);
+				if (entry.hash == p_hash && Comparator::compare(entry.data.key, p_key)) {
+					return i;
+				}
+			}
+			return used;
+		}
+
+		uint32_t pos = p_hash & slot_mask;
+		while (true) {
+			const Slot &slot = slots[pos];
+			if (slot.hash == EMPTY_HASH) {
+				return used;
+			}
+			if (slot.hash == p_hash && Comparator::compare(_get_entry(slot.index).data.key, p_key)) {
+				if (r_slot) {
+					*r_slot = pos;
+				}
+				return slot.index;
+			}
+			pos = (pos + 1) & slot_mask;
+		}
+	}
+
+	void _insert_slot(uint32_t p_hash, uint32_t p_index) {
+		uint32_t pos = p_hash & slot_mask;
+		while (slots[pos].hash != EMPTY_HASH) {
+			pos = (pos + 1) & slot_mask;
+		}
+		slots[pos].hash = p_hash;
+		slots[pos].index = p_index;
+	}
+
+	// Backward shift deletion, keeps probe sequences intact without tombstones.
+	void _remove_slot(uint32_t p_pos) {
+		uint32_t hole = p_pos;
+		uint32_t pos = (p_pos + 1) & slot_mask;
+		while (slots[pos].hash != EMPTY_HASH) {
+			const uint32_t ideal = slots[pos].hash & slot_mask;
+			if (((pos - ideal) & slot_mask) >= ((pos - hole) & slot_mask)) {
+				slots[hole] = slots[pos];
+				hole = pos;
+			}
+			pos = (pos + 1) & slot_mask;
+		}
+		slots[hole].hash = EMPTY_HASH;
+	}
+
+	void _rebuild_index(uint32_t p_min_entries) {
+		if (p_min_entries <= LINEAR_SCAN_LIMIT) {
+			if (slots) {
+				Memory::free_static(slots);
+				slots = nullptr;
+				slot_mask = 0;
+			}
+			return;
+		}
+
+		// Keep the load factor under 0.5, probing stays short with linear probing.
+		const uint32_t capacity = next_power_of_2(p_min_entries * 2);
+		if (slots == nullptr || capacity != slot_mask + 1) {
+			if (slots) {
+				Memory::free_static(slots);
+			}
+			slots = reinterpret_cast<Slot *>(Memory::alloc_static(sizeof(Slot) * capacity));
+			slot_mask = capacity - 1;
+		}
+		memset(slots, 0, sizeof(Slot) * capacity);
+		static_assert(EMPTY_HASH == 0, "EMPTY_HASH must always be 0 for the memset() optimization.");
+
+		for (uint32_t i = 0; i < used; i++) {
+			const Entry &entry = _get_entry(i);
+			if (entry.hash != EMPTY_HASH) {
+				_insert_slot(entry.hash, i);
+			}
+		}
+	}
+
+	void _add_page() {
+		pages = reinterpret_cast<Entry **>(Memory::realloc_static(pages, sizeof(Entry *) * (page_count + 1)));
+		pages[page_count] = reinterpret_cast<Entry *>(Memory::alloc_static(sizeof(Entry) * (LINEAR_SCAN_LIMIT << page_count)));
+		page_count++;
+	}
+
+	uint32_t _insert(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(used == _get_capacity())) {
+			_add_page();
+		}
+
+		const uint32_t index = used++;
+		Entry &entry = _get_entry(index);
+		entry.hash = p_hash;
+		memnew_placement(&entry.data, MapKeyValue(p_key, p_value));
+		num_elements++;
+
+		if (slots == nullptr) {
+			if (used > LINEAR_SCAN_LIMIT) {
+				_rebuild_index(used);
+			}
+		} else if (used * 2 > slot_mask + 1) {
+			_rebuild_index(used);
+		} else {
+			_insert_slot(p_hash, index);
+		}
+		return index;
+	}
+
+	void _compact() {
+		uint32_t dst = 0;
+		for (uint32_t src = 0; src < used; src++) {
+			Entry &from = _get_entry(src);
+			if (from.hash == EMPTY_HASH) {
+				continue;
+			}
+			if (src != dst) {
+				Entry &to = _get_entry(dst);
+				to.hash = from.hash;
+				memnew_placement(&to.data, MapKeyValue(std::move(from.data)));
+				from.data.~MapKeyValue();
+				from.hash = EMPTY_HASH;
+			}
+			dst++;
+		}
+		used = dst;
+		_rebuild_index(used);
+	}
+
+	void _init_from(const DenseHashMap &p_other) {
+		reserve(p_other.num_elements);
+		for (uint32_t i = 0; i < p_other.used; i++) {
+			const Entry &from = p_other._get_entry(i);
+			if (from.hash == EMPTY_HASH) {
+				continue;
+			}
+			Entry &to = _get_entry(used++);
+			to.hash = from.hash;
+			memnew_placement(&to.data, MapKeyValue(from.data));
+		}
+		num_elements = p_other.num_elements;
+		_rebuild_index(used);
+	}
+
+	void _free() {
+		clear();
+		for (uint32_t i = 0; i < page_count; i++) {
+			Memory::free_static(pages[i]);
+		}
+		if (pages) {
+			Memory::free_static(pages);
+			pages = nullptr;
+		}
+		page_count = 0;
+		if (slots) {
+			Memory::free_static(slots);
+			slots = nullptr;
+		}
+		slot_mask = 0;
+	}
+
+	_FORCE_INLINE_ uint32_t _next_index(uint32_t p_index) const {
+		do {
+			p_index++;
+		} while (p_index < used && _get_entry(p_index).hash == EMPTY_HASH);
+		return p_index;
+	}
+
+	_FORCE_INLINE_ uint32_t _prev_index(uint32_t p_index) const {
+		while (p_index > 0) {
+			p_index--;
+			if (_get_entry(p_index).hash != EMPTY_HASH) {
+				return p_index;
+			}
+		}
+		return used;
+	}
+
+	_FORCE_INLINE_ uint32_t _first_index() const {
+		return (used > 0 && _get_entry(0).hash == EMPTY_HASH) ? _next_index(0) : 0;
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return _get_capacity(); }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	_FORCE_INLINE_ bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if constexpr (!(std::is_trivially_destructible_v<TKey> && std::is_trivially_destructible_v<TValue>)) {
+			for (uint32_t i = 0; i < used; i++) {
+				Entry &entry = _get_entry(i);
+				if (entry.hash != EMPTY_HASH) {
+					entry.data.~MapKeyValue();
+				}
+			}
+		}
+		if (slots) {
+			memset(slots, 0, sizeof(Slot) * (slot_mask + 1));
+		}
+		used = 0;
+		num_elements = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		const uint32_t index = _lookup(p_key, _hash(p_key));
+		CRASH_COND_MSG(index == used, "DenseHashMap key not found.");
+		return _get_entry(index).data.value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		const uint32_t index = _lookup(p_key, _hash(p_key));
+		CRASH_COND_MSG(index == used, "DenseHashMap key not found.");
+		return _get_entry(index).data.value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		const uint32_t index = _lookup(p_key, _hash(p_key));
+		return index == used ? nullptr : &_get_entry(index).data.value;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		const uint32_t index = _lookup(p_key, _hash(p_key));
+		return index == used ? nullptr : &_get_entry(index).data.value;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		return _lookup(p_key, _hash(p_key)) != used;
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t slot = 0;
+		const uint32_t index = _lookup(p_key, _hash(p_key), &slot);
+		if (index == used) {
+			return false;
+		}
+
+		if (slots) {
+			_remove_slot(slot);
+		}
+
+		Entry &entry = _get_entry(index);
+		entry.data.~MapKeyValue();
+		entry.hash = EMPTY_HASH;
+		num_elements--;
+
+		if (index == used - 1) {
+			// Trailing holes can be reused right away.
+			while (used > 0 && _get_entry(used - 1).hash == EMPTY_HASH) {
+				used--;
+			}
+		} else if (used >= LINEAR_SCAN_LIMIT && used - num_elements > num_elements) {
+			_compact();
+		}
+		return true;
+	}
+
+	// Reserves space for at least `p_new_capacity` entries.
+	void reserve(uint32_t p_new_capacity) {
+		while (_get_capacity() < p_new_capacity) {
+			_add_page();
+		}
+		if (p_new_capacity > LINEAR_SCAN_LIMIT && p_new_capacity * 2 > slot_mask + 1) {
+			_rebuild_index(p_new_capacity);
+		}
+	}
+
+	// Sorts the entries by key, see `HashMap::sort()`. Only available for Variant keys.
+	void sort() {
+		if (num_elements < 2) {
+			return;
+		}
+		_compact();
+
+		// Insertion sort on a list of indices, fast for already sorted or nearly sorted input.
+		LocalVector<uint32_t> order;
+		order.resize(used);
+		for (uint32_t i = 0; i < used; i++) {
+			uint32_t j = i;
+			while (j > 0 && _hashmap_variant_less_than(_get_entry(i).data.key, _get_entry(order[j - 1]).data.key)) {
+				order[j] = order[j - 1];
+				j--;
+			}
+			order[j] = i;
+		}
+
+		Entry *sorted = reinterpret_cast<Entry *>(Memory::alloc_static(sizeof(Entry) * used));
+		for (uint32_t i = 0; i < used; i++) {
+			Entry &from = _get_entry(order[i]);
+			sorted[i].hash = from.hash;
+			memnew_placement(&sorted[i].data, MapKeyValue(std::move(from.data)));
+			from.data.~MapKeyValue();
+		}
+		for (uint32_t i = 0; i < used; i++) {
+			Entry &to = _get_entry(i);
+			to.hash = sorted[i].hash;
+			memnew_placement(&to.data, MapKeyValue(std::move(sorted[i].data)));
+			sorted[i].data.~MapKeyValue();
+		}
+		Memory::free_static(sorted);
+		_rebuild_index(used);
+	}
+
+	/* Iterator API */
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const MapKeyValue &operator*() const {
+			return map->_get_entry(index).data;
+		}
+		_FORCE_INLINE_ const MapKeyValue *operator->() const { return &map->_get_entry(index).data; }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			if (map && index < map->used) {
+				index = map->_next_index(index);
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ ConstIterator &operator--() {
+			if (map && index < map->used) {
+				index = map->_prev_index(index);
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return map == b.map && index == b.index; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return map != b.map || index != b.index; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr && index < map->used;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const DenseHashMap *p_map, uint32_t p_index) {
+			map = p_map;
+			index = p_index;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+		_FORCE_INLINE_ ConstIterator(const ConstIterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+		_FORCE_INLINE_ void operator=(const ConstIterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+
+	private:
+		const DenseHashMap *map = nullptr;
+		uint32_t index = 0;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ MapKeyValue &operator*() const {
+			return map->_get_entry(index).data;
+		}
+		_FORCE_INLINE_ MapKeyValue *operator->() const { return &map->_get_entry(index).data; }
+		_FORCE_INLINE_ Iterator &operator++() {
+			if (map && index < map->used) {
+				index = map->_next_index(index);
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ Iterator &operator--() {
+			if (map && index < map->used) {
+				index = map->_prev_index(index);
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return map == b.map && index == b.index; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return map != b.map || index != b.index; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr && index < map->used;
+		}
+
+		_FORCE_INLINE_ Iterator(const DenseHashMap *p_map, uint32_t p_index) {
+			map = p_map;
+			index = p_index;
+		}
+		_FORCE_INLINE_ Iterator() {}
+		_FORCE_INLINE_ Iterator(const Iterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+		_FORCE_INLINE_ void operator=(const Iterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+
+		operator ConstIterator() const {
+			return ConstIterator(map, index);
+		}
+
+	private:
+		const DenseHashMap *map = nullptr;
+		uint32_t index = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(this, _first_index());
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(this, used);
+	}
+	_FORCE_INLINE_ Iterator last() {
+		return Iterator(this, _prev_index(used));
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		return Iterator(this, _lookup(p_key, _hash(p_key)));
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(this, _first_index());
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(this, used);
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		return ConstIterator(this, _prev_index(used));
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		return ConstIterator(this, _lookup(p_key, _hash(p_key)));
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		const uint32_t index = _lookup(p_key, _hash(p_key));
+		CRASH_COND(index == used);
+		return _get_entry(index).data.value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		const uint32_t hash = _hash(p_key);
+		uint32_t index = _lookup(p_key, hash);
+		if (index == used) {
+			index = _insert(p_key, TValue(), hash);
+		}
+		return _get_entry(index).data.value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		const uint32_t hash = _hash(p_key);
+		uint32_t index = _lookup(p_key, hash);
+		if (index == used) {
+			index = _insert(p_key, p_value, hash);
+		} else {
+			_get_entry(index).data.value = p_value;
+		}
+		return Iterator(this, index);
+	}
+
+	/* Constructors */
+
+	DenseHashMap(const DenseHashMap &p_other) {
+		_init_from(p_other);
+	}
+
+	void operator=(const DenseHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		clear();
+		_init_from(p_other);
+	}
+
+	DenseHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	DenseHashMap() {}
+
+	DenseHashMap(std::initializer_list<KeyValue<TKey, TValue>> p_init) {
+		reserve(p_init.size());
+		for (const KeyValue<TKey, TValue> &E : p_init) {
+			insert(E.key, E.value);
+		}
+	}
+
+	~DenseHashMap() {
+		_free();
+	}
+};
@@ -0,0 +1,122 @@
+/**************************************************************************/
+/*  frame_vector.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/frame_arena.h"
+#include "core/templates/sort_array.h"
+
+#include <type_traits>
+
+// LocalVector-like container for temporary lists built and dropped within a
+// frame. Storage comes from the FrameArena of the creating thread, so it must
+// be destroyed on that thread and never be kept across frames. Elements are
+// relocated with memcpy when growing, like LocalVector does.
+template <typename T, typename U = uint32_t>
+class FrameVector {
+	U count = 0;
+	U capacity = 0;
+	T *data = nullptr;
+	FrameArena *arena = &FrameArena::get_thread_arena();
+
+public:
+	_FORCE_INLINE_ T *ptr() { return data; }
+	_FORCE_INLINE_ const T *ptr() const { return data; }
+	_FORCE_INLINE_ U size() const { return count; }
+	_FORCE_INLINE_ bool is_empty() const { return count == 0; }
+
+	_FORCE_INLINE_ void reserve(U p_size) {
+		if (p_size > capacity) {
+			U new_capacity = nearest_power_of_2_templated(p_size);
+			data = (T *)arena->realloc(data, capacity * sizeof(T), new_capacity * sizeof(T));
+			capacity = new_capacity;
+		}
+	}
+
+	_FORCE_INLINE_ void push_back(const T &p_elem) {
+		if (unlikely(count == capacity)) {
+			reserve(count + 1);
+		}
+		memnew_placement(&data[count++], T(p_elem));
+	}
+
+	void resize(U p_size) {
+		if (p_size < count) {
+			if constexpr (!std::is_trivially_destructible_v<T>) {
+				for (U i = p_size; i < count; i++) {
+					data[i].~T();
+				}
+			}
+		} else if (p_size > count) {
+			reserve(p_size);
+			memnew_arr_placement(data + count, p_size - count);
+		}
+		count = p_size;
+	}
+
+	_FORCE_INLINE_ void clear() { resize(0); }
+
+	_FORCE_INLINE_ const T &operator[](U p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+	_FORCE_INLINE_ T &operator[](U p_index) {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+
+	template <typename C>
+	void sort_custom() {
+		if (count == 0) {
+			return;
+		}
+
+		SortArray<T, C> sorter;
+		sorter.sort(data, count);
+	}
+
+	void sort() {
+		sort_custom<Comparator<T>>();
+	}
+
+	_FORCE_INLINE_ T *begin() { return data; }
+	_FORCE_INLINE_ T *end() { return data + count; }
+	_FORCE_INLINE_ const T *begin() const { return data; }
+	_FORCE_INLINE_ const T *end() const { return data + count; }
+
+	FrameVector() {}
+	FrameVector(const FrameVector &) = delete;
+	void operator=(const FrameVector &) = delete;
+
+	~FrameVector() {
+		clear();
+		arena->free(data, capacity * sizeof(T));
+	}
+};
@@ -38,6 +38,7 @@
 #include "core/os/os.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
+#include "core/variant/variant_call_site.h"
 
 typedef void (*VariantFunc)(Variant &r_ret, Variant &p_self, const Variant **p_args);
 typedef void (*VariantConstructFunc)(Variant &r_ret, const Variant **p_args);
@@ -1384,6 +1385,108 @@ void Variant::call_static(Variant::Type p_type, const StringName &p_method, cons
 	imf->call(nullptr, p_args, p_argcount, r_ret, imf->default_arguments, r_error);
 }
 
+void VariantInlineCache::store(uint64_t p_key, const void *p_identity, const void *p_resolved) {
+	uint32_t seq = sequence.load(std::memory_order_relaxed);
+	if ((seq & 1) || !sequence.compare_exchange_strong(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+		return; // Another thread is updating the cache, skip caching this time.
+	}
+	std::atomic_thread_fence(std::memory_order_release);
+
+	int index = -1;
+	for (int i = 0; i < SIZE; i++) {
+		if (entries[i].identity.load(std::memory_order_relaxed) == p_identity && entries[i].key.load(std::memory_order_relaxed) == p_key) {
+			index = i;
+			break;
+		}
+	}
+	if (index < 0) {
+		index = next_entry;
+		next_entry = (next_entry + 1) % SIZE;
+	}
+
+	entries[index].key.store(p_key, std::memory_order_relaxed);
+	entries[index].identity.store(p_identity, std::memory_order_relaxed);
+	entries[index].resolved.store(p_resolved, std::memory_order_relaxed);
+	sequence.store(seq + 2, std::memory_order_release);
+}
+
+void VariantInlineCache::clear() {
+	uint32_t seq = sequence.load(std::memory_order_relaxed);
+	while ((seq & 1) || !sequence.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+		seq = sequence.load(std::memory_order_relaxed); // Clearing must not be skipped, wait for the other update.
+	}
+	std::atomic_thread_fence(std::memory_order_release);
+
+	for (int i = 0; i < SIZE; i++) {
+		entries[i].key.store(0, std::memory_order_relaxed);
+		entries[i].identity.store(nullptr, std::memory_order_relaxed);
+		entries[i].resolved.store(nullptr, std::memory_order_relaxed);
+	}
+	next_entry = 0;
+	sequence.store(seq + 2, std::memory_order_release);
+}
+
+void VariantCallSite::set_method(const StringName &p_method) {
+	method = p_method;
+	is_free = p_method == CoreStringName(free_);
+	clear_cache();
+}
+
+void VariantCallSite::clear_cache() {
+	cache.clear();
+}
+
+void VariantCallSite::call(Variant &p_base, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
+	const Variant::Type type = p_base.get_type();
+
+	if (type == Variant::OBJECT) {
+		Object *obj = p_base._get_obj().obj;
+		if (!obj) {
+			r_error.error = Callable::CallError::CALL_ERROR_INSTANCE_IS_NULL;
+			return;
+		}
+#ifdef DEBUG_ENABLED
+		if (EngineDebugger::is_active() && !p_base._get_obj().id.is_ref_counted() && ObjectDB::get_instance(p_base._get_obj().id) == nullptr) {
+			r_error.error = Callable::CallError::CALL_ERROR_INSTANCE_IS_NULL;
+			return;
+		}
+#endif // DEBUG_ENABLED
+
+		if (is_free || obj->get_script_instance() || obj->_get_extension() || obj->_has_custom_callp()) {
+			r_ret = obj->callp(method, p_args, p_argcount, r_error);
+			return;
+		}
+
+		// The class name is stored once per class, so its address identifies the class.
+		const StringName *class_name = &obj->get_class_name();
+		MethodBind *bind = (MethodBind *)cache.lookup(Variant::OBJECT, class_name);
+		if (!bind) {
+			bind = ClassDB::get_method(*class_name, method);
+			if (!bind) {
+				r_ret = obj->callp(method, p_args, p_argcount, r_error);
+				return;
+			}
+			cache.store(Variant::OBJECT, class_name, bind);
+		}
+
+		r_ret = obj->callp_method_bind(bind, p_args, p_argcount, r_error);
+	} else {
+		r_error.error = Callable::CallError::CALL_OK;
+
+		const VariantBuiltInMethodInfo *imf = (const VariantBuiltInMethodInfo *)cache.lookup(type, nullptr);
+		if (!imf) {
+			imf = builtin_method_info[type].lookup_ptr(method);
+			if (!imf) {
+				r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
+				return;
+			}
+			cache.store(type, nullptr, imf);
+		}
+
+		imf->call(&p_base, p_args, p_argcount, r_ret, imf->default_arguments, r_error);
+	}
+}
+
 bool Variant::has_method(const StringName &p_method) const {
 	if (type == OBJECT) {
 		Object *obj = get_validated_object();
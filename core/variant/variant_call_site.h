@@ -0,0 +1,130 @@
+/**************************************************************************/
+/*  variant_call_site.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/variant/variant.h"
+
+#include <atomic>
+
+// Small polymorphic inline cache, mapping a key and an identity (a receiver
+// type and class, a script...) to a resolved pointer. It keeps the last
+// VariantInlineCache::SIZE distinct receivers, replacing the oldest one when
+// full, so a site seeing a single receiver type is monomorphic and sites
+// seeing a few types don't thrash.
+//
+// Caches can be shared between threads, entries are guarded by a sequence
+// counter so lookups never block. A lookup returns nullptr on a miss, so
+// resolved pointers must not be null.
+class VariantInlineCache {
+public:
+	static constexpr int SIZE = 4;
+
+private:
+	struct Entry {
+		std::atomic<uint64_t> key = { 0 };
+		std::atomic<const void *> identity = { nullptr };
+		std::atomic<const void *> resolved = { nullptr };
+	};
+
+	std::atomic<uint32_t> sequence = { 0 };
+	uint32_t next_entry = 0; // Only accessed while holding the sequence.
+	Entry entries[SIZE];
+
+public:
+	_FORCE_INLINE_ const void *lookup(uint64_t p_key, const void *p_identity) const {
+		uint32_t seq = sequence.load(std::memory_order_acquire);
+		if (seq & 1) {
+			return nullptr; // Being updated.
+		}
+		const void *resolved = nullptr;
+		for (int i = 0; i < SIZE; i++) {
+			if (entries[i].identity.load(std::memory_order_relaxed) == p_identity && entries[i].key.load(std::memory_order_relaxed) == p_key) {
+				resolved = entries[i].resolved.load(std::memory_order_relaxed);
+				break;
+			}
+		}
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (sequence.load(std::memory_order_relaxed) != seq) {
+			return nullptr;
+		}
+		return resolved;
+	}
+
+	void store(uint64_t p_key, const void *p_identity, const void *p_resolved);
+	void clear();
+};
+
+// A call site caches the methods resolved for the last receiver types it was
+// used with, so repeated dynamic calls of the same method on the same types
+// skip the builtin method table and ClassDB lookups.
+//
+// Objects with a script instance, extension classes and classes with a custom
+// Object::callp() are always dispatched through Object::callp().
+class VariantCallSite {
+	StringName method;
+	bool is_free = false;
+
+	VariantInlineCache cache;
+
+public:
+	_FORCE_INLINE_ const StringName &get_method() const { return method; }
+	void set_method(const StringName &p_method);
+
+	void call(Variant &p_base, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error);
+	void clear_cache();
+
+	VariantCallSite() {}
+	VariantCallSite(const StringName &p_method) { set_method(p_method); }
+};
+
+// A property site caches the getter and setter MethodBinds of a named
+// property for the last object classes it was used with, so repeated dynamic
+// property access skips the inheritance walk in ClassDB.
+//
+// Values of other types, objects with a script instance and extension classes
+// go through Variant::get_named() and Variant::set_named().
+class VariantPropertySite {
+	StringName member;
+
+	VariantInlineCache getters;
+	VariantInlineCache setters;
+
+public:
+	_FORCE_INLINE_ const StringName &get_member() const { return member; }
+	void set_member(const StringName &p_member);
+
+	void get(const Variant &p_base, Variant &r_ret, bool &r_valid);
+	void set(Variant &p_base, const Variant &p_value, bool &r_valid);
+	void clear_cache();
+
+	VariantPropertySite() {}
+	VariantPropertySite(const StringName &p_member) { set_member(p_member); }
+};
@@ -32,6 +32,8 @@
 #include "variant_callable.h"
 
 #include "core/io/resource.h"
+#include "core/object/class_db.h"
+#include "core/variant/variant_call_site.h"
 
 struct VariantSetterGetterInfo {
 	void (*setter)(Variant *base, const Variant *value, bool &valid);
@@ -305,6 +307,76 @@ Variant Variant::get_named(const StringName &p_member, bool &r_valid) const {
 	return Variant();
 }
 
+// Resolved when the property can't be accessed through a cached MethodBind, so misses don't walk ClassDB again.
+static const char property_site_uncached = 0;
+
+static const void *_resolve_property_site_bind(const StringName &p_class, const StringName &p_member, bool p_setter) {
+	// Indexed properties and properties without a bound accessor use the generic path.
+	const MethodBind *bind = ClassDB::get_property_accessor_bind(p_class, p_member, p_setter);
+	return bind ? (const void *)bind : &property_site_uncached;
+}
+
+void VariantPropertySite::set_member(const StringName &p_member) {
+	member = p_member;
+	clear_cache();
+}
+
+void VariantPropertySite::clear_cache() {
+	getters.clear();
+	setters.clear();
+}
+
+void VariantPropertySite::get(const Variant &p_base, Variant &r_ret, bool &r_valid) {
+	Object *obj = p_base.get_type() == Variant::OBJECT ? p_base.get_validated_object() : nullptr;
+	if (!obj || obj->get_script_instance() || obj->_get_extension()) {
+		r_ret = p_base.get_named(member, r_valid);
+		return;
+	}
+
+	// The class name is stored once per class, so its address identifies the class.
+	const StringName *class_name = &obj->get_class_name();
+	const void *resolved = getters.lookup(Variant::OBJECT, class_name);
+	if (!resolved) {
+		resolved = _resolve_property_site_bind(*class_name, member, false);
+		getters.store(Variant::OBJECT, class_name, resolved);
+	}
+	if (resolved == &property_site_uncached) {
+		r_ret = obj->get(member, &r_valid);
+		return;
+	}
+
+	Callable::CallError ce;
+	r_ret = ((MethodBind *)resolved)->call(obj, nullptr, 0, ce);
+	r_valid = true;
+}
+
+void VariantPropertySite::set(Variant &p_base, const Variant &p_value, bool &r_valid) {
+	Object *obj = p_base.get_type() == Variant::OBJECT ? p_base.get_validated_object() : nullptr;
+	if (!obj || obj->get_script_instance() || obj->_get_extension()) {
+		p_base.set_named(member, p_value, r_valid);
+		return;
+	}
+
+	const StringName *class_name = &obj->get_class_name();
+	const void *resolved = setters.lookup(Variant::OBJECT, class_name);
+	if (!resolved) {
+		resolved = _resolve_property_site_bind(*class_name, member, true);
+		setters.store(Variant::OBJECT, class_name, resolved);
+	}
+	if (resolved == &property_site_uncached) {
+		obj->set(member, p_value, &r_valid);
+		return;
+	}
+
+#ifdef TOOLS_ENABLED
+	obj->_edited = true;
+#endif
+	const Variant *args[1] = { &p_value };
+	Callable::CallError ce;
+	((MethodBind *)resolved)->call(obj, args, 1, ce);
+	r_valid = ce.error == Callable::CallError::CALL_OK;
+}
+
 /**** INDEXED SETTERS AND GETTERS ****/
 
 #ifdef DEBUG_ENABLED
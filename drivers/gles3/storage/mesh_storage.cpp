@@ -2041,6 +2041,83 @@ void MeshStorage::_multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_
 	}
 }
 
+// Number of floats per instance in the buffers passed to the RenderingServer.
+static uint32_t _multimesh_get_buffer_stride(const MultiMesh *p_multimesh) {
+	uint32_t stride = p_multimesh->xform_format == RS::MULTIMESH_TRANSFORM_2D ? 8 : 12;
+	stride += p_multimesh->uses_colors ? 4 : 0;
+	stride += p_multimesh->uses_custom_data ? 4 : 0;
+	return stride;
+}
+
+// Copies one instance from the RenderingServer layout to the data cache layout, packing colors and custom data like _multimesh_set_buffer() does.
+static void _multimesh_copy_instance(const MultiMesh *p_multimesh, float *r_dst, const float *p_src) {
+	const uint32_t xform_size = p_multimesh->xform_format == RS::MULTIMESH_TRANSFORM_2D ? 8 : 12;
+	memcpy(r_dst, p_src, xform_size * sizeof(float));
+
+	if (p_multimesh->uses_colors) {
+		const float *src = p_src + xform_size;
+		uint16_t val[4] = { Math::make_half_float(src[0]), Math::make_half_float(src[1]), Math::make_half_float(src[2]), Math::make_half_float(src[3]) };
+		memcpy(r_dst + p_multimesh->color_offset_cache, val, 2 * 4);
+	}
+	if (p_multimesh->uses_custom_data) {
+		const float *src = p_src + xform_size + (p_multimesh->uses_colors ? 4 : 0);
+		uint16_t val[4] = { Math::make_half_float(src[0]), Math::make_half_float(src[1]), Math::make_half_float(src[2]), Math::make_half_float(src[3]) };
+		memcpy(r_dst + p_multimesh->custom_data_offset_cache, val, 2 * 4);
+	}
+}
+
+void MeshStorage::_multimesh_set_buffer_range(RID p_multimesh, int p_first_instance, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	const uint32_t buffer_stride = _multimesh_get_buffer_stride(multimesh);
+	ERR_FAIL_COND_MSG(p_buffer.size() % buffer_stride != 0, vformat("Buffer size must be a multiple of %d elements, got %d instead.", buffer_stride, p_buffer.size()));
+	const int instance_count = p_buffer.size() / buffer_stride;
+	ERR_FAIL_COND(p_first_instance < 0 || p_first_instance + instance_count > multimesh->instances);
+	if (instance_count == 0) {
+		return;
+	}
+
+	// Partial updates go through the data cache, the dirty regions are uploaded in _update_dirty_multimeshes().
+	_multimesh_make_local(multimesh);
+
+	float *w = multimesh->data_cache.ptrw() + p_first_instance * multimesh->stride_cache;
+	const float *r = p_buffer.ptr();
+	if (buffer_stride == multimesh->stride_cache) {
+		memcpy(w, r, p_buffer.size() * sizeof(float));
+	} else {
+		for (int i = 0; i < instance_count; i++) {
+			_multimesh_copy_instance(multimesh, w + i * multimesh->stride_cache, r + i * buffer_stride);
+		}
+	}
+
+	const int last_instance = p_first_instance + instance_count - 1;
+	for (int i = p_first_instance; i <= last_instance; i += MULTIMESH_DIRTY_REGION_SIZE) {
+		_multimesh_mark_dirty(multimesh, i, true);
+	}
+	_multimesh_mark_dirty(multimesh, last_instance, true);
+}
+
+void MeshStorage::_multimesh_set_buffer_instances(RID p_multimesh, const Vector<int32_t> &p_instances, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	const uint32_t buffer_stride = _multimesh_get_buffer_stride(multimesh);
+	ERR_FAIL_COND_MSG(p_buffer.size() != p_instances.size() * (int)buffer_stride, vformat("Buffer should have %d elements, got %d instead.", p_instances.size() * (int)buffer_stride, p_buffer.size()));
+	if (p_instances.is_empty()) {
+		return;
+	}
+
+	_multimesh_make_local(multimesh);
+
+	float *w = multimesh->data_cache.ptrw();
+	const int32_t *instances = p_instances.ptr();
+	const float *r = p_buffer.ptr();
+	for (int i = 0; i < p_instances.size(); i++) {
+		ERR_FAIL_INDEX(instances[i], multimesh->instances);
+		_multimesh_copy_instance(multimesh, w + instances[i] * multimesh->stride_cache, r + i * buffer_stride);
+		_multimesh_mark_dirty(multimesh, instances[i], true);
+	}
+}
+
 RID MeshStorage::_multimesh_get_command_buffer_rd_rid(RID p_multimesh) const {
 	ERR_FAIL_V_MSG(RID(), "GLES3 does not implement indirect multimeshes.");
 }
@@ -2325,6 +2402,22 @@ void MeshStorage::skeleton_bone_set_transform(RID p_skeleton, int p_bone, const
 	_skeleton_make_dirty(skeleton);
 }
 
+void MeshStorage::skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) {
+	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+
+	ERR_FAIL_NULL(skeleton);
+	ERR_FAIL_COND(skeleton->use_2d);
+	ERR_FAIL_COND(p_buffer.size() != skeleton->size * 12);
+
+	if (skeleton->size == 0) {
+		return;
+	}
+
+	memcpy(skeleton->data.ptr(), p_buffer.ptr(), p_buffer.size() * sizeof(float));
+
+	_skeleton_make_dirty(skeleton);
+}
+
 Transform3D MeshStorage::skeleton_bone_get_transform(RID p_skeleton, int p_bone) const {
 	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
 
@@ -0,0 +1,80 @@
+/**************************************************************************/
+/*  hlod_3d_editor_plugin.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "hlod_3d_editor_plugin.h"
+
+#include "editor/editor_node.h"
+#include "editor/editor_string_names.h"
+#include "editor/editor_undo_redo_manager.h"
+#include "scene/gui/button.h"
+
+void HLOD3DEditorPlugin::_bake() {
+	if (!hlod) {
+		return;
+	}
+
+	if (hlod->bake() != OK) {
+		EditorNode::get_singleton()->show_warning(TTR("No meshes to bake.\nMake sure there is at least one visible MeshInstance3D below the HLOD3D node that doesn't already use a visibility range or a skin."));
+		return;
+	}
+
+	EditorUndoRedoManager::get_singleton()->set_history_as_unsaved(EditorNode::get_editor_data().get_current_edited_scene_history_id());
+}
+
+void HLOD3DEditorPlugin::edit(Object *p_object) {
+	HLOD3D *s = Object::cast_to<HLOD3D>(p_object);
+	if (!s) {
+		return;
+	}
+
+	hlod = s;
+}
+
+bool HLOD3DEditorPlugin::handles(Object *p_object) const {
+	return p_object->is_class("HLOD3D");
+}
+
+void HLOD3DEditorPlugin::make_visible(bool p_visible) {
+	if (p_visible) {
+		bake->show();
+	} else {
+		bake->hide();
+	}
+}
+
+HLOD3DEditorPlugin::HLOD3DEditorPlugin() {
+	bake = memnew(Button);
+	bake->set_theme_type_variation(SceneStringName(FlatButton));
+	bake->set_button_icon(EditorNode::get_singleton()->get_editor_theme()->get_icon(SNAME("Bake"), EditorStringName(EditorIcons)));
+	bake->set_text(TTR("Bake HLOD"));
+	bake->hide();
+	bake->connect(SceneStringName(pressed), callable_mp(this, &HLOD3DEditorPlugin::_bake));
+	add_control_to_container(CONTAINER_SPATIAL_EDITOR_MENU, bake);
+}
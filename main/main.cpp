@@ -48,6 +48,7 @@
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
 #include "core/object/script_language.h"
+#include "core/os/frame_arena.h"
 #include "core/os/os.h"
 #include "core/os/time.h"
 #include "core/register_core_types.h"
@@ -4617,6 +4618,9 @@ bool Main::is_iterating() {
 static uint64_t physics_process_max = 0;
 static uint64_t process_max = 0;
 static uint64_t navigation_process_max = 0;
+#ifdef DEBUG_ENABLED
+static uint64_t last_fps_alloc_count = 0;
+#endif
 
 // Return false means iterating further, returning true means `OS::run`
 // will terminate the program. In case of failure, the OS exit code needs
@@ -4793,6 +4797,8 @@ bool Main::iteration() {
 		EngineDebugger::get_singleton()->iteration(frame_time, process_ticks, physics_process_ticks, physics_step);
 	}
 
+	FrameArena::get_thread_arena().reset();
+
 	frames++;
 	Engine::get_singleton()->_process_frames++;
 
@@ -4806,9 +4812,17 @@ bool Main::iteration() {
 			} else if (print_fps || GLOBAL_GET("debug/settings/stdout/print_fps")) {
 				print_line(vformat("Project FPS: %d (%s mspf)", frames, rtos(1000.0 / frames).pad_decimals(2)));
 			}
+#ifdef DEBUG_ENABLED
+			if (print_fps) {
+				print_line(vformat("Heap allocations: %d per frame", (Memory::get_alloc_count() - last_fps_alloc_count) / frames));
+			}
+#endif
 		} else {
 			hide_print_fps_attempts--;
 		}
+#ifdef DEBUG_ENABLED
+		last_fps_alloc_count = Memory::get_alloc_count();
+#endif
 
 		Engine::get_singleton()->_fps = frames;
 		performance->set_process_time(USEC_TO_SEC(process_max));
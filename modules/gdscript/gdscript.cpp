@@ -31,6 +31,7 @@
 #include "gdscript.h"
 
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode.h"
 #include "gdscript_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
@@ -812,6 +813,19 @@ Error GDScript::reload(bool p_keep_state) {
 #endif
 
 	valid = false;
+
+	if (!bytecode.is_empty()) {
+		// Only usable once, later reloads go through the tokens.
+		Vector<uint8_t> compiled = bytecode;
+		bytecode = Vector<uint8_t>();
+		if (!has_instances && GDScriptBytecode::load(this, compiled) == OK) {
+			can_run = ScriptServer::is_scripting_enabled() || is_tool();
+			Error err = can_run ? _static_init() : OK;
+			reloading = false;
+			return err;
+		}
+	}
+
 	GDScriptParser parser;
 	Error err;
 	if (!binary_tokens.is_empty()) {
@@ -1144,6 +1158,14 @@ const Vector<uint8_t> &GDScript::get_binary_tokens_source() const {
 	return binary_tokens;
 }
 
+void GDScript::set_bytecode_source(const Vector<uint8_t> &p_bytecode) {
+	bytecode = p_bytecode;
+}
+
+const Vector<uint8_t> &GDScript::get_bytecode_source() const {
+	return bytecode;
+}
+
 Vector<uint8_t> GDScript::get_as_binary_tokens() const {
 	GDScriptTokenizerBuffer tokenizer;
 	return tokenizer.parse_code_string(source, GDScriptTokenizerBuffer::COMPRESS_NONE);
@@ -1532,11 +1554,14 @@ void GDScript::_recurse_replace_function_ptrs(const HashMap<GDScriptFunction *,
 	}
 }
 
+SafeNumeric<uint32_t> GDScript::member_layout_version;
+
 void GDScript::clear(ClearData *p_clear_data) {
 	if (clearing) {
 		return;
 	}
 	clearing = true;
+	member_layout_version.increment();
 
 	ClearData data;
 	ClearData *clear_data = p_clear_data;
@@ -1649,6 +1674,7 @@ GDScript::~GDScript() {
 		return;
 	}
 	destructing = true;
+	member_layout_version.increment();
 
 	if (is_print_verbose_enabled()) {
 		MutexLock lock(func_ptrs_to_update_mutex);
@@ -2286,6 +2312,24 @@ void GDScriptLanguage::init() {
 	}
 #endif
 
+	if (!Engine::get_singleton()->is_project_manager_hint()) {
+		// Global classes and autoloads are loaded early on, so parse them all at once on the worker threads.
+		Vector<String> startup_scripts;
+		List<StringName> global_classes;
+		ScriptServer::get_global_class_list(&global_classes);
+		for (const StringName &class_name : global_classes) {
+			if (ScriptServer::get_global_class_language(class_name) == get_name()) {
+				startup_scripts.push_back(ScriptServer::get_global_class_path(class_name));
+			}
+		}
+		for (const KeyValue<StringName, ProjectSettings::AutoloadInfo> &E : ProjectSettings::get_singleton()->get_autoload_list()) {
+			if (E.value.path.get_extension().to_lower() == "gd") {
+				startup_scripts.push_back(E.value.path);
+			}
+		}
+		GDScriptCache::preload_scripts(startup_scripts);
+	}
+
 #ifdef TESTS_ENABLED
 	GDScriptTests::GDScriptTestRunner::handle_cmdline();
 #endif
@@ -84,6 +84,8 @@ class GDScript : public Script {
 	friend class GDScriptInstance;
 	friend class GDScriptFunction;
 	friend class GDScriptAnalyzer;
+	friend class GDScriptBytecode;
+	friend class GDScriptBytecodeSerializer;
 	friend class GDScriptCompiler;
 	friend class GDScriptDocGen;
 	friend class GDScriptLambdaCallable;
@@ -182,6 +184,7 @@ private:
 	//exported members
 	String source;
 	Vector<uint8_t> binary_tokens;
+	Vector<uint8_t> bytecode; // Compiled form shipped by exported projects, used instead of the tokens on first load.
 	String path;
 	bool path_valid = false; // False if using default path.
 	StringName local_name; // Inner class identifier or `class_name`.
@@ -235,6 +238,9 @@ public:
 	static String debug_get_script_name(const Ref<Script> &p_script);
 #endif
 
+	// Bumped when member layouts are rebuilt or a script is freed, invalidating inline caches keyed by script.
+	static SafeNumeric<uint32_t> member_layout_version;
+
 	static String canonicalize_path(const String &p_path);
 	_FORCE_INLINE_ static bool is_canonically_equal_paths(const String &p_path_a, const String &p_path_b) {
 		return canonicalize_path(p_path_a) == canonicalize_path(p_path_b);
@@ -320,6 +326,9 @@ public:
 	const Vector<uint8_t> &get_binary_tokens_source() const;
 	Vector<uint8_t> get_as_binary_tokens() const;
 
+	void set_bytecode_source(const Vector<uint8_t> &p_bytecode);
+	const Vector<uint8_t> &get_bytecode_source() const;
+
 	bool get_property_default_value(const StringName &p_property, Variant &r_value) const override;
 
 	virtual void get_script_method_list(List<MethodInfo> *p_list) const override;
@@ -213,11 +213,24 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		}
 		function->_global_names_count = function->global_names.size();
 
+		function->_call_sites_ptr = memnew_arr(VariantCallSite, function->_global_names_count);
+		for (int i = 0; i < function->_global_names_count; i++) {
+			function->_call_sites_ptr[i].set_method(function->global_names[i]);
+		}
+
 	} else {
 		function->_global_names_ptr = nullptr;
 		function->_global_names_count = 0;
 	}
 
+	function->_property_sites_count = function->property_site_members.size();
+	if (function->_property_sites_count) {
+		function->_property_sites_ptr = memnew_arr(GDScriptFunction::PropertySite, function->_property_sites_count);
+		for (int i = 0; i < function->_property_sites_count; i++) {
+			function->_property_sites_ptr[i].native.set_member(function->property_site_members[i]);
+		}
+	}
+
 	if (opcodes.size()) {
 		function->code = opcodes;
 		function->_code_ptr = &function->code.write[0];
@@ -464,10 +477,10 @@ void GDScriptByteCodeGenerator::write_type_adjust(const Address &p_target, Varia
 			append_opcode(GDScriptFunction::OPCODE_TYPE_ADJUST_TRANSFORM2D);
 			break;
 		case Variant::VECTOR4:
-			append_opcode(GDScriptFunction::OPCODE_TYPE_ADJUST_VECTOR3);
+			append_opcode(GDScriptFunction::OPCODE_TYPE_ADJUST_VECTOR4);
 			break;
 		case Variant::VECTOR4I:
-			append_opcode(GDScriptFunction::OPCODE_TYPE_ADJUST_VECTOR3I);
+			append_opcode(GDScriptFunction::OPCODE_TYPE_ADJUST_VECTOR4I);
 			break;
 		case Variant::PLANE:
 			append_opcode(GDScriptFunction::OPCODE_TYPE_ADJUST_PLANE);
@@ -601,22 +614,32 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 	}
 
 	if (valid) {
+		bool forwardable = false;
 		if (p_target.mode == Address::TEMPORARY) {
 			Variant::Type result_type = Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 			Variant::Type temp_type = temporaries[p_target.address].type;
 			if (result_type != temp_type) {
 				write_type_adjust(p_target, result_type);
+			} else {
+				forwardable = result_type != Variant::NIL;
 			}
 		}
 
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
+		function->validated_operator_positions.push_back(opcodes.size());
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(p_right_operand);
+		int target_pos = opcodes.size();
 		append(p_target);
 		append(op_func);
+		if (forwardable) {
+			last_operator_result.temporary = p_target.address;
+			last_operator_result.target_pos = target_pos;
+			last_operator_result.end_pos = opcodes.size();
+		}
 #ifdef DEBUG_ENABLED
 		add_debug_name(operator_names, get_operation_pos(op_func), Variant::get_operator_name(p_operator));
 #endif
@@ -786,6 +809,18 @@ void GDScriptByteCodeGenerator::write_end_ternary() {
 }
 
 void GDScriptByteCodeGenerator::write_set(const Address &p_target, const Address &p_index, const Address &p_source) {
+	if (IS_BUILTIN_TYPE(p_target, Variant::ARRAY) && p_target.type.has_container_element_type(0) && IS_BUILTIN_TYPE(p_index, Variant::INT)) {
+		const GDScriptDataType element_type = p_target.type.get_container_element_type(0);
+		if (element_type.kind == GDScriptDataType::BUILTIN && IS_BUILTIN_TYPE(p_source, element_type.builtin_type)) {
+			// Source matches the typed array element type, no need to validate it at runtime.
+			append_opcode(GDScriptFunction::OPCODE_SET_INDEXED_TYPED_ARRAY);
+			append(p_target);
+			append(p_index);
+			append(p_source);
+			return;
+		}
+	}
+
 	if (HAS_BUILTIN_TYPE(p_target)) {
 		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_setter(p_target.type.builtin_type) &&
 				IS_BUILTIN_TYPE(p_source, Variant::get_indexed_element_type(p_target.type.builtin_type))) {
@@ -815,6 +850,14 @@ void GDScriptByteCodeGenerator::write_set(const Address &p_target, const Address
 }
 
 void GDScriptByteCodeGenerator::write_get(const Address &p_target, const Address &p_index, const Address &p_source) {
+	if (IS_BUILTIN_TYPE(p_source, Variant::ARRAY) && p_source.type.has_container_element_type(0) && IS_BUILTIN_TYPE(p_index, Variant::INT)) {
+		append_opcode(GDScriptFunction::OPCODE_GET_INDEXED_TYPED_ARRAY);
+		append(p_source);
+		append(p_index);
+		append(p_target);
+		return;
+	}
+
 	if (HAS_BUILTIN_TYPE(p_source)) {
 		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_getter(p_source.type.builtin_type)) {
 			// Use indexed getter instead.
@@ -858,6 +901,8 @@ void GDScriptByteCodeGenerator::write_set_named(const Address &p_target, const S
 	append(p_target);
 	append(p_source);
 	append(p_name);
+	append(function->property_site_members.size());
+	function->property_site_members.push_back(p_name);
 }
 
 void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) {
@@ -876,6 +921,8 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append(function->property_site_members.size());
+	function->property_site_members.push_back(p_name);
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -905,6 +952,8 @@ void GDScriptByteCodeGenerator::write_get_static_variable(const Address &p_targe
 }
 
 void GDScriptByteCodeGenerator::write_assign_with_conversion(const Address &p_target, const Address &p_source) {
+	mark_local_initialized(p_target);
+
 	switch (p_target.type.kind) {
 		case GDScriptDataType::BUILTIN: {
 			if (p_target.type.builtin_type == Variant::ARRAY && p_target.type.has_container_element_type(0)) {
@@ -964,7 +1013,58 @@ void GDScriptByteCodeGenerator::write_assign_with_conversion(const Address &p_ta
 	}
 }
 
+bool GDScriptByteCodeGenerator::forward_operator_result(const Address &p_target, const Address &p_source) {
+	// Only when the operator was the very last thing emitted and wrote into this temporary.
+	if (!operator_result_forwarding || p_source.mode != Address::TEMPORARY || p_source.address != last_operator_result.temporary || opcodes.size() != last_operator_result.end_pos) {
+		return false;
+	}
+	// The local must already hold a value of its type, since validated evaluators write into it in place.
+	if (p_target.mode != Address::LOCAL_VARIABLE || !initialized_locals.has(p_target.address)) {
+		return false;
+	}
+	if (!p_target.type.has_type || p_target.type.kind != GDScriptDataType::BUILTIN || p_target.type.builtin_type != temporaries[p_source.address].type) {
+		return false;
+	}
+
+	switch (p_target.type.builtin_type) {
+		case Variant::BOOL:
+		case Variant::INT:
+		case Variant::FLOAT:
+		case Variant::VECTOR2:
+		case Variant::VECTOR2I:
+		case Variant::RECT2:
+		case Variant::RECT2I:
+		case Variant::VECTOR3:
+		case Variant::VECTOR3I:
+		case Variant::TRANSFORM2D:
+		case Variant::VECTOR4:
+		case Variant::VECTOR4I:
+		case Variant::PLANE:
+		case Variant::QUATERNION:
+		case Variant::AABB:
+		case Variant::BASIS:
+		case Variant::TRANSFORM3D:
+		case Variant::PROJECTION:
+		case Variant::COLOR:
+			break;
+		default:
+			return false;
+	}
+
+	Vector<int> &indices = temporaries.write[p_source.address].bytecode_indices;
+	ERR_FAIL_COND_V(indices.is_empty() || indices[indices.size() - 1] != last_operator_result.target_pos, false);
+	indices.remove_at(indices.size() - 1);
+	opcodes.write[last_operator_result.target_pos] = address_of(p_target);
+	last_operator_result = OperatorResult();
+	return true;
+}
+
 void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Address &p_source) {
+	if (forward_operator_result(p_target, p_source)) {
+		return;
+	}
+	mark_local_initialized(p_target);
+
 	if (p_target.type.kind == GDScriptDataType::BUILTIN && p_target.type.builtin_type == Variant::ARRAY && p_target.type.has_container_element_type(0)) {
 		const GDScriptDataType &element_type = p_target.type.get_container_element_type(0);
 		append_opcode(GDScriptFunction::OPCODE_ASSIGN_TYPED_ARRAY);
@@ -1025,6 +1125,9 @@ void GDScriptByteCodeGenerator::write_assign_default_parameter(const Address &p_
 void GDScriptByteCodeGenerator::write_store_global(const Address &p_dst, int p_global_index) {
 	append_opcode(GDScriptFunction::OPCODE_STORE_GLOBAL);
 	append(p_dst);
+#ifdef TOOLS_ENABLED
+	function->global_index_positions.push_back(opcodes.size());
+#endif
 	append(p_global_index);
 }
 
@@ -1863,10 +1966,19 @@ void GDScriptByteCodeGenerator::write_return(const Address &p_return_value) {
 	}
 }
 
+void GDScriptByteCodeGenerator::write_assert_begin() {
+	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_RELEASE);
+	assert_jmp_addrs.push_back(opcodes.size());
+	append(0); // Jump destination, will be patched.
+}
+
 void GDScriptByteCodeGenerator::write_assert(const Address &p_test, const Address &p_message) {
 	append_opcode(GDScriptFunction::OPCODE_ASSERT);
 	append(p_test);
 	append(p_message);
+
+	patch_jump(assert_jmp_addrs.back()->get());
+	assert_jmp_addrs.pop_back();
 }
 
 void GDScriptByteCodeGenerator::start_block() {
@@ -1925,6 +2037,7 @@ void GDScriptByteCodeGenerator::clear_address(const Address &p_address) {
 
 	if (p_address.mode == Address::LOCAL_VARIABLE) {
 		dirty_locals.erase(p_address.address);
+		initialized_locals.insert(p_address.address);
 	}
 }
 
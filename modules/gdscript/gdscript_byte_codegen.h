@@ -84,12 +84,22 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	Vector<StackSlot> locals;
 	HashSet<int> dirty_locals;
+	HashSet<int> initialized_locals;
 
 	Vector<StackSlot> temporaries;
 	List<int> used_temporaries;
 	HashSet<int> temporaries_pending_clear;
 	RBMap<Variant::Type, List<int>> temporaries_pool;
 
+	// Last validated operator whose result went into a temporary of the exact result type.
+	// An assignment emitted right after it can write straight into the local instead.
+	struct OperatorResult {
+		int temporary = -1;
+		int target_pos = -1;
+		int end_pos = -1;
+	} last_operator_result;
+	static inline bool operator_result_forwarding = true;
+
 	List<GDScriptFunction::StackDebug> stack_debug;
 	List<RBMap<StringName, int>> block_identifier_stack;
 	RBMap<StringName, int> block_identifiers;
@@ -157,6 +167,8 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	List<List<int>> current_breaks_to_patch;
 
+	List<int> assert_jmp_addrs;
+
 	void add_stack_identifier(const StringName &p_id, int p_stackpos) {
 		if (locals.size() > max_locals) {
 			max_locals = locals.size();
@@ -195,6 +207,7 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 #endif
 		for (int i = current_locals; i < locals.size(); i++) {
 			dirty_locals.insert(i + GDScriptFunction::FIXED_ADDRESSES_MAX);
+			initialized_locals.erase(i + GDScriptFunction::FIXED_ADDRESSES_MAX);
 		}
 		locals.resize(current_locals);
 		if (GDScriptLanguage::get_singleton()->should_track_locals()) {
@@ -450,6 +463,14 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		opcodes.write[p_address] = opcodes.size();
 	}
 
+	void mark_local_initialized(const Address &p_address) {
+		if (p_address.mode == Address::LOCAL_VARIABLE) {
+			initialized_locals.insert(p_address.address);
+		}
+	}
+
+	bool forward_operator_result(const Address &p_target, const Address &p_source);
+
 public:
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
@@ -547,7 +568,12 @@ public:
 	virtual void write_breakpoint() override;
 	virtual void write_newline(int p_line) override;
 	virtual void write_return(const Address &p_return_value) override;
+	virtual void write_assert_begin() override;
 	virtual void write_assert(const Address &p_test, const Address &p_message) override;
 
+	// Only meant to be disabled to measure the effect of the optimization.
+	static void set_operator_result_forwarding_enabled(bool p_enabled) { operator_result_forwarding = p_enabled; }
+	static bool is_operator_result_forwarding_enabled() { return operator_result_forwarding; }
+
 	virtual ~GDScriptByteCodeGenerator();
 };
@@ -0,0 +1,1643 @@
+/**************************************************************************/
+/*  gdscript_bytecode.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_bytecode.h"
+
+#include "gdscript.h"
+#include "gdscript_cache.h"
+
+#include "core/config/engine.h"
+#include "core/io/marshalls.h"
+#include "core/io/resource_loader.h"
+#include "core/object/class_db.h"
+#include "core/version.h"
+
+#ifdef DEBUG_ENABLED
+#include "core/debugger/engine_debugger.h"
+#endif
+
+class GDScriptBytecodeReader {
+	const uint8_t *data = nullptr;
+	uint32_t size = 0;
+	uint32_t position = 0;
+	bool failed = false;
+
+public:
+	_FORCE_INLINE_ bool has_failed() const { return failed; }
+	_FORCE_INLINE_ bool is_at_end() const { return position == size; }
+
+	uint8_t get_u8() {
+		if (unlikely(position >= size)) {
+			failed = true;
+			return 0;
+		}
+		return data[position++];
+	}
+
+	uint32_t get_u32() {
+		if (unlikely(size - position < 4)) {
+			failed = true;
+			return 0;
+		}
+		uint32_t value = decode_uint32(data + position);
+		position += 4;
+		return value;
+	}
+
+	int32_t get_i32() {
+		return int32_t(get_u32());
+	}
+
+	// Counts can't exceed the remaining data, so corrupted files don't cause huge allocations.
+	uint32_t get_count() {
+		uint32_t count = get_u32();
+		if (unlikely(count > size - position)) {
+			failed = true;
+			return 0;
+		}
+		return count;
+	}
+
+	String get_string() {
+		uint32_t length = get_count();
+		if (failed || length == 0) {
+			return String();
+		}
+		String string = String::utf8(reinterpret_cast<const char *>(data + position), length);
+		position += length;
+		return string;
+	}
+
+	StringName get_string_name() {
+		return StringName(get_string());
+	}
+
+	Variant get_variant() {
+		uint32_t length = get_count();
+		Variant value;
+		if (failed || decode_variant(value, data + position, length) != OK) {
+			failed = true;
+			return Variant();
+		}
+		position += length;
+		return value;
+	}
+
+	GDScriptBytecodeReader(const Vector<uint8_t> &p_buffer) {
+		data = p_buffer.ptr();
+		size = p_buffer.size();
+	}
+};
+
+struct GDScriptBytecode::LoadState {
+	GDScriptBytecodeReader reader;
+	GDScript *root = nullptr;
+	LocalVector<GDScriptFunction *> functions;
+	LocalVector<bool> owned; // Whether the function was handed over to its script or its enclosing function.
+
+	LoadState(const Vector<uint8_t> &p_buffer) :
+			reader(p_buffer) {}
+};
+
+template <typename T>
+static void _bind_table(const Vector<T> &p_table, int &r_count, const T *&r_ptr) {
+	r_count = p_table.size();
+	r_ptr = p_table.is_empty() ? nullptr : p_table.ptr();
+}
+
+static PropertyInfo _read_property_info(GDScriptBytecodeReader &p_reader) {
+	PropertyInfo info;
+	info.type = Variant::Type(MIN(p_reader.get_u32(), uint32_t(Variant::VARIANT_MAX - 1)));
+	info.name = p_reader.get_string();
+	info.class_name = p_reader.get_string_name();
+	info.hint = PropertyHint(MIN(p_reader.get_u32(), uint32_t(PROPERTY_HINT_MAX - 1)));
+	info.hint_string = p_reader.get_string();
+	info.usage = p_reader.get_u32();
+	return info;
+}
+
+String GDScriptBytecode::get_build_id() {
+	return String(GODOT_VERSION_FULL_BUILD) + "." + GODOT_VERSION_HASH;
+}
+
+uint32_t GDScriptBytecode::get_build_flags() {
+	uint32_t flags = 0;
+#ifdef DEBUG_ENABLED
+	flags |= FLAG_DEBUG;
+#endif
+	return flags;
+}
+
+bool GDScriptBytecode::_read_header(GDScriptBytecodeReader &p_reader, const GDScript *p_script) {
+	if (p_reader.get_u8() != 'G' || p_reader.get_u8() != 'D' || p_reader.get_u8() != 'B' || p_reader.get_u8() != 'C') {
+		return false;
+	}
+	if (p_reader.get_u32() != FORMAT_VERSION) {
+		return false;
+	}
+	if (p_reader.get_string() != get_build_id()) {
+		return false;
+	}
+	// Release builds also run debug bytecode, but debug builds need the asserts.
+	const uint32_t flags = p_reader.get_u32();
+	if ((flags & ~uint32_t(FLAG_DEBUG)) != 0 || (get_build_flags() & ~flags) != 0) {
+		return false;
+	}
+	if (p_script != nullptr && p_reader.get_string() != p_script->path) {
+		return false;
+	}
+	return !p_reader.has_failed();
+}
+
+bool GDScriptBytecode::is_compatible(const Vector<uint8_t> &p_buffer) {
+	GDScriptBytecodeReader reader(p_buffer);
+	return _read_header(reader, nullptr);
+}
+
+void GDScriptBytecode::_read_scripts(GDScriptBytecodeReader &p_reader, GDScript *p_script) {
+	p_script->fully_qualified_name = p_reader.get_string();
+	p_script->local_name = p_reader.get_string_name();
+	p_script->global_name = p_reader.get_string_name();
+	p_script->simplified_icon_path = p_reader.get_string();
+
+	HashMap<StringName, Ref<GDScript>> old_subclasses = p_script->subclasses;
+	p_script->subclasses.clear();
+
+	uint32_t subclass_count = p_reader.get_count();
+	for (uint32_t i = 0; i < subclass_count && !p_reader.has_failed(); i++) {
+		StringName name = p_reader.get_string_name();
+
+		Ref<GDScript> subclass;
+		if (old_subclasses.has(name)) {
+			subclass = old_subclasses[name];
+		} else {
+			subclass.instantiate();
+		}
+
+		subclass->_owner = p_script;
+		subclass->path = p_script->path;
+		p_script->subclasses.insert(name, subclass);
+
+		_read_scripts(p_reader, subclass.ptr());
+	}
+}
+
+Error GDScriptBytecode::make_scripts(GDScript *p_script, const Vector<uint8_t> &p_buffer) {
+	ERR_FAIL_NULL_V(p_script, ERR_INVALID_PARAMETER);
+
+	GDScriptBytecodeReader reader(p_buffer);
+	if (!_read_header(reader, p_script)) {
+		return ERR_INVALID_DATA;
+	}
+	_read_scripts(reader, p_script);
+	return reader.has_failed() ? ERR_INVALID_DATA : OK;
+}
+
+GDScript *GDScriptBytecode::_resolve_script(LoadState &p_state, const String &p_path, const String &p_fully_qualified_name) {
+	if (p_path == p_state.root->path) {
+		return p_state.root->find_class(p_fully_qualified_name);
+	}
+
+	// Registered as a dependency, so it gets fully loaded by `GDScriptCache::finish_compiling()`.
+	Error err = OK;
+	Ref<GDScript> script = GDScriptCache::get_shallow_script(p_path, err, p_state.root->path);
+	if (err != OK || script.is_null()) {
+		return nullptr;
+	}
+	return script->find_class(p_fully_qualified_name);
+}
+
+bool GDScriptBytecode::_read_value(LoadState &p_state, Variant &r_value, int p_depth) {
+	GDScriptBytecodeReader &reader = p_state.reader;
+	if (p_depth > Variant::MAX_RECURSION_DEPTH) {
+		return false;
+	}
+
+	switch (reader.get_u8()) {
+		case VALUE_VARIANT: {
+			r_value = reader.get_variant();
+		} break;
+		case VALUE_NULL_OBJECT: {
+			r_value = (Object *)nullptr;
+		} break;
+		case VALUE_ARRAY: {
+			bool read_only = reader.get_u8();
+			uint32_t typed_builtin = reader.get_u32();
+			StringName typed_class_name = reader.get_string_name();
+			Variant typed_script;
+			if (!_read_value(p_state, typed_script, p_depth + 1) || typed_builtin >= Variant::VARIANT_MAX) {
+				return false;
+			}
+
+			Array array;
+			if (typed_builtin != Variant::NIL) {
+				array.set_typed(typed_builtin, typed_class_name, typed_script);
+			}
+			uint32_t size = reader.get_count();
+			array.resize(size);
+			for (uint32_t i = 0; i < size; i++) {
+				Variant element;
+				if (!_read_value(p_state, element, p_depth + 1)) {
+					return false;
+				}
+				array.set(i, element);
+			}
+			if (read_only) {
+				array.make_read_only();
+			}
+			r_value = array;
+		} break;
+		case VALUE_DICTIONARY: {
+			bool read_only = reader.get_u8();
+			uint32_t key_builtin = reader.get_u32();
+			StringName key_class_name = reader.get_string_name();
+			Variant key_script;
+			if (!_read_value(p_state, key_script, p_depth + 1) || key_builtin >= Variant::VARIANT_MAX) {
+				return false;
+			}
+			uint32_t value_builtin = reader.get_u32();
+			StringName value_class_name = reader.get_string_name();
+			Variant value_script;
+			if (!_read_value(p_state, value_script, p_depth + 1) || value_builtin >= Variant::VARIANT_MAX) {
+				return false;
+			}
+
+			Dictionary dictionary;
+			if (key_builtin != Variant::NIL || value_builtin != Variant::NIL) {
+				dictionary.set_typed(key_builtin, key_class_name, key_script, value_builtin, value_class_name, value_script);
+			}
+			uint32_t size = reader.get_count();
+			for (uint32_t i = 0; i < size; i++) {
+				Variant key;
+				Variant value;
+				if (!_read_value(p_state, key, p_depth + 1) || !_read_value(p_state, value, p_depth + 1)) {
+					return false;
+				}
+				dictionary[key] = value;
+			}
+			if (read_only) {
+				dictionary.make_read_only();
+			}
+			r_value = dictionary;
+		} break;
+		case VALUE_NATIVE_CLASS: {
+			const int *index = GDScriptLanguage::get_singleton()->get_global_map().getptr(reader.get_string_name());
+			if (index == nullptr) {
+				return false;
+			}
+			r_value = GDScriptLanguage::get_singleton()->get_global_array()[*index];
+			if (Object::cast_to<GDScriptNativeClass>(r_value.get_validated_object()) == nullptr) {
+				return false;
+			}
+		} break;
+		case VALUE_SCRIPT: {
+			String path = reader.get_string();
+			String fully_qualified_name = reader.get_string();
+			if (reader.has_failed()) {
+				return false;
+			}
+			GDScript *script = _resolve_script(p_state, path, fully_qualified_name);
+			if (script == nullptr) {
+				return false;
+			}
+			r_value = Ref<GDScript>(script);
+		} break;
+		case VALUE_RESOURCE: {
+			String path = reader.get_string();
+			if (reader.has_failed()) {
+				return false;
+			}
+			Ref<Resource> resource = ResourceLoader::load(path);
+			if (resource.is_null()) {
+				return false;
+			}
+			r_value = resource;
+		} break;
+		case VALUE_SINGLETON: {
+			StringName name = reader.get_string_name();
+			if (!Engine::get_singleton()->has_singleton(name)) {
+				return false;
+			}
+			r_value = Engine::get_singleton()->get_singleton_object(name);
+		} break;
+		default: {
+			return false;
+		}
+	}
+
+	return !reader.has_failed();
+}
+
+bool GDScriptBytecode::_read_data_type(LoadState &p_state, GDScriptDataType &r_type) {
+	GDScriptBytecodeReader &reader = p_state.reader;
+
+	r_type.has_type = reader.get_u8();
+	uint32_t kind = reader.get_u8();
+	uint32_t builtin_type = reader.get_u32();
+	if (kind > GDScriptDataType::GDSCRIPT || builtin_type >= Variant::VARIANT_MAX) {
+		return false;
+	}
+	r_type.kind = GDScriptDataType::Kind(kind);
+	r_type.builtin_type = Variant::Type(builtin_type);
+	r_type.native_type = reader.get_string_name();
+
+	if (r_type.kind == GDScriptDataType::SCRIPT || r_type.kind == GDScriptDataType::GDSCRIPT) {
+		Variant script;
+		if (!_read_value(p_state, script)) {
+			return false;
+		}
+		bool strong_reference = reader.get_u8();
+		r_type.script_type = Object::cast_to<Script>(script.get_validated_object());
+		if (strong_reference) {
+			r_type.script_type_ref = Ref<Script>(r_type.script_type);
+		}
+	}
+
+	uint32_t element_count = reader.get_count();
+	r_type.container_element_types.resize(element_count);
+	for (uint32_t i = 0; i < element_count; i++) {
+		if (!_read_data_type(p_state, r_type.container_element_types.write[i])) {
+			return false;
+		}
+	}
+
+	return !reader.has_failed();
+}
+
+bool GDScriptBytecode::_read_member_info(LoadState &p_state, GDScript::MemberInfo &r_info) {
+	GDScriptBytecodeReader &reader = p_state.reader;
+
+	r_info.index = reader.get_i32();
+	r_info.setter = reader.get_string_name();
+	r_info.getter = reader.get_string_name();
+	if (!_read_data_type(p_state, r_info.data_type)) {
+		return false;
+	}
+	r_info.property_info = _read_property_info(reader);
+	return !reader.has_failed();
+}
+
+bool GDScriptBytecode::_read_method_info(LoadState &p_state, MethodInfo &r_info) {
+	GDScriptBytecodeReader &reader = p_state.reader;
+
+	r_info.name = reader.get_string();
+	r_info.return_val = _read_property_info(reader);
+	r_info.flags = reader.get_u32();
+	r_info.id = reader.get_i32();
+	r_info.return_val_metadata = reader.get_i32();
+
+	uint32_t argument_count = reader.get_count();
+	for (uint32_t i = 0; i < argument_count && !reader.has_failed(); i++) {
+		r_info.arguments.push_back(_read_property_info(reader));
+	}
+	uint32_t default_argument_count = reader.get_count();
+	for (uint32_t i = 0; i < default_argument_count; i++) {
+		Variant value;
+		if (!_read_value(p_state, value)) {
+			return false;
+		}
+		r_info.default_arguments.push_back(value);
+	}
+	uint32_t metadata_count = reader.get_count();
+	for (uint32_t i = 0; i < metadata_count && !reader.has_failed(); i++) {
+		r_info.arguments_metadata.push_back(reader.get_i32());
+	}
+
+	return !reader.has_failed();
+}
+
+GDScriptFunction *GDScriptBytecode::_take_function(LoadState &p_state, int p_id) {
+	if (p_id < 0 || p_id >= int(p_state.functions.size()) || p_state.owned[p_id]) {
+		return nullptr;
+	}
+	p_state.owned[p_id] = true;
+	return p_state.functions[p_id];
+}
+
+GDScriptFunction *GDScriptBytecode::_read_function(LoadState &p_state, GDScript *p_script) {
+	GDScriptBytecodeReader &reader = p_state.reader;
+
+	GDScriptFunction *function = memnew(GDScriptFunction);
+	p_state.functions.push_back(function);
+	p_state.owned.push_back(false);
+
+	function->_script = p_script;
+	function->name = reader.get_string_name();
+	function->source = p_script->get_script_path();
+
+	uint8_t function_flags = reader.get_u8();
+	function->_static = function_flags & 1;
+	function->_initial_line = reader.get_i32();
+	function->_argument_count = reader.get_i32();
+	function->_stack_size = reader.get_i32();
+	function->_instruction_args_size = reader.get_i32();
+	if (function->_stack_size < GDScriptFunction::FIXED_ADDRESSES_MAX || function->_argument_count < 0 || function->_instruction_args_size < 0) {
+		return nullptr;
+	}
+
+#ifdef DEBUG_ENABLED
+	function->func_cname = (String(function->source) + " - " + String(function->name)).utf8();
+	function->_func_cname = function->func_cname.get_data();
+
+	if (EngineDebugger::is_active()) {
+		String signature = String(function->source) + "::" + itos(function->_initial_line) + "::";
+		if (p_script->local_name != StringName()) {
+			signature += String(p_script->local_name) + ".";
+		}
+		signature += String(function->name);
+		if (function_flags & 2) {
+			signature += "(lambda)";
+		}
+		function->profile.signature = signature;
+	}
+#endif
+
+	if (!_read_data_type(p_state, function->return_type)) {
+		return nullptr;
+	}
+	uint32_t argument_type_count = reader.get_count();
+	function->argument_types.resize(argument_type_count);
+	for (uint32_t i = 0; i < argument_type_count; i++) {
+		if (!_read_data_type(p_state, function->argument_types.write[i])) {
+			return nullptr;
+		}
+	}
+	if (!_read_method_info(p_state, function->method_info) || !_read_value(p_state, function->rpc_config)) {
+		return nullptr;
+	}
+
+	uint32_t temporary_count = reader.get_count();
+	for (uint32_t i = 0; i < temporary_count; i++) {
+		int slot = reader.get_i32();
+		uint32_t type = reader.get_u32();
+		if (type >= Variant::VARIANT_MAX) {
+			return nullptr;
+		}
+		function->temporary_slots[slot] = Variant::Type(type);
+	}
+
+	uint32_t stack_debug_count = reader.get_count();
+	bool track_locals = GDScriptLanguage::get_singleton()->should_track_locals();
+	for (uint32_t i = 0; i < stack_debug_count && !reader.has_failed(); i++) {
+		GDScriptFunction::StackDebug stack_debug;
+		stack_debug.line = reader.get_i32();
+		stack_debug.pos = reader.get_i32();
+		stack_debug.added = reader.get_u8();
+		stack_debug.identifier = reader.get_string_name();
+		if (track_locals) {
+			function->stack_debug.push_back(stack_debug);
+		}
+	}
+
+	uint32_t code_size = reader.get_count();
+	if (code_size == 0) {
+		return nullptr;
+	}
+	function->code.resize(code_size);
+	int *code = function->code.ptrw();
+	for (uint32_t i = 0; i < code_size; i++) {
+		code[i] = reader.get_i32();
+	}
+
+	// Indices into the global array depend on the order in which the running binary registered its globals.
+	uint32_t relocation_count = reader.get_count();
+	for (uint32_t i = 0; i < relocation_count; i++) {
+		uint32_t position = reader.get_u32();
+		const int *global_index = GDScriptLanguage::get_singleton()->get_global_map().getptr(reader.get_string_name());
+		if (position >= code_size || global_index == nullptr) {
+			return nullptr;
+		}
+		code[position] = *global_index;
+	}
+
+	uint32_t default_argument_count = reader.get_count();
+	for (uint32_t i = 0; i < default_argument_count; i++) {
+		int position = reader.get_i32();
+		if (position < 0 || position >= int(code_size)) {
+			return nullptr;
+		}
+		function->default_arguments.push_back(position);
+	}
+
+	uint32_t validated_operator_count = reader.get_count();
+	for (uint32_t i = 0; i < validated_operator_count; i++) {
+		int position = reader.get_i32();
+		if (position < 0 || position + 5 > int(code_size)) {
+			return nullptr;
+		}
+		function->validated_operator_positions.push_back(position);
+	}
+
+	uint32_t property_site_count = reader.get_count();
+	for (uint32_t i = 0; i < property_site_count && !reader.has_failed(); i++) {
+		function->property_site_members.push_back(reader.get_string_name());
+	}
+
+	uint32_t constant_count = reader.get_count();
+	function->constants.resize(constant_count);
+	for (uint32_t i = 0; i < constant_count; i++) {
+		if (!_read_value(p_state, function->constants.write[i])) {
+			return nullptr;
+		}
+	}
+
+	uint32_t global_name_count = reader.get_count();
+	for (uint32_t i = 0; i < global_name_count && !reader.has_failed(); i++) {
+		function->global_names.push_back(reader.get_string_name());
+	}
+
+	uint32_t operator_count = reader.get_count();
+	for (uint32_t i = 0; i < operator_count; i++) {
+		uint32_t op = reader.get_u8();
+		uint32_t type_a = reader.get_u8();
+		uint32_t type_b = reader.get_u8();
+		if (op >= Variant::OP_MAX || type_a >= Variant::VARIANT_MAX || type_b >= Variant::VARIANT_MAX) {
+			return nullptr;
+		}
+		Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator(Variant::Operator(op), Variant::Type(type_a), Variant::Type(type_b));
+		if (evaluator == nullptr) {
+			return nullptr;
+		}
+		function->operator_funcs.push_back(evaluator);
+#ifdef DEBUG_ENABLED
+		function->operator_names.push_back(Variant::get_operator_name(Variant::Operator(op)));
+#endif
+	}
+
+	uint32_t setter_count = reader.get_count();
+	for (uint32_t i = 0; i < setter_count; i++) {
+		uint32_t type = reader.get_u8();
+		StringName member = reader.get_string_name();
+		Variant::ValidatedSetter setter = type < Variant::VARIANT_MAX ? Variant::get_member_validated_setter(Variant::Type(type), member) : nullptr;
+		if (setter == nullptr) {
+			return nullptr;
+		}
+		function->setters.push_back(setter);
+#ifdef DEBUG_ENABLED
+		function->setter_names.push_back(member);
+#endif
+	}
+
+	uint32_t getter_count = reader.get_count();
+	for (uint32_t i = 0; i < getter_count; i++) {
+		uint32_t type = reader.get_u8();
+		StringName member = reader.get_string_name();
+		Variant::ValidatedGetter getter = type < Variant::VARIANT_MAX ? Variant::get_member_validated_getter(Variant::Type(type), member) : nullptr;
+		if (getter == nullptr) {
+			return nullptr;
+		}
+		function->getters.push_back(getter);
+#ifdef DEBUG_ENABLED
+		function->getter_names.push_back(member);
+#endif
+	}
+
+	uint32_t keyed_setter_count = reader.get_count();
+	for (uint32_t i = 0; i < keyed_setter_count; i++) {
+		uint32_t type = reader.get_u8();
+		Variant::ValidatedKeyedSetter setter = type < Variant::VARIANT_MAX ? Variant::get_member_validated_keyed_setter(Variant::Type(type)) : nullptr;
+		if (setter == nullptr) {
+			return nullptr;
+		}
+		function->keyed_setters.push_back(setter);
+	}
+
+	uint32_t keyed_getter_count = reader.get_count();
+	for (uint32_t i = 0; i < keyed_getter_count; i++) {
+		uint32_t type = reader.get_u8();
+		Variant::ValidatedKeyedGetter getter = type < Variant::VARIANT_MAX ? Variant::get_member_validated_keyed_getter(Variant::Type(type)) : nullptr;
+		if (getter == nullptr) {
+			return nullptr;
+		}
+		function->keyed_getters.push_back(getter);
+	}
+
+	uint32_t indexed_setter_count = reader.get_count();
+	for (uint32_t i = 0; i < indexed_setter_count; i++) {
+		uint32_t type = reader.get_u8();
+		Variant::ValidatedIndexedSetter setter = type < Variant::VARIANT_MAX ? Variant::get_member_validated_indexed_setter(Variant::Type(type)) : nullptr;
+		if (setter == nullptr) {
+			return nullptr;
+		}
+		function->indexed_setters.push_back(setter);
+	}
+
+	uint32_t indexed_getter_count = reader.get_count();
+	for (uint32_t i = 0; i < indexed_getter_count; i++) {
+		uint32_t type = reader.get_u8();
+		Variant::ValidatedIndexedGetter getter = type < Variant::VARIANT_MAX ? Variant::get_member_validated_indexed_getter(Variant::Type(type)) : nullptr;
+		if (getter == nullptr) {
+			return nullptr;
+		}
+		function->indexed_getters.push_back(getter);
+	}
+
+	uint32_t builtin_method_count = reader.get_count();
+	for (uint32_t i = 0; i < builtin_method_count; i++) {
+		uint32_t type = reader.get_u8();
+		StringName method = reader.get_string_name();
+		Variant::ValidatedBuiltInMethod builtin_method = type < Variant::VARIANT_MAX ? Variant::get_validated_builtin_method(Variant::Type(type), method) : nullptr;
+		if (builtin_method == nullptr) {
+			return nullptr;
+		}
+		function->builtin_methods.push_back(builtin_method);
+#ifdef DEBUG_ENABLED
+		function->builtin_methods_names.push_back(method);
+#endif
+	}
+
+	uint32_t constructor_count = reader.get_count();
+	for (uint32_t i = 0; i < constructor_count; i++) {
+		uint32_t type = reader.get_u8();
+		int index = reader.get_i32();
+		if (type >= Variant::VARIANT_MAX || index < 0 || index >= Variant::get_constructor_count(Variant::Type(type))) {
+			return nullptr;
+		}
+		function->constructors.push_back(Variant::get_validated_constructor(Variant::Type(type), index));
+#ifdef DEBUG_ENABLED
+		function->constructors_names.push_back(Variant::get_type_name(Variant::Type(type)));
+#endif
+	}
+
+	uint32_t utility_count = reader.get_count();
+	for (uint32_t i = 0; i < utility_count; i++) {
+		StringName utility_name = reader.get_string_name();
+		Variant::ValidatedUtilityFunction utility = Variant::get_validated_utility_function(utility_name);
+		if (utility == nullptr) {
+			return nullptr;
+		}
+		function->utilities.push_back(utility);
+#ifdef DEBUG_ENABLED
+		function->utilities_names.push_back(utility_name);
+#endif
+	}
+
+	uint32_t gds_utility_count = reader.get_count();
+	for (uint32_t i = 0; i < gds_utility_count; i++) {
+		StringName utility_name = reader.get_string_name();
+		GDScriptUtilityFunctions::FunctionPtr utility = GDScriptUtilityFunctions::get_function(utility_name);
+		if (utility == nullptr) {
+			return nullptr;
+		}
+		function->gds_utilities.push_back(utility);
+#ifdef DEBUG_ENABLED
+		function->gds_utilities_names.push_back(utility_name);
+#endif
+	}
+
+	uint32_t method_count = reader.get_count();
+	for (uint32_t i = 0; i < method_count; i++) {
+		StringName class_name = reader.get_string_name();
+		StringName method_name = reader.get_string_name();
+		MethodBind *method = ClassDB::get_method(class_name, method_name);
+		if (method == nullptr) {
+			return nullptr;
+		}
+		function->methods.push_back(method);
+	}
+
+	uint32_t lambda_count = reader.get_count();
+	for (uint32_t i = 0; i < lambda_count; i++) {
+		GDScriptFunction *lambda = _take_function(p_state, reader.get_i32());
+		if (lambda == nullptr) {
+			return nullptr;
+		}
+		function->lambdas.push_back(lambda);
+	}
+
+	if (reader.has_failed()) {
+		return nullptr;
+	}
+
+	// Same pointer setup as `GDScriptByteCodeGenerator::write_end()`.
+	function->_code_ptr = code;
+	function->_code_size = code_size;
+	function->_constant_count = function->constants.size();
+	function->_constants_ptr = function->constants.is_empty() ? nullptr : function->constants.ptrw();
+	if (function->default_arguments.size()) {
+		function->_default_arg_count = function->default_arguments.size() - 1;
+		function->_default_arg_ptr = function->default_arguments.ptr();
+	}
+	_bind_table(function->global_names, function->_global_names_count, function->_global_names_ptr);
+	if (function->_global_names_count) {
+		function->_call_sites_ptr = memnew_arr(VariantCallSite, function->_global_names_count);
+		for (int i = 0; i < function->_global_names_count; i++) {
+			function->_call_sites_ptr[i].set_method(function->global_names[i]);
+		}
+	}
+	function->_property_sites_count = function->property_site_members.size();
+	if (function->_property_sites_count) {
+		function->_property_sites_ptr = memnew_arr(GDScriptFunction::PropertySite, function->_property_sites_count);
+		for (int i = 0; i < function->_property_sites_count; i++) {
+			function->_property_sites_ptr[i].native.set_member(function->property_site_members[i]);
+		}
+	}
+	_bind_table(function->operator_funcs, function->_operator_funcs_count, function->_operator_funcs_ptr);
+	_bind_table(function->setters, function->_setters_count, function->_setters_ptr);
+	_bind_table(function->getters, function->_getters_count, function->_getters_ptr);
+	_bind_table(function->keyed_setters, function->_keyed_setters_count, function->_keyed_setters_ptr);
+	_bind_table(function->keyed_getters, function->_keyed_getters_count, function->_keyed_getters_ptr);
+	_bind_table(function->indexed_setters, function->_indexed_setters_count, function->_indexed_setters_ptr);
+	_bind_table(function->indexed_getters, function->_indexed_getters_count, function->_indexed_getters_ptr);
+	_bind_table(function->builtin_methods, function->_builtin_methods_count, function->_builtin_methods_ptr);
+	_bind_table(function->constructors, function->_constructors_count, function->_constructors_ptr);
+	_bind_table(function->utilities, function->_utilities_count, function->_utilities_ptr);
+	_bind_table(function->gds_utilities, function->_gds_utilities_count, function->_gds_utilities_ptr);
+	function->_methods_count = function->methods.size();
+	function->_methods_ptr = function->methods.is_empty() ? nullptr : function->methods.ptrw();
+	function->_lambdas_count = function->lambdas.size();
+	function->_lambdas_ptr = function->lambdas.is_empty() ? nullptr : function->lambdas.ptrw();
+
+	return function;
+}
+
+bool GDScriptBytecode::_read_class(LoadState &p_state, GDScript *p_script) {
+	GDScriptBytecodeReader &reader = p_state.reader;
+	GDScriptLanguage *language = GDScriptLanguage::get_singleton();
+
+	p_script->tool = reader.get_u8();
+	p_script->_is_abstract = reader.get_u8();
+
+	const int *native_index = language->get_global_map().getptr(reader.get_string_name());
+	if (native_index == nullptr) {
+		return false;
+	}
+	p_script->native = language->get_global_array()[*native_index];
+	if (p_script->native.is_null()) {
+		return false;
+	}
+
+	if (reader.get_u8()) {
+		String path = reader.get_string();
+		String fully_qualified_name = reader.get_string();
+		GDScript *base = reader.has_failed() ? nullptr : _resolve_script(p_state, path, fully_qualified_name);
+		if (base == nullptr) {
+			return false;
+		}
+		p_script->base = Ref<GDScript>(base);
+		p_script->_base = base;
+	}
+
+	uint32_t member_count = reader.get_count();
+	for (uint32_t i = 0; i < member_count; i++) {
+		StringName name = reader.get_string_name();
+		if (!_read_member_info(p_state, p_script->member_indices[name])) {
+			return false;
+		}
+	}
+
+	uint32_t own_member_count = reader.get_count();
+	for (uint32_t i = 0; i < own_member_count && !reader.has_failed(); i++) {
+		p_script->members.insert(reader.get_string_name());
+	}
+
+	uint32_t static_variable_count = reader.get_count();
+	for (uint32_t i = 0; i < static_variable_count; i++) {
+		StringName name = reader.get_string_name();
+		GDScript::MemberInfo &info = p_script->static_variables_indices[name];
+		if (!_read_member_info(p_state, info) || info.index < 0 || info.index >= int(static_variable_count)) {
+			return false;
+		}
+	}
+	p_script->static_variables.resize(p_script->static_variables_indices.size());
+
+	uint32_t constant_count = reader.get_count();
+	for (uint32_t i = 0; i < constant_count; i++) {
+		StringName name = reader.get_string_name();
+		Variant value;
+		if (!_read_value(p_state, value)) {
+			return false;
+		}
+		p_script->constants.insert(name, value);
+	}
+
+	uint32_t signal_count = reader.get_count();
+	for (uint32_t i = 0; i < signal_count; i++) {
+		StringName name = reader.get_string_name();
+		MethodInfo info;
+		if (!_read_method_info(p_state, info)) {
+			return false;
+		}
+		p_script->_signals[name] = info;
+	}
+
+	Variant rpc_config;
+	if (!_read_value(p_state, rpc_config) || rpc_config.get_type() != Variant::DICTIONARY) {
+		return false;
+	}
+	p_script->rpc_config = rpc_config;
+
+	uint32_t function_count = reader.get_count();
+	for (uint32_t i = 0; i < function_count; i++) {
+		if (_read_function(p_state, p_script) == nullptr) {
+			return false;
+		}
+	}
+
+	uint32_t member_function_count = reader.get_count();
+	for (uint32_t i = 0; i < member_function_count; i++) {
+		StringName name = reader.get_string_name();
+		GDScriptFunction *function = _take_function(p_state, reader.get_i32());
+		if (function == nullptr) {
+			return false;
+		}
+		p_script->member_functions[name] = function;
+	}
+
+	int initializer_id = reader.get_i32();
+	if (initializer_id >= 0) {
+		// `_init()` is one of the member functions handed over above.
+		if (initializer_id >= int(p_state.functions.size()) || !p_state.owned[initializer_id]) {
+			return false;
+		}
+		p_script->initializer = p_state.functions[initializer_id];
+	}
+
+	GDScriptFunction **special_functions[] = { &p_script->implicit_initializer, &p_script->implicit_ready, &p_script->static_initializer };
+	for (GDScriptFunction **special_function : special_functions) {
+		int id = reader.get_i32();
+		if (id >= 0) {
+			*special_function = _take_function(p_state, id);
+			if (*special_function == nullptr) {
+				return false;
+			}
+		}
+	}
+
+	uint32_t lambda_count = reader.get_count();
+	for (uint32_t i = 0; i < lambda_count; i++) {
+		int id = reader.get_i32();
+		GDScript::LambdaInfo info;
+		info.capture_count = reader.get_i32();
+		info.use_self = reader.get_u8();
+		if (id < 0 || id >= int(p_state.functions.size())) {
+			return false;
+		}
+		p_script->lambda_info.insert(p_state.functions[id], info);
+	}
+
+	uint32_t subclass_count = reader.get_count();
+	for (uint32_t i = 0; i < subclass_count; i++) {
+		HashMap<StringName, Ref<GDScript>>::Iterator subclass = p_script->subclasses.find(reader.get_string_name());
+		if (!subclass || !_read_class(p_state, subclass->value.ptr())) {
+			return false;
+		}
+		p_script->constants.insert(subclass->key, subclass->value);
+	}
+
+	return !reader.has_failed();
+}
+
+void GDScriptBytecode::_finish_class(GDScript *p_script) {
+	for (KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		_finish_class(E.value.ptr());
+	}
+	p_script->_static_default_init();
+	p_script->valid = true;
+}
+
+Error GDScriptBytecode::load(GDScript *p_script, const Vector<uint8_t> &p_buffer) {
+	ERR_FAIL_NULL_V(p_script, ERR_INVALID_PARAMETER);
+
+	LoadState state(p_buffer);
+	state.root = p_script;
+	if (!_read_header(state.reader, p_script)) {
+		return ERR_INVALID_DATA;
+	}
+	_read_scripts(state.reader, p_script);
+	p_script->_owner = nullptr;
+
+	bool static_cache = state.reader.get_u8();
+	if (state.reader.has_failed() || !_read_class(state, p_script) || !state.reader.is_at_end()) {
+		// Whatever was handed over to the scripts is released when they get compiled from source.
+		for (uint32_t i = 0; i < state.functions.size(); i++) {
+			if (!state.owned[i]) {
+				memdelete(state.functions[i]);
+			}
+		}
+		print_verbose(vformat(R"(GDScript: Compiled bytecode for "%s" can't be used, compiling it from source instead.)", p_script->path));
+		return ERR_INVALID_DATA;
+	}
+
+	_finish_class(p_script);
+
+	if (static_cache) {
+		GDScriptCache::add_static_script(p_script);
+	}
+
+	return GDScriptCache::finish_compiling(p_script->path);
+}
+
+#ifdef TOOLS_ENABLED
+
+class GDScriptBytecodeWriter {
+	LocalVector<uint8_t> data;
+
+	void _put_bytes(const uint8_t *p_bytes, uint32_t p_size) {
+		uint32_t position = data.size();
+		data.resize(position + p_size);
+		memcpy(data.ptr() + position, p_bytes, p_size);
+	}
+
+public:
+	void put_u8(uint8_t p_value) {
+		data.push_back(p_value);
+	}
+
+	void put_u32(uint32_t p_value) {
+		uint8_t bytes[4];
+		encode_uint32(p_value, bytes);
+		_put_bytes(bytes, 4);
+	}
+
+	void put_i32(int32_t p_value) {
+		put_u32(uint32_t(p_value));
+	}
+
+	void put_string(const String &p_string) {
+		CharString utf8 = p_string.utf8();
+		put_u32(utf8.length());
+		_put_bytes(reinterpret_cast<const uint8_t *>(utf8.get_data()), utf8.length());
+	}
+
+	bool put_variant(const Variant &p_value) {
+		int length = 0;
+		if (encode_variant(p_value, nullptr, length) != OK) {
+			return false;
+		}
+		put_u32(length);
+		uint32_t position = data.size();
+		data.resize(position + length);
+		return encode_variant(p_value, data.ptr() + position, length) == OK;
+	}
+
+	Vector<uint8_t> get_data() const {
+		Vector<uint8_t> buffer;
+		buffer.resize(data.size());
+		memcpy(buffer.ptrw(), data.ptr(), data.size());
+		return buffer;
+	}
+};
+
+static void _write_property_info(GDScriptBytecodeWriter &p_writer, const PropertyInfo &p_info) {
+	p_writer.put_u32(p_info.type);
+	p_writer.put_string(p_info.name);
+	p_writer.put_string(p_info.class_name);
+	p_writer.put_u32(p_info.hint);
+	p_writer.put_string(p_info.hint_string);
+	p_writer.put_u32(p_info.usage);
+}
+
+// Generated code only stores function pointers, so map them back to what the loader needs to look them up again.
+void GDScriptBytecodeSerializer::_build_tables() {
+	for (int type_index = 0; type_index < Variant::VARIANT_MAX; type_index++) {
+		Variant::Type type = Variant::Type(type_index);
+
+		for (int op = 0; op < Variant::OP_MAX; op++) {
+			for (int other_index = 0; other_index < Variant::VARIANT_MAX; other_index++) {
+				Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator(Variant::Operator(op), type, Variant::Type(other_index));
+				if (evaluator != nullptr && !operators.has(evaluator)) {
+					operators.insert(evaluator, { Variant::Operator(op), type, Variant::Type(other_index) });
+				}
+			}
+		}
+
+		List<StringName> members;
+		Variant::get_member_list(type, &members);
+		for (const StringName &member : members) {
+			FunctionEntry entry = { type, 0, member };
+			Variant::ValidatedSetter setter = Variant::get_member_validated_setter(type, member);
+			if (setter != nullptr && !setters.has(setter)) {
+				setters.insert(setter, entry);
+			}
+			Variant::ValidatedGetter getter = Variant::get_member_validated_getter(type, member);
+			if (getter != nullptr && !getters.has(getter)) {
+				getters.insert(getter, entry);
+			}
+		}
+
+		FunctionEntry type_entry = { type, 0, StringName() };
+		Variant::ValidatedKeyedSetter keyed_setter = Variant::get_member_validated_keyed_setter(type);
+		if (keyed_setter != nullptr && !keyed_setters.has(keyed_setter)) {
+			keyed_setters.insert(keyed_setter, type_entry);
+		}
+		Variant::ValidatedKeyedGetter keyed_getter = Variant::get_member_validated_keyed_getter(type);
+		if (keyed_getter != nullptr && !keyed_getters.has(keyed_getter)) {
+			keyed_getters.insert(keyed_getter, type_entry);
+		}
+		Variant::ValidatedIndexedSetter indexed_setter = Variant::get_member_validated_indexed_setter(type);
+		if (indexed_setter != nullptr && !indexed_setters.has(indexed_setter)) {
+			indexed_setters.insert(indexed_setter, type_entry);
+		}
+		Variant::ValidatedIndexedGetter indexed_getter = Variant::get_member_validated_indexed_getter(type);
+		if (indexed_getter != nullptr && !indexed_getters.has(indexed_getter)) {
+			indexed_getters.insert(indexed_getter, type_entry);
+		}
+
+		List<StringName> methods;
+		Variant::get_builtin_method_list(type, &methods);
+		for (const StringName &method : methods) {
+			Variant::ValidatedBuiltInMethod builtin_method = Variant::get_validated_builtin_method(type, method);
+			if (builtin_method != nullptr && !builtin_methods.has(builtin_method)) {
+				builtin_methods.insert(builtin_method, { type, 0, method });
+			}
+		}
+
+		for (int i = 0; i < Variant::get_constructor_count(type); i++) {
+			Variant::ValidatedConstructor constructor = Variant::get_validated_constructor(type, i);
+			if (constructor != nullptr && !constructors.has(constructor)) {
+				constructors.insert(constructor, { type, i, StringName() });
+			}
+		}
+	}
+
+	List<StringName> utility_names;
+	Variant::get_utility_function_list(&utility_names);
+	for (const StringName &name : utility_names) {
+		Variant::ValidatedUtilityFunction utility = Variant::get_validated_utility_function(name);
+		if (utility != nullptr && !utilities.has(utility)) {
+			utilities.insert(utility, name);
+		}
+	}
+
+	List<StringName> gds_utility_names;
+	GDScriptUtilityFunctions::get_function_list(&gds_utility_names);
+	for (const StringName &name : gds_utility_names) {
+		GDScriptUtilityFunctions::FunctionPtr utility = GDScriptUtilityFunctions::get_function(name);
+		if (utility != nullptr && !gds_utilities.has(utility)) {
+			gds_utilities.insert(utility, name);
+		}
+	}
+
+	tables_built = true;
+}
+
+bool GDScriptBytecodeSerializer::_write_value(GDScriptBytecodeWriter &p_writer, const Variant &p_value, int p_depth) {
+	if (p_depth > Variant::MAX_RECURSION_DEPTH) {
+		return false;
+	}
+
+	switch (p_value.get_type()) {
+		case Variant::ARRAY: {
+			const Array array = p_value;
+			p_writer.put_u8(GDScriptBytecode::VALUE_ARRAY);
+			p_writer.put_u8(array.is_read_only());
+			p_writer.put_u32(array.get_typed_builtin());
+			p_writer.put_string(array.get_typed_class_name());
+			if (!_write_value(p_writer, array.get_typed_script(), p_depth + 1)) {
+				return false;
+			}
+			p_writer.put_u32(array.size());
+			for (const Variant &element : array) {
+				if (!_write_value(p_writer, element, p_depth + 1)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		case Variant::DICTIONARY: {
+			const Dictionary dictionary = p_value;
+			p_writer.put_u8(GDScriptBytecode::VALUE_DICTIONARY);
+			p_writer.put_u8(dictionary.is_read_only());
+			p_writer.put_u32(dictionary.get_typed_key_builtin());
+			p_writer.put_string(dictionary.get_typed_key_class_name());
+			if (!_write_value(p_writer, dictionary.get_typed_key_script(), p_depth + 1)) {
+				return false;
+			}
+			p_writer.put_u32(dictionary.get_typed_value_builtin());
+			p_writer.put_string(dictionary.get_typed_value_class_name());
+			if (!_write_value(p_writer, dictionary.get_typed_value_script(), p_depth + 1)) {
+				return false;
+			}
+			p_writer.put_u32(dictionary.size());
+			for (const KeyValue<Variant, Variant> &kv : dictionary) {
+				if (!_write_value(p_writer, kv.key, p_depth + 1) || !_write_value(p_writer, kv.value, p_depth + 1)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		case Variant::OBJECT: {
+			Object *object = p_value.get_validated_object();
+			if (object == nullptr) {
+				p_writer.put_u8(GDScriptBytecode::VALUE_NULL_OBJECT);
+				return true;
+			}
+			if (const GDScriptNativeClass *native_class = Object::cast_to<GDScriptNativeClass>(object)) {
+				p_writer.put_u8(GDScriptBytecode::VALUE_NATIVE_CLASS);
+				p_writer.put_string(native_class->get_name());
+				return true;
+			}
+			if (const GDScript *script = Object::cast_to<GDScript>(object)) {
+				const String path = script->get_script_path();
+				if (path.is_empty() || path.contains("::")) {
+					return false; // Built-in scripts aren't exported on their own.
+				}
+				p_writer.put_u8(GDScriptBytecode::VALUE_SCRIPT);
+				p_writer.put_string(path);
+				p_writer.put_string(script->get_fully_qualified_name());
+				return true;
+			}
+			if (const Resource *resource = Object::cast_to<Resource>(object)) {
+				if (resource->is_built_in()) {
+					return false;
+				}
+				p_writer.put_u8(GDScriptBytecode::VALUE_RESOURCE);
+				p_writer.put_string(resource->get_path());
+				return true;
+			}
+			List<Engine::Singleton> singletons;
+			Engine::get_singleton()->get_singletons(&singletons);
+			for (const Engine::Singleton &singleton : singletons) {
+				if (singleton.ptr == object) {
+					p_writer.put_u8(GDScriptBytecode::VALUE_SINGLETON);
+					p_writer.put_string(singleton.name);
+					return true;
+				}
+			}
+			return false;
+		}
+		case Variant::RID:
+		case Variant::CALLABLE:
+		case Variant::SIGNAL: {
+			return false; // Only meaningful within the running process.
+		}
+		default: {
+			p_writer.put_u8(GDScriptBytecode::VALUE_VARIANT);
+			return p_writer.put_variant(p_value);
+		}
+	}
+}
+
+bool GDScriptBytecodeSerializer::_write_data_type(GDScriptBytecodeWriter &p_writer, const GDScriptDataType &p_type) {
+	p_writer.put_u8(p_type.has_type);
+	p_writer.put_u8(p_type.kind);
+	p_writer.put_u32(p_type.builtin_type);
+	p_writer.put_string(p_type.native_type);
+
+	if (p_type.kind == GDScriptDataType::SCRIPT || p_type.kind == GDScriptDataType::GDSCRIPT) {
+		if (!_write_value(p_writer, Variant(p_type.script_type))) {
+			return false;
+		}
+		p_writer.put_u8(p_type.script_type_ref.is_valid());
+	}
+
+	p_writer.put_u32(p_type.container_element_types.size());
+	for (const GDScriptDataType &element_type : p_type.container_element_types) {
+		if (!_write_data_type(p_writer, element_type)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool GDScriptBytecodeSerializer::_write_member_info(GDScriptBytecodeWriter &p_writer, const StringName &p_name, const GDScript::MemberInfo &p_info) {
+	p_writer.put_string(p_name);
+	p_writer.put_i32(p_info.index);
+	p_writer.put_string(p_info.setter);
+	p_writer.put_string(p_info.getter);
+	if (!_write_data_type(p_writer, p_info.data_type)) {
+		return false;
+	}
+	_write_property_info(p_writer, p_info.property_info);
+	return true;
+}
+
+bool GDScriptBytecodeSerializer::_write_method_info(GDScriptBytecodeWriter &p_writer, const MethodInfo &p_info) {
+	p_writer.put_string(p_info.name);
+	_write_property_info(p_writer, p_info.return_val);
+	p_writer.put_u32(p_info.flags);
+	p_writer.put_i32(p_info.id);
+	p_writer.put_i32(p_info.return_val_metadata);
+
+	p_writer.put_u32(p_info.arguments.size());
+	for (const PropertyInfo &argument : p_info.arguments) {
+		_write_property_info(p_writer, argument);
+	}
+	p_writer.put_u32(p_info.default_arguments.size());
+	for (const Variant &value : p_info.default_arguments) {
+		if (!_write_value(p_writer, value)) {
+			return false;
+		}
+	}
+	p_writer.put_u32(p_info.arguments_metadata.size());
+	for (int metadata : p_info.arguments_metadata) {
+		p_writer.put_i32(metadata);
+	}
+	return true;
+}
+
+bool GDScriptBytecodeSerializer::_write_function_id(GDScriptBytecodeWriter &p_writer, const GDScriptFunction *p_function) {
+	if (p_function == nullptr) {
+		p_writer.put_i32(-1);
+		return true;
+	}
+	const int *id = function_ids.getptr(p_function);
+	if (id == nullptr) {
+		return false;
+	}
+	p_writer.put_i32(*id);
+	return true;
+}
+
+bool GDScriptBytecodeSerializer::_write_function(GDScriptBytecodeWriter &p_writer, const GDScriptFunction *p_function, bool p_lambda) {
+	p_writer.put_string(p_function->name);
+	p_writer.put_u8((p_function->_static ? 1 : 0) | (p_lambda ? 2 : 0));
+	p_writer.put_i32(p_function->_initial_line);
+	p_writer.put_i32(p_function->_argument_count);
+	p_writer.put_i32(p_function->_stack_size);
+	p_writer.put_i32(p_function->_instruction_args_size);
+
+	if (!_write_data_type(p_writer, p_function->return_type)) {
+		return false;
+	}
+	p_writer.put_u32(p_function->argument_types.size());
+	for (const GDScriptDataType &argument_type : p_function->argument_types) {
+		if (!_write_data_type(p_writer, argument_type)) {
+			return false;
+		}
+	}
+	if (!_write_method_info(p_writer, p_function->method_info) || !_write_value(p_writer, p_function->rpc_config)) {
+		return false;
+	}
+
+	p_writer.put_u32(p_function->temporary_slots.size());
+	for (const KeyValue<int, Variant::Type> &E : p_function->temporary_slots) {
+		p_writer.put_i32(E.key);
+		p_writer.put_u32(E.value);
+	}
+
+	p_writer.put_u32(p_function->stack_debug.size());
+	for (const GDScriptFunction::StackDebug &stack_debug : p_function->stack_debug) {
+		p_writer.put_i32(stack_debug.line);
+		p_writer.put_i32(stack_debug.pos);
+		p_writer.put_u8(stack_debug.added);
+		p_writer.put_string(stack_debug.identifier);
+	}
+
+	p_writer.put_u32(p_function->code.size());
+	for (int word : p_function->code) {
+		p_writer.put_i32(word);
+	}
+
+	p_writer.put_u32(p_function->global_index_positions.size());
+	for (int position : p_function->global_index_positions) {
+		const StringName *global_name = global_names.getptr(p_function->code[position]);
+		if (global_name == nullptr) {
+			return false;
+		}
+		p_writer.put_u32(position);
+		p_writer.put_string(*global_name);
+	}
+
+	p_writer.put_u32(p_function->default_arguments.size());
+	for (int position : p_function->default_arguments) {
+		p_writer.put_i32(position);
+	}
+
+	p_writer.put_u32(p_function->validated_operator_positions.size());
+	for (int position : p_function->validated_operator_positions) {
+		p_writer.put_i32(position);
+	}
+
+	p_writer.put_u32(p_function->property_site_members.size());
+	for (const StringName &member : p_function->property_site_members) {
+		p_writer.put_string(member);
+	}
+
+	p_writer.put_u32(p_function->constants.size());
+	for (const Variant &constant : p_function->constants) {
+		if (!_write_value(p_writer, constant)) {
+			return false;
+		}
+	}
+
+	p_writer.put_u32(p_function->global_names.size());
+	for (const StringName &name : p_function->global_names) {
+		p_writer.put_string(name);
+	}
+
+	p_writer.put_u32(p_function->operator_funcs.size());
+	for (Variant::ValidatedOperatorEvaluator evaluator : p_function->operator_funcs) {
+		const OperatorEntry *entry = operators.getptr(evaluator);
+		if (entry == nullptr) {
+			return false;
+		}
+		p_writer.put_u8(entry->op);
+		p_writer.put_u8(entry->type_a);
+		p_writer.put_u8(entry->type_b);
+	}
+
+	p_writer.put_u32(p_function->setters.size());
+	for (Variant::ValidatedSetter setter : p_function->setters) {
+		const FunctionEntry *entry = setters.getptr(setter);
+		if (entry == nullptr) {
+			return false;
+		}
+		p_writer.put_u8(entry->type);
+		p_writer.put_string(entry->name);
+	}
+
+	p_writer.put_u32(p_function->getters.size());
+	for (Variant::ValidatedGetter getter : p_function->getters) {
+		const FunctionEntry *entry = getters.getptr(getter);
+		if (entry == nullptr) {
+			return false;
+		}
+		p_writer.put_u8(entry->type);
+		p_writer.put_string(entry->name);
+	}
+
+	p_writer.put_u32(p_function->keyed_setters.size());
+	for (Variant::ValidatedKeyedSetter setter : p_function->keyed_setters) {
+		const FunctionEntry *entry = keyed_setters.getptr(setter);
+		if (entry == nullptr) {
+			return false;
+		}
+		p_writer.put_u8(entry->type);
+	}
+
+	p_writer.put_u32(p_function->keyed_getters.size());
+	for (Variant::ValidatedKeyedGetter getter : p_function->keyed_getters) {
+		const FunctionEntry *entry = keyed_getters.getptr(getter);
+		if (entry == nullptr) {
+			return false;
+		}
+		p_writer.put_u8(entry->type);
+	}
+
+	p_writer.put_u32(p_function->indexed_setters.size());
+	for (Variant::ValidatedIndexedSetter setter : p_function->indexed_setters) {
+		const FunctionEntry *entry = indexed_setters.getptr(setter);
+		if (entry == nullptr) {
+			return false;
+		}
+		p_writer.put_u8(entry->type);
+	}
+
+	p_writer.put_u32(p_function->indexed_getters.size());
+	for (Variant::ValidatedIndexedGetter getter : p_function->indexed_getters) {
+		const FunctionEntry *entry = indexed_getters.getptr(getter);
+		if (entry == nullptr) {
+			return false;
+		}
+		p_writer.put_u8(entry->type);
+	}
+
+	p_writer.put_u32(p_function->builtin_methods.size());
+	for (Variant::ValidatedBuiltInMethod builtin_method : p_function->builtin_methods) {
+		const FunctionEntry *entry = builtin_methods.getptr(builtin_method);
+		if (entry == nullptr) {
+			return false;
+		}
+		p_writer.put_u8(entry->type);
+		p_writer.put_string(entry->name);
+	}
+
+	p_writer.put_u32(p_function->constructors.size());
+	for (Variant::ValidatedConstructor constructor : p_function->constructors) {
+		const FunctionEntry *entry = constructors.getptr(constructor);
+		if (entry == nullptr) {
+			return false;
+		}
+		p_writer.put_u8(entry->type);
+		p_writer.put_i32(entry->index);
+	}
+
+	p_writer.put_u32(p_function->utilities.size());
+	for (Variant::ValidatedUtilityFunction utility : p_function->utilities) {
+		const StringName *name = utilities.getptr(utility);
+		if (name == nullptr) {
+			return false;
+		}
+		p_writer.put_string(*name);
+	}
+
+	p_writer.put_u32(p_function->gds_utilities.size());
+	for (GDScriptUtilityFunctions::FunctionPtr utility : p_function->gds_utilities) {
+		const StringName *name = gds_utilities.getptr(utility);
+		if (name == nullptr) {
+			return false;
+		}
+		p_writer.put_string(*name);
+	}
+
+	p_writer.put_u32(p_function->methods.size());
+	for (const MethodBind *method : p_function->methods) {
+		p_writer.put_string(method->get_instance_class());
+		p_writer.put_string(method->get_name());
+	}
+
+	p_writer.put_u32(p_function->lambdas.size());
+	for (const GDScriptFunction *lambda : p_function->lambdas) {
+		if (!_write_function_id(p_writer, lambda)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Lambdas are listed before the functions containing them, so the loader can hand them over right away.
+void GDScriptBytecodeSerializer::_collect_functions(const GDScriptFunction *p_function, bool p_lambda, LocalVector<const GDScriptFunction *> &r_functions, LocalVector<bool> &r_lambdas) {
+	for (const GDScriptFunction *lambda : p_function->lambdas) {
+		_collect_functions(lambda, true, r_functions, r_lambdas);
+	}
+	r_functions.push_back(p_function);
+	r_lambdas.push_back(p_lambda);
+}
+
+void GDScriptBytecodeSerializer::_write_scripts(GDScriptBytecodeWriter &p_writer, const GDScript *p_script) {
+	p_writer.put_string(p_script->fully_qualified_name);
+	p_writer.put_string(p_script->local_name);
+	p_writer.put_string(p_script->global_name);
+	p_writer.put_string(p_script->simplified_icon_path);
+
+	p_writer.put_u32(p_script->subclasses.size());
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		p_writer.put_string(E.key);
+		_write_scripts(p_writer, E.value.ptr());
+	}
+}
+
+bool GDScriptBytecodeSerializer::_write_class(GDScriptBytecodeWriter &p_writer, const GDScript *p_script) {
+	if (!p_script->valid || p_script->native.is_null()) {
+		return false;
+	}
+
+	p_writer.put_u8(p_script->tool);
+	p_writer.put_u8(p_script->_is_abstract);
+	p_writer.put_string(p_script->native->get_name());
+
+	p_writer.put_u8(p_script->base.is_valid());
+	if (p_script->base.is_valid()) {
+		const String base_path = p_script->base->get_script_path();
+		if (base_path.is_empty() || base_path.contains("::")) {
+			return false;
+		}
+		p_writer.put_string(base_path);
+		p_writer.put_string(p_script->base->fully_qualified_name);
+	}
+
+	p_writer.put_u32(p_script->member_indices.size());
+	for (const KeyValue<StringName, GDScript::MemberInfo> &E : p_script->member_indices) {
+		if (!_write_member_info(p_writer, E.key, E.value)) {
+			return false;
+		}
+	}
+	p_writer.put_u32(p_script->members.size());
+	for (const StringName &name : p_script->members) {
+		p_writer.put_string(name);
+	}
+	p_writer.put_u32(p_script->static_variables_indices.size());
+	for (const KeyValue<StringName, GDScript::MemberInfo> &E : p_script->static_variables_indices) {
+		if (!_write_member_info(p_writer, E.key, E.value)) {
+			return false;
+		}
+	}
+
+	// Inner classes are part of the constants too, the loader adds them back.
+	LocalVector<const KeyValue<StringName, Variant> *> constants;
+	for (const KeyValue<StringName, Variant> &E : p_script->constants) {
+		if (!p_script->subclasses.has(E.key)) {
+			constants.push_back(&E);
+		}
+	}
+	p_writer.put_u32(constants.size());
+	for (const KeyValue<StringName, Variant> *E : constants) {
+		p_writer.put_string(E->key);
+		if (!_write_value(p_writer, E->value)) {
+			return false;
+		}
+	}
+
+	p_writer.put_u32(p_script->_signals.size());
+	for (const KeyValue<StringName, MethodInfo> &E : p_script->_signals) {
+		p_writer.put_string(E.key);
+		if (!_write_method_info(p_writer, E.value)) {
+			return false;
+		}
+	}
+
+	if (!_write_value(p_writer, p_script->rpc_config)) {
+		return false;
+	}
+
+	LocalVector<const GDScriptFunction *> functions;
+	LocalVector<bool> lambdas;
+	for (const KeyValue<StringName, GDScriptFunction *> &E : p_script->member_functions) {
+		_collect_functions(E.value, false, functions, lambdas);
+	}
+	const GDScriptFunction *special_functions[] = { p_script->implicit_initializer, p_script->implicit_ready, p_script->static_initializer };
+	for (const GDScriptFunction *special_function : special_functions) {
+		if (special_function != nullptr) {
+			_collect_functions(special_function, false, functions, lambdas);
+		}
+	}
+
+	p_writer.put_u32(functions.size());
+	for (uint32_t i = 0; i < functions.size(); i++) {
+		function_ids.insert(functions[i], function_ids.size());
+		if (!_write_function(p_writer, functions[i], lambdas[i])) {
+			return false;
+		}
+	}
+
+	p_writer.put_u32(p_script->member_functions.size());
+	for (const KeyValue<StringName, GDScriptFunction *> &E : p_script->member_functions) {
+		p_writer.put_string(E.key);
+		if (!_write_function_id(p_writer, E.value)) {
+			return false;
+		}
+	}
+	if (!_write_function_id(p_writer, p_script->initializer)) {
+		return false;
+	}
+	for (const GDScriptFunction *special_function : special_functions) {
+		if (!_write_function_id(p_writer, special_function)) {
+			return false;
+		}
+	}
+
+	p_writer.put_u32(p_script->lambda_info.size());
+	for (const KeyValue<GDScriptFunction *, GDScript::LambdaInfo> &E : p_script->lambda_info) {
+		if (!_write_function_id(p_writer, E.key)) {
+			return false;
+		}
+		p_writer.put_i32(E.value.capture_count);
+		p_writer.put_u8(E.value.use_self);
+	}
+
+	p_writer.put_u32(p_script->subclasses.size());
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		p_writer.put_string(E.key);
+		if (!_write_class(p_writer, E.value.ptr())) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+Vector<uint8_t> GDScriptBytecodeSerializer::serialize(const GDScript *p_script) {
+	ERR_FAIL_NULL_V(p_script, Vector<uint8_t>());
+	if (p_script->path.is_empty() || p_script->path.contains("::")) {
+		return Vector<uint8_t>();
+	}
+
+	if (!tables_built) {
+		_build_tables();
+	}
+	function_ids.clear();
+	global_names.clear();
+	for (const KeyValue<StringName, int> &E : GDScriptLanguage::get_singleton()->get_global_map()) {
+		global_names.insert(E.value, E.key);
+	}
+
+	GDScriptBytecodeWriter writer;
+	writer.put_u8('G');
+	writer.put_u8('D');
+	writer.put_u8('B');
+	writer.put_u8('C');
+	writer.put_u32(GDScriptBytecode::FORMAT_VERSION);
+	writer.put_string(GDScriptBytecode::get_build_id());
+	writer.put_u32(GDScriptBytecode::get_build_flags());
+	writer.put_string(p_script->path);
+
+	_write_scripts(writer, p_script);
+	writer.put_u8(GDScriptCache::has_static_script(p_script->fully_qualified_name));
+
+	if (!_write_class(writer, p_script)) {
+		return Vector<uint8_t>();
+	}
+	return writer.get_data();
+}
+
+#endif // TOOLS_ENABLED
@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*  gdscript_bytecode.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "gdscript.h"
+#include "gdscript_function.h"
+#include "gdscript_utility_functions.h"
+
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+
+class GDScriptBytecodeReader;
+class GDScriptBytecodeWriter;
+
+// Compiled form of a script and its inner classes, exported next to the binary tokens
+// so projects can skip parsing, analysis and code generation when loading scripts.
+// Function pointer tables are stored by name and resolved again when loading, which keeps
+// the format independent from the address layout of the binary that wrote it.
+class GDScriptBytecode {
+	struct LoadState;
+
+	static bool _read_header(GDScriptBytecodeReader &p_reader, const GDScript *p_script);
+	static void _read_scripts(GDScriptBytecodeReader &p_reader, GDScript *p_script);
+	static bool _read_class(LoadState &p_state, GDScript *p_script);
+	static GDScriptFunction *_read_function(LoadState &p_state, GDScript *p_script);
+	static bool _read_data_type(LoadState &p_state, GDScriptDataType &r_type);
+	static bool _read_member_info(LoadState &p_state, GDScript::MemberInfo &r_info);
+	static bool _read_method_info(LoadState &p_state, MethodInfo &r_info);
+	static bool _read_value(LoadState &p_state, Variant &r_value, int p_depth = 0);
+	static GDScript *_resolve_script(LoadState &p_state, const String &p_path, const String &p_fully_qualified_name);
+	static GDScriptFunction *_take_function(LoadState &p_state, int p_id);
+	static void _finish_class(GDScript *p_script);
+
+public:
+	static constexpr uint32_t FORMAT_VERSION = 3;
+
+	enum ValueKind {
+		VALUE_VARIANT,
+		VALUE_NULL_OBJECT,
+		VALUE_ARRAY,
+		VALUE_DICTIONARY,
+		VALUE_NATIVE_CLASS,
+		VALUE_SCRIPT,
+		VALUE_RESOURCE,
+		VALUE_SINGLETON,
+	};
+
+	enum Flags {
+		FLAG_DEBUG = 1 << 0, // Compiled with asserts, which release builds jump over.
+	};
+
+	static String get_build_id();
+	static uint32_t get_build_flags();
+
+	static bool is_compatible(const Vector<uint8_t> &p_buffer);
+	// Creates the inner class scripts, like `GDScriptCompiler::make_scripts()` does from the parse tree.
+	static Error make_scripts(GDScript *p_script, const Vector<uint8_t> &p_buffer);
+	static Error load(GDScript *p_script, const Vector<uint8_t> &p_buffer);
+};
+
+#ifdef TOOLS_ENABLED
+class GDScriptBytecodeSerializer {
+	struct FunctionEntry {
+		int type = 0;
+		int index = 0;
+		StringName name;
+	};
+
+	struct OperatorEntry {
+		Variant::Operator op = Variant::OP_MAX;
+		Variant::Type type_a = Variant::NIL;
+		Variant::Type type_b = Variant::NIL;
+	};
+
+	// Function pointers have no default hasher.
+	struct FunctionPointerHasher {
+		template <typename T>
+		static _FORCE_INLINE_ uint32_t hash(T p_function) { return hash_one_uint64((uint64_t)reinterpret_cast<uintptr_t>(p_function)); }
+	};
+
+	bool tables_built = false;
+	HashMap<Variant::ValidatedOperatorEvaluator, OperatorEntry, FunctionPointerHasher> operators;
+	HashMap<Variant::ValidatedSetter, FunctionEntry, FunctionPointerHasher> setters;
+	HashMap<Variant::ValidatedGetter, FunctionEntry, FunctionPointerHasher> getters;
+	HashMap<Variant::ValidatedKeyedSetter, FunctionEntry, FunctionPointerHasher> keyed_setters;
+	HashMap<Variant::ValidatedKeyedGetter, FunctionEntry, FunctionPointerHasher> keyed_getters;
+	HashMap<Variant::ValidatedIndexedSetter, FunctionEntry, FunctionPointerHasher> indexed_setters;
+	HashMap<Variant::ValidatedIndexedGetter, FunctionEntry, FunctionPointerHasher> indexed_getters;
+	HashMap<Variant::ValidatedBuiltInMethod, FunctionEntry, FunctionPointerHasher> builtin_methods;
+	HashMap<Variant::ValidatedConstructor, FunctionEntry, FunctionPointerHasher> constructors;
+	HashMap<Variant::ValidatedUtilityFunction, StringName, FunctionPointerHasher> utilities;
+	HashMap<GDScriptUtilityFunctions::FunctionPtr, StringName, FunctionPointerHasher> gds_utilities;
+
+	HashMap<const GDScriptFunction *, int> function_ids;
+	HashMap<int, StringName> global_names;
+
+	void _build_tables();
+
+	void _write_scripts(GDScriptBytecodeWriter &p_writer, const GDScript *p_script);
+	bool _write_class(GDScriptBytecodeWriter &p_writer, const GDScript *p_script);
+	bool _write_function(GDScriptBytecodeWriter &p_writer, const GDScriptFunction *p_function, bool p_lambda);
+	bool _write_data_type(GDScriptBytecodeWriter &p_writer, const GDScriptDataType &p_type);
+	bool _write_member_info(GDScriptBytecodeWriter &p_writer, const StringName &p_name, const GDScript::MemberInfo &p_info);
+	bool _write_method_info(GDScriptBytecodeWriter &p_writer, const MethodInfo &p_info);
+	bool _write_value(GDScriptBytecodeWriter &p_writer, const Variant &p_value, int p_depth = 0);
+	bool _write_function_id(GDScriptBytecodeWriter &p_writer, const GDScriptFunction *p_function);
+	void _collect_functions(const GDScriptFunction *p_function, bool p_lambda, LocalVector<const GDScriptFunction *> &r_functions, LocalVector<bool> &r_lambdas);
+
+public:
+	// Returns an empty buffer if the script uses something that can't be stored, in which case it has to be compiled from source when loaded.
+	Vector<uint8_t> serialize(const GDScript *p_script);
+};
+#endif // TOOLS_ENABLED
@@ -32,10 +32,12 @@
 
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/vector.h"
 
 GDScriptParserRef::Status GDScriptParserRef::get_status() const {
@@ -253,6 +255,7 @@ void GDScriptCache::remove_parser(const String &p_path) {
 
 	// Can't clear the parser because some other parser might be currently using it in the chain of calls.
 	singleton->parser_map.erase(p_path);
+	singleton->preloaded_parsers.erase(p_path);
 
 	// Have to copy while iterating, because parser_inverse_dependencies is modified.
 	HashSet<String> ideps = singleton->parser_inverse_dependencies[p_path];
@@ -295,6 +298,21 @@ Vector<uint8_t> GDScriptCache::get_binary_tokens(const String &p_path) {
 	return buffer;
 }
 
+Vector<uint8_t> GDScriptCache::get_bytecode(const String &p_path) {
+	const String bytecode_path = p_path.get_basename() + ".gdbc";
+	if (!FileAccess::exists(bytecode_path)) {
+		return Vector<uint8_t>();
+	}
+
+	Vector<uint8_t> buffer = FileAccess::get_file_as_bytes(bytecode_path);
+	if (!GDScriptBytecode::is_compatible(buffer)) {
+		// Written by another engine build, the binary tokens are used instead.
+		print_verbose(vformat(R"(GDScript: Ignoring bytecode "%s" compiled by a different engine build.)", bytecode_path));
+		return Vector<uint8_t>();
+	}
+	return buffer;
+}
+
 Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_error, const String &p_owner) {
 	MutexLock lock(singleton->mutex);
 
@@ -319,6 +337,7 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_e
 			r_error = ERR_FILE_CANT_READ;
 		}
 		script->set_binary_tokens_source(buffer);
+		script->set_bytecode_source(get_bytecode(remapped_path));
 	} else {
 		r_error = script->load_source_code(remapped_path);
 	}
@@ -327,6 +346,13 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_e
 		return Ref<GDScript>(); // Returns null and does not cache when the script fails to load.
 	}
 
+	if (!script->get_bytecode_source().is_empty() && GDScriptBytecode::make_scripts(script.ptr(), script->get_bytecode_source()) == OK) {
+		// Inner classes come from the bytecode, the script doesn't need to be parsed at all.
+		singleton->shallow_gdscript_cache[p_path] = script;
+		return script;
+	}
+	script->set_bytecode_source(Vector<uint8_t>());
+
 	Ref<GDScriptParserRef> parser_ref = get_parser(p_path, GDScriptParserRef::PARSED, r_error);
 	if (r_error == OK) {
 		GDScriptCompiler::make_scripts(script.ptr(), parser_ref->get_parser()->get_tree(), true);
@@ -430,16 +456,101 @@ Error GDScriptCache::finish_compiling(const String &p_owner) {
 	}
 
 	singleton->dependencies.erase(p_owner);
+	singleton->preloaded_parsers.erase(p_owner);
 
 	return err;
 }
 
+void GDScriptCache::_preload_parse(void *p_userdata, uint32_t p_index) {
+	Ref<GDScriptParserRef> *parser_refs = static_cast<Ref<GDScriptParserRef> *>(p_userdata);
+	parser_refs[p_index]->raise_status(GDScriptParserRef::PARSED);
+}
+
+void GDScriptCache::preload_scripts(const Vector<String> &p_paths) {
+	if (singleton == nullptr) {
+		return;
+	}
+
+	const uint64_t start_time = OS::get_singleton()->get_ticks_msec();
+	uint32_t parsed_count = 0;
+
+	HashSet<String> visited;
+	Vector<String> pending = p_paths;
+	while (!pending.is_empty()) {
+		LocalVector<Ref<GDScriptParserRef>> parser_refs;
+		{
+			MutexLock lock(singleton->mutex);
+			for (const String &path : pending) {
+				if (visited.has(path)) {
+					continue;
+				}
+				visited.insert(path);
+				if (singleton->parser_map.has(path) || singleton->full_gdscript_cache.has(path) || !FileAccess::exists(ResourceLoader::path_remap(path))) {
+					continue;
+				}
+
+				Ref<GDScriptParserRef> ref;
+				ref.instantiate();
+				ref->path = path;
+				// Not registered yet, so it must not unregister another parser if it's discarded.
+				ref->abandoned = true;
+				// The first parser registers the annotations, which must not happen concurrently.
+				ref->get_parser();
+				parser_refs.push_back(ref);
+			}
+		}
+		pending.clear();
+
+		if (parser_refs.is_empty()) {
+			break;
+		}
+
+		// Parsing only reads the script's own file, so every script can be parsed independently.
+		// The analysis is still done on demand, since it resolves other scripts through the cache.
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&GDScriptCache::_preload_parse, parser_refs.ptr(), parser_refs.size(), -1, true, SNAME("GDScriptPreloadParse"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		MutexLock lock(singleton->mutex);
+		for (Ref<GDScriptParserRef> &ref : parser_refs) {
+			if (ref->result != OK) {
+				// Let the script report its errors when it's actually loaded.
+				continue;
+			}
+
+			// Base scripts extended by path are needed as soon as the script gets analyzed.
+			const GDScriptParser::ClassNode *tree = ref->get_parser()->get_tree();
+			if (tree != nullptr && !tree->extends_path.is_empty()) {
+				String base_path = tree->extends_path;
+				if (base_path.is_relative_path()) {
+					base_path = ref->path.get_base_dir().path_join(base_path).simplify_path();
+				}
+				pending.push_back(base_path);
+			}
+
+			if (singleton->cleared || singleton->parser_map.has(ref->path)) {
+				// Loaded while it was being parsed.
+				continue;
+			}
+			ref->abandoned = false;
+			singleton->parser_map[ref->path] = ref.ptr();
+			singleton->preloaded_parsers[ref->path] = ref;
+			parsed_count++;
+		}
+	}
+
+	print_verbose(vformat("GDScript: Parsed %d scripts ahead of loading in %d ms.", parsed_count, OS::get_singleton()->get_ticks_msec() - start_time));
+}
+
 void GDScriptCache::add_static_script(Ref<GDScript> p_script) {
 	ERR_FAIL_COND_MSG(p_script.is_null(), "Trying to cache empty script as static.");
 	ERR_FAIL_COND_MSG(!p_script->is_valid(), "Trying to cache non-compiled script as static.");
 	singleton->static_gdscript_cache[p_script->get_fully_qualified_name()] = p_script;
 }
 
+bool GDScriptCache::has_static_script(const String &p_fqcn) {
+	return singleton->static_gdscript_cache.has(p_fqcn);
+}
+
 void GDScriptCache::remove_static_script(const String &p_fqcn) {
 	singleton->static_gdscript_cache.erase(p_fqcn);
 }
@@ -483,6 +594,7 @@ void GDScriptCache::clear() {
 	}
 
 	parser_map_refs.clear();
+	singleton->preloaded_parsers.clear();
 	singleton->shallow_gdscript_cache.clear();
 	singleton->full_gdscript_cache.clear();
 	singleton->static_gdscript_cache.clear();
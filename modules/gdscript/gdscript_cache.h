@@ -87,6 +87,8 @@ class GDScriptCache {
 	HashMap<String, Ref<GDScript>> static_gdscript_cache;
 	HashMap<String, HashSet<String>> dependencies;
 	HashMap<String, HashSet<String>> parser_inverse_dependencies;
+	// Parsers made by `preload_scripts()`, kept alive until their script is compiled.
+	HashMap<String, Ref<GDScriptParserRef>> preloaded_parsers;
 
 	friend class GDScript;
 	friend class GDScriptParserRef;
@@ -103,6 +105,8 @@ private:
 	static SafeBinaryMutex<BINARY_MUTEX_TAG> mutex;
 	friend SafeBinaryMutex<BINARY_MUTEX_TAG> &_get_gdscript_cache_mutex();
 
+	static void _preload_parse(void *p_userdata, uint32_t p_index);
+
 public:
 	static void move_script(const String &p_from, const String &p_to);
 	static void remove_script(const String &p_path);
@@ -111,11 +115,14 @@ public:
 	static void remove_parser(const String &p_path);
 	static String get_source_code(const String &p_path);
 	static Vector<uint8_t> get_binary_tokens(const String &p_path);
+	static Vector<uint8_t> get_bytecode(const String &p_path);
 	static Ref<GDScript> get_shallow_script(const String &p_path, Error &r_error, const String &p_owner = String());
 	static Ref<GDScript> get_full_script(const String &p_path, Error &r_error, const String &p_owner = String(), bool p_update_from_disk = false);
 	static Ref<GDScript> get_cached_script(const String &p_path);
 	static Error finish_compiling(const String &p_owner);
+	static void preload_scripts(const Vector<String> &p_paths);
 	static void add_static_script(Ref<GDScript> p_script);
+	static bool has_static_script(const String &p_fqcn);
 	static void remove_static_script(const String &p_fqcn);
 
 	static void clear();
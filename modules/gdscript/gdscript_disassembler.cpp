@@ -98,7 +98,10 @@ static String _disassemble_address(const GDScript *p_script, const GDScriptFunct
 }
 
 void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
-#define DADDR(m_ip) (_disassemble_address(_script, *this, _code_ptr[ip + m_ip]))
+#define DADDR(m_ip) (_disassemble_address(_script, *this, code_ptr[ip + m_ip]))
+
+	// Shows the specialized opcodes once the function is hot.
+	const int *code_ptr = _get_code_ptr();
 
 	for (int ip = 0; ip < _code_size;) {
 		StringBuilder text;
@@ -109,12 +112,12 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 		text += ": ";
 
 		// This makes the compiler complain if some opcode is unchecked in the switch.
-		Opcode opcode = Opcode(_code_ptr[ip]);
+		Opcode opcode = Opcode(code_ptr[ip]);
 
 		switch (opcode) {
 			case OPCODE_OPERATOR: {
-				constexpr int _pointer_size = sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(*_code_ptr);
-				int operation = _code_ptr[ip + 4];
+				constexpr int _pointer_size = sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(*code_ptr);
+				int operation = code_ptr[ip + 4];
 
 				text += "operator ";
 
@@ -135,19 +138,71 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += " = ";
 				text += DADDR(1);
 				text += " ";
-				text += operator_names[_code_ptr[ip + 4]];
+				text += operator_names[code_ptr[ip + 4]];
 				text += " ";
 				text += DADDR(2);
 
 				incr += 5;
 			} break;
+
+#define DISASSEMBLE_OPERATOR_SPECIALIZED(m_name, m_type) \
+	case OPCODE_OPERATOR_##m_name##_##m_type: {          \
+		text += "specialized operator (";                \
+		text += #m_type;                                 \
+		text += ") ";                                    \
+		text += DADDR(3);                                \
+		text += " = ";                                   \
+		text += DADDR(1);                                \
+		text += " ";                                     \
+		text += operator_names[code_ptr[ip + 4]];       \
+		text += " ";                                     \
+		text += DADDR(2);                                \
+		incr += 5;                                       \
+	} break
+
+				DISASSEMBLE_OPERATOR_SPECIALIZED(ADD, INT);
+				DISASSEMBLE_OPERATOR_SPECIALIZED(SUBTRACT, INT);
+				DISASSEMBLE_OPERATOR_SPECIALIZED(MULTIPLY, INT);
+				DISASSEMBLE_OPERATOR_SPECIALIZED(ADD, FLOAT);
+				DISASSEMBLE_OPERATOR_SPECIALIZED(SUBTRACT, FLOAT);
+				DISASSEMBLE_OPERATOR_SPECIALIZED(MULTIPLY, FLOAT);
+				DISASSEMBLE_OPERATOR_SPECIALIZED(DIVIDE, FLOAT);
+
+#define DISASSEMBLE_COMPARE_JUMP(m_name, m_type)    \
+	case OPCODE_COMPARE_JUMP_##m_name##_##m_type: { \
+		text += "compare-and-jump (";               \
+		text += #m_type;                            \
+		text += ") ";                               \
+		text += DADDR(3);                           \
+		text += " = ";                              \
+		text += DADDR(1);                           \
+		text += " ";                                \
+		text += operator_names[code_ptr[ip + 4]];  \
+		text += " ";                                \
+		text += DADDR(2);                           \
+		text += ", else to ";                       \
+		text += itos(code_ptr[ip + 7]);            \
+		incr += 8;                                  \
+	} break
+
+				DISASSEMBLE_COMPARE_JUMP(EQUAL, INT);
+				DISASSEMBLE_COMPARE_JUMP(NOT_EQUAL, INT);
+				DISASSEMBLE_COMPARE_JUMP(LESS, INT);
+				DISASSEMBLE_COMPARE_JUMP(LESS_EQUAL, INT);
+				DISASSEMBLE_COMPARE_JUMP(GREATER, INT);
+				DISASSEMBLE_COMPARE_JUMP(GREATER_EQUAL, INT);
+				DISASSEMBLE_COMPARE_JUMP(LESS, FLOAT);
+				DISASSEMBLE_COMPARE_JUMP(LESS_EQUAL, FLOAT);
+				DISASSEMBLE_COMPARE_JUMP(GREATER, FLOAT);
+				DISASSEMBLE_COMPARE_JUMP(GREATER_EQUAL, FLOAT);
+
 			case OPCODE_TYPE_TEST_BUILTIN: {
 				text += "type test ";
 				text += DADDR(1);
 				text += " = ";
 				text += DADDR(2);
 				text += " is ";
-				text += Variant::get_type_name(Variant::Type(_code_ptr[ip + 3]));
+				text += Variant::get_type_name(Variant::Type(code_ptr[ip + 3]));
 
 				incr += 4;
 			} break;
@@ -158,9 +213,9 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += DADDR(2);
 				text += " is Array[";
 
-				Ref<Script> script_type = get_constant(_code_ptr[ip + 3] & ADDR_MASK);
-				Variant::Type builtin_type = (Variant::Type)_code_ptr[ip + 4];
-				StringName native_type = get_global_name(_code_ptr[ip + 5]);
+				Ref<Script> script_type = get_constant(code_ptr[ip + 3] & ADDR_MASK);
+				Variant::Type builtin_type = (Variant::Type)code_ptr[ip + 4];
+				StringName native_type = get_global_name(code_ptr[ip + 5]);
 
 				if (script_type.is_valid() && script_type->is_valid()) {
 					text += "script(";
@@ -183,9 +238,9 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += DADDR(2);
 				text += " is Dictionary[";
 
-				Ref<Script> key_script_type = get_constant(_code_ptr[ip + 3] & ADDR_MASK);
-				Variant::Type key_builtin_type = (Variant::Type)_code_ptr[ip + 5];
-				StringName key_native_type = get_global_name(_code_ptr[ip + 6]);
+				Ref<Script> key_script_type = get_constant(code_ptr[ip + 3] & ADDR_MASK);
+				Variant::Type key_builtin_type = (Variant::Type)code_ptr[ip + 5];
+				StringName key_native_type = get_global_name(code_ptr[ip + 6]);
 
 				if (key_script_type.is_valid() && key_script_type->is_valid()) {
 					text += "script(";
@@ -199,9 +254,9 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				text += ", ";
 
-				Ref<Script> value_script_type = get_constant(_code_ptr[ip + 4] & ADDR_MASK);
-				Variant::Type value_builtin_type = (Variant::Type)_code_ptr[ip + 7];
-				StringName value_native_type = get_global_name(_code_ptr[ip + 8]);
+				Ref<Script> value_script_type = get_constant(code_ptr[ip + 4] & ADDR_MASK);
+				Variant::Type value_builtin_type = (Variant::Type)code_ptr[ip + 7];
+				StringName value_native_type = get_global_name(code_ptr[ip + 8]);
 
 				if (value_script_type.is_valid() && value_script_type->is_valid()) {
 					text += "script(";
@@ -223,7 +278,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += " = ";
 				text += DADDR(2);
 				text += " is ";
-				text += get_global_name(_code_ptr[ip + 3]);
+				text += get_global_name(code_ptr[ip + 3]);
 
 				incr += 4;
 			} break;
@@ -267,6 +322,16 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+			case OPCODE_SET_INDEXED_TYPED_ARRAY: {
+				text += "set indexed typed array ";
+				text += DADDR(1);
+				text += "[";
+				text += DADDR(2);
+				text += "] = ";
+				text += DADDR(3);
+
+				incr += 4;
+			} break;
 			case OPCODE_GET_KEYED: {
 				text += "get keyed ";
 				text += DADDR(3);
@@ -300,21 +365,32 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+			case OPCODE_GET_INDEXED_TYPED_ARRAY: {
+				text += "get indexed typed array ";
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += "[";
+				text += DADDR(2);
+				text += "]";
+
+				incr += 4;
+			} break;
 			case OPCODE_SET_NAMED: {
 				text += "set_named ";
 				text += DADDR(1);
 				text += "[\"";
-				text += _global_names_ptr[_code_ptr[ip + 3]];
+				text += _global_names_ptr[code_ptr[ip + 3]];
 				text += "\"] = ";
 				text += DADDR(2);
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_SET_NAMED_VALIDATED: {
 				text += "set_named validated ";
 				text += DADDR(1);
 				text += "[\"";
-				text += setter_names[_code_ptr[ip + 3]];
+				text += setter_names[code_ptr[ip + 3]];
 				text += "\"] = ";
 				text += DADDR(2);
 
@@ -326,10 +402,10 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += " = ";
 				text += DADDR(1);
 				text += "[\"";
-				text += _global_names_ptr[_code_ptr[ip + 3]];
+				text += _global_names_ptr[code_ptr[ip + 3]];
 				text += "\"]";
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_GET_NAMED_VALIDATED: {
 				text += "get_named validated ";
@@ -337,7 +413,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += " = ";
 				text += DADDR(1);
 				text += "[\"";
-				text += getter_names[_code_ptr[ip + 3]];
+				text += getter_names[code_ptr[ip + 3]];
 				text += "\"]";
 
 				incr += 4;
@@ -345,7 +421,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 			case OPCODE_SET_MEMBER: {
 				text += "set_member ";
 				text += "[\"";
-				text += _global_names_ptr[_code_ptr[ip + 2]];
+				text += _global_names_ptr[code_ptr[ip + 2]];
 				text += "\"] = ";
 				text += DADDR(1);
 
@@ -356,26 +432,26 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += DADDR(1);
 				text += " = ";
 				text += "[\"";
-				text += _global_names_ptr[_code_ptr[ip + 2]];
+				text += _global_names_ptr[code_ptr[ip + 2]];
 				text += "\"]";
 
 				incr += 3;
 			} break;
 			case OPCODE_SET_STATIC_VARIABLE: {
 				Ref<GDScript> gdscript;
-				if (_code_ptr[ip + 2] == ADDR_CLASS) {
+				if (code_ptr[ip + 2] == ADDR_CLASS) {
 					gdscript = Ref<GDScript>(_script);
 				} else {
-					gdscript = get_constant(_code_ptr[ip + 2] & ADDR_MASK);
+					gdscript = get_constant(code_ptr[ip + 2] & ADDR_MASK);
 				}
 
 				text += "set_static_variable script(";
 				text += GDScript::debug_get_script_name(gdscript);
 				text += ")";
 				if (gdscript.is_valid()) {
-					text += "[\"" + gdscript->debug_get_static_var_by_index(_code_ptr[ip + 3]) + "\"]";
+					text += "[\"" + gdscript->debug_get_static_var_by_index(code_ptr[ip + 3]) + "\"]";
 				} else {
-					text += "[<index " + itos(_code_ptr[ip + 3]) + ">]";
+					text += "[<index " + itos(code_ptr[ip + 3]) + ">]";
 				}
 				text += " = ";
 				text += DADDR(1);
@@ -384,10 +460,10 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 			} break;
 			case OPCODE_GET_STATIC_VARIABLE: {
 				Ref<GDScript> gdscript;
-				if (_code_ptr[ip + 2] == ADDR_CLASS) {
+				if (code_ptr[ip + 2] == ADDR_CLASS) {
 					gdscript = Ref<GDScript>(_script);
 				} else {
-					gdscript = get_constant(_code_ptr[ip + 2] & ADDR_MASK);
+					gdscript = get_constant(code_ptr[ip + 2] & ADDR_MASK);
 				}
 
 				text += "get_static_variable ";
@@ -396,9 +472,9 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += GDScript::debug_get_script_name(gdscript);
 				text += ")";
 				if (gdscript.is_valid()) {
-					text += "[\"" + gdscript->debug_get_static_var_by_index(_code_ptr[ip + 3]) + "\"]";
+					text += "[\"" + gdscript->debug_get_static_var_by_index(code_ptr[ip + 3]) + "\"]";
 				} else {
-					text += "[<index " + itos(_code_ptr[ip + 3]) + ">]";
+					text += "[<index " + itos(code_ptr[ip + 3]) + ">]";
 				}
 
 				incr += 4;
@@ -434,7 +510,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 			} break;
 			case OPCODE_ASSIGN_TYPED_BUILTIN: {
 				text += "assign typed builtin (";
-				text += Variant::get_type_name((Variant::Type)_code_ptr[ip + 3]);
+				text += Variant::get_type_name((Variant::Type)code_ptr[ip + 3]);
 				text += ") ";
 				text += DADDR(1);
 				text += " = ";
@@ -469,7 +545,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr += 4;
 			} break;
 			case OPCODE_ASSIGN_TYPED_SCRIPT: {
-				Ref<Script> script = get_constant(_code_ptr[ip + 3] & ADDR_MASK);
+				Ref<Script> script = get_constant(code_ptr[ip + 3] & ADDR_MASK);
 
 				text += "assign typed script (";
 				text += GDScript::debug_get_script_name(script);
@@ -486,7 +562,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += " = ";
 				text += DADDR(1);
 				text += " as ";
-				text += Variant::get_type_name(Variant::Type(_code_ptr[ip + 1]));
+				text += Variant::get_type_name(Variant::Type(code_ptr[ip + 1]));
 
 				incr += 4;
 			} break;
@@ -511,9 +587,9 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr += 4;
 			} break;
 			case OPCODE_CONSTRUCT: {
-				int instr_var_args = _code_ptr[++ip];
-				Variant::Type t = Variant::Type(_code_ptr[ip + 3 + instr_var_args]);
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				int instr_var_args = code_ptr[++ip];
+				Variant::Type t = Variant::Type(code_ptr[ip + 3 + instr_var_args]);
+				int argc = code_ptr[ip + 1 + instr_var_args];
 
 				text += "construct ";
 				text += DADDR(1 + argc);
@@ -531,14 +607,14 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr = 3 + instr_var_args;
 			} break;
 			case OPCODE_CONSTRUCT_VALIDATED: {
-				int instr_var_args = _code_ptr[++ip];
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				int instr_var_args = code_ptr[++ip];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 
 				text += "construct validated ";
 				text += DADDR(1 + argc);
 				text += " = ";
 
-				text += constructors_names[_code_ptr[ip + 3 + argc]];
+				text += constructors_names[code_ptr[ip + 3 + argc]];
 				text += "(";
 				for (int i = 0; i < argc; i++) {
 					if (i > 0) {
@@ -551,8 +627,8 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr = 3 + instr_var_args;
 			} break;
 			case OPCODE_CONSTRUCT_ARRAY: {
-				int instr_var_args = _code_ptr[++ip];
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				int instr_var_args = code_ptr[++ip];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 				text += " make_array ";
 				text += DADDR(1 + argc);
 				text += " = [";
@@ -569,12 +645,12 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr += 3 + argc;
 			} break;
 			case OPCODE_CONSTRUCT_TYPED_ARRAY: {
-				int instr_var_args = _code_ptr[++ip];
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				int instr_var_args = code_ptr[++ip];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 
-				Ref<Script> script_type = get_constant(_code_ptr[ip + argc + 2] & ADDR_MASK);
-				Variant::Type builtin_type = (Variant::Type)_code_ptr[ip + argc + 4];
-				StringName native_type = get_global_name(_code_ptr[ip + argc + 5]);
+				Ref<Script> script_type = get_constant(code_ptr[ip + argc + 2] & ADDR_MASK);
+				Variant::Type builtin_type = (Variant::Type)code_ptr[ip + argc + 4];
+				StringName native_type = get_global_name(code_ptr[ip + argc + 5]);
 
 				String type_name;
 				if (script_type.is_valid() && script_type->is_valid()) {
@@ -604,8 +680,8 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr += 6 + argc;
 			} break;
 			case OPCODE_CONSTRUCT_DICTIONARY: {
-				int instr_var_args = _code_ptr[++ip];
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				int instr_var_args = code_ptr[++ip];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 				text += "make_dict ";
 				text += DADDR(1 + argc * 2);
 				text += " = {";
@@ -624,12 +700,12 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr += 3 + argc * 2;
 			} break;
 			case OPCODE_CONSTRUCT_TYPED_DICTIONARY: {
-				int instr_var_args = _code_ptr[++ip];
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				int instr_var_args = code_ptr[++ip];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 
-				Ref<Script> key_script_type = get_constant(_code_ptr[ip + argc * 2 + 2] & ADDR_MASK);
-				Variant::Type key_builtin_type = (Variant::Type)_code_ptr[ip + argc * 2 + 5];
-				StringName key_native_type = get_global_name(_code_ptr[ip + argc * 2 + 6]);
+				Ref<Script> key_script_type = get_constant(code_ptr[ip + argc * 2 + 2] & ADDR_MASK);
+				Variant::Type key_builtin_type = (Variant::Type)code_ptr[ip + argc * 2 + 5];
+				StringName key_native_type = get_global_name(code_ptr[ip + argc * 2 + 6]);
 
 				String key_type_name;
 				if (key_script_type.is_valid() && key_script_type->is_valid()) {
@@ -640,9 +716,9 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 					key_type_name = Variant::get_type_name(key_builtin_type);
 				}
 
-				Ref<Script> value_script_type = get_constant(_code_ptr[ip + argc * 2 + 3] & ADDR_MASK);
-				Variant::Type value_builtin_type = (Variant::Type)_code_ptr[ip + argc * 2 + 7];
-				StringName value_native_type = get_global_name(_code_ptr[ip + argc * 2 + 8]);
+				Ref<Script> value_script_type = get_constant(code_ptr[ip + argc * 2 + 3] & ADDR_MASK);
+				Variant::Type value_builtin_type = (Variant::Type)code_ptr[ip + argc * 2 + 7];
+				StringName value_native_type = get_global_name(code_ptr[ip + argc * 2 + 8]);
 
 				String value_type_name;
 				if (value_script_type.is_valid() && value_script_type->is_valid()) {
@@ -678,10 +754,10 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 			case OPCODE_CALL:
 			case OPCODE_CALL_RETURN:
 			case OPCODE_CALL_ASYNC: {
-				bool ret = (_code_ptr[ip]) == OPCODE_CALL_RETURN;
-				bool async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
+				bool ret = (code_ptr[ip]) == OPCODE_CALL_RETURN;
+				bool async = (code_ptr[ip]) == OPCODE_CALL_ASYNC;
 
-				int instr_var_args = _code_ptr[++ip];
+				int instr_var_args = code_ptr[++ip];
 
 				if (ret) {
 					text += "call-ret ";
@@ -691,13 +767,13 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 					text += "call ";
 				}
 
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 				if (ret || async) {
 					text += DADDR(2 + argc) + " = ";
 				}
 
 				text += DADDR(1 + argc) + ".";
-				text += String(_global_names_ptr[_code_ptr[ip + 2 + instr_var_args]]);
+				text += String(_global_names_ptr[code_ptr[ip + 2 + instr_var_args]]);
 				text += "(";
 
 				for (int i = 0; i < argc; i++) {
@@ -712,8 +788,8 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 			} break;
 			case OPCODE_CALL_METHOD_BIND:
 			case OPCODE_CALL_METHOD_BIND_RET: {
-				bool ret = (_code_ptr[ip]) == OPCODE_CALL_METHOD_BIND_RET;
-				int instr_var_args = _code_ptr[++ip];
+				bool ret = (code_ptr[ip]) == OPCODE_CALL_METHOD_BIND_RET;
+				int instr_var_args = code_ptr[++ip];
 
 				if (ret) {
 					text += "call-method_bind-ret ";
@@ -721,9 +797,9 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 					text += "call-method_bind ";
 				}
 
-				MethodBind *method = _methods_ptr[_code_ptr[ip + 2 + instr_var_args]];
+				MethodBind *method = _methods_ptr[code_ptr[ip + 2 + instr_var_args]];
 
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 				if (ret) {
 					text += DADDR(2 + argc) + " = ";
 				}
@@ -743,16 +819,16 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr = 5 + argc;
 			} break;
 			case OPCODE_CALL_BUILTIN_STATIC: {
-				int instr_var_args = _code_ptr[++ip];
-				Variant::Type type = (Variant::Type)_code_ptr[ip + 1 + instr_var_args];
-				int argc = _code_ptr[ip + 3 + instr_var_args];
+				int instr_var_args = code_ptr[++ip];
+				Variant::Type type = (Variant::Type)code_ptr[ip + 1 + instr_var_args];
+				int argc = code_ptr[ip + 3 + instr_var_args];
 
 				text += "call built-in method static ";
 				text += DADDR(1 + argc);
 				text += " = ";
 				text += Variant::get_type_name(type);
 				text += ".";
-				text += _global_names_ptr[_code_ptr[ip + 2 + instr_var_args]].operator String();
+				text += _global_names_ptr[code_ptr[ip + 2 + instr_var_args]].operator String();
 				text += "(";
 
 				for (int i = 0; i < argc; i++) {
@@ -766,9 +842,9 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr += 5 + argc;
 			} break;
 			case OPCODE_CALL_NATIVE_STATIC: {
-				int instr_var_args = _code_ptr[++ip];
-				MethodBind *method = _methods_ptr[_code_ptr[ip + 1 + instr_var_args]];
-				int argc = _code_ptr[ip + 2 + instr_var_args];
+				int instr_var_args = code_ptr[++ip];
+				MethodBind *method = _methods_ptr[code_ptr[ip + 1 + instr_var_args]];
+				int argc = code_ptr[ip + 2 + instr_var_args];
 
 				text += "call native method static ";
 				text += DADDR(1 + argc);
@@ -790,10 +866,10 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 			} break;
 
 			case OPCODE_CALL_NATIVE_STATIC_VALIDATED_RETURN: {
-				int instr_var_args = _code_ptr[++ip];
+				int instr_var_args = code_ptr[++ip];
 				text += "call native static method validated (return) ";
-				MethodBind *method = _methods_ptr[_code_ptr[ip + 2 + instr_var_args]];
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				MethodBind *method = _methods_ptr[code_ptr[ip + 2 + instr_var_args]];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 				text += DADDR(1 + argc) + " = ";
 				text += method->get_instance_class();
 				text += ".";
@@ -810,13 +886,13 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 			} break;
 
 			case OPCODE_CALL_NATIVE_STATIC_VALIDATED_NO_RETURN: {
-				int instr_var_args = _code_ptr[++ip];
+				int instr_var_args = code_ptr[++ip];
 
 				text += "call native static method validated (no return) ";
 
-				MethodBind *method = _methods_ptr[_code_ptr[ip + 2 + instr_var_args]];
+				MethodBind *method = _methods_ptr[code_ptr[ip + 2 + instr_var_args]];
 
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 
 				text += method->get_instance_class();
 				text += ".";
@@ -835,10 +911,10 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 			} break;
 
 			case OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN: {
-				int instr_var_args = _code_ptr[++ip];
+				int instr_var_args = code_ptr[++ip];
 				text += "call method-bind validated (return) ";
-				MethodBind *method = _methods_ptr[_code_ptr[ip + 2 + instr_var_args]];
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				MethodBind *method = _methods_ptr[code_ptr[ip + 2 + instr_var_args]];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 				text += DADDR(2 + argc) + " = ";
 				text += DADDR(1 + argc) + ".";
 				text += method->get_name();
@@ -854,13 +930,13 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 			} break;
 
 			case OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN: {
-				int instr_var_args = _code_ptr[++ip];
+				int instr_var_args = code_ptr[++ip];
 
 				text += "call method-bind validated (no return) ";
 
-				MethodBind *method = _methods_ptr[_code_ptr[ip + 2 + instr_var_args]];
+				MethodBind *method = _methods_ptr[code_ptr[ip + 2 + instr_var_args]];
 
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 
 				text += DADDR(1 + argc) + ".";
 				text += method->get_name();
@@ -878,15 +954,15 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 			} break;
 
 			case OPCODE_CALL_BUILTIN_TYPE_VALIDATED: {
-				int instr_var_args = _code_ptr[++ip];
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				int instr_var_args = code_ptr[++ip];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 
 				text += "call-builtin-method validated ";
 
 				text += DADDR(2 + argc) + " = ";
 
 				text += DADDR(1) + ".";
-				text += builtin_methods_names[_code_ptr[ip + 4 + argc]];
+				text += builtin_methods_names[code_ptr[ip + 4 + argc]];
 
 				text += "(";
 
@@ -901,14 +977,14 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr = 5 + argc;
 			} break;
 			case OPCODE_CALL_UTILITY: {
-				int instr_var_args = _code_ptr[++ip];
+				int instr_var_args = code_ptr[++ip];
 
 				text += "call-utility ";
 
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 				text += DADDR(1 + argc) + " = ";
 
-				text += _global_names_ptr[_code_ptr[ip + 2 + instr_var_args]];
+				text += _global_names_ptr[code_ptr[ip + 2 + instr_var_args]];
 				text += "(";
 
 				for (int i = 0; i < argc; i++) {
@@ -922,14 +998,14 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr = 4 + argc;
 			} break;
 			case OPCODE_CALL_UTILITY_VALIDATED: {
-				int instr_var_args = _code_ptr[++ip];
+				int instr_var_args = code_ptr[++ip];
 
 				text += "call-utility validated ";
 
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 				text += DADDR(1 + argc) + " = ";
 
-				text += utilities_names[_code_ptr[ip + 3 + argc]];
+				text += utilities_names[code_ptr[ip + 3 + argc]];
 				text += "(";
 
 				for (int i = 0; i < argc; i++) {
@@ -943,14 +1019,14 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr = 4 + argc;
 			} break;
 			case OPCODE_CALL_GDSCRIPT_UTILITY: {
-				int instr_var_args = _code_ptr[++ip];
+				int instr_var_args = code_ptr[++ip];
 
 				text += "call-gdscript-utility ";
 
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 				text += DADDR(1 + argc) + " = ";
 
-				text += gds_utilities_names[_code_ptr[ip + 3 + argc]];
+				text += gds_utilities_names[code_ptr[ip + 3 + argc]];
 				text += "(";
 
 				for (int i = 0; i < argc; i++) {
@@ -964,14 +1040,14 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr = 4 + argc;
 			} break;
 			case OPCODE_CALL_SELF_BASE: {
-				int instr_var_args = _code_ptr[++ip];
+				int instr_var_args = code_ptr[++ip];
 
 				text += "call-self-base ";
 
-				int argc = _code_ptr[ip + 1 + instr_var_args];
+				int argc = code_ptr[ip + 1 + instr_var_args];
 				text += DADDR(2 + argc) + " = ";
 
-				text += _global_names_ptr[_code_ptr[ip + 2 + instr_var_args]];
+				text += _global_names_ptr[code_ptr[ip + 2 + instr_var_args]];
 				text += "(";
 
 				for (int i = 0; i < argc; i++) {
@@ -997,9 +1073,9 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr = 2;
 			} break;
 			case OPCODE_CREATE_LAMBDA: {
-				int instr_var_args = _code_ptr[++ip];
-				int captures_count = _code_ptr[ip + 1 + instr_var_args];
-				GDScriptFunction *lambda = _lambdas_ptr[_code_ptr[ip + 2 + instr_var_args]];
+				int instr_var_args = code_ptr[++ip];
+				int captures_count = code_ptr[ip + 1 + instr_var_args];
+				GDScriptFunction *lambda = _lambdas_ptr[code_ptr[ip + 2 + instr_var_args]];
 
 				text += DADDR(1 + captures_count);
 				text += "create lambda from ";
@@ -1017,9 +1093,9 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr = 4 + captures_count;
 			} break;
 			case OPCODE_CREATE_SELF_LAMBDA: {
-				int instr_var_args = _code_ptr[++ip];
-				int captures_count = _code_ptr[ip + 1 + instr_var_args];
-				GDScriptFunction *lambda = _lambdas_ptr[_code_ptr[ip + 2 + instr_var_args]];
+				int instr_var_args = code_ptr[++ip];
+				int captures_count = code_ptr[ip + 1 + instr_var_args];
+				GDScriptFunction *lambda = _lambdas_ptr[code_ptr[ip + 2 + instr_var_args]];
 
 				text += DADDR(1 + captures_count);
 				text += "create self lambda from ";
@@ -1038,7 +1114,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 			} break;
 			case OPCODE_JUMP: {
 				text += "jump ";
-				text += itos(_code_ptr[ip + 1]);
+				text += itos(code_ptr[ip + 1]);
 
 				incr = 2;
 			} break;
@@ -1046,7 +1122,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += "jump-if ";
 				text += DADDR(1);
 				text += " to ";
-				text += itos(_code_ptr[ip + 2]);
+				text += itos(code_ptr[ip + 2]);
 
 				incr = 3;
 			} break;
@@ -1054,7 +1130,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += "jump-if-not ";
 				text += DADDR(1);
 				text += " to ";
-				text += itos(_code_ptr[ip + 2]);
+				text += itos(code_ptr[ip + 2]);
 
 				incr = 3;
 			} break;
@@ -1067,7 +1143,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += "jump-if-shared ";
 				text += DADDR(1);
 				text += " to ";
-				text += itos(_code_ptr[ip + 2]);
+				text += itos(code_ptr[ip + 2]);
 
 				incr = 3;
 			} break;
@@ -1079,7 +1155,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 			} break;
 			case OPCODE_RETURN_TYPED_BUILTIN: {
 				text += "return typed builtin (";
-				text += Variant::get_type_name((Variant::Type)_code_ptr[ip + 2]);
+				text += Variant::get_type_name((Variant::Type)code_ptr[ip + 2]);
 				text += ") ";
 				text += DADDR(1);
 
@@ -1106,7 +1182,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				incr += 3;
 			} break;
 			case OPCODE_RETURN_TYPED_SCRIPT: {
-				Ref<Script> script = get_constant(_code_ptr[ip + 2] & ADDR_MASK);
+				Ref<Script> script = get_constant(code_ptr[ip + 2] & ADDR_MASK);
 
 				text += "return typed script (";
 				text += GDScript::debug_get_script_name(script);
@@ -1127,7 +1203,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 		text += " counter ";             \
 		text += DADDR(1);                \
 		text += " end ";                 \
-		text += itos(_code_ptr[ip + 4]); \
+		text += itos(code_ptr[ip + 4]); \
 		incr += 5;                       \
 	} break
 
@@ -1142,7 +1218,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 		text += " counter ";              \
 		text += DADDR(1);                 \
 		text += " end ";                  \
-		text += itos(_code_ptr[ip + 4]);  \
+		text += itos(code_ptr[ip + 4]);  \
 		incr += 5;                        \
 	} break
 
@@ -1176,7 +1252,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += " counter ";
 				text += DADDR(1);
 				text += " end ";
-				text += itos(_code_ptr[ip + 4]);
+				text += itos(code_ptr[ip + 4]);
 
 				incr += 5;
 			} break;
@@ -1189,7 +1265,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += " counter ";
 				text += DADDR(1);
 				text += " end ";
-				text += itos(_code_ptr[ip + 4]);
+				text += itos(code_ptr[ip + 4]);
 
 				incr += 5;
 			} break;
@@ -1198,7 +1274,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += "store global ";
 				text += DADDR(1);
 				text += " = ";
-				text += String::num_int64(_code_ptr[ip + 2]);
+				text += String::num_int64(code_ptr[ip + 2]);
 
 				incr += 3;
 			} break;
@@ -1206,12 +1282,12 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += "store named global ";
 				text += DADDR(1);
 				text += " = ";
-				text += String(_global_names_ptr[_code_ptr[ip + 2]]);
+				text += String(_global_names_ptr[code_ptr[ip + 2]]);
 
 				incr += 3;
 			} break;
 			case OPCODE_LINE: {
-				int line = _code_ptr[ip + 1] - 1;
+				int line = code_ptr[ip + 1] - 1;
 				if (line >= 0 && line < p_code_lines.size()) {
 					text += "line ";
 					text += itos(line + 1);
@@ -1272,6 +1348,12 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				DISASSEMBLE_TYPE_ADJUST(PACKED_COLOR_ARRAY);
 				DISASSEMBLE_TYPE_ADJUST(PACKED_VECTOR4_ARRAY);
 
+			case OPCODE_JUMP_IF_RELEASE: {
+				text += "jump-if-release ";
+				text += itos(code_ptr[ip + 1]);
+
+				incr = 2;
+			} break;
 			case OPCODE_ASSERT: {
 				text += "assert (";
 				text += DADDR(1);
@@ -42,6 +42,70 @@ StringName GDScriptFunction::get_global_name(int p_idx) const {
 	return global_names[p_idx];
 }
 
+void GDScriptFunction::_optimize() {
+	struct Specialization {
+		Variant::Operator op;
+		Variant::Type type;
+		Opcode opcode;
+		bool fused_jump;
+	};
+	static const Specialization specializations[] = {
+		{ Variant::OP_ADD, Variant::INT, OPCODE_OPERATOR_ADD_INT, false },
+		{ Variant::OP_SUBTRACT, Variant::INT, OPCODE_OPERATOR_SUBTRACT_INT, false },
+		{ Variant::OP_MULTIPLY, Variant::INT, OPCODE_OPERATOR_MULTIPLY_INT, false },
+		{ Variant::OP_ADD, Variant::FLOAT, OPCODE_OPERATOR_ADD_FLOAT, false },
+		{ Variant::OP_SUBTRACT, Variant::FLOAT, OPCODE_OPERATOR_SUBTRACT_FLOAT, false },
+		{ Variant::OP_MULTIPLY, Variant::FLOAT, OPCODE_OPERATOR_MULTIPLY_FLOAT, false },
+		{ Variant::OP_DIVIDE, Variant::FLOAT, OPCODE_OPERATOR_DIVIDE_FLOAT, false },
+		{ Variant::OP_EQUAL, Variant::INT, OPCODE_COMPARE_JUMP_EQUAL_INT, true },
+		{ Variant::OP_NOT_EQUAL, Variant::INT, OPCODE_COMPARE_JUMP_NOT_EQUAL_INT, true },
+		{ Variant::OP_LESS, Variant::INT, OPCODE_COMPARE_JUMP_LESS_INT, true },
+		{ Variant::OP_LESS_EQUAL, Variant::INT, OPCODE_COMPARE_JUMP_LESS_EQUAL_INT, true },
+		{ Variant::OP_GREATER, Variant::INT, OPCODE_COMPARE_JUMP_GREATER_INT, true },
+		{ Variant::OP_GREATER_EQUAL, Variant::INT, OPCODE_COMPARE_JUMP_GREATER_EQUAL_INT, true },
+		{ Variant::OP_LESS, Variant::FLOAT, OPCODE_COMPARE_JUMP_LESS_FLOAT, true },
+		{ Variant::OP_LESS_EQUAL, Variant::FLOAT, OPCODE_COMPARE_JUMP_LESS_EQUAL_FLOAT, true },
+		{ Variant::OP_GREATER, Variant::FLOAT, OPCODE_COMPARE_JUMP_GREATER_FLOAT, true },
+		{ Variant::OP_GREATER_EQUAL, Variant::FLOAT, OPCODE_COMPARE_JUMP_GREATER_EQUAL_FLOAT, true },
+	};
+
+	if (validated_operator_positions.is_empty()) {
+		return;
+	}
+
+	optimized_code = code;
+	int *optimized_ptr = optimized_code.ptrw();
+	bool specialized = false;
+
+	for (int position : validated_operator_positions) {
+		ERR_CONTINUE(position < 0 || position + 5 > _code_size || optimized_ptr[position] != OPCODE_OPERATOR_VALIDATED);
+		const int operator_idx = optimized_ptr[position + 4];
+		ERR_CONTINUE(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+
+		// The operand types were already checked by the compiler, so the specialized forms need no guards.
+		for (const Specialization &specialization : specializations) {
+			if (_operator_funcs_ptr[operator_idx] != Variant::get_validated_operator_evaluator(specialization.op, specialization.type, specialization.type)) {
+				continue;
+			}
+			if (specialization.fused_jump && (position + 8 > _code_size || optimized_ptr[position + 5] != OPCODE_JUMP_IF_NOT || optimized_ptr[position + 6] != optimized_ptr[position + 3])) {
+				break;
+			}
+			optimized_ptr[position] = specialization.opcode;
+			specialized = true;
+			break;
+		}
+	}
+
+	if (!specialized) {
+		optimized_code.clear();
+		return;
+	}
+
+	// Released after the code above is written, so no thread can load a partially specialized copy.
+	// The original code stays alive, other threads may still be running it.
+	_optimized_code_ptr.store(optimized_ptr, std::memory_order_release);
+}
+
 struct _GDFKC {
 	int order = 0;
 	List<int> pos;
@@ -121,6 +185,13 @@ GDScriptFunction::~GDScriptFunction() {
 		memdelete(lambdas[i]);
 	}
 
+	if (_call_sites_ptr) {
+		memdelete_arr(_call_sites_ptr);
+	}
+	if (_property_sites_ptr) {
+		memdelete_arr(_property_sites_ptr);
+	}
+
 	for (int i = 0; i < argument_types.size(); i++) {
 		argument_types.write[i].script_type_ref = Ref<Script>();
 	}
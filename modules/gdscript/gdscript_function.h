@@ -39,6 +39,7 @@
 #include "core/templates/pair.h"
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
+#include "core/variant/variant_call_site.h"
 
 class GDScriptInstance;
 class GDScript;
@@ -256,6 +257,24 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		// Specialized validated operators, only present in `optimized_code`.
+		OPCODE_OPERATOR_ADD_INT,
+		OPCODE_OPERATOR_SUBTRACT_INT,
+		OPCODE_OPERATOR_MULTIPLY_INT,
+		OPCODE_OPERATOR_ADD_FLOAT,
+		OPCODE_OPERATOR_SUBTRACT_FLOAT,
+		OPCODE_OPERATOR_MULTIPLY_FLOAT,
+		OPCODE_OPERATOR_DIVIDE_FLOAT,
+		OPCODE_COMPARE_JUMP_EQUAL_INT,
+		OPCODE_COMPARE_JUMP_NOT_EQUAL_INT,
+		OPCODE_COMPARE_JUMP_LESS_INT,
+		OPCODE_COMPARE_JUMP_LESS_EQUAL_INT,
+		OPCODE_COMPARE_JUMP_GREATER_INT,
+		OPCODE_COMPARE_JUMP_GREATER_EQUAL_INT,
+		OPCODE_COMPARE_JUMP_LESS_FLOAT,
+		OPCODE_COMPARE_JUMP_LESS_EQUAL_FLOAT,
+		OPCODE_COMPARE_JUMP_GREATER_FLOAT,
+		OPCODE_COMPARE_JUMP_GREATER_EQUAL_FLOAT,
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_DICTIONARY,
@@ -264,9 +283,11 @@ public:
 		OPCODE_SET_KEYED,
 		OPCODE_SET_KEYED_VALIDATED,
 		OPCODE_SET_INDEXED_VALIDATED,
+		OPCODE_SET_INDEXED_TYPED_ARRAY,
 		OPCODE_GET_KEYED,
 		OPCODE_GET_KEYED_VALIDATED,
 		OPCODE_GET_INDEXED_VALIDATED,
+		OPCODE_GET_INDEXED_TYPED_ARRAY,
 		OPCODE_SET_NAMED,
 		OPCODE_SET_NAMED_VALIDATED,
 		OPCODE_GET_NAMED,
@@ -406,6 +427,7 @@ public:
 		OPCODE_TYPE_ADJUST_PACKED_VECTOR3_ARRAY,
 		OPCODE_TYPE_ADJUST_PACKED_COLOR_ARRAY,
 		OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY,
+		OPCODE_JUMP_IF_RELEASE, // Skips debug-only code, like asserts, in release builds.
 		OPCODE_ASSERT,
 		OPCODE_BREAKPOINT,
 		OPCODE_LINE,
@@ -441,6 +463,8 @@ public:
 
 private:
 	friend class GDScript;
+	friend class GDScriptBytecode;
+	friend class GDScriptBytecodeSerializer;
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
 	friend class GDScriptLanguage;
@@ -517,6 +541,33 @@ private:
 	const GDScriptUtilityFunctions::FunctionPtr *_gds_utilities_ptr = nullptr;
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
+	// One per global name, used by untyped method calls.
+	VariantCallSite *_call_sites_ptr = nullptr;
+
+	// One per untyped named get or set instruction.
+	struct PropertySite {
+		VariantPropertySite native;
+		// Plain members of GDScript instances, keyed by `GDScript::member_layout_version` and script.
+		VariantInlineCache script_members;
+	};
+	Vector<StringName> property_site_members;
+	int _property_sites_count = 0;
+	PropertySite *_property_sites_ptr = nullptr;
+
+	// Calls and loop iterations after which `_optimize()` specializes the code.
+	static constexpr uint32_t OPTIMIZE_THRESHOLD = 1000;
+	SafeNumeric<uint32_t> hotness;
+	// Positions of every `OPCODE_OPERATOR_VALIDATED` in `code`.
+	Vector<int> validated_operator_positions;
+	// Same layout as `code`, so the call that triggers `_optimize()` can switch to it mid-loop.
+	Vector<int> optimized_code;
+	// Published once `optimized_code` is complete, calls load it when they start.
+	std::atomic<int *> _optimized_code_ptr = { nullptr };
+
+#ifdef TOOLS_ENABLED
+	// Code positions holding global array indices, which are remapped by name when loading exported bytecode.
+	Vector<int> global_index_positions;
+#endif
 
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
@@ -553,6 +604,14 @@ private:
 
 	_FORCE_INLINE_ String _get_call_error(const String &p_where, const Variant **p_argptrs, const Variant &p_ret, const Callable::CallError &p_err) const;
 	Variant _get_default_variant_for_data_type(const GDScriptDataType &p_data_type);
+	void _optimize();
+	_FORCE_INLINE_ int *_get_code_ptr() const {
+		int *optimized_ptr = _optimized_code_ptr.load(std::memory_order_acquire);
+		return optimized_ptr ? optimized_ptr : _code_ptr;
+	}
+	static const void *_resolve_script_member(VariantInlineCache &p_cache, const StringName &p_name, const GDScript *p_script);
+	static bool _get_script_member(PropertySite &p_site, const Variant &p_base, Variant &r_ret);
+	static bool _set_script_member(PropertySite &p_site, const Variant &p_base, const Variant &p_value);
 
 public:
 	static constexpr int MAX_CALL_DEPTH = 2048; // Limit to try to avoid crash because of a stack overflow.
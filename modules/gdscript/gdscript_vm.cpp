@@ -32,6 +32,7 @@
 #include "gdscript_function.h"
 #include "gdscript_lambda_callable.h"
 
+#include "core/config/engine.h"
 #include "core/os/os.h"
 
 #ifdef DEBUG_ENABLED
@@ -232,6 +233,23 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = {            \
 		&&OPCODE_OPERATOR,                               \
 		&&OPCODE_OPERATOR_VALIDATED,                     \
+		&&OPCODE_OPERATOR_ADD_INT,                       \
+		&&OPCODE_OPERATOR_SUBTRACT_INT,                  \
+		&&OPCODE_OPERATOR_MULTIPLY_INT,                  \
+		&&OPCODE_OPERATOR_ADD_FLOAT,                     \
+		&&OPCODE_OPERATOR_SUBTRACT_FLOAT,                \
+		&&OPCODE_OPERATOR_MULTIPLY_FLOAT,                \
+		&&OPCODE_OPERATOR_DIVIDE_FLOAT,                  \
+		&&OPCODE_COMPARE_JUMP_EQUAL_INT,                 \
+		&&OPCODE_COMPARE_JUMP_NOT_EQUAL_INT,             \
+		&&OPCODE_COMPARE_JUMP_LESS_INT,                  \
+		&&OPCODE_COMPARE_JUMP_LESS_EQUAL_INT,            \
+		&&OPCODE_COMPARE_JUMP_GREATER_INT,               \
+		&&OPCODE_COMPARE_JUMP_GREATER_EQUAL_INT,         \
+		&&OPCODE_COMPARE_JUMP_LESS_FLOAT,                \
+		&&OPCODE_COMPARE_JUMP_LESS_EQUAL_FLOAT,          \
+		&&OPCODE_COMPARE_JUMP_GREATER_FLOAT,             \
+		&&OPCODE_COMPARE_JUMP_GREATER_EQUAL_FLOAT,       \
 		&&OPCODE_TYPE_TEST_BUILTIN,                      \
 		&&OPCODE_TYPE_TEST_ARRAY,                        \
 		&&OPCODE_TYPE_TEST_DICTIONARY,                   \
@@ -240,9 +258,11 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_SET_KEYED,                              \
 		&&OPCODE_SET_KEYED_VALIDATED,                    \
 		&&OPCODE_SET_INDEXED_VALIDATED,                  \
+		&&OPCODE_SET_INDEXED_TYPED_ARRAY,                \
 		&&OPCODE_GET_KEYED,                              \
 		&&OPCODE_GET_KEYED_VALIDATED,                    \
 		&&OPCODE_GET_INDEXED_VALIDATED,                  \
+		&&OPCODE_GET_INDEXED_TYPED_ARRAY,                \
 		&&OPCODE_SET_NAMED,                              \
 		&&OPCODE_SET_NAMED_VALIDATED,                    \
 		&&OPCODE_GET_NAMED,                              \
@@ -382,6 +402,7 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_TYPE_ADJUST_PACKED_VECTOR3_ARRAY,       \
 		&&OPCODE_TYPE_ADJUST_PACKED_COLOR_ARRAY,         \
 		&&OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY,       \
+		&&OPCODE_JUMP_IF_RELEASE,                        \
 		&&OPCODE_ASSERT,                                 \
 		&&OPCODE_BREAKPOINT,                             \
 		&&OPCODE_LINE,                                   \
@@ -400,10 +421,10 @@ void (*type_init_function_table[])(Variant *) = {
 
 #ifdef DEBUG_ENABLED
 #define DISPATCH_OPCODE          \
-	last_opcode = _code_ptr[ip]; \
+	last_opcode = code_ptr[ip]; \
 	goto *switch_table_ops[last_opcode]
 #else // !DEBUG_ENABLED
-#define DISPATCH_OPCODE goto *switch_table_ops[_code_ptr[ip]]
+#define DISPATCH_OPCODE goto *switch_table_ops[code_ptr[ip]]
 #endif // DEBUG_ENABLED
 
 #define OPCODE_BREAK goto OPSEXIT
@@ -470,13 +491,86 @@ void (*type_init_function_table[])(Variant *) = {
 #define METHOD_CALL_ON_NULL_VALUE_ERROR(method_pointer) "Cannot call method '" + (method_pointer)->get_name() + "' on a null value."
 #define METHOD_CALL_ON_FREED_INSTANCE_ERROR(method_pointer) "Cannot call method '" + (method_pointer)->get_name() + "' on a previously freed instance."
 
+// Resolved for names that are not plain members of the script, so misses don't search the script again.
+static const char script_member_uncached = 0;
+
+static _FORCE_INLINE_ GDScriptInstance *_get_gdscript_instance(const Variant &p_base) {
+	if (p_base.get_type() != Variant::OBJECT) {
+		return nullptr;
+	}
+	Object *obj = p_base.get_validated_object();
+	if (!obj) {
+		return nullptr;
+	}
+	ScriptInstance *instance = obj->get_script_instance();
+	if (!instance || instance->get_language() != GDScriptLanguage::get_singleton() || instance->is_placeholder()) {
+		return nullptr;
+	}
+	return static_cast<GDScriptInstance *>(instance);
+}
+
+// Returns the `GDScript::MemberInfo` the site resolved for the script, if the member can be accessed directly.
+const void *GDScriptFunction::_resolve_script_member(VariantInlineCache &p_cache, const StringName &p_name, const GDScript *p_script) {
+	const uint32_t version = GDScript::member_layout_version.get();
+	const void *resolved = p_cache.lookup(version, p_script);
+	if (!resolved) {
+		HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = p_script->member_indices.find(p_name);
+		// Members with a getter or setter go through the instance.
+		resolved = (E && E->value.getter == StringName() && E->value.setter == StringName()) ? (const void *)&E->value : &script_member_uncached;
+		p_cache.store(version, p_script, resolved);
+	}
+	return resolved == &script_member_uncached ? nullptr : resolved;
+}
+
+bool GDScriptFunction::_get_script_member(PropertySite &p_site, const Variant &p_base, Variant &r_ret) {
+	GDScriptInstance *instance = _get_gdscript_instance(p_base);
+	if (!instance) {
+		return false;
+	}
+	const GDScript::MemberInfo *member = (const GDScript::MemberInfo *)_resolve_script_member(p_site.script_members, p_site.native.get_member(), instance->script.ptr());
+	if (!member || member->index >= instance->members.size()) {
+		return false;
+	}
+	// Copy first, `r_ret` may be the variant holding the instance.
+	Variant value = instance->members[member->index];
+	r_ret = value;
+	return true;
+}
+
+bool GDScriptFunction::_set_script_member(PropertySite &p_site, const Variant &p_base, const Variant &p_value) {
+#ifdef TOOLS_ENABLED
+	if (Engine::get_singleton()->is_editor_hint()) {
+		return false; // `Object::set()` also marks the object as edited.
+	}
+#endif
+	GDScriptInstance *instance = _get_gdscript_instance(p_base);
+	if (!instance) {
+		return false;
+	}
+	const GDScript::MemberInfo *member = (const GDScript::MemberInfo *)_resolve_script_member(p_site.script_members, p_site.native.get_member(), instance->script.ptr());
+	if (!member || member->index >= instance->members.size()) {
+		return false;
+	}
+	if (member->data_type.has_type && !member->data_type.is_type(p_value)) {
+		return false; // Converted by the instance.
+	}
+	instance->members.write[member->index] = p_value;
+	return true;
+}
+
 Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Callable::CallError &r_err, CallState *p_state) {
 	OPCODES_TABLE;
 
-	if (!_code_ptr) {
+	int *code_ptr = _get_code_ptr();
+	if (!code_ptr) {
 		return _get_default_variant_for_data_type(return_type);
 	}
 
+	if (unlikely(hotness.get() < OPTIMIZE_THRESHOLD) && hotness.increment() == OPTIMIZE_THRESHOLD) {
+		_optimize();
+		code_ptr = _get_code_ptr();
+	}
+
 	r_err.error = Callable::CallError::CALL_OK;
 
 	static thread_local int call_depth = 0;
@@ -638,7 +732,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #define GET_VARIANT_PTR(m_v, m_code_ofs)                                                            \
 	Variant *m_v;                                                                                   \
 	{                                                                                               \
-		int address = _code_ptr[ip + 1 + (m_code_ofs)];                                             \
+		int address = code_ptr[ip + 1 + (m_code_ofs)];                                             \
 		int address_type = (address & ADDR_TYPE_MASK) >> ADDR_BITS;                                 \
 		if (unlikely(address_type < 0 || address_type >= ADDR_TYPE_MAX)) {                          \
 			err_text = "Bad address type.";                                                         \
@@ -665,7 +759,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #define GET_VARIANT_PTR(m_v, m_code_ofs)                                                        \
 	Variant *m_v;                                                                               \
 	{                                                                                           \
-		int address = _code_ptr[ip + 1 + (m_code_ofs)];                                         \
+		int address = code_ptr[ip + 1 + (m_code_ofs)];                                         \
 		m_v = &variant_addresses[(address & ADDR_TYPE_MASK) >> ADDR_BITS][address & ADDR_MASK]; \
 		if (unlikely(!m_v))                                                                     \
 			OPCODE_BREAK;                                                                       \
@@ -674,7 +768,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #endif // DEBUG_ENABLED
 
 #define LOAD_INSTRUCTION_ARGS                   \
-	int instr_arg_count = _code_ptr[ip + 1];    \
+	int instr_arg_count = code_ptr[ip + 1];    \
 	for (int i = 0; i < instr_arg_count; i++) { \
 		GET_VARIANT_PTR(v, i + 1);              \
 		instruction_args[i] = v;                \
@@ -703,32 +797,32 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 #ifdef DEBUG_ENABLED
 	OPCODE_WHILE(ip < _code_size) {
-		int last_opcode = _code_ptr[ip];
+		int last_opcode = code_ptr[ip];
 #else
 	OPCODE_WHILE(true) {
 #endif
 
-		OPCODE_SWITCH(_code_ptr[ip]) {
+		OPCODE_SWITCH(code_ptr[ip]) {
 			OPCODE(OPCODE_OPERATOR) {
-				constexpr int _pointer_size = sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(*_code_ptr);
+				constexpr int _pointer_size = sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(*code_ptr);
 				CHECK_SPACE(7 + _pointer_size);
 
 				bool valid;
-				Variant::Operator op = (Variant::Operator)_code_ptr[ip + 4];
+				Variant::Operator op = (Variant::Operator)code_ptr[ip + 4];
 				GD_ERR_BREAK(op >= Variant::OP_MAX);
 
 				GET_VARIANT_PTR(a, 0);
 				GET_VARIANT_PTR(b, 1);
 				GET_VARIANT_PTR(dst, 2);
 				// Compute signatures (types of operands) so it can be optimized when matching.
-				uint32_t op_signature = _code_ptr[ip + 5];
+				uint32_t op_signature = code_ptr[ip + 5];
 				uint32_t actual_signature = (a->get_type() << 8) | (b->get_type());
 
 #ifdef DEBUG_ENABLED
 				if (op == Variant::OP_DIVIDE || op == Variant::OP_MODULE) {
 					// Don't optimize division and modulo since there's not check for division by zero with validated calls.
 					op_signature = 0xFFFF;
-					_code_ptr[ip + 5] = op_signature;
+					code_ptr[ip + 5] = op_signature;
 				}
 #endif
 
@@ -753,18 +847,18 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						op_func(a, b, dst);
 
 						// Check again in case another thread already set it.
-						if (_code_ptr[ip + 5] == 0) {
-							_code_ptr[ip + 5] = actual_signature;
-							_code_ptr[ip + 6] = static_cast<int>(ret_type);
-							Variant::ValidatedOperatorEvaluator *tmp = reinterpret_cast<Variant::ValidatedOperatorEvaluator *>(&_code_ptr[ip + 7]);
+						if (code_ptr[ip + 5] == 0) {
+							code_ptr[ip + 5] = actual_signature;
+							code_ptr[ip + 6] = static_cast<int>(ret_type);
+							Variant::ValidatedOperatorEvaluator *tmp = reinterpret_cast<Variant::ValidatedOperatorEvaluator *>(&code_ptr[ip + 7]);
 							*tmp = op_func;
 						}
 					}
 					initializer_mutex.unlock();
 				} else if (likely(op_signature == actual_signature)) {
 					// If the signature matches, we can use the optimized path.
-					Variant::Type ret_type = static_cast<Variant::Type>(_code_ptr[ip + 6]);
-					Variant::ValidatedOperatorEvaluator op_func = *reinterpret_cast<Variant::ValidatedOperatorEvaluator *>(&_code_ptr[ip + 7]);
+					Variant::Type ret_type = static_cast<Variant::Type>(code_ptr[ip + 6]);
+					Variant::ValidatedOperatorEvaluator op_func = *reinterpret_cast<Variant::ValidatedOperatorEvaluator *>(&code_ptr[ip + 7]);
 
 					// Make sure the return value has the correct type.
 					VariantInternal::initialize(dst, ret_type);
@@ -799,7 +893,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			OPCODE(OPCODE_OPERATOR_VALIDATED) {
 				CHECK_SPACE(5);
 
-				int operator_idx = _code_ptr[ip + 4];
+				int operator_idx = code_ptr[ip + 4];
 				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
 				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
 
@@ -813,13 +907,62 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_OPERATOR_SPECIALIZED(m_name, m_type, m_get_func, m_op)                                             \
+	OPCODE(OPCODE_OPERATOR_##m_name##_##m_type) {                                                                 \
+		CHECK_SPACE(5);                                                                                           \
+		GET_VARIANT_PTR(a, 0);                                                                                    \
+		GET_VARIANT_PTR(b, 1);                                                                                    \
+		GET_VARIANT_PTR(dst, 2);                                                                                  \
+		*VariantInternal::m_get_func(dst) = *VariantInternal::m_get_func(a) m_op *VariantInternal::m_get_func(b); \
+		ip += 5;                                                                                                  \
+	}                                                                                                             \
+	DISPATCH_OPCODE
+
+			OPCODE_OPERATOR_SPECIALIZED(ADD, INT, get_int, +);
+			OPCODE_OPERATOR_SPECIALIZED(SUBTRACT, INT, get_int, -);
+			OPCODE_OPERATOR_SPECIALIZED(MULTIPLY, INT, get_int, *);
+			OPCODE_OPERATOR_SPECIALIZED(ADD, FLOAT, get_float, +);
+			OPCODE_OPERATOR_SPECIALIZED(SUBTRACT, FLOAT, get_float, -);
+			OPCODE_OPERATOR_SPECIALIZED(MULTIPLY, FLOAT, get_float, *);
+			OPCODE_OPERATOR_SPECIALIZED(DIVIDE, FLOAT, get_float, /);
+
+#define OPCODE_COMPARE_JUMP(m_name, m_type, m_get_func, m_op)                               \
+	OPCODE(OPCODE_COMPARE_JUMP_##m_name##_##m_type) {                                       \
+		CHECK_SPACE(8);                                                                     \
+		GET_VARIANT_PTR(a, 0);                                                              \
+		GET_VARIANT_PTR(b, 1);                                                              \
+		GET_VARIANT_PTR(dst, 2);                                                            \
+		bool result = *VariantInternal::m_get_func(a) m_op *VariantInternal::m_get_func(b); \
+		*VariantInternal::get_bool(dst) = result;                                           \
+		if (result) {                                                                       \
+			ip += 8;                                                                        \
+		} else {                                                                            \
+			int to = code_ptr[ip + 7];                                                     \
+			GD_ERR_BREAK(to < 0 || to > _code_size);                                        \
+			ip = to;                                                                        \
+		}                                                                                   \
+	}                                                                                       \
+	DISPATCH_OPCODE
+
+			// Comparisons fused with the `OPCODE_JUMP_IF_NOT` testing their result, which is kept right after them.
+			OPCODE_COMPARE_JUMP(EQUAL, INT, get_int, ==);
+			OPCODE_COMPARE_JUMP(NOT_EQUAL, INT, get_int, !=);
+			OPCODE_COMPARE_JUMP(LESS, INT, get_int, <);
+			OPCODE_COMPARE_JUMP(LESS_EQUAL, INT, get_int, <=);
+			OPCODE_COMPARE_JUMP(GREATER, INT, get_int, >);
+			OPCODE_COMPARE_JUMP(GREATER_EQUAL, INT, get_int, >=);
+			OPCODE_COMPARE_JUMP(LESS, FLOAT, get_float, <);
+			OPCODE_COMPARE_JUMP(LESS_EQUAL, FLOAT, get_float, <=);
+			OPCODE_COMPARE_JUMP(GREATER, FLOAT, get_float, >);
+			OPCODE_COMPARE_JUMP(GREATER_EQUAL, FLOAT, get_float, >=);
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
 
-				Variant::Type builtin_type = (Variant::Type)_code_ptr[ip + 3];
+				Variant::Type builtin_type = (Variant::Type)code_ptr[ip + 3];
 				GD_ERR_BREAK(builtin_type < 0 || builtin_type >= Variant::VARIANT_MAX);
 
 				*dst = value->get_type() == builtin_type;
@@ -834,8 +977,8 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(value, 1);
 
 				GET_VARIANT_PTR(script_type, 2);
-				Variant::Type builtin_type = (Variant::Type)_code_ptr[ip + 4];
-				int native_type_idx = _code_ptr[ip + 5];
+				Variant::Type builtin_type = (Variant::Type)code_ptr[ip + 4];
+				int native_type_idx = code_ptr[ip + 5];
 				GD_ERR_BREAK(native_type_idx < 0 || native_type_idx >= _global_names_count);
 				const StringName native_type = _global_names_ptr[native_type_idx];
 
@@ -857,14 +1000,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(value, 1);
 
 				GET_VARIANT_PTR(key_script_type, 2);
-				Variant::Type key_builtin_type = (Variant::Type)_code_ptr[ip + 5];
-				int key_native_type_idx = _code_ptr[ip + 6];
+				Variant::Type key_builtin_type = (Variant::Type)code_ptr[ip + 5];
+				int key_native_type_idx = code_ptr[ip + 6];
 				GD_ERR_BREAK(key_native_type_idx < 0 || key_native_type_idx >= _global_names_count);
 				const StringName key_native_type = _global_names_ptr[key_native_type_idx];
 
 				GET_VARIANT_PTR(value_script_type, 3);
-				Variant::Type value_builtin_type = (Variant::Type)_code_ptr[ip + 7];
-				int value_native_type_idx = _code_ptr[ip + 8];
+				Variant::Type value_builtin_type = (Variant::Type)code_ptr[ip + 7];
+				int value_native_type_idx = code_ptr[ip + 8];
 				GD_ERR_BREAK(value_native_type_idx < 0 || value_native_type_idx >= _global_names_count);
 				const StringName value_native_type = _global_names_ptr[value_native_type_idx];
 
@@ -886,7 +1029,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
 
-				int native_type_idx = _code_ptr[ip + 3];
+				int native_type_idx = code_ptr[ip + 3];
 				GD_ERR_BREAK(native_type_idx < 0 || native_type_idx >= _global_names_count);
 				const StringName native_type = _global_names_ptr[native_type_idx];
 
@@ -989,7 +1132,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(index, 1);
 				GET_VARIANT_PTR(value, 2);
 
-				int index_setter = _code_ptr[ip + 4];
+				int index_setter = code_ptr[ip + 4];
 				GD_ERR_BREAK(index_setter < 0 || index_setter >= _keyed_setters_count);
 				const Variant::ValidatedKeyedSetter setter = _keyed_setters_ptr[index_setter];
 
@@ -1023,7 +1166,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(index, 1);
 				GET_VARIANT_PTR(value, 2);
 
-				int index_setter = _code_ptr[ip + 4];
+				int index_setter = code_ptr[ip + 4];
 				GD_ERR_BREAK(index_setter < 0 || index_setter >= _indexed_setters_count);
 				const Variant::ValidatedIndexedSetter setter = _indexed_setters_ptr[index_setter];
 
@@ -1052,6 +1195,38 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_SET_INDEXED_TYPED_ARRAY) {
+				CHECK_SPACE(4);
+
+				GET_VARIANT_PTR(dst, 0);
+				GET_VARIANT_PTR(index, 1);
+				GET_VARIANT_PTR(value, 2);
+
+				// The compiler guarantees the value matches the element type,
+				// so it's stored directly without going through Array::set().
+				Array *array = VariantInternal::get_array(dst);
+				int64_t int_index = *VariantInternal::get_int(index);
+				const int64_t size = array->size();
+				if (int_index < 0) {
+					int_index += size;
+				}
+
+				if (likely(!array->is_read_only() && int_index >= 0 && int_index < size)) {
+					(*array)[int_index] = *value;
+				}
+#ifdef DEBUG_ENABLED
+				else if (array->is_read_only()) {
+					err_text = "Invalid assignment on read-only value (on base: '" + _get_var_type(dst) + "').";
+					OPCODE_BREAK;
+				} else {
+					err_text = "Out of bounds set index '" + index->operator String() + "' (on base: '" + _get_var_type(dst) + "')";
+					OPCODE_BREAK;
+				}
+#endif
+				ip += 4;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_GET_KEYED) {
 				CHECK_SPACE(3);
 
@@ -1095,7 +1270,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(key, 1);
 				GET_VARIANT_PTR(dst, 2);
 
-				int index_getter = _code_ptr[ip + 4];
+				int index_getter = code_ptr[ip + 4];
 				GD_ERR_BREAK(index_getter < 0 || index_getter >= _keyed_getters_count);
 				const Variant::ValidatedKeyedGetter getter = _keyed_getters_ptr[index_getter];
 
@@ -1131,7 +1306,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(index, 1);
 				GET_VARIANT_PTR(dst, 2);
 
-				int index_getter = _code_ptr[ip + 4];
+				int index_getter = code_ptr[ip + 4];
 				GD_ERR_BREAK(index_getter < 0 || index_getter >= _indexed_getters_count);
 				const Variant::ValidatedIndexedGetter getter = _indexed_getters_ptr[index_getter];
 
@@ -1156,19 +1331,53 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_GET_INDEXED_TYPED_ARRAY) {
+				CHECK_SPACE(4);
+
+				GET_VARIANT_PTR(src, 0);
+				GET_VARIANT_PTR(index, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				const Array *array = VariantInternal::get_array(src);
+				int64_t int_index = *VariantInternal::get_int(index);
+				const int64_t size = array->size();
+				if (int_index < 0) {
+					int_index += size;
+				}
+
+				if (likely(int_index >= 0 && int_index < size)) {
+					*dst = (*array)[int_index];
+				}
+#ifdef DEBUG_ENABLED
+				else {
+					err_text = "Out of bounds get index '" + index->operator String() + "' (on base: '" + _get_var_type(src) + "')";
+					OPCODE_BREAK;
+				}
+#endif
+				ip += 4;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(4);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
 
-				int indexname = _code_ptr[ip + 3];
-
+#ifdef DEBUG_ENABLED
+				int indexname = code_ptr[ip + 3];
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
+#endif
 
-				bool valid;
-				dst->set_named(*index, *value, valid);
+				int site_index = code_ptr[ip + 4];
+				GD_ERR_BREAK(site_index < 0 || site_index >= _property_sites_count);
+				PropertySite &site = _property_sites_ptr[site_index];
+
+				bool valid = true;
+				if (!_set_script_member(site, *dst, *value)) {
+					site.native.set(*dst, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1189,7 +1398,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1199,7 +1408,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
 
-				int index_setter = _code_ptr[ip + 3];
+				int index_setter = code_ptr[ip + 3];
 				GD_ERR_BREAK(index_setter < 0 || index_setter >= _setters_count);
 				const Variant::ValidatedSetter setter = _setters_ptr[index_setter];
 
@@ -1209,23 +1418,33 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
 
-				int indexname = _code_ptr[ip + 3];
-
+#ifdef DEBUG_ENABLED
+				int indexname = code_ptr[ip + 3];
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
+#endif
 
-				bool valid;
+				int site_index = code_ptr[ip + 4];
+				GD_ERR_BREAK(site_index < 0 || site_index >= _property_sites_count);
+				PropertySite &site = _property_sites_ptr[site_index];
+
+				bool valid = true;
 #ifdef DEBUG_ENABLED
 				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+				Variant ret;
+				if (!_get_script_member(site, *src, ret)) {
+					site.native.get(*src, ret, valid);
+				}
 
 #else
-				*dst = src->get_named(*index, valid);
+				if (!_get_script_member(site, *src, *dst)) {
+					site.native.get(*src, *dst, valid);
+				}
 #endif
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1234,7 +1453,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 				*dst = ret;
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1244,7 +1463,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
 
-				int index_getter = _code_ptr[ip + 3];
+				int index_getter = code_ptr[ip + 3];
 				GD_ERR_BREAK(index_getter < 0 || index_getter >= _getters_count);
 				const Variant::ValidatedGetter getter = _getters_ptr[index_getter];
 
@@ -1256,7 +1475,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			OPCODE(OPCODE_SET_MEMBER) {
 				CHECK_SPACE(3);
 				GET_VARIANT_PTR(src, 0);
-				int indexname = _code_ptr[ip + 2];
+				int indexname = code_ptr[ip + 2];
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
@@ -1280,7 +1499,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			OPCODE(OPCODE_GET_MEMBER) {
 				CHECK_SPACE(3);
 				GET_VARIANT_PTR(dst, 0);
-				int indexname = _code_ptr[ip + 2];
+				int indexname = code_ptr[ip + 2];
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 #ifndef DEBUG_ENABLED
@@ -1305,7 +1524,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GDScript *gdscript = Object::cast_to<GDScript>(_class->operator Object *());
 				GD_ERR_BREAK(!gdscript);
 
-				int index = _code_ptr[ip + 3];
+				int index = code_ptr[ip + 3];
 				GD_ERR_BREAK(index < 0 || index >= gdscript->static_variables.size());
 
 				gdscript->static_variables.write[index] = *value;
@@ -1323,7 +1542,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GDScript *gdscript = Object::cast_to<GDScript>(_class->operator Object *());
 				GD_ERR_BREAK(!gdscript);
 
-				int index = _code_ptr[ip + 3];
+				int index = code_ptr[ip + 3];
 				GD_ERR_BREAK(index < 0 || index >= gdscript->static_variables.size());
 
 				*target = gdscript->static_variables[index];
@@ -1378,7 +1597,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(src, 1);
 
-				Variant::Type var_type = (Variant::Type)_code_ptr[ip + 3];
+				Variant::Type var_type = (Variant::Type)code_ptr[ip + 3];
 				GD_ERR_BREAK(var_type < 0 || var_type >= Variant::VARIANT_MAX);
 
 				if (src->get_type() != var_type) {
@@ -1408,8 +1627,8 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(src, 1);
 
 				GET_VARIANT_PTR(script_type, 2);
-				Variant::Type builtin_type = (Variant::Type)_code_ptr[ip + 4];
-				int native_type_idx = _code_ptr[ip + 5];
+				Variant::Type builtin_type = (Variant::Type)code_ptr[ip + 4];
+				int native_type_idx = code_ptr[ip + 5];
 				GD_ERR_BREAK(native_type_idx < 0 || native_type_idx >= _global_names_count);
 				const StringName native_type = _global_names_ptr[native_type_idx];
 
@@ -1443,14 +1662,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(src, 1);
 
 				GET_VARIANT_PTR(key_script_type, 2);
-				Variant::Type key_builtin_type = (Variant::Type)_code_ptr[ip + 5];
-				int key_native_type_idx = _code_ptr[ip + 6];
+				Variant::Type key_builtin_type = (Variant::Type)code_ptr[ip + 5];
+				int key_native_type_idx = code_ptr[ip + 6];
 				GD_ERR_BREAK(key_native_type_idx < 0 || key_native_type_idx >= _global_names_count);
 				const StringName key_native_type = _global_names_ptr[key_native_type_idx];
 
 				GET_VARIANT_PTR(value_script_type, 3);
-				Variant::Type value_builtin_type = (Variant::Type)_code_ptr[ip + 7];
-				int value_native_type_idx = _code_ptr[ip + 8];
+				Variant::Type value_builtin_type = (Variant::Type)code_ptr[ip + 7];
+				int value_native_type_idx = code_ptr[ip + 8];
 				GD_ERR_BREAK(value_native_type_idx < 0 || value_native_type_idx >= _global_names_count);
 				const StringName value_native_type = _global_names_ptr[value_native_type_idx];
 
@@ -1579,7 +1798,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				CHECK_SPACE(4);
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
-				Variant::Type to_type = (Variant::Type)_code_ptr[ip + 3];
+				Variant::Type to_type = (Variant::Type)code_ptr[ip + 3];
 
 				GD_ERR_BREAK(to_type < 0 || to_type >= Variant::VARIANT_MAX);
 
@@ -1690,9 +1909,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 
-				Variant::Type t = Variant::Type(_code_ptr[ip + 2]);
+				Variant::Type t = Variant::Type(code_ptr[ip + 2]);
 
 				Variant **argptrs = instruction_args;
 
@@ -1717,9 +1936,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				CHECK_SPACE(2 + instr_arg_count);
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 
-				int constructor_idx = _code_ptr[ip + 2];
+				int constructor_idx = code_ptr[ip + 2];
 				GD_ERR_BREAK(constructor_idx < 0 || constructor_idx >= _constructors_count);
 				Variant::ValidatedConstructor constructor = _constructors_ptr[constructor_idx];
 
@@ -1738,7 +1957,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				CHECK_SPACE(1 + instr_arg_count);
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 				Array array;
 				array.resize(argc);
 
@@ -1760,11 +1979,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				CHECK_SPACE(3 + instr_arg_count);
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 
 				GET_INSTRUCTION_ARG(script_type, argc + 1);
-				Variant::Type builtin_type = (Variant::Type)_code_ptr[ip + 2];
-				int native_type_idx = _code_ptr[ip + 3];
+				Variant::Type builtin_type = (Variant::Type)code_ptr[ip + 2];
+				int native_type_idx = code_ptr[ip + 3];
 				GD_ERR_BREAK(native_type_idx < 0 || native_type_idx >= _global_names_count);
 				const StringName native_type = _global_names_ptr[native_type_idx];
 
@@ -1789,7 +2008,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 				Dictionary dict;
 
 				for (int i = 0; i < argc; i++) {
@@ -1813,17 +2032,17 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				CHECK_SPACE(6 + instr_arg_count);
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 
 				GET_INSTRUCTION_ARG(key_script_type, argc * 2 + 1);
-				Variant::Type key_builtin_type = (Variant::Type)_code_ptr[ip + 2];
-				int key_native_type_idx = _code_ptr[ip + 3];
+				Variant::Type key_builtin_type = (Variant::Type)code_ptr[ip + 2];
+				int key_native_type_idx = code_ptr[ip + 3];
 				GD_ERR_BREAK(key_native_type_idx < 0 || key_native_type_idx >= _global_names_count);
 				const StringName key_native_type = _global_names_ptr[key_native_type_idx];
 
 				GET_INSTRUCTION_ARG(value_script_type, argc * 2 + 2);
-				Variant::Type value_builtin_type = (Variant::Type)_code_ptr[ip + 4];
-				int value_native_type_idx = _code_ptr[ip + 5];
+				Variant::Type value_builtin_type = (Variant::Type)code_ptr[ip + 4];
+				int value_native_type_idx = code_ptr[ip + 5];
 				GD_ERR_BREAK(value_native_type_idx < 0 || value_native_type_idx >= _global_names_count);
 				const StringName value_native_type = _global_names_ptr[value_native_type_idx];
 
@@ -1848,21 +2067,22 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			OPCODE(OPCODE_CALL_ASYNC)
 			OPCODE(OPCODE_CALL_RETURN)
 			OPCODE(OPCODE_CALL) {
-				bool call_ret = (_code_ptr[ip]) != OPCODE_CALL;
+				bool call_ret = (code_ptr[ip]) != OPCODE_CALL;
 #ifdef DEBUG_ENABLED
-				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
+				bool call_async = (code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
 				CHECK_SPACE(3 + instr_arg_count);
 
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 				GD_ERR_BREAK(argc < 0);
 
-				int methodname_idx = _code_ptr[ip + 2];
+				int methodname_idx = code_ptr[ip + 2];
 				GD_ERR_BREAK(methodname_idx < 0 || methodname_idx >= _global_names_count);
 				const StringName *methodname = &_global_names_ptr[methodname_idx];
+				VariantCallSite *call_site = &_call_sites_ptr[methodname_idx];
 
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
@@ -1882,7 +2102,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				Callable::CallError err;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					call_site->call(*base, (const Variant **)argptrs, argc, temp_ret, err);
 					*ret = temp_ret;
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
@@ -1912,7 +2132,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					}
 #endif
 				} else {
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					call_site->call(*base, (const Variant **)argptrs, argc, temp_ret, err);
 				}
 #ifdef DEBUG_ENABLED
 
@@ -1968,16 +2188,16 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 			OPCODE(OPCODE_CALL_METHOD_BIND)
 			OPCODE(OPCODE_CALL_METHOD_BIND_RET) {
-				bool call_ret = (_code_ptr[ip]) == OPCODE_CALL_METHOD_BIND_RET;
+				bool call_ret = (code_ptr[ip]) == OPCODE_CALL_METHOD_BIND_RET;
 				LOAD_INSTRUCTION_ARGS
 				CHECK_SPACE(3 + instr_arg_count);
 
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 				GD_ERR_BREAK(argc < 0);
-				GD_ERR_BREAK(_code_ptr[ip + 2] < 0 || _code_ptr[ip + 2] >= _methods_count);
-				MethodBind *method = _methods_ptr[_code_ptr[ip + 2]];
+				GD_ERR_BREAK(code_ptr[ip + 2] < 0 || code_ptr[ip + 2] >= _methods_count);
+				MethodBind *method = _methods_ptr[code_ptr[ip + 2]];
 
 				GET_INSTRUCTION_ARG(base, argc);
 
@@ -2057,14 +2277,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				ip += instr_arg_count;
 
-				GD_ERR_BREAK(_code_ptr[ip + 1] < 0 || _code_ptr[ip + 1] >= Variant::VARIANT_MAX);
-				Variant::Type builtin_type = (Variant::Type)_code_ptr[ip + 1];
+				GD_ERR_BREAK(code_ptr[ip + 1] < 0 || code_ptr[ip + 1] >= Variant::VARIANT_MAX);
+				Variant::Type builtin_type = (Variant::Type)code_ptr[ip + 1];
 
-				int methodname_idx = _code_ptr[ip + 2];
+				int methodname_idx = code_ptr[ip + 2];
 				GD_ERR_BREAK(methodname_idx < 0 || methodname_idx >= _global_names_count);
 				const StringName *methodname = &_global_names_ptr[methodname_idx];
 
-				int argc = _code_ptr[ip + 3];
+				int argc = code_ptr[ip + 3];
 				GD_ERR_BREAK(argc < 0);
 
 				GET_INSTRUCTION_ARG(ret, argc);
@@ -2091,10 +2311,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				ip += instr_arg_count;
 
-				GD_ERR_BREAK(_code_ptr[ip + 1] < 0 || _code_ptr[ip + 1] >= _methods_count);
-				MethodBind *method = _methods_ptr[_code_ptr[ip + 1]];
+				GD_ERR_BREAK(code_ptr[ip + 1] < 0 || code_ptr[ip + 1] >= _methods_count);
+				MethodBind *method = _methods_ptr[code_ptr[ip + 1]];
 
-				int argc = _code_ptr[ip + 2];
+				int argc = code_ptr[ip + 2];
 				GD_ERR_BREAK(argc < 0);
 
 				GET_INSTRUCTION_ARG(ret, argc);
@@ -2134,11 +2354,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 				GD_ERR_BREAK(argc < 0);
 
-				GD_ERR_BREAK(_code_ptr[ip + 2] < 0 || _code_ptr[ip + 2] >= _methods_count);
-				MethodBind *method = _methods_ptr[_code_ptr[ip + 2]];
+				GD_ERR_BREAK(code_ptr[ip + 2] < 0 || code_ptr[ip + 2] >= _methods_count);
+				MethodBind *method = _methods_ptr[code_ptr[ip + 2]];
 
 				Variant **argptrs = instruction_args;
 
@@ -2170,11 +2390,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 				GD_ERR_BREAK(argc < 0);
 
-				GD_ERR_BREAK(_code_ptr[ip + 2] < 0 || _code_ptr[ip + 2] >= _methods_count);
-				MethodBind *method = _methods_ptr[_code_ptr[ip + 2]];
+				GD_ERR_BREAK(code_ptr[ip + 2] < 0 || code_ptr[ip + 2] >= _methods_count);
+				MethodBind *method = _methods_ptr[code_ptr[ip + 2]];
 
 				Variant **argptrs = instruction_args;
 #ifdef DEBUG_ENABLED
@@ -2206,11 +2426,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 				GD_ERR_BREAK(argc < 0);
 
-				GD_ERR_BREAK(_code_ptr[ip + 2] < 0 || _code_ptr[ip + 2] >= _methods_count);
-				MethodBind *method = _methods_ptr[_code_ptr[ip + 2]];
+				GD_ERR_BREAK(code_ptr[ip + 2] < 0 || code_ptr[ip + 2] >= _methods_count);
+				MethodBind *method = _methods_ptr[code_ptr[ip + 2]];
 
 				GET_INSTRUCTION_ARG(base, argc);
 
@@ -2258,11 +2478,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 				GD_ERR_BREAK(argc < 0);
 
-				GD_ERR_BREAK(_code_ptr[ip + 2] < 0 || _code_ptr[ip + 2] >= _methods_count);
-				MethodBind *method = _methods_ptr[_code_ptr[ip + 2]];
+				GD_ERR_BREAK(code_ptr[ip + 2] < 0 || code_ptr[ip + 2] >= _methods_count);
+				MethodBind *method = _methods_ptr[code_ptr[ip + 2]];
 
 				GET_INSTRUCTION_ARG(base, argc);
 #ifdef DEBUG_ENABLED
@@ -2309,13 +2529,13 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 				GD_ERR_BREAK(argc < 0);
 
 				GET_INSTRUCTION_ARG(base, argc);
 
-				GD_ERR_BREAK(_code_ptr[ip + 2] < 0 || _code_ptr[ip + 2] >= _builtin_methods_count);
-				Variant::ValidatedBuiltInMethod method = _builtin_methods_ptr[_code_ptr[ip + 2]];
+				GD_ERR_BREAK(code_ptr[ip + 2] < 0 || code_ptr[ip + 2] >= _builtin_methods_count);
+				Variant::ValidatedBuiltInMethod method = _builtin_methods_ptr[code_ptr[ip + 2]];
 				Variant **argptrs = instruction_args;
 
 				GET_INSTRUCTION_ARG(ret, argc + 1);
@@ -2331,11 +2551,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 				GD_ERR_BREAK(argc < 0);
 
-				GD_ERR_BREAK(_code_ptr[ip + 2] < 0 || _code_ptr[ip + 2] >= _global_names_count);
-				StringName function = _global_names_ptr[_code_ptr[ip + 2]];
+				GD_ERR_BREAK(code_ptr[ip + 2] < 0 || code_ptr[ip + 2] >= _global_names_count);
+				StringName function = _global_names_ptr[code_ptr[ip + 2]];
 
 				Variant **argptrs = instruction_args;
 
@@ -2366,11 +2586,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 				GD_ERR_BREAK(argc < 0);
 
-				GD_ERR_BREAK(_code_ptr[ip + 2] < 0 || _code_ptr[ip + 2] >= _utilities_count);
-				Variant::ValidatedUtilityFunction function = _utilities_ptr[_code_ptr[ip + 2]];
+				GD_ERR_BREAK(code_ptr[ip + 2] < 0 || code_ptr[ip + 2] >= _utilities_count);
+				Variant::ValidatedUtilityFunction function = _utilities_ptr[code_ptr[ip + 2]];
 
 				Variant **argptrs = instruction_args;
 
@@ -2388,11 +2608,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 				GD_ERR_BREAK(argc < 0);
 
-				GD_ERR_BREAK(_code_ptr[ip + 2] < 0 || _code_ptr[ip + 2] >= _gds_utilities_count);
-				GDScriptUtilityFunctions::FunctionPtr function = _gds_utilities_ptr[_code_ptr[ip + 2]];
+				GD_ERR_BREAK(code_ptr[ip + 2] < 0 || code_ptr[ip + 2] >= _gds_utilities_count);
+				GDScriptUtilityFunctions::FunctionPtr function = _gds_utilities_ptr[code_ptr[ip + 2]];
 
 				Variant **argptrs = instruction_args;
 
@@ -2403,7 +2623,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 #ifdef DEBUG_ENABLED
 				if (err.error != Callable::CallError::CALL_OK) {
-					String methodstr = gds_utilities_names[_code_ptr[ip + 2]];
+					String methodstr = gds_utilities_names[code_ptr[ip + 2]];
 					if (dst->get_type() == Variant::STRING && !dst->operator String().is_empty()) {
 						// Call provided error string.
 						err_text = vformat(R"*(Error calling GDScript utility function "%s()": %s)*", methodstr, *dst);
@@ -2423,10 +2643,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				ip += instr_arg_count;
 
-				int argc = _code_ptr[ip + 1];
+				int argc = code_ptr[ip + 1];
 				GD_ERR_BREAK(argc < 0);
 
-				int self_fun = _code_ptr[ip + 2];
+				int self_fun = code_ptr[ip + 2];
 #ifdef DEBUG_ENABLED
 				if (self_fun < 0 || self_fun >= _global_names_count) {
 					err_text = "compiler bug, function name not found";
@@ -2593,10 +2813,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				ip += instr_arg_count;
 
-				int captures_count = _code_ptr[ip + 1];
+				int captures_count = code_ptr[ip + 1];
 				GD_ERR_BREAK(captures_count < 0);
 
-				int lambda_index = _code_ptr[ip + 2];
+				int lambda_index = code_ptr[ip + 2];
 				GD_ERR_BREAK(lambda_index < 0 || lambda_index >= _lambdas_count);
 				GDScriptFunction *lambda = _lambdas_ptr[lambda_index];
 
@@ -2624,10 +2844,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				ip += instr_arg_count;
 
-				int captures_count = _code_ptr[ip + 1];
+				int captures_count = code_ptr[ip + 1];
 				GD_ERR_BREAK(captures_count < 0);
 
-				int lambda_index = _code_ptr[ip + 2];
+				int lambda_index = code_ptr[ip + 2];
 				GD_ERR_BREAK(lambda_index < 0 || lambda_index >= _lambdas_count);
 				GDScriptFunction *lambda = _lambdas_ptr[lambda_index];
 
@@ -2654,9 +2874,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 			OPCODE(OPCODE_JUMP) {
 				CHECK_SPACE(2);
-				int to = _code_ptr[ip + 1];
+				int to = code_ptr[ip + 1];
 
 				GD_ERR_BREAK(to < 0 || to > _code_size);
+				if (to < ip && unlikely(hotness.get() < OPTIMIZE_THRESHOLD) && hotness.increment() == OPTIMIZE_THRESHOLD) {
+					// Hot loop, the optimized code has the same layout so this call continues in it.
+					_optimize();
+					code_ptr = _get_code_ptr();
+				}
 				ip = to;
 			}
 			DISPATCH_OPCODE;
@@ -2669,7 +2894,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool result = test->booleanize();
 
 				if (result) {
-					int to = _code_ptr[ip + 2];
+					int to = code_ptr[ip + 2];
 					GD_ERR_BREAK(to < 0 || to > _code_size);
 					ip = to;
 				} else {
@@ -2686,7 +2911,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool result = test->booleanize();
 
 				if (!result) {
-					int to = _code_ptr[ip + 2];
+					int to = code_ptr[ip + 2];
 					GD_ERR_BREAK(to < 0 || to > _code_size);
 					ip = to;
 				} else {
@@ -2707,7 +2932,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(val, 0);
 
 				if (val->is_shared()) {
-					int to = _code_ptr[ip + 2];
+					int to = code_ptr[ip + 2];
 					GD_ERR_BREAK(to < 0 || to > _code_size);
 					ip = to;
 				} else {
@@ -2730,7 +2955,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				CHECK_SPACE(3);
 				GET_VARIANT_PTR(r, 0);
 
-				Variant::Type ret_type = (Variant::Type)_code_ptr[ip + 2];
+				Variant::Type ret_type = (Variant::Type)code_ptr[ip + 2];
 				GD_ERR_BREAK(ret_type < 0 || ret_type >= Variant::VARIANT_MAX);
 
 				if (r->get_type() != ret_type) {
@@ -2762,8 +2987,8 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(r, 0);
 
 				GET_VARIANT_PTR(script_type, 1);
-				Variant::Type builtin_type = (Variant::Type)_code_ptr[ip + 3];
-				int native_type_idx = _code_ptr[ip + 4];
+				Variant::Type builtin_type = (Variant::Type)code_ptr[ip + 3];
+				int native_type_idx = code_ptr[ip + 4];
 				GD_ERR_BREAK(native_type_idx < 0 || native_type_idx >= _global_names_count);
 				const StringName native_type = _global_names_ptr[native_type_idx];
 
@@ -2798,14 +3023,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(r, 0);
 
 				GET_VARIANT_PTR(key_script_type, 1);
-				Variant::Type key_builtin_type = (Variant::Type)_code_ptr[ip + 4];
-				int key_native_type_idx = _code_ptr[ip + 5];
+				Variant::Type key_builtin_type = (Variant::Type)code_ptr[ip + 4];
+				int key_native_type_idx = code_ptr[ip + 5];
 				GD_ERR_BREAK(key_native_type_idx < 0 || key_native_type_idx >= _global_names_count);
 				const StringName key_native_type = _global_names_ptr[key_native_type_idx];
 
 				GET_VARIANT_PTR(value_script_type, 2);
-				Variant::Type value_builtin_type = (Variant::Type)_code_ptr[ip + 6];
-				int value_native_type_idx = _code_ptr[ip + 7];
+				Variant::Type value_builtin_type = (Variant::Type)code_ptr[ip + 6];
+				int value_native_type_idx = code_ptr[ip + 7];
 				GD_ERR_BREAK(value_native_type_idx < 0 || value_native_type_idx >= _global_names_count);
 				const StringName value_native_type = _global_names_ptr[value_native_type_idx];
 
@@ -2959,7 +3184,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						OPCODE_BREAK;
 					}
 #endif
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				} else {
@@ -2997,7 +3222,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					ip += 5;
 				} else {
 					// Jump to end of loop.
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				}
@@ -3024,7 +3249,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					ip += 5;
 				} else {
 					// Jump to end of loop.
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				}
@@ -3051,7 +3276,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					ip += 5;
 				} else {
 					// Jump to end of loop.
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				}
@@ -3078,7 +3303,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					ip += 5;
 				} else {
 					// Jump to end of loop.
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				}
@@ -3110,7 +3335,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					ip += 5;
 				} else {
 					// Jump to end of loop.
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				}
@@ -3142,7 +3367,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					ip += 5;
 				} else {
 					// Jump to end of loop.
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				}
@@ -3169,7 +3394,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					ip += 5;
 				} else {
 					// Jump to end of loop.
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				}
@@ -3194,7 +3419,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					ip += 5;
 				} else {
 					// Jump to end of loop.
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				}
@@ -3220,7 +3445,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					ip += 5;
 				} else {
 					// Jump to end of loop.
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				}
@@ -3242,7 +3467,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			*it = array->get(0);                                                                                           \
 			ip += 5;                                                                                                       \
 		} else {                                                                                                           \
-			int jumpto = _code_ptr[ip + 4];                                                                                \
+			int jumpto = code_ptr[ip + 4];                                                                                \
 			GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);                                                               \
 			ip = jumpto;                                                                                                   \
 		}                                                                                                                  \
@@ -3298,7 +3523,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif
 				if (!has_next.booleanize()) {
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				} else {
@@ -3332,7 +3557,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						OPCODE_BREAK;
 					}
 #endif
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				} else {
@@ -3362,7 +3587,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				(*count)++;
 
 				if (*count >= size) {
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				} else {
@@ -3386,7 +3611,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				(*count)++;
 
 				if (*count >= size) {
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				} else {
@@ -3410,7 +3635,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				(*count)++;
 
 				if (*count >= bounds->y) {
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				} else {
@@ -3434,7 +3659,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				(*count)++;
 
 				if (*count >= bounds->y) {
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				} else {
@@ -3458,7 +3683,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				*count += bounds->z;
 
 				if ((bounds->z < 0 && *count <= bounds->y) || (bounds->z > 0 && *count >= bounds->y)) {
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				} else {
@@ -3482,7 +3707,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				*count += bounds->z;
 
 				if ((bounds->z < 0 && *count <= bounds->y) || (bounds->z > 0 && *count >= bounds->y)) {
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				} else {
@@ -3505,7 +3730,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				(*idx)++;
 
 				if (*idx >= str->length()) {
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				} else {
@@ -3527,7 +3752,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				const Variant *next = dict->next(counter);
 
 				if (!next) {
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				} else {
@@ -3551,7 +3776,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				(*idx)++;
 
 				if (*idx >= array->size()) {
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				} else {
@@ -3572,7 +3797,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		int64_t *idx = VariantInternal::get_int(counter);                                           \
 		(*idx)++;                                                                                   \
 		if (*idx >= array->size()) {                                                                \
-			int jumpto = _code_ptr[ip + 4];                                                         \
+			int jumpto = code_ptr[ip + 4];                                                         \
 			GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);                                        \
 			ip = jumpto;                                                                            \
 		} else {                                                                                    \
@@ -3631,7 +3856,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif
 				if (!has_next.booleanize()) {
-					int jumpto = _code_ptr[ip + 4];
+					int jumpto = code_ptr[ip + 4];
 					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
 					ip = jumpto;
 				} else {
@@ -3653,7 +3878,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 			OPCODE(OPCODE_STORE_GLOBAL) {
 				CHECK_SPACE(3);
-				int global_idx = _code_ptr[ip + 2];
+				int global_idx = code_ptr[ip + 2];
 				GD_ERR_BREAK(global_idx < 0 || global_idx >= GDScriptLanguage::get_singleton()->get_global_array_size());
 
 				GET_VARIANT_PTR(dst, 0);
@@ -3665,7 +3890,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 			OPCODE(OPCODE_STORE_NAMED_GLOBAL) {
 				CHECK_SPACE(3);
-				int globalname_idx = _code_ptr[ip + 2];
+				int globalname_idx = code_ptr[ip + 2];
 				GD_ERR_BREAK(globalname_idx < 0 || globalname_idx >= _global_names_count);
 				const StringName *globalname = &_global_names_ptr[globalname_idx];
 				GD_ERR_BREAK(!GDScriptLanguage::get_singleton()->get_named_globals_map().has(*globalname));
@@ -3725,6 +3950,20 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			OPCODE_TYPE_ADJUST(PACKED_COLOR_ARRAY, PackedColorArray);
 			OPCODE_TYPE_ADJUST(PACKED_VECTOR4_ARRAY, PackedVector4Array);
 
+			OPCODE(OPCODE_JUMP_IF_RELEASE) {
+				CHECK_SPACE(2);
+
+#ifdef DEBUG_ENABLED
+				ip += 2;
+#else
+				int to = code_ptr[ip + 1];
+
+				GD_ERR_BREAK(to < 0 || to > _code_size);
+				ip = to;
+#endif
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_ASSERT) {
 				CHECK_SPACE(3);
 
@@ -3734,7 +3973,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				if (!result) {
 					String message_str;
-					if (_code_ptr[ip + 2] != 0) {
+					if (code_ptr[ip + 2] != 0) {
 						GET_VARIANT_PTR(message, 1);
 						Variant message_var = *message;
 						if (message->get_type() != Variant::NIL) {
@@ -3767,7 +4006,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			OPCODE(OPCODE_LINE) {
 				CHECK_SPACE(2);
 
-				line = _code_ptr[ip + 1];
+				line = code_ptr[ip + 1];
 				ip += 2;
 
 				if (EngineDebugger::is_active()) {
@@ -3805,7 +4044,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 #if 0 // Enable for debugging.
 			default: {
-				err_text = "Illegal opcode " + itos(_code_ptr[ip]) + " at address " + itos(ip);
+				err_text = "Illegal opcode " + itos(code_ptr[ip]) + " at address " + itos(ip);
 				OPCODE_BREAK;
 			}
 #endif
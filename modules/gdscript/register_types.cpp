@@ -31,6 +31,7 @@
 #include "register_types.h"
 
 #include "gdscript.h"
+#include "gdscript_bytecode.h"
 #include "gdscript_cache.h"
 #include "gdscript_parser.h"
 #include "gdscript_tokenizer_buffer.h"
@@ -80,6 +81,7 @@ class EditorExportGDScript : public EditorExportPlugin {
 
 	static constexpr int DEFAULT_SCRIPT_MODE = EditorExportPreset::MODE_SCRIPT_BINARY_TOKENS_COMPRESSED;
 	int script_mode = DEFAULT_SCRIPT_MODE;
+	GDScriptBytecodeSerializer bytecode_serializer;
 
 protected:
 	virtual void _export_begin(const HashSet<String> &p_features, bool p_debug, const String &p_path, int p_flags) override {
@@ -109,6 +111,24 @@ protected:
 		}
 
 		add_file(p_path.get_basename() + ".gdc", file, true);
+
+		// The editor compiles debug bytecode, release export templates jump over its asserts.
+		// The tokens are always exported too, so scripts still load if the bytecode is rejected.
+		if (script_mode != EditorExportPreset::MODE_SCRIPT_COMPILED_BYTECODE) {
+			return;
+		}
+
+		Ref<GDScript> script = ResourceLoader::load(p_path);
+		if (script.is_null() || !script->is_valid()) {
+			return;
+		}
+
+		Vector<uint8_t> bytecode = bytecode_serializer.serialize(script.ptr());
+		if (bytecode.is_empty()) {
+			print_verbose(vformat(R"(GDScript: "%s" can't be stored as bytecode, only binary tokens are exported.)", p_path));
+			return;
+		}
+		add_file(p_path.get_basename() + ".gdbc", bytecode, false);
 	}
 
 public:
@@ -32,7 +32,15 @@
 
 #include "gdscript_test_runner.h"
 
+#include "../gdscript_byte_codegen.h"
+#include "../gdscript_bytecode.h"
+#include "../gdscript_cache.h"
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+
 #include "tests/test_macros.h"
+#include "tests/test_utils.h"
 
 namespace GDScriptTests {
 
@@ -72,6 +80,244 @@ func _init():
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
 
+#ifdef TOOLS_ENABLED
+TEST_CASE("[Modules][GDScript] Load compiled bytecode and run it") {
+	GDScriptLanguage::get_singleton()->init();
+	const String path = "res://bytecode_round_trip.gd";
+
+	Vector<uint8_t> bytecode;
+	{
+		Ref<GDScript> gdscript = memnew(GDScript);
+		gdscript->set_path(path);
+		gdscript->set_source_code(R"(
+extends RefCounted
+
+const OFFSET = 2
+
+class Inner:
+	var factor := 2
+	func scale(value: int) -> int:
+		return value * factor
+
+func _init():
+	var add := func(value: int) -> int: return value + OFFSET
+	assert(add.call(0) == OFFSET, "Asserts are skipped in release builds.")
+	set_meta("result", add.call(Inner.new().scale(20)))
+)");
+		ERR_PRINT_OFF;
+		const Error error = gdscript->reload();
+		ERR_PRINT_ON;
+		REQUIRE_MESSAGE(error == OK, "The script should compile successfully.");
+
+		GDScriptBytecodeSerializer serializer;
+		bytecode = serializer.serialize(gdscript.ptr());
+		GDScriptCache::remove_script(path);
+	}
+	REQUIRE_MESSAGE(GDScriptBytecode::is_compatible(bytecode), "The script should be serialized to bytecode.");
+
+	// No source code is set, so the script can only work if the bytecode was loaded.
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_path(path);
+	gdscript->set_bytecode_source(bytecode);
+	CHECK_MESSAGE(gdscript->reload() == OK, "The bytecode should load successfully.");
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(gdscript);
+	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The loaded bytecode should run like the compiled script.");
+
+	ref_counted->set_script(Variant());
+	GDScriptCache::remove_script(path);
+}
+#endif // TOOLS_ENABLED
+
+// Collects the script errors reported while loading, with paths relative to the script directory.
+struct ScriptErrorCollector {
+	String dir;
+	Vector<String> errors;
+	ErrorHandlerList handler;
+
+	static void _collect_error(void *p_self, const char *p_func, const char *p_file, int p_line, const char *p_error, const char *p_errorexp, bool p_editor_notify, ErrorHandlerType p_type) {
+		if (p_type != ERR_HANDLER_SCRIPT) {
+			return;
+		}
+		ScriptErrorCollector *self = static_cast<ScriptErrorCollector *>(p_self);
+		self->errors.push_back(vformat("%s:%d: %s", String::utf8(p_file).get_file(), p_line, String::utf8(p_error).replace(self->dir, "")));
+	}
+
+	ScriptErrorCollector(const String &p_dir) {
+		dir = p_dir;
+		handler.errfunc = _collect_error;
+		handler.userdata = this;
+		add_error_handler(&handler);
+	}
+
+	~ScriptErrorCollector() {
+		remove_error_handler(&handler);
+	}
+};
+
+// Scripts preloading each other, a cyclic member reference and a parse error.
+static Vector<String> write_dependent_scripts(const String &p_dir) {
+	static const char *scripts[][2] = {
+		{ "a.gd", "extends \"b.gd\"\n\nconst C = preload(\"c.gd\")\n\nfunc value() -> int:\n\treturn base_value() + C.new().value()\n" },
+		{ "b.gd", "extends RefCounted\n\nfunc base_value() -> int:\n\treturn 1\n" },
+		{ "c.gd", "extends RefCounted\n\nconst D = preload(\"d.gd\")\n\nfunc value() -> int:\n\treturn 10\n\nfunc other() -> int:\n\treturn D.new().value()\n" },
+		{ "d.gd", "extends RefCounted\n\nconst C = preload(\"c.gd\")\n\nfunc value() -> int:\n\treturn 100 + C.new().value()\n" },
+		{ "cyclic_a.gd", "extends RefCounted\n\nconst B = preload(\"cyclic_b.gd\")\n\nvar v = B.v\n" },
+		{ "cyclic_b.gd", "extends RefCounted\n\nconst A = preload(\"cyclic_a.gd\")\n\nvar v = A.v\n" },
+		{ "broken.gd", "extends RefCounted\n\nfunc broken(:\n\tpass\n" },
+		{ "extends_broken.gd", "extends \"broken.gd\"\n" },
+	};
+
+	DirAccess::make_dir_recursive_absolute(p_dir);
+	Vector<String> paths;
+	for (const auto &script : scripts) {
+		const String path = p_dir.path_join(script[0]);
+		Ref<FileAccess> file = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(file.is_valid());
+		file->store_string(script[1]);
+		paths.push_back(path);
+	}
+	return paths;
+}
+
+static Vector<String> load_dependent_scripts(const Vector<String> &p_paths) {
+	Vector<String> states;
+	for (const String &path : p_paths) {
+		Error error = OK;
+		Ref<GDScript> script = GDScriptCache::get_full_script(path, error);
+		const bool valid = script.is_valid() && script->is_valid();
+		String state = vformat("%s: error %d, valid %s, cached %s, parser %s", path.get_file(), error, valid, GDScriptCache::get_cached_script(path).is_valid(), GDScriptCache::has_parser(path));
+		if (valid && script->get_base_script().is_valid()) {
+			state += ", base " + script->get_base_script()->get_path().get_file();
+		}
+		if (valid && script->has_method("value")) {
+			Ref<RefCounted> instance = memnew(RefCounted);
+			instance->set_script(script);
+			state += vformat(", value %d", instance->call("value"));
+			if (script->has_method("other")) {
+				state += vformat(", other %d", instance->call("other"));
+			}
+			instance->set_script(Variant());
+		}
+		states.push_back(state);
+	}
+	return states;
+}
+
+static void remove_dependent_scripts(const Vector<String> &p_paths) {
+	for (const String &path : p_paths) {
+		GDScriptCache::remove_script(path);
+		DirAccess::remove_absolute(path);
+	}
+	DirAccess::remove_absolute(p_paths[0].get_base_dir());
+}
+
+TEST_CASE("[Modules][GDScript] Parallel preload matches loading on demand") {
+	GDScriptLanguage::get_singleton()->init();
+
+	const Vector<String> serial_paths = write_dependent_scripts(TestUtils::get_temp_path("gdscript_preload/serial"));
+	const Vector<String> parallel_paths = write_dependent_scripts(TestUtils::get_temp_path("gdscript_preload/parallel"));
+
+	Vector<String> serial_states;
+	Vector<String> serial_errors;
+	{
+		ScriptErrorCollector collector(serial_paths[0].get_base_dir());
+		ERR_PRINT_OFF;
+		serial_states = load_dependent_scripts(serial_paths);
+		ERR_PRINT_ON;
+		serial_errors = collector.errors;
+	}
+
+	Vector<String> parallel_states;
+	Vector<String> parallel_errors;
+	{
+		ScriptErrorCollector collector(parallel_paths[0].get_base_dir());
+		// The base scripts are left out, they must be found from the scripts extending them.
+		Vector<String> roots = parallel_paths;
+		roots.erase(parallel_paths[1]);
+		roots.erase(parallel_paths[6]);
+		GDScriptCache::preload_scripts(roots);
+		CHECK_MESSAGE(collector.errors.is_empty(), "Preloading should leave reporting errors to the loading script.");
+
+		for (const String &path : parallel_paths) {
+			const String file = path.get_file();
+			CHECK_MESSAGE(GDScriptCache::has_parser(path) == (file != "broken.gd"), vformat("Unexpected preloaded parser state for \"%s\".", file));
+		}
+
+		ERR_PRINT_OFF;
+		parallel_states = load_dependent_scripts(parallel_paths);
+		ERR_PRINT_ON;
+		parallel_errors = collector.errors;
+	}
+
+	CHECK(serial_states[0].ends_with("base b.gd, value 11"));
+	CHECK(serial_states[2].ends_with("value 10, other 110"));
+	CHECK(serial_states[6].begins_with(vformat("broken.gd: error %d,", ERR_PARSE_ERROR)));
+	CHECK_FALSE(serial_errors.is_empty());
+
+	REQUIRE(parallel_states.size() == serial_states.size());
+	for (int i = 0; i < serial_states.size(); i++) {
+		CHECK(parallel_states[i] == serial_states[i]);
+	}
+	REQUIRE(parallel_errors.size() == serial_errors.size());
+	for (int i = 0; i < serial_errors.size(); i++) {
+		CHECK(parallel_errors[i] == serial_errors[i]);
+	}
+
+	remove_dependent_scripts(serial_paths);
+	remove_dependent_scripts(parallel_paths);
+}
+
+static Variant run_vector_math(bool p_forward_operator_results, int p_iterations, uint64_t &r_usec) {
+	const bool was_enabled = GDScriptByteCodeGenerator::is_operator_result_forwarding_enabled();
+	GDScriptByteCodeGenerator::set_operator_result_forwarding_enabled(p_forward_operator_results);
+
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends RefCounted
+
+func run(iterations: int) -> Vector3:
+	var position := Vector3()
+	var velocity := Vector3(1, 2, 3)
+	var offset := Vector2()
+	var step := Vector2(0.5, 0.25)
+	for i in iterations:
+		velocity = velocity * 0.99
+		position = position + velocity
+		offset = offset + step
+		offset = offset * 0.5
+	return position + Vector3(offset.x, offset.y, 0)
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	GDScriptByteCodeGenerator::set_operator_result_forwarding_enabled(was_enabled);
+	REQUIRE_MESSAGE(error == OK, "The script should compile successfully.");
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(gdscript);
+
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	const Variant result = ref_counted->call("run", p_iterations);
+	r_usec = OS::get_singleton()->get_ticks_usec() - begin;
+	return result;
+}
+
+TEST_CASE_BENCHMARK("[Modules][GDScript][Benchmark] Typed vector arithmetic in a loop") {
+	GDScriptLanguage::get_singleton()->init();
+	const int iterations = 1000000;
+
+	uint64_t before_usec = 0;
+	uint64_t after_usec = 0;
+	const Variant before = run_vector_math(false, iterations, before_usec);
+	const Variant after = run_vector_math(true, iterations, after_usec);
+
+	MESSAGE(vformat("%d iterations: %d usec with a copy per assignment, %d usec writing operator results into the locals.", iterations, before_usec, after_usec).utf8().get_data());
+	CHECK(before.get_type() == Variant::VECTOR3);
+	CHECK(after == before);
+}
+
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
 	GDScriptLanguage *lang = GDScriptLanguage::get_singleton();
 
@@ -0,0 +1,43 @@
+# Typed operator results may be written straight into the local they are assigned to.
+
+func test():
+	var position := Vector3(1, 2, 3)
+	var velocity := Vector3(0.5, 0, -1)
+	for _i in 4:
+		position = position + velocity
+	print(position)
+
+	var cell := Vector3i(1, 1, 1)
+	cell *= 3
+	cell -= Vector3i(0, 1, 2)
+	print(cell)
+
+	var transform := Transform3D.IDENTITY
+	var step := Transform3D(Basis.IDENTITY, Vector3(1, 0, 0))
+	for _i in 3:
+		transform = transform * step
+	print(transform.origin)
+
+	var v := Vector2(1, 1)
+	v = v * 2.0 + v
+	print(v)
+
+	var w := Vector4(1, 2, 3, 4)
+	w = w - Vector4(1, 1, 1, 1)
+	print(w)
+
+	var total: int
+	for i in 10:
+		var squared: int
+		squared = i * i
+		total += squared
+	print(total)
+
+	var below := true
+	below = position.x < cell.x
+	print(below)
+
+	var untyped = 5
+	var counter := 1
+	counter = counter + untyped
+	print(counter)
@@ -0,0 +1,21 @@
+func test():
+	var ints: Array[int] = [1, 2, 3]
+	var index := 1
+	ints[index] = 20
+	ints[-1] = 30
+	var first: int = ints[0]
+	print(first)
+	print(ints[index])
+	print(ints[-1])
+
+	var vectors: Array[Vector3] = [Vector3.ZERO, Vector3.ONE]
+	var value := Vector3(1, 2, 3)
+	vectors[index] = value
+	vectors[0] = vectors[index] * 2.0
+	print(vectors)
+
+	# Copies are independent from the typed array storage.
+	var copy := vectors[0]
+	copy.x = 100.0
+	print(vectors[0])
+	print(vectors.get_typed_builtin() == TYPE_VECTOR3)
@@ -0,0 +1,51 @@
+# Loops and calls long enough for the typed operators to be specialized while running.
+
+func scale(value: float, factor: float) -> float:
+	return value * factor / 2.0 - 1.0
+
+func test():
+	var sum := 0
+	var count := 0
+	for i: int in 3000:
+		if i < 1500:
+			sum += i * 2
+		elif i >= 2500:
+			sum -= i
+		if i != 1000 and i <= 2999:
+			count += 1
+	print(sum)
+	print(count)
+
+	var total := 0.0
+	var step := 0
+	while step < 2000:
+		total += scale(float(step), 3.0)
+		step += 1
+	print(total)
+
+	var multiples := 0
+	var last := 0
+	var above := 0
+	var below := 0
+	var big := 0
+	var tiny := 0
+	for k: int in 1500:
+		if k % 7 == 0:
+			multiples += 1
+		if k > 1400:
+			last += 1
+		var value := float(k) / 4.0
+		if value >= 100.0:
+			above += 1
+		if value < 50.0:
+			below += 1
+		if value > 300.0:
+			big += 1
+		if value <= 0.5:
+			tiny += 1
+	print(multiples)
+	print(last)
+	print(above)
+	print(below)
+	print(big)
+	print(tiny)
@@ -0,0 +1,45 @@
+# Untyped property access goes through per-instruction inline caches, which must
+# follow the receiver's script or class and keep setters, getters and conversions.
+
+class A:
+	var value = 1
+	var ratio: float = 0.0
+	var with_setter = 0:
+		set(v):
+			with_setter = v * 2
+
+class B:
+	var other = "x"
+	var value = 10
+
+func read_value(obj):
+	return obj.value
+
+func write_value(obj, v):
+	obj.value = v
+
+func test():
+	var a = A.new()
+	var b = B.new()
+	var total = 0
+	for _i in 10:
+		total += read_value(a) + read_value(b)
+	print(total)
+
+	write_value(a, 5)
+	write_value(b, 7)
+	print(read_value(a) + read_value(b))
+
+	a.ratio = 3
+	print(a.ratio)
+
+	a.with_setter = 4
+	print(a.with_setter)
+
+	var resource = Resource.new()
+	for label in ["first", "second"]:
+		resource.resource_name = label
+		print(resource.resource_name)
+
+	for receiver in [a, b, {"value": 9}, a]:
+		print(read_value(receiver))
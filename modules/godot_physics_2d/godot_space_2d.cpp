@@ -1030,12 +1030,12 @@ void *GodotSpace2D::_broadphase_pair(GodotCollisionObject2D *A, int p_subindex_A
 			return area2_pair;
 		} else {
 			GodotBody2D *body = static_cast<GodotBody2D *>(B);
-			GodotAreaPair2D *area_pair = memnew(GodotAreaPair2D(body, p_subindex_B, area, p_subindex_A));
+			GodotAreaPair2D *area_pair = self->area_pair_allocator.alloc(body, p_subindex_B, area, p_subindex_A);
 			return area_pair;
 		}
 
 	} else {
-		GodotBodyPair2D *b = memnew(GodotBodyPair2D(static_cast<GodotBody2D *>(A), p_subindex_A, static_cast<GodotBody2D *>(B), p_subindex_B));
+		GodotBodyPair2D *b = self->body_pair_allocator.alloc(static_cast<GodotBody2D *>(A), p_subindex_A, static_cast<GodotBody2D *>(B), p_subindex_B);
 		return b;
 	}
 }
@@ -1047,8 +1047,18 @@ void GodotSpace2D::_broadphase_unpair(GodotCollisionObject2D *A, int p_subindex_
 
 	GodotSpace2D *self = static_cast<GodotSpace2D *>(p_self);
 	self->collision_pairs--;
-	GodotConstraint2D *c = static_cast<GodotConstraint2D *>(p_data);
-	memdelete(c);
+
+	// Same classification as in _broadphase_pair().
+	GodotCollisionObject2D::Type type_A = A->get_type();
+	GodotCollisionObject2D::Type type_B = B->get_type();
+	if (type_A == GodotCollisionObject2D::TYPE_BODY && type_B == GodotCollisionObject2D::TYPE_BODY) {
+		self->body_pair_allocator.free(static_cast<GodotBodyPair2D *>(p_data));
+	} else if ((type_A == GodotCollisionObject2D::TYPE_AREA && type_B == GodotCollisionObject2D::TYPE_BODY) || (type_A == GodotCollisionObject2D::TYPE_BODY && type_B == GodotCollisionObject2D::TYPE_AREA)) {
+		self->area_pair_allocator.free(static_cast<GodotAreaPair2D *>(p_data));
+	} else {
+		GodotConstraint2D *c = static_cast<GodotConstraint2D *>(p_data);
+		memdelete(c);
+	}
 }
 
 const SelfList<GodotBody2D>::List &GodotSpace2D::get_active_body_list() const {
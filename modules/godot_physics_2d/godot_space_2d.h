@@ -35,6 +35,7 @@
 #include "godot_broad_phase_2d.h"
 #include "godot_collision_object_2d.h"
 
+#include "core/templates/paged_allocator.h"
 #include "core/typedefs.h"
 
 class GodotPhysicsDirectSpaceState2D : public PhysicsDirectSpaceState2D {
@@ -53,6 +54,9 @@ public:
 	GodotPhysicsDirectSpaceState2D() {}
 };
 
+class GodotAreaPair2D;
+class GodotBodyPair2D;
+
 class GodotSpace2D {
 public:
 	enum ElapsedTime {
@@ -87,6 +91,10 @@ private:
 	static void *_broadphase_pair(GodotCollisionObject2D *A, int p_subindex_A, GodotCollisionObject2D *B, int p_subindex_B, void *p_self);
 	static void _broadphase_unpair(GodotCollisionObject2D *A, int p_subindex_A, GodotCollisionObject2D *B, int p_subindex_B, void *p_data, void *p_self);
 
+	// Pairs are created and destroyed as objects move in and out of each other's bounds, so pool the common kinds.
+	PagedAllocator<GodotBodyPair2D, false, 64> body_pair_allocator;
+	PagedAllocator<GodotAreaPair2D, false, 64> area_pair_allocator;
+
 	HashSet<GodotCollisionObject2D *> objects;
 
 	GodotArea2D *area = nullptr;
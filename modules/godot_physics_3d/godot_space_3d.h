@@ -36,6 +36,7 @@
 #include "godot_collision_object_3d.h"
 #include "godot_soft_body_3d.h"
 
+#include "core/templates/paged_allocator.h"
 #include "core/typedefs.h"
 
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
@@ -55,6 +56,9 @@ public:
 	GodotPhysicsDirectSpaceState3D();
 };
 
+class GodotAreaPair3D;
+class GodotBodyPair3D;
+
 class GodotSpace3D {
 public:
 	enum ElapsedTime {
@@ -84,6 +88,10 @@ private:
 	static void *_broadphase_pair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_self);
 	static void _broadphase_unpair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_data, void *p_self);
 
+	// Pairs are created and destroyed as objects move in and out of each other's bounds, so pool the common kinds.
+	PagedAllocator<GodotBodyPair3D, false, 64> body_pair_allocator;
+	PagedAllocator<GodotAreaPair3D, false, 64> area_pair_allocator;
+
 	HashSet<GodotCollisionObject3D *> objects;
 
 	GodotArea3D *area = nullptr;
@@ -0,0 +1,146 @@
+/**************************************************************************/
+/*  test_raycast_occlusion_cull.h                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../raycast_occlusion_cull.h"
+
+#include "core/os/os.h"
+#include "servers/rendering/renderer_scene_occlusion_raster.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRaycastOcclusionCull {
+
+struct BenchmarkResult {
+	uint64_t update_usec = 0;
+	LocalVector<bool> occluded;
+};
+
+// A city block of box occluders, seen from street level.
+static void _run_occlusion_benchmark(RendererSceneOcclusionCull *p_cull, const LocalVector<AABB> &p_tests, BenchmarkResult &r_result) {
+	const int grid_size = 20;
+	const int iterations = 100;
+	const RID scenario = RID::from_uint64(1);
+	const RID buffer = RID::from_uint64(2);
+
+	p_cull->add_scenario(scenario);
+	p_cull->add_buffer(buffer);
+	p_cull->buffer_set_scenario(buffer, scenario);
+	p_cull->buffer_set_size(buffer, Vector2i(256, 144));
+
+	const PackedVector3Array vertices = {
+		Vector3(-2, 0, -2), Vector3(2, 0, -2), Vector3(2, 0, 2), Vector3(-2, 0, 2),
+		Vector3(-2, 1, -2), Vector3(2, 1, -2), Vector3(2, 1, 2), Vector3(-2, 1, 2)
+	};
+	const PackedInt32Array indices = {
+		0, 1, 2, 0, 2, 3, 4, 6, 5, 4, 7, 6,
+		0, 4, 5, 0, 5, 1, 1, 5, 6, 1, 6, 2,
+		2, 6, 7, 2, 7, 3, 3, 7, 4, 3, 4, 0
+	};
+	RID occluder = p_cull->occluder_allocate();
+	p_cull->occluder_initialize(occluder);
+	p_cull->occluder_set_mesh(occluder, vertices, indices);
+
+	LocalVector<RID> instances;
+	for (int i = 0; i < grid_size * grid_size; i++) {
+		const RID instance = RID::from_uint64(100 + i);
+		const real_t height = 5 + (i * 7919) % 20;
+		const Transform3D xform(Basis().scaled(Vector3(1, height, 1)), Vector3((i % grid_size) * 10, 0, -(i / grid_size) * 10 - 10));
+		p_cull->scenario_set_instance(scenario, instance, occluder, xform, true);
+		instances.push_back(instance);
+	}
+
+	const Transform3D camera = Transform3D().looking_at(Vector3(0.3, -0.05, -1)).translated(Vector3(5, 1.7, 0));
+	Projection projection;
+	projection.set_perspective(75, 16.0 / 9.0, 0.05, 500);
+
+	// Let backends with asynchronous scene builds catch up.
+	for (int i = 0; i < 10; i++) {
+		p_cull->buffer_update(buffer, camera, projection, false);
+		OS::get_singleton()->delay_usec(10000);
+	}
+
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		p_cull->buffer_update(buffer, camera, projection, false);
+	}
+	r_result.update_usec = (OS::get_singleton()->get_ticks_usec() - begin) / iterations;
+
+	const Transform3D cam_inv = camera.affine_inverse();
+	for (const AABB &aabb : p_tests) {
+		const Vector3 end = aabb.get_end();
+		const real_t bounds[6] = { aabb.position.x, aabb.position.y, aabb.position.z, end.x, end.y, end.z };
+		uint64_t timeout = 0;
+		r_result.occluded.push_back(p_cull->buffer_get_ptr(buffer)->is_occluded(bounds, camera.origin, cam_inv, projection, projection.get_z_near(), timeout));
+	}
+
+	for (const RID &instance : instances) {
+		p_cull->scenario_remove_instance(scenario, instance);
+	}
+	p_cull->free_occluder(occluder);
+	p_cull->remove_buffer(buffer);
+	p_cull->remove_scenario(scenario);
+}
+
+TEST_CASE_BENCHMARK("[Raycast][Benchmark] Raycast and raster occlusion culling") {
+	LocalVector<AABB> tests;
+	for (int x = 0; x < 40; x++) {
+		for (int z = 0; z < 40; z++) {
+			tests.push_back(AABB(Vector3(x * 5 - 2.5, 0, -z * 5 - 7.5), Vector3(1, 2, 1)));
+		}
+	}
+
+	BenchmarkResult raster;
+	{
+		RendererSceneOcclusionRaster cull;
+		_run_occlusion_benchmark(&cull, tests, raster);
+	}
+
+	BenchmarkResult raycast;
+	{
+		RaycastOcclusionCull cull;
+		_run_occlusion_benchmark(&cull, tests, raycast);
+	}
+
+	int raster_occluded = 0;
+	int raycast_occluded = 0;
+	int matching = 0;
+	for (uint32_t i = 0; i < tests.size(); i++) {
+		raster_occluded += raster.occluded[i];
+		raycast_occluded += raycast.occluded[i];
+		matching += raster.occluded[i] == raycast.occluded[i];
+	}
+
+	MESSAGE(vformat("Buffer update: raycast %d usec, raster %d usec. Occluded: raycast %d, raster %d of %d, %d matching.", raycast.update_usec, raster.update_usec, raycast_occluded, raster_occluded, tests.size(), matching).utf8().get_data());
+	CHECK(matching >= (int)tests.size() * 9 / 10);
+}
+
+} // namespace TestRaycastOcclusionCull
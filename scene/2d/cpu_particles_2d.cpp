@@ -31,8 +31,9 @@
 #include "cpu_particles_2d.h"
 #include "cpu_particles_2d.compat.inc"
 
-#include "core/math/random_number_generator.h"
+#include "core/math/random_pcg.h"
 #include "core/math/transform_interpolator.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/2d/gpu_particles_2d.h"
 #include "scene/resources/atlas_texture.h"
 #include "scene/resources/canvas_item_material.h"
@@ -744,9 +745,6 @@ void CPUParticles2D::_particles_process(double p_delta) {
 	p_delta *= speed_scale;
 
 	int pcount = particles.size();
-	Particle *w = particles.ptrw();
-
-	Particle *parray = w;
 
 	double prev_time = time;
 	time += p_delta;
@@ -759,29 +757,71 @@ void CPUParticles2D::_particles_process(double p_delta) {
 		}
 	}
 
-	Transform2D emission_xform;
-	Transform2D velocity_xform;
+	ProcessData process_data;
+	process_data.particles = particles.ptrw();
+	process_data.particle_count = pcount;
+	process_data.delta = p_delta;
+	process_data.prev_time = prev_time;
+	process_data.system_phase = time / lifetime;
 	if (!local_coords) {
 		if (!_interpolation_data.interpolated_follow) {
-			emission_xform = get_global_transform();
+			process_data.emission_xform = get_global_transform();
 		} else {
-			TransformInterpolator::interpolate_transform_2d(_interpolation_data.global_xform_prev, _interpolation_data.global_xform_curr, emission_xform, Engine::get_singleton()->get_physics_interpolation_fraction());
+			TransformInterpolator::interpolate_transform_2d(_interpolation_data.global_xform_prev, _interpolation_data.global_xform_curr, process_data.emission_xform, Engine::get_singleton()->get_physics_interpolation_fraction());
+		}
+		process_data.velocity_xform = process_data.emission_xform;
+		process_data.velocity_xform[2] = Vector2();
+	}
+
+	if (pcount >= threaded_process_threshold) {
+		// Gradients sort their points lazily on first use, do it here before sampling them from several threads.
+		if (color_ramp.is_valid()) {
+			color_ramp->get_color_at_offset(0.0);
+		}
+		if (color_initial_ramp.is_valid()) {
+			color_initial_ramp->get_color_at_offset(0.0);
 		}
-		velocity_xform = emission_xform;
-		velocity_xform[2] = Vector2();
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles2D::_particles_process_threaded, &process_data, WorkerThreadPool::get_singleton()->get_thread_count(), -1, true, SNAME("CPUParticles2DProcess"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_particles_process_range(process_data, 0, pcount);
+	}
+
+	bool should_be_active = process_data.should_be_active.is_set();
+	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
+		active = false;
+		emit_signal(SceneStringName(finished));
 	}
+}
+
+void CPUParticles2D::_particles_process_threaded(uint32_t p_thread, ProcessData *p_data) {
+	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
+	uint32_t from = p_thread * p_data->particle_count / total_threads;
+	uint32_t to = (p_thread + 1 == total_threads) ? p_data->particle_count : ((p_thread + 1) * p_data->particle_count / total_threads);
+
+	_particles_process_range(*p_data, from, to);
+}
 
-	double system_phase = time / lifetime;
+void CPUParticles2D::_particles_process_range(ProcessData &p_data, int p_from, int p_to) {
+	Particle *parray = p_data.particles;
+	const int pcount = p_data.particle_count;
+	const double prev_time = p_data.prev_time;
+	const double system_phase = p_data.system_phase;
+	const Transform2D &emission_xform = p_data.emission_xform;
+	const Transform2D &velocity_xform = p_data.velocity_xform;
+
+	// Particles reseed the generator from their own seed, so each range can use a local one.
+	RandomPCG rng;
 
 	bool should_be_active = false;
-	for (int i = 0; i < pcount; i++) {
+	for (int i = p_from; i < p_to; i++) {
 		Particle &p = parray[i];
 
 		if (!emitting && !p.active) {
 			continue;
 		}
 
-		double local_delta = p_delta;
+		double local_delta = p_data.delta;
 
 		// The phase is a ratio between 0 (birth) and 1 (end of life) for each particle.
 		// While we use time in tests later on, for randomness we use the phase as done in the
@@ -857,22 +897,22 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			}
 
 			p.seed = seed + uint32_t(i) + i + cycle;
-			rng->set_seed(p.seed);
+			rng.seed(p.seed);
 
-			p.angle_rand = rng->randf();
-			p.scale_rand = rng->randf();
-			p.hue_rot_rand = rng->randf();
-			p.anim_offset_rand = rng->randf();
+			p.angle_rand = rng.randf();
+			p.scale_rand = rng.randf();
+			p.hue_rot_rand = rng.randf();
+			p.anim_offset_rand = rng.randf();
 
 			if (color_initial_ramp.is_valid()) {
-				p.start_color_rand = color_initial_ramp->get_color_at_offset(rng->randf());
+				p.start_color_rand = color_initial_ramp->get_color_at_offset(rng.randf());
 			} else {
 				p.start_color_rand = Color(1, 1, 1, 1);
 			}
 
-			real_t angle1_rad = direction.angle() + Math::deg_to_rad((rng->randf() * 2.0 - 1.0) * spread);
+			real_t angle1_rad = direction.angle() + Math::deg_to_rad((rng.randf() * 2.0 - 1.0) * spread);
 			Vector2 rot = Vector2(Math::cos(angle1_rad), Math::sin(angle1_rad));
-			p.velocity = rot * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], rng->randf());
+			p.velocity = rot * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], rng.randf());
 
 			real_t base_angle = tex_angle * Math::lerp(parameters_min[PARAM_ANGLE], parameters_max[PARAM_ANGLE], p.angle_rand);
 			p.rotation = Math::deg_to_rad(base_angle);
@@ -880,7 +920,7 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			p.custom[0] = 0.0; // unused
 			p.custom[1] = 0.0; // phase [0..1]
 			p.custom[2] = tex_anim_offset * Math::lerp(parameters_min[PARAM_ANIM_OFFSET], parameters_max[PARAM_ANIM_OFFSET], p.anim_offset_rand);
-			p.custom[3] = (1.0 - rng->randf() * lifetime_randomness);
+			p.custom[3] = (1.0 - rng.randf() * lifetime_randomness);
 			p.transform = Transform2D();
 			p.time = 0;
 			p.lifetime = lifetime * p.custom[3];
@@ -891,17 +931,17 @@ void CPUParticles2D::_particles_process(double p_delta) {
 					//do none
 				} break;
 				case EMISSION_SHAPE_SPHERE: {
-					real_t t = Math::TAU * rng->randf();
-					real_t radius = emission_sphere_radius * rng->randf();
+					real_t t = Math::TAU * rng.randf();
+					real_t radius = emission_sphere_radius * rng.randf();
 					p.transform[2] = Vector2(Math::cos(t), Math::sin(t)) * radius;
 				} break;
 				case EMISSION_SHAPE_SPHERE_SURFACE: {
-					real_t s = rng->randf(), t = Math::TAU * rng->randf();
+					real_t s = rng.randf(), t = Math::TAU * rng.randf();
 					real_t radius = emission_sphere_radius * Math::sqrt(1.0 - s * s);
 					p.transform[2] = Vector2(Math::cos(t), Math::sin(t)) * radius;
 				} break;
 				case EMISSION_SHAPE_RECTANGLE: {
-					p.transform[2] = Vector2(rng->randf() * 2.0 - 1.0, rng->randf() * 2.0 - 1.0) * emission_rect_extents;
+					p.transform[2] = Vector2(rng.randf() * 2.0 - 1.0, rng.randf() * 2.0 - 1.0) * emission_rect_extents;
 				} break;
 				case EMISSION_SHAPE_POINTS:
 				case EMISSION_SHAPE_DIRECTED_POINTS: {
@@ -910,7 +950,7 @@ void CPUParticles2D::_particles_process(double p_delta) {
 						break;
 					}
 
-					int random_idx = Math::rand() % pc;
+					int random_idx = rng.rand() % uint32_t(pc);
 
 					p.transform[2] = emission_points.get(random_idx);
 
@@ -1121,9 +1161,9 @@ void CPUParticles2D::_particles_process(double p_delta) {
 
 		should_be_active = true;
 	}
-	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
-		active = false;
-		emit_signal(SceneStringName(finished));
+
+	if (should_be_active) {
+		p_data.should_be_active.set();
 	}
 }
 
@@ -1137,7 +1177,6 @@ void CPUParticles2D::_update_particle_data_buffer() {
 
 	float *w = particle_data.ptrw();
 	const Particle *r = particles.ptr();
-	float *ptr = w;
 
 	if (draw_order != DRAW_ORDER_INDEX) {
 		ow = particle_order.ptrw();
@@ -1153,7 +1192,34 @@ void CPUParticles2D::_update_particle_data_buffer() {
 		}
 	}
 
-	for (int i = 0; i < pc; i++) {
+	BufferData buffer_data;
+	buffer_data.particles = r;
+	buffer_data.order = order;
+	buffer_data.buffer = w;
+	buffer_data.particle_count = pc;
+
+	if (pc >= threaded_process_threshold) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles2D::_update_particle_data_threaded, &buffer_data, WorkerThreadPool::get_singleton()->get_thread_count(), -1, true, SNAME("CPUParticles2DUpdateBuffer"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_update_particle_data_range(buffer_data, 0, pc);
+	}
+}
+
+void CPUParticles2D::_update_particle_data_threaded(uint32_t p_thread, BufferData *p_data) {
+	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
+	uint32_t from = p_thread * p_data->particle_count / total_threads;
+	uint32_t to = (p_thread + 1 == total_threads) ? p_data->particle_count : ((p_thread + 1) * p_data->particle_count / total_threads);
+
+	_update_particle_data_range(*p_data, from, to);
+}
+
+void CPUParticles2D::_update_particle_data_range(const BufferData &p_data, int p_from, int p_to) {
+	const Particle *r = p_data.particles;
+	const int *order = p_data.order;
+	float *ptr = p_data.buffer + p_from * 16;
+
+	for (int i = p_from; i < p_to; i++) {
 		int idx = order ? order[i] : i;
 
 		Transform2D t = r[idx].transform;
@@ -1650,8 +1716,6 @@ CPUParticles2D::CPUParticles2D() {
 	set_use_local_coordinates(false);
 	set_seed(Math::rand());
 
-	rng.instantiate();
-
 	set_param_min(PARAM_INITIAL_LINEAR_VELOCITY, 0);
 	set_param_min(PARAM_ANGULAR_VELOCITY, 0);
 	set_param_min(PARAM_ORBIT_VELOCITY, 0);
@@ -32,8 +32,6 @@
 
 #include "scene/2d/node_2d.h"
 
-class RandomNumberGenerator;
-
 class CPUParticles2D : public Node2D {
 private:
 	GDCLASS(CPUParticles2D, Node2D);
@@ -112,6 +110,27 @@ private:
 	Vector<float> particle_data;
 	Vector<int> particle_order;
 
+	// Emitters with at least this many particles are simulated and uploaded on the WorkerThreadPool.
+	static inline int threaded_process_threshold = 2048;
+
+	struct ProcessData {
+		Particle *particles = nullptr;
+		int particle_count = 0;
+		double delta = 0.0;
+		double prev_time = 0.0;
+		double system_phase = 0.0;
+		Transform2D emission_xform;
+		Transform2D velocity_xform;
+		SafeFlag should_be_active;
+	};
+
+	struct BufferData {
+		const Particle *particles = nullptr;
+		const int *order = nullptr;
+		float *buffer = nullptr;
+		int particle_count = 0;
+	};
+
 	struct SortLifetime {
 		const Particle *particles = nullptr;
 
@@ -184,11 +203,13 @@ private:
 
 	Vector2 gravity = Vector2(0, 980);
 
-	Ref<RandomNumberGenerator> rng;
-
 	void _update_internal();
 	void _particles_process(double p_delta);
+	void _particles_process_threaded(uint32_t p_thread, ProcessData *p_data);
+	void _particles_process_range(ProcessData &p_data, int p_from, int p_to);
 	void _update_particle_data_buffer();
+	void _update_particle_data_threaded(uint32_t p_thread, BufferData *p_data);
+	void _update_particle_data_range(const BufferData &p_data, int p_from, int p_to);
 	void _set_emitting();
 
 	Mutex update_mutex;
@@ -271,6 +292,9 @@ public:
 
 	void request_particles_process(real_t p_requested_process_time);
 
+	static void set_threaded_process_threshold(int p_count) { threaded_process_threshold = p_count; }
+	static int get_threaded_process_threshold() { return threaded_process_threshold; }
+
 	///////////////////
 
 	void set_direction(Vector2 p_direction);
@@ -31,7 +31,8 @@
 #include "cpu_particles_3d.h"
 #include "cpu_particles_3d.compat.inc"
 
-#include "core/math/random_number_generator.h"
+#include "core/math/random_pcg.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/camera_3d.h"
 #include "scene/3d/gpu_particles_3d.h"
 #include "scene/main/viewport.h"
@@ -720,9 +721,6 @@ void CPUParticles3D::_particles_process(double p_delta) {
 	p_delta *= speed_scale;
 
 	int pcount = particles.size();
-	Particle *w = particles.ptrw();
-
-	Particle *parray = w;
 
 	double prev_time = time;
 	time += p_delta;
@@ -735,24 +733,66 @@ void CPUParticles3D::_particles_process(double p_delta) {
 		}
 	}
 
-	Transform3D emission_xform;
-	Basis velocity_xform;
+	ProcessData process_data;
+	process_data.particles = particles.ptrw();
+	process_data.particle_count = pcount;
+	process_data.delta = p_delta;
+	process_data.prev_time = prev_time;
+	process_data.system_phase = time / lifetime;
 	if (!local_coords) {
-		emission_xform = get_global_transform_interpolated();
-		velocity_xform = emission_xform.basis;
+		process_data.emission_xform = get_global_transform_interpolated();
+		process_data.velocity_xform = process_data.emission_xform.basis;
+	}
+
+	if (pcount >= threaded_process_threshold) {
+		// Gradients sort their points lazily on first use, do it here before sampling them from several threads.
+		if (color_ramp.is_valid()) {
+			color_ramp->get_color_at_offset(0.0);
+		}
+		if (color_initial_ramp.is_valid()) {
+			color_initial_ramp->get_color_at_offset(0.0);
+		}
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles3D::_particles_process_threaded, &process_data, WorkerThreadPool::get_singleton()->get_thread_count(), -1, true, SNAME("CPUParticles3DProcess"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_particles_process_range(process_data, 0, pcount);
+	}
+
+	bool should_be_active = process_data.should_be_active.is_set();
+	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
+		active = false;
+		emit_signal(SceneStringName(finished));
 	}
+}
 
-	double system_phase = time / lifetime;
+void CPUParticles3D::_particles_process_threaded(uint32_t p_thread, ProcessData *p_data) {
+	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
+	uint32_t from = p_thread * p_data->particle_count / total_threads;
+	uint32_t to = (p_thread + 1 == total_threads) ? p_data->particle_count : ((p_thread + 1) * p_data->particle_count / total_threads);
+
+	_particles_process_range(*p_data, from, to);
+}
+
+void CPUParticles3D::_particles_process_range(ProcessData &p_data, int p_from, int p_to) {
+	Particle *parray = p_data.particles;
+	const int pcount = p_data.particle_count;
+	const double prev_time = p_data.prev_time;
+	const double system_phase = p_data.system_phase;
+	const Transform3D &emission_xform = p_data.emission_xform;
+	const Basis &velocity_xform = p_data.velocity_xform;
+
+	// Particles reseed the generator from their own seed, so each range can use a local one.
+	RandomPCG rng;
 
 	bool should_be_active = false;
-	for (int i = 0; i < pcount; i++) {
+	for (int i = p_from; i < p_to; i++) {
 		Particle &p = parray[i];
 
 		if (!emitting && !p.active) {
 			continue;
 		}
 
-		double local_delta = p_delta;
+		double local_delta = p_data.delta;
 
 		// The phase is a ratio between 0 (birth) and 1 (end of life) for each particle.
 		// While we use time in tests later on, for randomness we use the phase as done in the
@@ -828,26 +868,26 @@ void CPUParticles3D::_particles_process(double p_delta) {
 			}
 
 			p.seed = seed + uint32_t(1) + i + cycle;
-			rng->set_seed(p.seed);
-			p.angle_rand = rng->randf();
-			p.scale_rand = rng->randf();
-			p.hue_rot_rand = rng->randf();
-			p.anim_offset_rand = rng->randf();
+			rng.seed(p.seed);
+			p.angle_rand = rng.randf();
+			p.scale_rand = rng.randf();
+			p.hue_rot_rand = rng.randf();
+			p.anim_offset_rand = rng.randf();
 
 			if (color_initial_ramp.is_valid()) {
-				p.start_color_rand = color_initial_ramp->get_color_at_offset(rng->randf());
+				p.start_color_rand = color_initial_ramp->get_color_at_offset(rng.randf());
 			} else {
 				p.start_color_rand = Color(1, 1, 1, 1);
 			}
 
 			if (particle_flags[PARTICLE_FLAG_DISABLE_Z]) {
-				real_t angle1_rad = Math::atan2(direction.y, direction.x) + Math::deg_to_rad((rng->randf() * 2.0 - 1.0) * spread);
+				real_t angle1_rad = Math::atan2(direction.y, direction.x) + Math::deg_to_rad((rng.randf() * 2.0 - 1.0) * spread);
 				Vector3 rot = Vector3(Math::cos(angle1_rad), Math::sin(angle1_rad), 0.0);
-				p.velocity = rot * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], rng->randf());
+				p.velocity = rot * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], rng.randf());
 			} else {
 				//initiate velocity spread in 3D
-				real_t angle1_rad = Math::deg_to_rad((rng->randf() * (real_t)2.0 - (real_t)1.0) * spread);
-				real_t angle2_rad = Math::deg_to_rad((rng->randf() * (real_t)2.0 - (real_t)1.0) * ((real_t)1.0 - flatness) * spread);
+				real_t angle1_rad = Math::deg_to_rad((rng.randf() * (real_t)2.0 - (real_t)1.0) * spread);
+				real_t angle2_rad = Math::deg_to_rad((rng.randf() * (real_t)2.0 - (real_t)1.0) * ((real_t)1.0 - flatness) * spread);
 
 				Vector3 direction_xz = Vector3(Math::sin(angle1_rad), 0, Math::cos(angle1_rad));
 				Vector3 direction_yz = Vector3(0, Math::sin(angle2_rad), Math::cos(angle2_rad));
@@ -867,14 +907,14 @@ void CPUParticles3D::_particles_process(double p_delta) {
 				binormal.normalize();
 				Vector3 normal = binormal.cross(direction_nrm);
 				spread_direction = binormal * spread_direction.x + normal * spread_direction.y + direction_nrm * spread_direction.z;
-				p.velocity = spread_direction * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], rng->randf());
+				p.velocity = spread_direction * Math::lerp(parameters_min[PARAM_INITIAL_LINEAR_VELOCITY], parameters_max[PARAM_INITIAL_LINEAR_VELOCITY], rng.randf());
 			}
 
 			real_t base_angle = tex_angle * Math::lerp(parameters_min[PARAM_ANGLE], parameters_max[PARAM_ANGLE], p.angle_rand);
 			p.custom[0] = Math::deg_to_rad(base_angle); //angle
 			p.custom[1] = 0.0; //phase
 			p.custom[2] = tex_anim_offset * Math::lerp(parameters_min[PARAM_ANIM_OFFSET], parameters_max[PARAM_ANIM_OFFSET], p.anim_offset_rand); //animation offset (0-1)
-			p.custom[3] = (1.0 - rng->randf() * lifetime_randomness);
+			p.custom[3] = (1.0 - rng.randf() * lifetime_randomness);
 			p.transform = Transform3D();
 			p.time = 0;
 			p.lifetime = lifetime * p.custom[3];
@@ -885,20 +925,20 @@ void CPUParticles3D::_particles_process(double p_delta) {
 					//do none
 				} break;
 				case EMISSION_SHAPE_SPHERE: {
-					real_t s = 2.0 * rng->randf() - 1.0;
-					real_t t = Math::TAU * rng->randf();
-					real_t x = rng->randf();
+					real_t s = 2.0 * rng.randf() - 1.0;
+					real_t t = Math::TAU * rng.randf();
+					real_t x = rng.randf();
 					real_t radius = emission_sphere_radius * Math::sqrt(1.0 - s * s);
 					p.transform.origin = Vector3(0, 0, 0).lerp(Vector3(radius * Math::cos(t), radius * Math::sin(t), emission_sphere_radius * s), x);
 				} break;
 				case EMISSION_SHAPE_SPHERE_SURFACE: {
-					real_t s = 2.0 * rng->randf() - 1.0;
-					real_t t = Math::TAU * rng->randf();
+					real_t s = 2.0 * rng.randf() - 1.0;
+					real_t t = Math::TAU * rng.randf();
 					real_t radius = emission_sphere_radius * Math::sqrt(1.0 - s * s);
 					p.transform.origin = Vector3(radius * Math::cos(t), radius * Math::sin(t), emission_sphere_radius * s);
 				} break;
 				case EMISSION_SHAPE_BOX: {
-					p.transform.origin = Vector3(rng->randf() * 2.0 - 1.0, rng->randf() * 2.0 - 1.0, rng->randf() * 2.0 - 1.0) * emission_box_extents;
+					p.transform.origin = Vector3(rng.randf() * 2.0 - 1.0, rng.randf() * 2.0 - 1.0, rng.randf() * 2.0 - 1.0) * emission_box_extents;
 				} break;
 				case EMISSION_SHAPE_POINTS:
 				case EMISSION_SHAPE_DIRECTED_POINTS: {
@@ -907,7 +947,7 @@ void CPUParticles3D::_particles_process(double p_delta) {
 						break;
 					}
 
-					int random_idx = Math::rand() % pc;
+					int random_idx = rng.rand() % uint32_t(pc);
 
 					p.transform.origin = emission_points.get(random_idx);
 
@@ -942,11 +982,11 @@ void CPUParticles3D::_particles_process(double p_delta) {
 				case EMISSION_SHAPE_RING: {
 					real_t radius_clamped = MAX(0.001, emission_ring_radius);
 					real_t top_radius = MAX(radius_clamped - Math::tan(Math::deg_to_rad(90.0 - emission_ring_cone_angle)) * emission_ring_height, 0.0);
-					real_t y_pos = rng->randf();
+					real_t y_pos = rng.randf();
 					real_t skew = MAX(MIN(radius_clamped, top_radius) / MAX(radius_clamped, top_radius), 0.5);
 					y_pos = radius_clamped < top_radius ? Math::pow(y_pos, skew) : 1.0 - Math::pow(y_pos, skew);
-					real_t ring_random_angle = rng->randf() * Math::TAU;
-					real_t ring_random_radius = Math::sqrt(rng->randf() * (radius_clamped * radius_clamped - emission_ring_inner_radius * emission_ring_inner_radius) + emission_ring_inner_radius * emission_ring_inner_radius);
+					real_t ring_random_angle = rng.randf() * Math::TAU;
+					real_t ring_random_radius = Math::sqrt(rng.randf() * (radius_clamped * radius_clamped - emission_ring_inner_radius * emission_ring_inner_radius) + emission_ring_inner_radius * emission_ring_inner_radius);
 					ring_random_radius = Math::lerp(ring_random_radius, ring_random_radius * (top_radius / radius_clamped), y_pos);
 					Vector3 axis = emission_ring_axis == Vector3(0.0, 0.0, 0.0) ? Vector3(0.0, 0.0, 1.0) : emission_ring_axis.normalized();
 					Vector3 ortho_axis;
@@ -1221,9 +1261,9 @@ void CPUParticles3D::_particles_process(double p_delta) {
 
 		should_be_active = true;
 	}
-	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
-		active = false;
-		emit_signal(SceneStringName(finished));
+
+	if (should_be_active) {
+		p_data.should_be_active.set();
 	}
 }
 
@@ -1237,7 +1277,6 @@ void CPUParticles3D::_update_particle_data_buffer() {
 
 	float *w = particle_data.ptrw();
 	const Particle *r = particles.ptr();
-	float *ptr = w;
 
 	if (draw_order != DRAW_ORDER_INDEX) {
 		ow = particle_order.ptrw();
@@ -1272,7 +1311,36 @@ void CPUParticles3D::_update_particle_data_buffer() {
 		}
 	}
 
-	for (int i = 0; i < pc; i++) {
+	BufferData buffer_data;
+	buffer_data.particles = r;
+	buffer_data.order = order;
+	buffer_data.buffer = w;
+	buffer_data.particle_count = pc;
+
+	if (pc >= threaded_process_threshold) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles3D::_update_particle_data_threaded, &buffer_data, WorkerThreadPool::get_singleton()->get_thread_count(), -1, true, SNAME("CPUParticles3DUpdateBuffer"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_update_particle_data_range(buffer_data, 0, pc);
+	}
+
+	can_update.set();
+}
+
+void CPUParticles3D::_update_particle_data_threaded(uint32_t p_thread, BufferData *p_data) {
+	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
+	uint32_t from = p_thread * p_data->particle_count / total_threads;
+	uint32_t to = (p_thread + 1 == total_threads) ? p_data->particle_count : ((p_thread + 1) * p_data->particle_count / total_threads);
+
+	_update_particle_data_range(*p_data, from, to);
+}
+
+void CPUParticles3D::_update_particle_data_range(const BufferData &p_data, int p_from, int p_to) {
+	const Particle *r = p_data.particles;
+	const int *order = p_data.order;
+	float *ptr = p_data.buffer + p_from * 20;
+
+	for (int i = p_from; i < p_to; i++) {
 		int idx = order ? order[i] : i;
 
 		Transform3D t = r[idx].transform;
@@ -1312,8 +1380,6 @@ void CPUParticles3D::_update_particle_data_buffer() {
 
 		ptr += 20;
 	}
-
-	can_update.set();
 }
 
 void CPUParticles3D::_set_redraw(bool p_redraw) {
@@ -1776,8 +1842,6 @@ CPUParticles3D::CPUParticles3D() {
 	set_amount(8);
 	set_seed(Math::rand());
 
-	rng.instantiate();
-
 	set_param_min(PARAM_INITIAL_LINEAR_VELOCITY, 0);
 	set_param_min(PARAM_ANGULAR_VELOCITY, 0);
 	set_param_min(PARAM_ORBIT_VELOCITY, 0);
@@ -32,8 +32,6 @@
 
 #include "scene/3d/visual_instance_3d.h"
 
-class RandomNumberGenerator;
-
 class CPUParticles3D : public GeometryInstance3D {
 private:
 	GDCLASS(CPUParticles3D, GeometryInstance3D);
@@ -113,6 +111,27 @@ private:
 	Vector<float> particle_data;
 	Vector<int> particle_order;
 
+	// Emitters with at least this many particles are simulated and uploaded on the WorkerThreadPool.
+	static inline int threaded_process_threshold = 2048;
+
+	struct ProcessData {
+		Particle *particles = nullptr;
+		int particle_count = 0;
+		double delta = 0.0;
+		double prev_time = 0.0;
+		double system_phase = 0.0;
+		Transform3D emission_xform;
+		Basis velocity_xform;
+		SafeFlag should_be_active;
+	};
+
+	struct BufferData {
+		const Particle *particles = nullptr;
+		const int *order = nullptr;
+		float *buffer = nullptr;
+		int particle_count = 0;
+	};
+
 	struct SortLifetime {
 		const Particle *particles = nullptr;
 
@@ -191,11 +210,13 @@ private:
 
 	Vector3 gravity = Vector3(0, -9.8, 0);
 
-	Ref<RandomNumberGenerator> rng;
-
 	void _update_internal();
 	void _particles_process(double p_delta);
+	void _particles_process_threaded(uint32_t p_thread, ProcessData *p_data);
+	void _particles_process_range(ProcessData &p_data, int p_from, int p_to);
 	void _update_particle_data_buffer();
+	void _update_particle_data_threaded(uint32_t p_thread, BufferData *p_data);
+	void _update_particle_data_range(const BufferData &p_data, int p_from, int p_to);
 	void _set_emitting();
 
 	Mutex update_mutex;
@@ -261,6 +282,9 @@ public:
 
 	void request_particles_process(real_t p_requested_process_time);
 
+	static void set_threaded_process_threshold(int p_count) { threaded_process_threshold = p_count; }
+	static int get_threaded_process_threshold() { return threaded_process_threshold; }
+
 	///////////////////
 
 	void set_direction(Vector3 p_direction);
@@ -0,0 +1,378 @@
+/**************************************************************************/
+/*  hlod_3d.cpp                                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "hlod_3d.h"
+
+#include "scene/3d/mesh_instance_3d.h"
+#include "scene/resources/mesh.h"
+#include "scene/resources/surface_tool.h"
+
+namespace {
+
+// Surfaces of one cluster sharing a material, merged into the proxy's local space.
+struct MergedSurface {
+	Ref<Material> material;
+	LocalVector<Vector3> vertices;
+	LocalVector<Vector3> normals;
+	LocalVector<Vector2> uvs;
+	LocalVector<int> indices;
+	bool has_normals = true;
+	bool has_uvs = true;
+};
+
+void _merge_surface(MergedSurface &r_merged, const Array &p_arrays, const Transform3D &p_xform) {
+	const PackedVector3Array vertices = p_arrays[Mesh::ARRAY_VERTEX];
+	const PackedVector3Array normals = p_arrays[Mesh::ARRAY_NORMAL];
+	const PackedVector2Array uvs = p_arrays[Mesh::ARRAY_TEX_UV];
+	const PackedInt32Array indices = p_arrays[Mesh::ARRAY_INDEX];
+
+	const int base = r_merged.vertices.size();
+	const int vertex_count = vertices.size();
+	const Basis normal_basis = p_xform.basis.inverse().transposed();
+
+	r_merged.has_normals = r_merged.has_normals && normals.size() == vertex_count;
+	r_merged.has_uvs = r_merged.has_uvs && uvs.size() == vertex_count;
+
+	for (int i = 0; i < vertex_count; i++) {
+		r_merged.vertices.push_back(p_xform.xform(vertices[i]));
+		r_merged.normals.push_back(normals.size() == vertex_count ? normal_basis.xform(normals[i]).normalized() : Vector3());
+		r_merged.uvs.push_back(uvs.size() == vertex_count ? uvs[i] : Vector2());
+	}
+
+	if (indices.is_empty()) {
+		for (int i = 0; i < vertex_count - vertex_count % 3; i++) {
+			r_merged.indices.push_back(base + i);
+		}
+	} else {
+		for (int i = 0; i < indices.size(); i++) {
+			r_merged.indices.push_back(base + indices[i]);
+		}
+	}
+}
+
+void _simplify_surface(MergedSurface &r_merged, float p_ratio, float p_error) {
+	if (!SurfaceTool::simplify_func || p_ratio >= 1.0 || r_merged.indices.is_empty()) {
+		return;
+	}
+
+	LocalVector<float> positions;
+	positions.resize(r_merged.vertices.size() * 3);
+	for (uint32_t i = 0; i < r_merged.vertices.size(); i++) {
+		positions[i * 3 + 0] = r_merged.vertices[i].x;
+		positions[i * 3 + 1] = r_merged.vertices[i].y;
+		positions[i * 3 + 2] = r_merged.vertices[i].z;
+	}
+
+	const size_t target_index_count = MAX(3u, uint32_t(r_merged.indices.size() * p_ratio) / 3 * 3);
+	LocalVector<int> simplified;
+	simplified.resize(r_merged.indices.size());
+	float error = 0.0f;
+	const size_t index_count = SurfaceTool::simplify_func((unsigned int *)simplified.ptr(), (const unsigned int *)r_merged.indices.ptr(), r_merged.indices.size(), positions.ptr(), r_merged.vertices.size(), sizeof(float) * 3, target_index_count, p_error, 0, &error);
+	simplified.resize(index_count);
+
+	// Drop the vertices that are no longer referenced.
+	LocalVector<int> remap;
+	remap.resize(r_merged.vertices.size());
+	for (int &index : remap) {
+		index = -1;
+	}
+
+	MergedSurface compacted;
+	compacted.material = r_merged.material;
+	compacted.has_normals = r_merged.has_normals;
+	compacted.has_uvs = r_merged.has_uvs;
+	for (int index : simplified) {
+		if (remap[index] < 0) {
+			remap[index] = compacted.vertices.size();
+			compacted.vertices.push_back(r_merged.vertices[index]);
+			compacted.normals.push_back(r_merged.normals[index]);
+			compacted.uvs.push_back(r_merged.uvs[index]);
+		}
+		compacted.indices.push_back(remap[index]);
+	}
+
+	r_merged = compacted;
+}
+
+Ref<ArrayMesh> _build_proxy_mesh(const LocalVector<MergedSurface> &p_surfaces) {
+	Ref<ArrayMesh> mesh;
+	mesh.instantiate();
+
+	for (const MergedSurface &merged : p_surfaces) {
+		if (merged.indices.is_empty()) {
+			continue;
+		}
+
+		Array arrays;
+		arrays.resize(Mesh::ARRAY_MAX);
+
+		PackedVector3Array vertices;
+		vertices.resize(merged.vertices.size());
+		memcpy(vertices.ptrw(), merged.vertices.ptr(), merged.vertices.size() * sizeof(Vector3));
+		arrays[Mesh::ARRAY_VERTEX] = vertices;
+
+		if (merged.has_normals) {
+			PackedVector3Array normals;
+			normals.resize(merged.normals.size());
+			memcpy(normals.ptrw(), merged.normals.ptr(), merged.normals.size() * sizeof(Vector3));
+			arrays[Mesh::ARRAY_NORMAL] = normals;
+		}
+
+		if (merged.has_uvs) {
+			PackedVector2Array uvs;
+			uvs.resize(merged.uvs.size());
+			memcpy(uvs.ptrw(), merged.uvs.ptr(), merged.uvs.size() * sizeof(Vector2));
+			arrays[Mesh::ARRAY_TEX_UV] = uvs;
+		}
+
+		PackedInt32Array indices;
+		indices.resize(merged.indices.size());
+		memcpy(indices.ptrw(), merged.indices.ptr(), merged.indices.size() * sizeof(int));
+		arrays[Mesh::ARRAY_INDEX] = indices;
+
+		mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
+		mesh->surface_set_material(mesh->get_surface_count() - 1, merged.material);
+	}
+
+	return mesh;
+}
+
+} // namespace
+
+void HLOD3D::set_distance(float p_distance) {
+	distance = MAX(0.0f, p_distance);
+
+	for (int i = 0; i < proxies.size(); i++) {
+		MeshInstance3D *proxy = Object::cast_to<MeshInstance3D>(get_node_or_null(proxies[i]));
+		if (proxy) {
+			proxy->set_visibility_range_begin(distance);
+		}
+	}
+}
+
+float HLOD3D::get_distance() const {
+	return distance;
+}
+
+void HLOD3D::set_cluster_size(float p_size) {
+	cluster_size = MAX(0.0f, p_size);
+}
+
+float HLOD3D::get_cluster_size() const {
+	return cluster_size;
+}
+
+void HLOD3D::set_simplify_ratio(float p_ratio) {
+	simplify_ratio = CLAMP(p_ratio, 0.0f, 1.0f);
+}
+
+float HLOD3D::get_simplify_ratio() const {
+	return simplify_ratio;
+}
+
+void HLOD3D::set_simplify_error(float p_error) {
+	simplify_error = MAX(0.0f, p_error);
+}
+
+float HLOD3D::get_simplify_error() const {
+	return simplify_error;
+}
+
+void HLOD3D::set_proxies(const TypedArray<NodePath> &p_proxies) {
+	proxies = p_proxies;
+	update_configuration_warnings();
+}
+
+TypedArray<NodePath> HLOD3D::get_proxies() const {
+	return proxies;
+}
+
+void HLOD3D::_find_sources(Node *p_node, LocalVector<MeshInstance3D *> &r_sources) const {
+	Node3D *node_3d = Object::cast_to<Node3D>(p_node);
+	if (node_3d && !node_3d->is_visible()) {
+		return;
+	}
+
+	// Meshes already using visibility ranges are left alone, as are skinned ones.
+	MeshInstance3D *mi = Object::cast_to<MeshInstance3D>(p_node);
+	if (mi && mi->get_mesh().is_valid() && mi->get_skin().is_null() && mi->get_visibility_range_begin() == 0.0f && mi->get_visibility_range_end() == 0.0f && mi->get_visibility_parent().is_empty()) {
+		r_sources.push_back(mi);
+	}
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_find_sources(p_node->get_child(i), r_sources);
+	}
+}
+
+Error HLOD3D::bake() {
+	ERR_FAIL_COND_V_MSG(!is_inside_tree(), ERR_UNCONFIGURED, "HLOD3D must be inside the scene tree to bake.");
+
+	clear();
+
+	LocalVector<MeshInstance3D *> sources;
+	for (int i = 0; i < get_child_count(); i++) {
+		_find_sources(get_child(i), sources);
+	}
+
+	if (sources.is_empty()) {
+		return ERR_CANT_CREATE;
+	}
+
+	const Transform3D to_local = get_global_transform().affine_inverse();
+
+	HashMap<Vector3i, LocalVector<MeshInstance3D *>> clusters;
+	for (MeshInstance3D *source : sources) {
+		Vector3i key;
+		if (cluster_size > 0) {
+			const Vector3 center = (to_local * source->get_global_transform()).xform(source->get_aabb().get_center());
+			key = Vector3i((center / cluster_size).floor());
+		}
+		clusters[key].push_back(source);
+	}
+
+	Node *owner = get_owner() ? get_owner() : this;
+
+	for (const KeyValue<Vector3i, LocalVector<MeshInstance3D *>> &E : clusters) {
+		LocalVector<MergedSurface> surfaces;
+		HashMap<RID, uint32_t> surface_by_material;
+
+		for (MeshInstance3D *source : E.value) {
+			const Ref<Mesh> mesh = source->get_mesh();
+			const Transform3D xform = to_local * source->get_global_transform();
+
+			for (int i = 0; i < mesh->get_surface_count(); i++) {
+				if (mesh->surface_get_primitive_type(i) != Mesh::PRIMITIVE_TRIANGLES || (mesh->surface_get_format(i) & Mesh::ARRAY_FORMAT_BONES)) {
+					continue;
+				}
+
+				const Ref<Material> material = source->get_active_material(i);
+				const RID material_rid = material.is_valid() ? material->get_rid() : RID();
+				if (!surface_by_material.has(material_rid)) {
+					surface_by_material[material_rid] = surfaces.size();
+					surfaces.push_back(MergedSurface());
+					surfaces[surfaces.size() - 1].material = material;
+				}
+
+				_merge_surface(surfaces[surface_by_material[material_rid]], mesh->surface_get_arrays(i), xform);
+			}
+		}
+
+		for (MergedSurface &merged : surfaces) {
+			_simplify_surface(merged, simplify_ratio, simplify_error);
+		}
+
+		Ref<ArrayMesh> proxy_mesh = _build_proxy_mesh(surfaces);
+		if (proxy_mesh->get_surface_count() == 0) {
+			continue;
+		}
+
+		MeshInstance3D *proxy = memnew(MeshInstance3D);
+		proxy->set_name("HLODProxy");
+		proxy->set_mesh(proxy_mesh);
+		proxy->set_visibility_range_begin(distance);
+		add_child(proxy, true);
+		proxy->set_owner(owner);
+		proxies.push_back(get_path_to(proxy));
+
+		// Sources are only drawn while the proxy is hidden for being too close.
+		for (MeshInstance3D *source : E.value) {
+			source->set_visibility_parent(source->get_path_to(proxy));
+		}
+	}
+
+	update_configuration_warnings();
+	return OK;
+}
+
+void HLOD3D::_restore_sources(Node *p_node, const Node *p_proxy) {
+	GeometryInstance3D *gi = Object::cast_to<GeometryInstance3D>(p_node);
+	if (gi && !gi->get_visibility_parent().is_empty() && gi->get_node_or_null(gi->get_visibility_parent()) == p_proxy) {
+		gi->set_visibility_parent(NodePath());
+	}
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_restore_sources(p_node->get_child(i), p_proxy);
+	}
+}
+
+void HLOD3D::clear() {
+	for (int i = 0; i < proxies.size(); i++) {
+		Node *proxy = get_node_or_null(proxies[i]);
+		if (!proxy) {
+			continue;
+		}
+
+		for (int j = 0; j < get_child_count(); j++) {
+			if (get_child(j) != proxy) {
+				_restore_sources(get_child(j), proxy);
+			}
+		}
+
+		remove_child(proxy);
+		memdelete(proxy);
+	}
+
+	proxies.clear();
+	update_configuration_warnings();
+}
+
+PackedStringArray HLOD3D::get_configuration_warnings() const {
+	PackedStringArray warnings = Node3D::get_configuration_warnings();
+
+	if (proxies.is_empty()) {
+		warnings.push_back(RTR("No proxy meshes have been baked yet. Bake the HLOD to merge the MeshInstance3D nodes below it."));
+	}
+
+	return warnings;
+}
+
+void HLOD3D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_distance", "distance"), &HLOD3D::set_distance);
+	ClassDB::bind_method(D_METHOD("get_distance"), &HLOD3D::get_distance);
+	ClassDB::bind_method(D_METHOD("set_cluster_size", "size"), &HLOD3D::set_cluster_size);
+	ClassDB::bind_method(D_METHOD("get_cluster_size"), &HLOD3D::get_cluster_size);
+	ClassDB::bind_method(D_METHOD("set_simplify_ratio", "ratio"), &HLOD3D::set_simplify_ratio);
+	ClassDB::bind_method(D_METHOD("get_simplify_ratio"), &HLOD3D::get_simplify_ratio);
+	ClassDB::bind_method(D_METHOD("set_simplify_error", "error"), &HLOD3D::set_simplify_error);
+	ClassDB::bind_method(D_METHOD("get_simplify_error"), &HLOD3D::get_simplify_error);
+	ClassDB::bind_method(D_METHOD("set_proxies", "proxies"), &HLOD3D::set_proxies);
+	ClassDB::bind_method(D_METHOD("get_proxies"), &HLOD3D::get_proxies);
+
+	ClassDB::bind_method(D_METHOD("bake"), &HLOD3D::bake);
+	ClassDB::bind_method(D_METHOD("clear"), &HLOD3D::clear);
+
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "distance", PROPERTY_HINT_RANGE, "0,4096,0.01,or_greater,suffix:m"), "set_distance", "get_distance");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "cluster_size", PROPERTY_HINT_RANGE, "0,4096,0.01,or_greater,suffix:m"), "set_cluster_size", "get_cluster_size");
+	ADD_GROUP("Simplify", "simplify_");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "simplify_ratio", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_simplify_ratio", "get_simplify_ratio");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "simplify_error", PROPERTY_HINT_RANGE, "0,1,0.001"), "set_simplify_error", "get_simplify_error");
+	ADD_GROUP("", "");
+	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "proxies", PROPERTY_HINT_ARRAY_TYPE, "NodePath", PROPERTY_USAGE_NO_EDITOR), "set_proxies", "get_proxies");
+}
@@ -0,0 +1,76 @@
+/**************************************************************************/
+/*  hlod_3d.h                                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/variant/typed_array.h"
+#include "scene/3d/node_3d.h"
+
+class MeshInstance3D;
+
+// Merges static meshes below this node into simplified proxy meshes, which replace
+// them past a distance using visibility ranges.
+class HLOD3D : public Node3D {
+	GDCLASS(HLOD3D, Node3D);
+
+	float distance = 100.0;
+	float cluster_size = 0.0;
+	float simplify_ratio = 0.25;
+	float simplify_error = 0.01;
+
+	TypedArray<NodePath> proxies;
+
+	void _find_sources(Node *p_node, LocalVector<MeshInstance3D *> &r_sources) const;
+	static void _restore_sources(Node *p_node, const Node *p_proxy);
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_distance(float p_distance);
+	float get_distance() const;
+
+	void set_cluster_size(float p_size);
+	float get_cluster_size() const;
+
+	void set_simplify_ratio(float p_ratio);
+	float get_simplify_ratio() const;
+
+	void set_simplify_error(float p_error);
+	float get_simplify_error() const;
+
+	void set_proxies(const TypedArray<NodePath> &p_proxies);
+	TypedArray<NodePath> get_proxies() const;
+
+	Error bake();
+	void clear();
+
+	PackedStringArray get_configuration_warnings() const override;
+};
@@ -0,0 +1,147 @@
+/**************************************************************************/
+/*  portal_3d.cpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "portal_3d.h"
+
+#include "scene/3d/room_3d.h"
+
+Room3D *Portal3D::_get_parent_room() const {
+	return Object::cast_to<Room3D>(get_parent());
+}
+
+Room3D *Portal3D::_get_linked_room() const {
+	if (!is_inside_tree() || linked_room.is_empty()) {
+		return nullptr;
+	}
+	return Object::cast_to<Room3D>(get_node_or_null(linked_room));
+}
+
+void Portal3D::_update_points() {
+	if (!is_inside_tree()) {
+		return;
+	}
+
+	// The polygon lies on the local XY plane.
+	const Transform3D xform = get_global_transform();
+	PackedVector3Array points;
+	points.resize(polygon.size());
+	Vector3 *w = points.ptrw();
+	for (int i = 0; i < polygon.size(); i++) {
+		w[i] = xform.xform(Vector3(polygon[i].x, polygon[i].y, 0));
+	}
+	RS::get_singleton()->portal_set_points(portal, points);
+}
+
+void Portal3D::_update_rooms() {
+	Room3D *room_a = _get_parent_room();
+	Room3D *room_b = _get_linked_room();
+	RS::get_singleton()->portal_set_rooms(portal, room_a ? room_a->get_room() : RID(), room_b ? room_b->get_room() : RID());
+}
+
+void Portal3D::set_polygon(const PackedVector2Array &p_polygon) {
+	polygon = p_polygon;
+	_update_points();
+}
+
+PackedVector2Array Portal3D::get_polygon() const {
+	return polygon;
+}
+
+void Portal3D::set_linked_room(const NodePath &p_room) {
+	linked_room = p_room;
+	if (is_inside_tree()) {
+		_update_rooms();
+	}
+	update_configuration_warnings();
+}
+
+NodePath Portal3D::get_linked_room() const {
+	return linked_room;
+}
+
+RID Portal3D::get_portal() const {
+	return portal;
+}
+
+PackedStringArray Portal3D::get_configuration_warnings() const {
+	PackedStringArray warnings = Node3D::get_configuration_warnings();
+
+	if (!_get_parent_room()) {
+		warnings.push_back(RTR("A Portal3D must be a child of the Room3D it leads out of."));
+	}
+
+	if (is_inside_tree() && !_get_linked_room()) {
+		warnings.push_back(RTR("The linked room must point to the Room3D this portal leads into."));
+	}
+
+	return warnings;
+}
+
+void Portal3D::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_ENTER_WORLD: {
+			ERR_FAIL_COND(get_world_3d().is_null());
+			RS::get_singleton()->portal_set_scenario(portal, get_world_3d()->get_scenario());
+			_update_points();
+			_update_rooms();
+		} break;
+
+		case NOTIFICATION_TRANSFORM_CHANGED: {
+			_update_points();
+		} break;
+
+		case NOTIFICATION_EXIT_WORLD: {
+			RS::get_singleton()->portal_set_scenario(portal, RID());
+		} break;
+	}
+}
+
+void Portal3D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_polygon", "polygon"), &Portal3D::set_polygon);
+	ClassDB::bind_method(D_METHOD("get_polygon"), &Portal3D::get_polygon);
+	ClassDB::bind_method(D_METHOD("set_linked_room", "room"), &Portal3D::set_linked_room);
+	ClassDB::bind_method(D_METHOD("get_linked_room"), &Portal3D::get_linked_room);
+	ClassDB::bind_method(D_METHOD("get_portal"), &Portal3D::get_portal);
+
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_VECTOR2_ARRAY, "polygon"), "set_polygon", "get_polygon");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "linked_room", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "Room3D"), "set_linked_room", "get_linked_room");
+}
+
+Portal3D::Portal3D() {
+	portal = RS::get_singleton()->portal_create();
+	set_notify_transform(true);
+
+	polygon = { Vector2(-1, -1), Vector2(1, -1), Vector2(1, 1), Vector2(-1, 1) };
+}
+
+Portal3D::~Portal3D() {
+	ERR_FAIL_NULL(RenderingServer::get_singleton());
+	RS::get_singleton()->free(portal);
+}
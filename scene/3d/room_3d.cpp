@@ -0,0 +1,111 @@
+/**************************************************************************/
+/*  room_3d.cpp                                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "room_3d.h"
+
+void Room3D::_update_points() {
+	if (!is_inside_tree()) {
+		return;
+	}
+
+	const Transform3D xform = get_global_transform();
+	PackedVector3Array global_points;
+	global_points.resize(points.size());
+	Vector3 *w = global_points.ptrw();
+	for (int i = 0; i < points.size(); i++) {
+		w[i] = xform.xform(points[i]);
+	}
+	RS::get_singleton()->room_set_points(room, global_points);
+}
+
+void Room3D::set_points(const PackedVector3Array &p_points) {
+	points = p_points;
+	_update_points();
+	update_configuration_warnings();
+}
+
+PackedVector3Array Room3D::get_points() const {
+	return points;
+}
+
+RID Room3D::get_room() const {
+	return room;
+}
+
+PackedStringArray Room3D::get_configuration_warnings() const {
+	PackedStringArray warnings = Node3D::get_configuration_warnings();
+
+	if (points.size() < 4) {
+		warnings.push_back(RTR("A room needs at least 4 points enclosing a volume to take part in portal culling."));
+	}
+
+	return warnings;
+}
+
+void Room3D::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_ENTER_WORLD: {
+			ERR_FAIL_COND(get_world_3d().is_null());
+			RS::get_singleton()->room_set_scenario(room, get_world_3d()->get_scenario());
+			_update_points();
+		} break;
+
+		case NOTIFICATION_TRANSFORM_CHANGED: {
+			_update_points();
+		} break;
+
+		case NOTIFICATION_EXIT_WORLD: {
+			RS::get_singleton()->room_set_scenario(room, RID());
+		} break;
+	}
+}
+
+void Room3D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_points", "points"), &Room3D::set_points);
+	ClassDB::bind_method(D_METHOD("get_points"), &Room3D::get_points);
+	ClassDB::bind_method(D_METHOD("get_room"), &Room3D::get_room);
+
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_VECTOR3_ARRAY, "points"), "set_points", "get_points");
+}
+
+Room3D::Room3D() {
+	room = RS::get_singleton()->room_create();
+	set_notify_transform(true);
+
+	points = {
+		Vector3(-1, -1, -1), Vector3(1, -1, -1), Vector3(1, 1, -1), Vector3(-1, 1, -1),
+		Vector3(-1, -1, 1), Vector3(1, -1, 1), Vector3(1, 1, 1), Vector3(-1, 1, 1)
+	};
+}
+
+Room3D::~Room3D() {
+	ERR_FAIL_NULL(RenderingServer::get_singleton());
+	RS::get_singleton()->free(room);
+}
@@ -31,6 +31,7 @@
 #include "skeleton_3d.h"
 #include "skeleton_3d.compat.inc"
 
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/skeleton_modifier_3d.h"
 #if !defined(DISABLE_DEPRECATED) && !defined(PHYSICS_3D_DISABLED)
 #include "scene/3d/physics/physical_bone_simulator_3d.h"
@@ -66,6 +67,9 @@ SkinReference::~SkinReference() {
 
 ///////////////////////////////////////
 
+LocalVector<ObjectID> Skeleton3D::update_batch;
+uint64_t Skeleton3D::prepared_update_count = 0;
+
 bool Skeleton3D::_set(const StringName &p_path, const Variant &p_value) {
 #if !defined(DISABLE_DEPRECATED) && !defined(PHYSICS_3D_DISABLED)
 	if (p_path == SNAME("animate_physical_bones")) {
@@ -334,6 +338,10 @@ void Skeleton3D::_notification(int p_what) {
 		} break;
 #endif // TOOLS_ENABLED
 		case NOTIFICATION_UPDATE_SKELETON: {
+			if (Thread::is_main_thread() && !update_batch.is_empty()) {
+				_prepare_update_batch();
+			}
+
 			// Update bone transforms to apply unprocessed poses.
 			force_update_all_dirty_bones();
 
@@ -421,12 +429,16 @@ void Skeleton3D::_notification(int p_what) {
 					E->skeleton_version = version;
 				}
 
-				for (uint32_t i = 0; i < bind_count; i++) {
-					uint32_t bone_index = E->skin_bone_indices_ptrs[i];
-					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].global_pose * skin->get_bind_pose(i));
+				if (bind_count == 0) {
+					continue;
 				}
+
+				if (!skins_prepared) {
+					_update_skin_buffer(E);
+				}
+				rs->skeleton_set_buffer(skeleton, E->skin_buffer);
 			}
+			skins_prepared = false;
 
 			if (!modifiers.is_empty()) {
 				// Restore unmodified bone poses.
@@ -517,12 +529,14 @@ int Skeleton3D::_update_bone_nested_set(int p_bone, int p_offset) const {
 }
 
 void Skeleton3D::_make_bone_global_poses_dirty() const {
+	skins_prepared = false;
 	for (uint32_t i = 0; i < bone_global_pose_dirty.size(); i++) {
 		bone_global_pose_dirty[i] = true;
 	}
 }
 
 void Skeleton3D::_make_bone_global_pose_subtree_dirty(int p_bone) const {
+	skins_prepared = false;
 	if (process_order_dirty) {
 		return;
 	}
@@ -952,6 +966,7 @@ Transform3D Skeleton3D::get_bone_pose(int p_bone) const {
 }
 
 void Skeleton3D::_make_dirty() {
+	skins_prepared = false;
 	if (dirty) {
 		return;
 	}
@@ -970,11 +985,112 @@ void Skeleton3D::_update_deferred(UpdateFlag p_update_flag) {
 #endif //TOOLS_ENABLED
 		if (update_flags == UPDATE_FLAG_NONE && !updating) {
 			notify_deferred_thread_group(NOTIFICATION_UPDATE_SKELETON); // It must never be called more than once in a single frame.
+			if (Thread::is_main_thread() && _is_in_main_thread_group()) {
+				update_batch.push_back(get_instance_id());
+			}
 		}
 		update_flags |= p_update_flag;
 	}
 }
 
+bool Skeleton3D::_is_in_main_thread_group() const {
+	for (const Node *node = this; node; node = node->get_parent()) {
+		if (node->get_process_thread_group() != PROCESS_THREAD_GROUP_INHERIT) {
+			return node->get_process_thread_group() == PROCESS_THREAD_GROUP_MAIN_THREAD;
+		}
+	}
+	return true;
+}
+
+void Skeleton3D::_prepare_update_batch() {
+	thread_local LocalVector<Skeleton3D *> skeletons;
+	skeletons.clear();
+
+	for (const ObjectID &id : update_batch) {
+		Skeleton3D *skeleton = ObjectDB::get_instance<Skeleton3D>(id);
+		if (!skeleton || !skeleton->is_inside_tree() || skeleton->updating || skeleton->skins_prepared || !(skeleton->update_flags & UPDATE_FLAG_POSE)) {
+			continue;
+		}
+
+		// Modifiers run scripts and need the global poses, so those skeletons are updated on their own.
+		skeleton->_find_modifiers();
+		if (!skeleton->modifiers.is_empty()) {
+			continue;
+		}
+
+		skeleton->_update_process_order();
+		skeletons.push_back(skeleton);
+	}
+	update_batch.clear();
+
+	if (skeletons.size() < 2) {
+		// Nothing to gain over the regular update.
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Skeleton3D::_prepare_update_threaded, skeletons.ptr(), skeletons.size(), -1, true, SNAME("Skeleton3DPrepareUpdate"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (const Skeleton3D *skeleton : skeletons) {
+		if (skeleton->skins_prepared) {
+			prepared_update_count++;
+		}
+	}
+}
+
+void Skeleton3D::_prepare_update_threaded(uint32_t p_index, Skeleton3D *const *p_skeletons) {
+	p_skeletons[p_index]->_prepare_update();
+}
+
+void Skeleton3D::_prepare_update() {
+	// Runs on a worker thread, so signals are left for NOTIFICATION_UPDATE_SKELETON.
+	if (dirty && !parentless_bones.is_empty()) {
+		// Processes the whole nested set, whichever bone is passed.
+		_force_update_bone_children_transforms(parentless_bones[0]);
+	}
+
+	for (const SkinReference *E : skin_bindings) {
+		if (E->bind_count != E->skin->get_bind_count() || E->skeleton_version != version) {
+			return; // Skin data must be reallocated first.
+		}
+	}
+
+	for (SkinReference *E : skin_bindings) {
+		_update_skin_buffer(E);
+	}
+	skins_prepared = true;
+}
+
+void Skeleton3D::_update_skin_buffer(SkinReference *p_skin) const {
+	const Skin *skin = p_skin->skin.operator->();
+	const Bone *bonesptr = bones.ptr();
+	const uint32_t len = bones.size();
+
+	// Bones skipped below keep their previous transform, as they did when set one by one.
+	p_skin->skin_buffer.resize_initialized(p_skin->bind_count * 12);
+	float *bufferptr = p_skin->skin_buffer.ptrw();
+
+	for (uint32_t i = 0; i < p_skin->bind_count; i++) {
+		uint32_t bone_index = p_skin->skin_bone_indices_ptrs[i];
+		ERR_CONTINUE(bone_index >= len);
+		const Transform3D xform = bonesptr[bone_index].global_pose * skin->get_bind_pose(i);
+
+		float *dataptr = bufferptr + i * 12;
+		dataptr[0] = xform.basis.rows[0][0];
+		dataptr[1] = xform.basis.rows[0][1];
+		dataptr[2] = xform.basis.rows[0][2];
+		dataptr[3] = xform.origin.x;
+		dataptr[4] = xform.basis.rows[1][0];
+		dataptr[5] = xform.basis.rows[1][1];
+		dataptr[6] = xform.basis.rows[1][2];
+		dataptr[7] = xform.origin.y;
+		dataptr[8] = xform.basis.rows[2][0];
+		dataptr[9] = xform.basis.rows[2][1];
+		dataptr[10] = xform.basis.rows[2][2];
+		dataptr[11] = xform.origin.z;
+	}
+}
+
 void Skeleton3D::localize_rests() {
 	Vector<int> bones_to_process = get_parentless_bones();
 	while (bones_to_process.size() > 0) {
@@ -49,6 +49,7 @@ class SkinReference : public RefCounted {
 	uint64_t skeleton_version = 0;
 	Vector<uint32_t> skin_bone_indices;
 	uint32_t *skin_bone_indices_ptrs = nullptr;
+	Vector<float> skin_buffer; // Bone transforms in RenderingServer::skeleton_set_buffer() layout.
 
 protected:
 	static void _bind_methods();
@@ -57,6 +58,8 @@ public:
 	// Public for use with callable_mp.
 	void _skin_changed();
 
+	const Vector<float> &get_skin_buffer() const { return skin_buffer; }
+
 	RID get_skeleton() const;
 	Ref<Skin> get_skin() const;
 	~SkinReference();
@@ -96,6 +99,17 @@ private:
 	bool updating = false; // Is updating now?
 	double update_delta = 0.0;
 
+	// Skeletons of the main thread waiting for NOTIFICATION_UPDATE_SKELETON. When the first one is
+	// processed, global poses and skin buffers of those without modifiers are prepared in parallel.
+	static LocalVector<ObjectID> update_batch;
+	static uint64_t prepared_update_count;
+	mutable bool skins_prepared = false;
+	bool _is_in_main_thread_group() const;
+	void _prepare_update_batch();
+	void _prepare_update_threaded(uint32_t p_index, Skeleton3D *const *p_skeletons);
+	void _prepare_update();
+	void _update_skin_buffer(SkinReference *p_skin) const;
+
 	struct Bone {
 		String name;
 
@@ -222,6 +236,9 @@ public:
 		NOTIFICATION_UPDATE_SKELETON = 50
 	};
 
+	// Number of skeletons whose poses and skins were prepared by a batched update.
+	static uint64_t get_prepared_update_count() { return prepared_update_count; }
+
 	// Skeleton creation API
 	uint64_t get_version() const;
 	int add_bone(const String &p_name);
@@ -33,6 +33,7 @@
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/os/frame_arena.h"
 #include "core/string/string_name.h"
 #include "scene/2d/audio_stream_player_2d.h"
 #include "scene/animation/animation_player.h"
@@ -1135,8 +1136,8 @@ void AnimationMixer::_blend_calc_total_weight() {
 	for (const AnimationInstance &ai : animation_instances) {
 		Ref<Animation> a = ai.animation_data.animation;
 		real_t weight = ai.playback_info.weight;
-		const real_t *track_weights_ptr = ai.playback_info.track_weights.ptr();
-		int track_weights_count = ai.playback_info.track_weights.size();
+		const real_t *track_weights_ptr = ai.playback_info.track_weights;
+		int track_weights_count = ai.playback_info.track_weight_count;
 		ERR_CONTINUE_EDMSG(!animation_track_num_to_track_cache.has(a), "No animation in cache.");
 		LocalVector<TrackCache *> &track_num_to_track_cache = animation_track_num_to_track_cache[a];
 		thread_local HashSet<Animation::TypeHash, HashHasher> processed_hashes;
@@ -1180,8 +1181,8 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 		Animation::LoopedFlag looped_flag = ai.playback_info.looped_flag;
 		bool is_external_seeking = ai.playback_info.is_external_seeking;
 		real_t weight = ai.playback_info.weight;
-		const real_t *track_weights_ptr = ai.playback_info.track_weights.ptr();
-		int track_weights_count = ai.playback_info.track_weights.size();
+		const real_t *track_weights_ptr = ai.playback_info.track_weights;
+		int track_weights_count = ai.playback_info.track_weight_count;
 		bool backward = std::signbit(delta); // This flag is used by the root motion calculates or detecting the end of audio stream.
 		bool seeked_backward = std::signbit(p_delta);
 #ifndef _3D_DISABLED
@@ -2047,11 +2048,24 @@ void AnimationMixer::make_animation_instance(const StringName &p_name, const Pla
 	AnimationInstance ai;
 	ai.animation_data = ad;
 	ai.playback_info = p_playback_info;
+	if (p_playback_info.track_weight_count > 0) {
+		// The blending node reuses its weights for the next animation, keep a copy until the instances are cleared.
+		size_t size = p_playback_info.track_weight_count * sizeof(real_t);
+		real_t *track_weights = (real_t *)FrameArena::get_thread_arena().alloc(size);
+		memcpy(track_weights, p_playback_info.track_weights, size);
+		ai.playback_info.track_weights = track_weights;
+	}
 
 	animation_instances.push_back(ai);
 }
 
 void AnimationMixer::clear_animation_instances() {
+	// Release in reverse order, so the frame storage is reclaimed right away.
+	FrameArena &arena = FrameArena::get_thread_arena();
+	for (int64_t i = int64_t(animation_instances.size()) - 1; i >= 0; i--) {
+		const PlaybackInfo &pi = animation_instances[i].playback_info;
+		arena.free((void *)pi.track_weights, pi.track_weight_count * sizeof(real_t));
+	}
 	animation_instances.clear();
 }
 
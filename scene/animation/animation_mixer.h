@@ -91,7 +91,10 @@ public:
 		bool is_external_seeking = false;
 		Animation::LoopedFlag looped_flag = Animation::LOOPED_FLAG_NONE;
 		real_t weight = 0.0;
-		Vector<real_t> track_weights;
+		// Points into the state of the blending node until make_animation_instance()
+		// copies it into frame storage, which is released by clear_animation_instances().
+		const real_t *track_weights = nullptr;
+		uint32_t track_weight_count = 0;
 	};
 
 	struct AnimationInstance {
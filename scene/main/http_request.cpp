@@ -99,6 +99,40 @@ String HTTPRequest::get_header_value(const PackedStringArray &p_headers, const S
 	return value;
 }
 
+bool HTTPRequest::_parse_content_range(const String &p_value, int64_t &r_start, int64_t &r_end, int64_t &r_total) {
+	// Either "bytes <first>-<last>/<total>" or "bytes */<total>", the total may be "*" when unknown.
+	if (!p_value.to_lower().begins_with("bytes ")) {
+		return false;
+	}
+	Vector<String> parts = p_value.substr(6).strip_edges().split("/");
+	if (parts.size() != 2) {
+		return false;
+	}
+
+	r_start = -1;
+	r_end = -1;
+	if (parts[0] != "*") {
+		Vector<String> range = parts[0].split("-");
+		if (range.size() != 2 || !range[0].is_valid_int() || !range[1].is_valid_int()) {
+			return false;
+		}
+		r_start = range[0].to_int();
+		r_end = range[1].to_int();
+		if (r_start < 0 || r_end < r_start) {
+			return false;
+		}
+	}
+
+	if (parts[1] == "*") {
+		r_total = -1;
+	} else if (parts[1].is_valid_int()) {
+		r_total = parts[1].to_int();
+	} else {
+		return false;
+	}
+	return true;
+}
+
 Error HTTPRequest::request(const String &p_url, const Vector<String> &p_custom_headers, HTTPClient::Method p_method, const String &p_request_data) {
 	// Copy the string into a raw buffer.
 	Vector<uint8_t> raw_data;
@@ -132,7 +166,21 @@ Error HTTPRequest::request_raw(const String &p_url, const Vector<String> &p_cust
 
 	headers = p_custom_headers;
 
-	if (accept_gzip) {
+	// Byte ranges refer to the encoded body, so ranged downloads are never compressed.
+	// A user provided Range header takes precedence over resuming and splitting.
+	ranged_download = !download_to_file.is_empty() && (download_resume || download_connections > 1) && !has_header(headers, "Range");
+	resume_offset = 0;
+	if (ranged_download && download_resume) {
+		Ref<FileAccess> partial = FileAccess::open(download_to_file, FileAccess::READ);
+		if (partial.is_valid()) {
+			resume_offset = partial->get_length();
+		}
+		if (resume_offset > 0) {
+			headers.push_back(vformat("Range: bytes=%d-", resume_offset));
+		}
+	}
+
+	if (accept_gzip && !ranged_download) {
 		// If the user has specified an Accept-Encoding header, don't overwrite it.
 		if (!has_header(headers, "Accept-Encoding")) {
 			headers.push_back("Accept-Encoding: gzip, deflate");
@@ -198,6 +246,7 @@ void HTTPRequest::cancel_request() {
 		}
 	}
 
+	_close_segments();
 	file.unref();
 	decompressor.unref();
 	client->close();
@@ -272,6 +321,16 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 		}
 	}
 
+	if (response_code == 416 && resume_offset > 0) {
+		// Nothing left to resume if the partial file already has the full length.
+		int64_t start, end, total;
+		if (_parse_content_range(get_header_value(response_headers, "Content-Range"), start, end, total) && total == resume_offset) {
+			_defer_done(RESULT_SUCCESS, response_code, response_headers, PackedByteArray());
+			*ret_value = true;
+			return true;
+		}
+	}
+
 	// Check if we need to start streaming decompression.
 	String content_encoding;
 	if (accept_gzip) {
@@ -288,7 +347,241 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 	return false;
 }
 
+bool HTTPRequest::_open_download_file() {
+	int64_t file_start = 0;
+	if (resume_offset > 0 && response_code == 206) {
+		// Append to the partial file, but only if the server resumed where it ends.
+		int64_t start, end, total;
+		if (!_parse_content_range(get_header_value(response_headers, "Content-Range"), start, end, total) || start != resume_offset) {
+			_defer_done(RESULT_REQUEST_FAILED, response_code, response_headers, PackedByteArray());
+			return false;
+		}
+		file = FileAccess::open(download_to_file, FileAccess::READ_WRITE);
+		file_start = resume_offset;
+	} else {
+		file = FileAccess::open(download_to_file, FileAccess::WRITE);
+	}
+
+	if (file.is_null()) {
+		_defer_done(RESULT_DOWNLOAD_FILE_CANT_OPEN, response_code, response_headers, PackedByteArray());
+		return false;
+	}
+	file->seek(file_start);
+
+	if (ranged_download && download_connections > 1 && method == HTTPClient::METHOD_GET && decompressor.is_null() && body_len >= MIN_SEGMENT_SIZE * 2 && get_header_value(response_headers, "Accept-Ranges").to_lower() == "bytes") {
+		_start_segments(file_start, file_start + body_len);
+	}
+	return true;
+}
+
+void HTTPRequest::_start_segments(int64_t p_start, int64_t p_end) {
+	const int count = MIN((int64_t)download_connections, (p_end - p_start) / MIN_SEGMENT_SIZE);
+	const int64_t segment_size = (p_end - p_start + count - 1) / count;
+
+	segment_headers.clear();
+	for (const String &header : headers) {
+		if (!header.strip_edges().to_lower().begins_with("range:")) {
+			segment_headers.push_back(header);
+		}
+	}
+
+	stream_buffer.resize(get_download_chunk_size());
+	// All connections are polled from the same loop, none of them may block the others.
+	client->set_blocking_mode(false);
+
+	segments.resize(count);
+	for (int i = 0; i < count; i++) {
+		DownloadSegment &segment = segments[i];
+		segment.position = p_start + i * segment_size;
+		segment.end = MIN(segment.position + segment_size, p_end);
+		if (i == 0) {
+			// The connection that asked for the whole body keeps the first range.
+			segment.client = client;
+			segment.request_sent = true;
+			segment.got_response = true;
+			continue;
+		}
+
+		segment.client = Ref<HTTPClient>(HTTPClient::create());
+		segment.client->set_blocking_mode(false);
+		segment.client->set_read_chunk_size(get_download_chunk_size());
+		if (!http_proxy_host.is_empty()) {
+			segment.client->set_http_proxy(http_proxy_host, http_proxy_port);
+		}
+		if (!https_proxy_host.is_empty()) {
+			segment.client->set_https_proxy(https_proxy_host, https_proxy_port);
+		}
+		// A failure here shows up as a disconnected client, which is retried like any other connection error.
+		_connect_segment(segment);
+	}
+}
+
+Error HTTPRequest::_connect_segment(DownloadSegment &p_segment) {
+	p_segment.client->close();
+	p_segment.request_sent = false;
+	p_segment.got_response = false;
+	return p_segment.client->connect_to_host(url, port, use_tls ? tls_options : nullptr);
+}
+
+void HTTPRequest::_close_segments() {
+	if (segments.is_empty()) {
+		return;
+	}
+
+	if (file.is_valid()) {
+		// Only keep the contiguous part of the file, so that a resumed download doesn't skip over holes.
+		int64_t complete = 0;
+		for (const DownloadSegment &segment : segments) {
+			complete = segment.position;
+			if (segment.position != segment.end) {
+				break;
+			}
+		}
+		if (complete != segments[segments.size() - 1].end) {
+			file->flush();
+			file->resize(complete);
+		}
+	}
+
+	for (DownloadSegment &segment : segments) {
+		if (segment.client != client) {
+			segment.client->close();
+		}
+	}
+	segments.clear();
+}
+
+bool HTTPRequest::_update_segments() {
+	bool done = true;
+	for (DownloadSegment &segment : segments) {
+		if (segment.position == segment.end) {
+			continue;
+		}
+
+		Result result = _update_segment(segment);
+		if (result == RESULT_CANT_CONNECT || result == RESULT_CONNECTION_ERROR || result == RESULT_NO_RESPONSE) {
+			// Transient failures restart the range from the last byte written.
+			if (segment.retries < MAX_SEGMENT_RETRIES) {
+				segment.retries++;
+				if (_connect_segment(segment) == OK) {
+					result = RESULT_SUCCESS;
+				}
+			}
+		}
+		if (result != RESULT_SUCCESS) {
+			_defer_done(result, response_code, response_headers, PackedByteArray());
+			return true;
+		}
+
+		if (segment.position != segment.end) {
+			done = false;
+		}
+	}
+
+	if (done) {
+		_defer_done(RESULT_SUCCESS, response_code, response_headers, PackedByteArray());
+	}
+	return done;
+}
+
+HTTPRequest::Result HTTPRequest::_update_segment(DownloadSegment &p_segment) {
+	switch (p_segment.client->get_status()) {
+		case HTTPClient::STATUS_RESOLVING:
+		case HTTPClient::STATUS_CONNECTING:
+		case HTTPClient::STATUS_REQUESTING: {
+			p_segment.client->poll();
+			return RESULT_SUCCESS;
+		} break;
+		case HTTPClient::STATUS_CONNECTED: {
+			if (p_segment.request_sent) {
+				// The response ended before the range was complete.
+				return RESULT_NO_RESPONSE;
+			}
+
+			Vector<String> range_headers = segment_headers;
+			range_headers.push_back(vformat("Range: bytes=%d-%d", p_segment.position, p_segment.end - 1));
+			if (p_segment.client->request(HTTPClient::METHOD_GET, request_string, range_headers, nullptr, 0) != OK) {
+				return RESULT_CONNECTION_ERROR;
+			}
+			p_segment.request_sent = true;
+			return RESULT_SUCCESS;
+		} break;
+		case HTTPClient::STATUS_BODY: {
+			if (!p_segment.got_response) {
+				List<String> rheaders;
+				p_segment.client->get_response_headers(&rheaders);
+				String content_range;
+				for (const String &E : rheaders) {
+					if (E.to_lower().begins_with("content-range:")) {
+						content_range = E.substr(14).strip_edges();
+					}
+				}
+
+				// Anything but the exact range that was asked for would end up at the wrong offset.
+				int64_t start, end, total;
+				if (p_segment.client->get_response_code() != 206 || !_parse_content_range(content_range, start, end, total) || start != p_segment.position || end + 1 != p_segment.end) {
+					return RESULT_REQUEST_FAILED;
+				}
+				p_segment.got_response = true;
+			}
+
+			p_segment.client->poll();
+			if (p_segment.client->get_status() != HTTPClient::STATUS_BODY) {
+				return RESULT_SUCCESS;
+			}
+			return _read_segment(p_segment);
+		} break;
+		case HTTPClient::STATUS_CANT_RESOLVE: {
+			return RESULT_CANT_RESOLVE;
+		} break;
+		case HTTPClient::STATUS_DISCONNECTED:
+		case HTTPClient::STATUS_CANT_CONNECT: {
+			return RESULT_CANT_CONNECT;
+		} break;
+		case HTTPClient::STATUS_CONNECTION_ERROR: {
+			return RESULT_CONNECTION_ERROR;
+		} break;
+		case HTTPClient::STATUS_TLS_HANDSHAKE_ERROR: {
+			return RESULT_TLS_HANDSHAKE_ERROR;
+		} break;
+	}
+
+	ERR_FAIL_V(RESULT_REQUEST_FAILED);
+}
+
+HTTPRequest::Result HTTPRequest::_read_segment(DownloadSegment &p_segment) {
+	const int to_read = MIN((int64_t)stream_buffer.size(), p_segment.end - p_segment.position);
+	int received = 0;
+	if (p_segment.client->read_response_body_chunk_into(stream_buffer.ptr(), to_read, received) != OK) {
+		// The range was sent with chunked encoding, which can't be streamed in place.
+		return RESULT_REQUEST_FAILED;
+	}
+	if (received == 0) {
+		return RESULT_SUCCESS;
+	}
+
+	file->seek(p_segment.position);
+	file->store_buffer(stream_buffer.ptr(), received);
+	if (file->get_error() != OK) {
+		return RESULT_DOWNLOAD_FILE_WRITE_ERROR;
+	}
+
+	p_segment.position += received;
+	downloaded.add(received);
+	final_body_size.add(received);
+
+	if (p_segment.position == p_segment.end) {
+		// The first connection still has the rest of the body pending, the others are idle now.
+		p_segment.client->close();
+	}
+	return RESULT_SUCCESS;
+}
+
 bool HTTPRequest::_update_connection() {
+	if (!segments.is_empty()) {
+		return _update_segments();
+	}
+
 	switch (client->get_status()) {
 		case HTTPClient::STATUS_DISCONNECTED: {
 			_defer_done(RESULT_CANT_CONNECT, 0, PackedStringArray(), PackedByteArray());
@@ -379,12 +672,15 @@ bool HTTPRequest::_update_connection() {
 					return true;
 				}
 
+				stream_body = decompressor.is_null() && !client->is_response_chunked();
+
 				if (!download_to_file.is_empty()) {
-					file = FileAccess::open(download_to_file, FileAccess::WRITE);
-					if (file.is_null()) {
-						_defer_done(RESULT_DOWNLOAD_FILE_CANT_OPEN, response_code, response_headers, PackedByteArray());
+					if (!_open_download_file()) {
 						return true;
 					}
+					if (!segments.is_empty()) {
+						return false;
+					}
 				}
 			}
 
@@ -393,8 +689,35 @@ bool HTTPRequest::_update_connection() {
 				return false;
 			}
 
+			int received = 0;
+			Error read_err = ERR_UNAVAILABLE;
+			if (stream_body) {
+				// Read straight into the file buffer or the end of the body, without a temporary array per chunk.
+				int to_read = get_download_chunk_size();
+				if (body_len >= 0) {
+					to_read = MIN(to_read, body_len - downloaded.get());
+				}
+				if (file.is_valid()) {
+					if ((int)stream_buffer.size() < to_read) {
+						stream_buffer.resize(to_read);
+					}
+					read_err = client->read_response_body_chunk_into(stream_buffer.ptr(), to_read, received);
+				} else {
+					const int body_pos = body.size();
+					body.resize(body_pos + to_read);
+					read_err = client->read_response_body_chunk_into(body.ptrw() + body_pos, to_read, received);
+					body.resize(body_pos + received);
+				}
+			}
+
 			PackedByteArray chunk;
-			if (decompressor.is_null()) {
+			if (read_err == OK) {
+				downloaded.add(received);
+			} else if (stream_body) {
+				// Not supported by this client, fall back to reading chunk arrays.
+				stream_body = false;
+				return false;
+			} else if (decompressor.is_null()) {
 				// Chunk can be read directly.
 				chunk = client->read_response_body_chunk();
 				downloaded.add(chunk.size());
@@ -427,14 +750,22 @@ bool HTTPRequest::_update_connection() {
 					left -= w;
 				}
 			}
-			final_body_size.add(chunk.size());
+			final_body_size.add(read_err == OK ? received : chunk.size());
 
 			if (body_size_limit >= 0 && final_body_size.get() > body_size_limit) {
 				_defer_done(RESULT_BODY_SIZE_LIMIT_EXCEEDED, response_code, response_headers, PackedByteArray());
 				return true;
 			}
 
-			if (chunk.size()) {
+			if (read_err == OK) {
+				if (received && file.is_valid()) {
+					file->store_buffer(stream_buffer.ptr(), received);
+					if (file->get_error() != OK) {
+						_defer_done(RESULT_DOWNLOAD_FILE_WRITE_ERROR, response_code, response_headers, PackedByteArray());
+						return true;
+					}
+				}
+			} else if (chunk.size()) {
 				if (file.is_valid()) {
 					const uint8_t *r = chunk.ptr();
 					file->store_buffer(r, chunk.size());
@@ -553,6 +884,27 @@ int HTTPRequest::get_download_chunk_size() const {
 	return client->get_read_chunk_size();
 }
 
+void HTTPRequest::set_download_resume(bool p_enable) {
+	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
+
+	download_resume = p_enable;
+}
+
+bool HTTPRequest::is_download_resume_enabled() const {
+	return download_resume;
+}
+
+void HTTPRequest::set_download_connections(int p_connections) {
+	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
+	ERR_FAIL_COND_MSG(p_connections < 1 || p_connections > MAX_DOWNLOAD_CONNECTIONS, vformat("Download connections must be between 1 and %d.", MAX_DOWNLOAD_CONNECTIONS));
+
+	download_connections = p_connections;
+}
+
+int HTTPRequest::get_download_connections() const {
+	return download_connections;
+}
+
 HTTPClient::Status HTTPRequest::get_http_client_status() const {
 	return client->get_status();
 }
@@ -575,10 +927,14 @@ int HTTPRequest::get_body_size() const {
 
 void HTTPRequest::set_http_proxy(const String &p_host, int p_port) {
 	client->set_http_proxy(p_host, p_port);
+	http_proxy_host = p_host;
+	http_proxy_port = p_port;
 }
 
 void HTTPRequest::set_https_proxy(const String &p_host, int p_port) {
 	client->set_https_proxy(p_host, p_port);
+	https_proxy_host = p_host;
+	https_proxy_port = p_port;
 }
 
 void HTTPRequest::set_timeout(double p_timeout) {
@@ -632,11 +988,19 @@ void HTTPRequest::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_download_chunk_size", "chunk_size"), &HTTPRequest::set_download_chunk_size);
 	ClassDB::bind_method(D_METHOD("get_download_chunk_size"), &HTTPRequest::get_download_chunk_size);
 
+	ClassDB::bind_method(D_METHOD("set_download_resume", "enable"), &HTTPRequest::set_download_resume);
+	ClassDB::bind_method(D_METHOD("is_download_resume_enabled"), &HTTPRequest::is_download_resume_enabled);
+
+	ClassDB::bind_method(D_METHOD("set_download_connections", "connections"), &HTTPRequest::set_download_connections);
+	ClassDB::bind_method(D_METHOD("get_download_connections"), &HTTPRequest::get_download_connections);
+
 	ClassDB::bind_method(D_METHOD("set_http_proxy", "host", "port"), &HTTPRequest::set_http_proxy);
 	ClassDB::bind_method(D_METHOD("set_https_proxy", "host", "port"), &HTTPRequest::set_https_proxy);
 
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "download_file", PROPERTY_HINT_FILE), "set_download_file", "get_download_file");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "download_chunk_size", PROPERTY_HINT_RANGE, "256,16777216,suffix:B"), "set_download_chunk_size", "get_download_chunk_size");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "download_resume"), "set_download_resume", "is_download_resume_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "download_connections", PROPERTY_HINT_RANGE, "1,16"), "set_download_connections", "get_download_connections");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_threads"), "set_use_threads", "is_using_threads");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "accept_gzip"), "set_accept_gzip", "is_accepting_gzip");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "body_size_limit", PROPERTY_HINT_RANGE, "-1,2000000000,suffix:B"), "set_body_size_limit", "get_body_size_limit");
@@ -33,6 +33,7 @@
 #include "core/io/http_client.h"
 #include "core/io/stream_peer_gzip.h"
 #include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
@@ -83,6 +84,34 @@ private:
 	Vector<String> response_headers;
 
 	String download_to_file;
+	bool download_resume = false;
+	int download_connections = 1;
+
+	// Ranged downloads split the body into byte ranges, each fetched by its own connection and written in place.
+	struct DownloadSegment {
+		Ref<HTTPClient> client;
+		int64_t position = 0; // Next byte to be written to the file.
+		int64_t end = 0; // One past the last byte of the range.
+		bool request_sent = false;
+		bool got_response = false;
+		int retries = 0;
+	};
+
+	static constexpr int MAX_DOWNLOAD_CONNECTIONS = 16;
+	static constexpr int64_t MIN_SEGMENT_SIZE = 64 * 1024;
+	static constexpr int MAX_SEGMENT_RETRIES = 3;
+
+	bool ranged_download = false;
+	int64_t resume_offset = 0;
+	Vector<String> segment_headers;
+	LocalVector<DownloadSegment> segments;
+	LocalVector<uint8_t> stream_buffer;
+	bool stream_body = false;
+
+	String http_proxy_host;
+	int http_proxy_port = -1;
+	String https_proxy_host;
+	int https_proxy_port = -1;
 
 	Ref<StreamPeerGZIP> decompressor;
 	Ref<FileAccess> file;
@@ -107,6 +136,15 @@ private:
 	Error _parse_url(const String &p_url);
 	Error _request();
 
+	bool _open_download_file();
+	void _start_segments(int64_t p_start, int64_t p_end);
+	Error _connect_segment(DownloadSegment &p_segment);
+	bool _update_segments();
+	Result _update_segment(DownloadSegment &p_segment);
+	Result _read_segment(DownloadSegment &p_segment);
+	void _close_segments();
+	static bool _parse_content_range(const String &p_value, int64_t &r_start, int64_t &r_end, int64_t &r_total);
+
 	bool has_header(const PackedStringArray &p_headers, const String &p_header_name);
 	String get_header_value(const PackedStringArray &p_headers, const String &header_name);
 
@@ -141,6 +179,12 @@ public:
 	void set_download_chunk_size(int p_chunk_size);
 	int get_download_chunk_size() const;
 
+	void set_download_resume(bool p_enable);
+	bool is_download_resume_enabled() const;
+
+	void set_download_connections(int p_connections);
+	int get_download_connections() const;
+
 	void set_body_size_limit(int p_bytes);
 	int get_body_size_limit() const;
 
@@ -30,6 +30,7 @@
 
 #include "multiplayer_api.h"
 
+#include "core/config/project_settings.h"
 #include "core/io/marshalls.h"
 StringName MultiplayerAPI::default_interface;
 
@@ -54,6 +55,9 @@ Ref<MultiplayerAPI> MultiplayerAPI::create_default_interface() {
 // - The first LSB 6 bits are used for the variant type.
 // - The next two bits are used to store the encoding mode.
 // - Boolean values uses the encoding mode to store the value.
+// - Other types use the compact encoding with the type as its schema, marked by ENCODE_COMPACT.
+//   When `network/multiplayer/compact_variant_encoding` is disabled, they use the regular encoding
+//   with the encoding mode left at 0 instead, which is what versions without the compact encoding send.
 #define VARIANT_META_TYPE_MASK 0x3F
 #define VARIANT_META_EMODE_MASK 0xC0
 #define VARIANT_META_BOOL_MASK 0x80
@@ -61,6 +65,7 @@ Ref<MultiplayerAPI> MultiplayerAPI::create_default_interface() {
 #define ENCODE_16 1 << 6
 #define ENCODE_32 2 << 6
 #define ENCODE_64 3 << 6
+#define ENCODE_COMPACT 1 << 6
 Error MultiplayerAPI::encode_and_compress_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_allow_object_decoding) {
 	// Unreachable because `VARIANT_MAX` == 38 and `ENCODE_VARIANT_MASK` == 77
 	CRASH_COND(p_variant.get_type() > VARIANT_META_TYPE_MASK);
@@ -121,16 +126,28 @@ Error MultiplayerAPI::encode_and_compress_variant(const Variant &p_variant, uint
 			}
 		} break;
 		default:
-			// Any other case is not yet compressed.
-			Error err = encode_variant(p_variant, r_buffer, r_len, p_allow_object_decoding);
+			if (!GLOBAL_GET_CACHED(bool, "network/multiplayer/compact_variant_encoding")) {
+				Error err = encode_variant(p_variant, r_buffer, r_len, p_allow_object_decoding);
+				if (err != OK) {
+					return err;
+				}
+				if (r_buffer) {
+					// The first byte is not used by the marshaling, so store the type
+					// so we know how to decompress and decode this variant.
+					r_buffer[0] = p_variant.get_type();
+				}
+				break;
+			}
+			if (buf) {
+				buf[0] = ENCODE_COMPACT | p_variant.get_type();
+				buf += 1;
+			}
+			int size = 0;
+			Error err = encode_variant_compact(p_variant, buf, size, p_allow_object_decoding, p_variant.get_type());
 			if (err != OK) {
 				return err;
 			}
-			if (r_buffer) {
-				// The first byte is not used by the marshaling, so store the type
-				// so we know how to decompress and decode this variant.
-				r_buffer[0] = p_variant.get_type();
-			}
+			r_len = 1 + size;
 	}
 
 	return OK;
@@ -195,6 +212,17 @@ Error MultiplayerAPI::decode_and_decompress_variant(Variant &r_variant, const ui
 			}
 		} break;
 		default:
+			if (encode_mode == ENCODE_COMPACT) {
+				int size = 0;
+				Error err = decode_variant_compact(r_variant, p_buffer + 1, p_len - 1, &size, p_allow_object_decoding, Variant::Type(type));
+				if (err != OK) {
+					return err;
+				}
+				if (r_len) {
+					*r_len = 1 + size;
+				}
+				break;
+			}
 			Error err = decode_variant(r_variant, p_buffer, p_len, r_len, p_allow_object_decoding);
 			if (err != OK) {
 				return err;
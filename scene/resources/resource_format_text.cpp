@@ -1383,7 +1383,7 @@ Ref<Resource> ResourceFormatLoaderText::load(const String &p_path, const String
 
 	Error err;
 
-	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	Ref<FileAccess> f = ResourceLoader::open_prefetched(p_path, &err);
 
 	ERR_FAIL_COND_V_MSG(err != OK, Ref<Resource>(), "Cannot open file '" + p_path + "'.");
 
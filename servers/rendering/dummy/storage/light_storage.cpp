@@ -47,7 +47,10 @@ LightStorage::~LightStorage() {
 }
 
 bool LightStorage::free(RID p_rid) {
-	if (owns_lightmap(p_rid)) {
+	if (owns_light(p_rid)) {
+		light_free(p_rid);
+		return true;
+	} else if (owns_lightmap(p_rid)) {
 		lightmap_free(p_rid);
 		return true;
 	} else if (owns_lightmap_instance(p_rid)) {
@@ -58,6 +61,104 @@ bool LightStorage::free(RID p_rid) {
 	return false;
 }
 
+/* LIGHT API */
+
+RID LightStorage::directional_light_allocate() {
+	return light_owner.allocate_rid();
+}
+
+void LightStorage::directional_light_initialize(RID p_rid) {
+	Light light;
+	light.type = RS::LIGHT_DIRECTIONAL;
+	light_owner.initialize_rid(p_rid, light);
+}
+
+RID LightStorage::omni_light_allocate() {
+	return light_owner.allocate_rid();
+}
+
+void LightStorage::omni_light_initialize(RID p_rid) {
+	Light light;
+	light.type = RS::LIGHT_OMNI;
+	light_owner.initialize_rid(p_rid, light);
+}
+
+RID LightStorage::spot_light_allocate() {
+	return light_owner.allocate_rid();
+}
+
+void LightStorage::spot_light_initialize(RID p_rid) {
+	Light light;
+	light.type = RS::LIGHT_SPOT;
+	light_owner.initialize_rid(p_rid, light);
+}
+
+void LightStorage::light_free(RID p_rid) {
+	Light *light = light_owner.get_or_null(p_rid);
+	ERR_FAIL_NULL(light);
+	light->dependency.deleted_notify(p_rid);
+	light_owner.free(p_rid);
+}
+
+void LightStorage::light_set_param(RID p_light, RS::LightParam p_param, float p_value) {
+	Light *light = light_owner.get_or_null(p_light);
+	ERR_FAIL_NULL(light);
+
+	if (p_param == RS::LIGHT_PARAM_RANGE) {
+		light->range = p_value;
+	} else if (p_param == RS::LIGHT_PARAM_SPOT_ANGLE) {
+		light->spot_angle = p_value;
+	} else {
+		return;
+	}
+	light->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_LIGHT);
+}
+
+RS::LightType LightStorage::light_get_type(RID p_light) const {
+	const Light *light = light_owner.get_or_null(p_light);
+	ERR_FAIL_NULL_V(light, RS::LIGHT_DIRECTIONAL);
+	return light->type;
+}
+
+AABB LightStorage::light_get_aabb(RID p_light) const {
+	const Light *light = light_owner.get_or_null(p_light);
+	ERR_FAIL_NULL_V(light, AABB());
+
+	switch (light->type) {
+		case RS::LIGHT_SPOT: {
+			float size = Math::tan(Math::deg_to_rad(light->spot_angle)) * light->range;
+			return AABB(Vector3(-size, -size, -light->range), Vector3(size * 2, size * 2, light->range));
+		}
+		case RS::LIGHT_OMNI: {
+			float r = light->range;
+			return AABB(-Vector3(r, r, r), Vector3(r, r, r) * 2);
+		}
+		case RS::LIGHT_DIRECTIONAL: {
+			return AABB();
+		}
+	}
+
+	ERR_FAIL_V(AABB());
+}
+
+float LightStorage::light_get_param(RID p_light, RS::LightParam p_param) {
+	const Light *light = light_owner.get_or_null(p_light);
+	ERR_FAIL_NULL_V(light, 0.0);
+
+	if (p_param == RS::LIGHT_PARAM_RANGE) {
+		return light->range;
+	} else if (p_param == RS::LIGHT_PARAM_SPOT_ANGLE) {
+		return light->spot_angle;
+	}
+	return 0.0;
+}
+
+Dependency *LightStorage::light_get_dependency(RID p_light) const {
+	Light *light = light_owner.get_or_null(p_light);
+	ERR_FAIL_NULL_V(light, nullptr);
+	return &light->dependency;
+}
+
 /* LIGHTMAP API */
 
 RID LightStorage::lightmap_allocate() {
@@ -86,6 +86,20 @@ void MeshStorage::_multimesh_free(RID p_rid) {
 	multimesh_owner.free(p_rid);
 }
 
+void MeshStorage::_multimesh_allocate_data(RID p_multimesh, int p_instances, RS::MultimeshTransformFormat p_transform_format, bool p_use_colors, bool p_use_custom_data, bool p_use_indirect) {
+	DummyMultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	multimesh->instances = p_instances;
+	multimesh->stride = (p_transform_format == RS::MULTIMESH_TRANSFORM_2D ? 8 : 12) + (p_use_colors ? 4 : 0) + (p_use_custom_data ? 4 : 0);
+	multimesh->buffer.resize_initialized(p_instances * multimesh->stride);
+}
+
+int MeshStorage::_multimesh_get_instance_count(RID p_multimesh) const {
+	DummyMultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL_V(multimesh, 0);
+	return multimesh->instances;
+}
+
 void MeshStorage::_multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_buffer) {
 	DummyMultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL(multimesh);
@@ -94,6 +108,32 @@ void MeshStorage::_multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_
 	memcpy(cache_data, p_buffer.ptr(), p_buffer.size() * sizeof(float));
 }
 
+void MeshStorage::_multimesh_set_buffer_range(RID p_multimesh, int p_first_instance, const Vector<float> &p_buffer) {
+	DummyMultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	ERR_FAIL_COND(multimesh->stride == 0);
+	ERR_FAIL_COND(p_buffer.size() % multimesh->stride != 0);
+	ERR_FAIL_COND(p_first_instance < 0 || (p_first_instance * multimesh->stride + p_buffer.size()) > multimesh->buffer.size());
+	memcpy(multimesh->buffer.ptrw() + p_first_instance * multimesh->stride, p_buffer.ptr(), p_buffer.size() * sizeof(float));
+}
+
+void MeshStorage::_multimesh_set_buffer_instances(RID p_multimesh, const Vector<int32_t> &p_instances, const Vector<float> &p_buffer) {
+	DummyMultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	ERR_FAIL_COND(p_buffer.size() != p_instances.size() * multimesh->stride);
+	if (p_instances.is_empty()) {
+		return;
+	}
+
+	float *w = multimesh->buffer.ptrw();
+	const int32_t *instances = p_instances.ptr();
+	const float *r = p_buffer.ptr();
+	for (int i = 0; i < p_instances.size(); i++) {
+		ERR_FAIL_COND((instances[i] + 1) * multimesh->stride > multimesh->buffer.size() || instances[i] < 0);
+		memcpy(w + instances[i] * multimesh->stride, r + i * multimesh->stride, multimesh->stride * sizeof(float));
+	}
+}
+
 Vector<float> MeshStorage::_multimesh_get_buffer(RID p_multimesh) const {
 	DummyMultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL_V(multimesh, Vector<float>());
@@ -178,6 +178,151 @@ void RendererCanvasCull::_mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner
 	} while (ysort_owner && ysort_owner->sort_y);
 }
 
+const Rect2 &RendererCanvasCull::_get_subtree_rect(Item *p_item) {
+	if (!p_item->subtree_rect_dirty) {
+		return p_item->subtree_rect;
+	}
+
+	// Items whose drawing does not only depend on their rect are always visited.
+	bool unbounded = p_item->skeleton.is_valid() || p_item->update_when_visible || p_item->use_identity_transform || p_item->vp_render || p_item->copy_back_buffer || p_item->canvas_group || p_item->repeat_source || p_item->sort_y;
+
+	Rect2 rect = p_item->get_rect();
+	if (p_item->visibility_notifier && p_item->visibility_notifier->area.size != Vector2()) {
+		rect = rect.merge(p_item->visibility_notifier->area);
+	}
+
+	// All children are visited (even hidden ones), so that a clean item never has dirty descendants.
+	// Child rects are grown to account for pixel snapping at each level.
+	for (Item *child : p_item->child_items) {
+		const Rect2 &child_rect = _get_subtree_rect(child);
+		unbounded = unbounded || child->subtree_unbounded;
+		rect = rect.merge(child->xform_curr.xform(child_rect).grow(1));
+	}
+
+	p_item->subtree_rect = rect;
+	p_item->subtree_unbounded = unbounded;
+	p_item->subtree_rect_dirty = false;
+	return p_item->subtree_rect;
+}
+
+AABB RendererCanvasCull::_get_child_index_aabb(Item *p_item) {
+	const Rect2 &rect = _get_subtree_rect(p_item);
+	if (p_item->subtree_unbounded) {
+		return AABB(Vector3(-1e20, -1e20, 0), Vector3(2e20, 2e20, 0));
+	}
+
+	const Rect2 parent_rect = p_item->xform_curr.xform(rect).grow(1);
+	return AABB(Vector3(parent_rect.position.x, parent_rect.position.y, 0), Vector3(parent_rect.size.x, parent_rect.size.y, 0));
+}
+
+RendererCanvasCull::ChildIndex *RendererCanvasCull::_get_parent_child_index(Item *p_item) {
+	if (canvas_item_owner.owns(p_item->parent)) {
+		return canvas_item_owner.get_or_null(p_item->parent)->child_index;
+	}
+	Canvas *canvas = canvas_owner.get_or_null(p_item->parent);
+	return canvas ? canvas->child_index : nullptr;
+}
+
+void RendererCanvasCull::_item_bounds_changed(Item *p_item) {
+	// Dirty items always have dirty ancestors, so the walk can stop at the first one.
+	Item *item = p_item;
+	while (item && !item->subtree_rect_dirty) {
+		item->subtree_rect_dirty = true;
+
+		Item *parent = canvas_item_owner.owns(item->parent) ? canvas_item_owner.get_or_null(item->parent) : nullptr;
+		if (parent) {
+			_child_index_queue(parent->child_index, item);
+		} else {
+			Canvas *canvas = canvas_owner.get_or_null(item->parent);
+			_child_index_queue(canvas ? canvas->child_index : nullptr, item);
+		}
+
+		item = parent;
+	}
+}
+
+void RendererCanvasCull::_child_index_queue(ChildIndex *p_index, Item *p_item) {
+	if (p_index && p_item->child_index_dirty < 0) {
+		p_item->child_index_dirty = p_index->dirty_children.size();
+		p_index->dirty_children.push_back(p_item);
+	}
+}
+
+void RendererCanvasCull::_child_index_remove(ChildIndex *p_index, Item *p_item) {
+	if (!p_index) {
+		return;
+	}
+
+	if (p_item->child_index_id.is_valid()) {
+		p_index->bvh.remove(p_item->child_index_id);
+		p_item->child_index_id = DynamicBVH::ID();
+	}
+
+	if (p_item->child_index_dirty >= 0) {
+		const int32_t pos = p_item->child_index_dirty;
+		p_index->dirty_children.remove_at_unordered(pos);
+		if (pos < (int32_t)p_index->dirty_children.size()) {
+			p_index->dirty_children[pos]->child_index_dirty = pos;
+		}
+		p_item->child_index_dirty = -1;
+	}
+}
+
+RendererCanvasCull::ChildIndex *RendererCanvasCull::_child_index_create(Item *const *p_children, int p_child_count) {
+	ChildIndex *index = memnew(ChildIndex);
+	for (int i = 0; i < p_child_count; i++) {
+		Item *child = p_children[i];
+		child->child_index_id = index->bvh.insert(_get_child_index_aabb(child), child);
+		child->child_index_dirty = -1;
+	}
+	return index;
+}
+
+void RendererCanvasCull::_child_index_free(ChildIndex *p_index, Item *const *p_children, int p_child_count) {
+	for (int i = 0; i < p_child_count; i++) {
+		p_children[i]->child_index_id = DynamicBVH::ID();
+		p_children[i]->child_index_dirty = -1;
+	}
+	memdelete(p_index);
+}
+
+bool RendererCanvasCull::_child_index_cull(ChildIndex *p_index, const Transform2D &p_xform, const Rect2 &p_clip_rect, FrameVector<Item *> &r_children) {
+	if (Math::is_zero_approx(p_xform.determinant())) {
+		return false;
+	}
+
+	for (Item *child : p_index->dirty_children) {
+		child->child_index_dirty = -1;
+		const AABB aabb = _get_child_index_aabb(child);
+		if (child->child_index_id.is_valid()) {
+			p_index->bvh.update(child->child_index_id, aabb);
+		} else {
+			child->child_index_id = p_index->bvh.insert(aabb, child);
+		}
+	}
+	p_index->dirty_children.clear();
+
+	// Item rects are compared against the clip rect size, see _cull_canvas_item().
+	const Rect2 local_rect = p_xform.affine_inverse().xform(Rect2(Point2(), p_clip_rect.size).grow(1));
+
+	struct CullQuery {
+		FrameVector<Item *> *children;
+		_FORCE_INLINE_ bool operator()(void *p_data) {
+			children->push_back((Item *)p_data);
+			return false;
+		}
+	};
+
+	CullQuery query;
+	query.children = &r_children;
+	p_index->bvh.aabb_query(AABB(Vector3(local_rect.position.x, local_rect.position.y, 0), Vector3(local_rect.size.x, local_rect.size.y, 0)), query);
+
+	// Visit children in the same order as without the index, to keep draw order.
+	SortArray<Item *, ItemChildOrderSort> sorter;
+	sorter.sort(r_children.ptr(), r_children.size());
+	return true;
+}
+
 void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *ci, RendererCanvasCull::Item *p_canvas_clip, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, const Transform2D &p_transform, const Rect2 &p_clip_rect, Rect2 p_global_rect, const Color &p_modulate, int p_z, RendererCanvasCull::Item *p_material_owner, bool p_use_canvas_group, RendererCanvasRender::Item *r_canvas_group_from) {
 	if (ci->copy_back_buffer) {
 		ci->copy_back_buffer->screen_rect = p_transform.xform(ci->copy_back_buffer->rect).intersection(p_clip_rect);
@@ -303,6 +448,9 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 
 	if (ci->children_order_dirty) {
 		ci->child_items.sort_custom<ItemIndexSort>();
+		for (int i = 0; i < ci->child_items.size(); i++) {
+			ci->child_items[i]->child_order = i;
+		}
 		ci->children_order_dirty = false;
 	}
 
@@ -458,6 +606,23 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			_attach_canvas_item_for_draw(ci, p_canvas_clip, r_z_list, r_z_last_list, final_xform, p_clip_rect, global_rect, modulate, p_z, p_material_owner, use_canvas_group, canvas_group_from);
 		}
 	} else {
+		// Skip off-screen children when there are many of them. Repeated items are
+		// drawn at offsets, and interpolated ones away from their current transform.
+		FrameVector<Item *> visible_children;
+		if (child_index_min_children > 0 && !_interpolation_data.interpolation_enabled && !(repeat_source_item && (repeat_size.x || repeat_size.y))) {
+			if (!ci->child_index && child_item_count >= child_index_min_children) {
+				ci->child_index = _child_index_create(child_items, child_item_count);
+			} else if (ci->child_index && child_item_count < child_index_min_children / 2) {
+				_child_index_free(ci->child_index, child_items, child_item_count);
+				ci->child_index = nullptr;
+			}
+
+			if (ci->child_index && _child_index_cull(ci->child_index, final_xform, p_clip_rect, visible_children)) {
+				child_items = visible_children.ptr();
+				child_item_count = visible_children.size();
+			}
+		}
+
 		RendererCanvasRender::Item *canvas_group_from = nullptr;
 		bool use_canvas_group = ci->canvas_group != nullptr && (ci->canvas_group->fit_empty || ci->commands != nullptr);
 		if (use_canvas_group) {
@@ -489,12 +654,43 @@ void RendererCanvasCull::render_canvas(RID p_render_target, Canvas *p_canvas, co
 
 	if (p_canvas->children_order_dirty) {
 		p_canvas->child_items.sort();
+		for (int i = 0; i < p_canvas->child_items.size(); i++) {
+			p_canvas->child_items[i].item->child_order = i;
+		}
 		p_canvas->children_order_dirty = false;
 	}
 
 	int l = p_canvas->child_items.size();
 	Canvas::ChildItem *ci = p_canvas->child_items.ptrw();
 
+	FrameVector<Canvas::ChildItem> visible_items;
+	if (child_index_min_children > 0 && !_interpolation_data.interpolation_enabled) {
+		if ((!p_canvas->child_index && l >= child_index_min_children) || (p_canvas->child_index && l < child_index_min_children / 2)) {
+			FrameVector<Item *> children;
+			children.resize(l);
+			for (int i = 0; i < l; i++) {
+				children[i] = ci[i].item;
+			}
+
+			if (!p_canvas->child_index) {
+				p_canvas->child_index = _child_index_create(children.ptr(), l);
+			} else {
+				_child_index_free(p_canvas->child_index, children.ptr(), l);
+				p_canvas->child_index = nullptr;
+			}
+		}
+
+		FrameVector<Item *> visible_children;
+		if (p_canvas->child_index && _child_index_cull(p_canvas->child_index, p_transform, p_clip_rect, visible_children)) {
+			visible_items.resize(visible_children.size());
+			for (uint32_t i = 0; i < visible_children.size(); i++) {
+				visible_items[i].item = visible_children[i];
+			}
+			ci = visible_items.ptr();
+			l = visible_items.size();
+		}
+	}
+
 	_render_canvas_item_tree(p_render_target, ci, l, p_transform, p_clip_rect, p_canvas->modulate, p_lights, p_directional_lights, p_default_filter, p_default_repeat, p_snap_2d_vertices_to_pixel, canvas_cull_mask, r_render_info);
 
 	RENDER_TIMESTAMP("< Render Canvas");
@@ -516,6 +712,7 @@ void RendererCanvasCull::canvas_set_item_mirroring(RID p_canvas, RID p_item, con
 	ERR_FAIL_NULL(canvas);
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	int idx = canvas->find_item(canvas_item);
 	ERR_FAIL_COND(idx == -1);
@@ -531,6 +728,7 @@ void RendererCanvasCull::canvas_set_item_repeat(RID p_item, const Point2 &p_repe
 	ERR_FAIL_COND(p_repeat_times < 0);
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	bool is_repeat_source = (p_repeat_size.x || p_repeat_size.y) && p_repeat_times;
 	canvas_item->repeat_source = is_repeat_source;
@@ -571,12 +769,15 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 	ERR_FAIL_NULL(canvas_item);
 
 	if (canvas_item->parent.is_valid()) {
+		_child_index_remove(_get_parent_child_index(canvas_item), canvas_item);
+
 		if (canvas_owner.owns(canvas_item->parent)) {
 			Canvas *canvas = canvas_owner.get_or_null(canvas_item->parent);
 			canvas->erase_item(canvas_item);
 		} else if (canvas_item_owner.owns(canvas_item->parent)) {
 			Item *item_owner = canvas_item_owner.get_or_null(canvas_item->parent);
 			item_owner->child_items.erase(canvas_item);
+			_item_bounds_changed(item_owner);
 
 			if (item_owner->sort_y) {
 				_mark_ysort_dirty(item_owner);
@@ -593,10 +794,13 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 			ci.item = canvas_item;
 			canvas->child_items.push_back(ci);
 			canvas->children_order_dirty = true;
+			_child_index_queue(canvas->child_index, canvas_item);
 		} else if (canvas_item_owner.owns(p_parent)) {
 			Item *item_owner = canvas_item_owner.get_or_null(p_parent);
 			item_owner->child_items.push_back(canvas_item);
 			item_owner->children_order_dirty = true;
+			_item_bounds_changed(item_owner);
+			_child_index_queue(item_owner->child_index, canvas_item);
 
 			if (item_owner->sort_y) {
 				_mark_ysort_dirty(item_owner);
@@ -629,6 +833,7 @@ void RendererCanvasCull::canvas_item_set_light_mask(RID p_item, int p_mask) {
 void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D &p_transform) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	if (_interpolation_data.interpolation_enabled && canvas_item->interpolated) {
 		if (!canvas_item->on_interpolate_transform_list) {
@@ -674,6 +879,7 @@ void RendererCanvasCull::canvas_item_set_distance_field_mode(RID p_item, bool p_
 void RendererCanvasCull::canvas_item_set_custom_rect(RID p_item, bool p_custom_rect, const Rect2 &p_rect) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	canvas_item->custom_rect = p_custom_rect;
 	canvas_item->rect = p_rect;
@@ -703,6 +909,7 @@ void RendererCanvasCull::canvas_item_set_draw_behind_parent(RID p_item, bool p_e
 void RendererCanvasCull::canvas_item_set_use_identity_transform(RID p_item, bool p_enable) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	canvas_item->use_identity_transform = p_enable;
 }
@@ -710,6 +917,7 @@ void RendererCanvasCull::canvas_item_set_use_identity_transform(RID p_item, bool
 void RendererCanvasCull::canvas_item_set_update_when_visible(RID p_item, bool p_update) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	canvas_item->update_when_visible = p_update;
 }
@@ -717,6 +925,7 @@ void RendererCanvasCull::canvas_item_set_update_when_visible(RID p_item, bool p_
 void RendererCanvasCull::canvas_item_add_line(RID p_item, const Point2 &p_from, const Point2 &p_to, const Color &p_color, float p_width, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	Item::CommandPrimitive *line = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_NULL(line);
@@ -946,6 +1155,7 @@ void RendererCanvasCull::canvas_item_add_polyline(RID p_item, const Vector<Point
 	ERR_FAIL_COND(p_points.size() < 2);
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	Color color = Color(1, 1, 1, 1);
 
@@ -1216,6 +1426,7 @@ void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Poin
 		}
 		Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 		ERR_FAIL_NULL(canvas_item);
+		_item_bounds_changed(canvas_item);
 
 		Vector<Color> colors;
 		if (p_colors.size() == 1) {
@@ -1258,6 +1469,7 @@ void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Poin
 void RendererCanvasCull::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, const Color &p_color, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1422,6 +1634,7 @@ void RendererCanvasCull::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, c
 void RendererCanvasCull::canvas_item_add_circle(RID p_item, const Point2 &p_pos, float p_radius, const Color &p_color, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	static const int circle_segments = 64;
 
@@ -1513,6 +1726,7 @@ void RendererCanvasCull::canvas_item_add_circle(RID p_item, const Point2 &p_pos,
 void RendererCanvasCull::canvas_item_add_texture_rect(RID p_item, const Rect2 &p_rect, RID p_texture, bool p_tile, const Color &p_modulate, bool p_transpose) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1544,6 +1758,7 @@ void RendererCanvasCull::canvas_item_add_texture_rect(RID p_item, const Rect2 &p
 void RendererCanvasCull::canvas_item_add_msdf_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, int p_outline_size, float p_px_range, float p_scale) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1578,6 +1793,7 @@ void RendererCanvasCull::canvas_item_add_msdf_texture_rect_region(RID p_item, co
 void RendererCanvasCull::canvas_item_add_lcd_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1610,6 +1826,7 @@ void RendererCanvasCull::canvas_item_add_lcd_texture_rect_region(RID p_item, con
 void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, bool p_transpose, bool p_clip_uv) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1651,6 +1868,7 @@ void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const R
 void RendererCanvasCull::canvas_item_add_nine_patch(RID p_item, const Rect2 &p_rect, const Rect2 &p_source, RID p_texture, const Vector2 &p_topleft, const Vector2 &p_bottomright, RS::NinePatchAxisMode p_x_axis_mode, RS::NinePatchAxisMode p_y_axis_mode, bool p_draw_center, const Color &p_modulate) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	Item::CommandNinePatch *style = canvas_item->alloc_command<Item::CommandNinePatch>();
 	ERR_FAIL_NULL(style);
@@ -1675,6 +1893,7 @@ void RendererCanvasCull::canvas_item_add_primitive(RID p_item, const Vector<Poin
 
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	Item::CommandPrimitive *prim = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_NULL(prim);
@@ -1701,6 +1920,7 @@ void RendererCanvasCull::canvas_item_add_primitive(RID p_item, const Vector<Poin
 void RendererCanvasCull::canvas_item_add_polygon(RID p_item, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 #ifdef DEBUG_ENABLED
 	int pointcount = p_points.size();
 	ERR_FAIL_COND(pointcount < 3);
@@ -1722,6 +1942,7 @@ void RendererCanvasCull::canvas_item_add_polygon(RID p_item, const Vector<Point2
 void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, const Vector<int> &p_bones, const Vector<float> &p_weights, RID p_texture, int p_count) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	int vertex_count = p_points.size();
 	ERR_FAIL_COND(vertex_count == 0);
@@ -1743,6 +1964,7 @@ void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector
 void RendererCanvasCull::canvas_item_add_set_transform(RID p_item, const Transform2D &p_transform) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	Item::CommandTransform *tr = canvas_item->alloc_command<Item::CommandTransform>();
 	ERR_FAIL_NULL(tr);
@@ -1752,6 +1974,7 @@ void RendererCanvasCull::canvas_item_add_set_transform(RID p_item, const Transfo
 void RendererCanvasCull::canvas_item_add_mesh(RID p_item, const RID &p_mesh, const Transform2D &p_transform, const Color &p_modulate, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 	ERR_FAIL_COND(!p_mesh.is_valid());
 
 	Item::CommandMesh *m = canvas_item->alloc_command<Item::CommandMesh>();
@@ -1771,6 +1994,7 @@ void RendererCanvasCull::canvas_item_add_mesh(RID p_item, const RID &p_mesh, con
 void RendererCanvasCull::canvas_item_add_particles(RID p_item, RID p_particles, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	Item::CommandParticles *part = canvas_item->alloc_command<Item::CommandParticles>();
 	ERR_FAIL_NULL(part);
@@ -1785,6 +2009,7 @@ void RendererCanvasCull::canvas_item_add_particles(RID p_item, RID p_particles,
 void RendererCanvasCull::canvas_item_add_multimesh(RID p_item, RID p_mesh, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	Item::CommandMultiMesh *mm = canvas_item->alloc_command<Item::CommandMultiMesh>();
 	ERR_FAIL_NULL(mm);
@@ -1796,6 +2021,7 @@ void RendererCanvasCull::canvas_item_add_multimesh(RID p_item, RID p_mesh, RID p
 void RendererCanvasCull::canvas_item_add_clip_ignore(RID p_item, bool p_ignore) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	Item::CommandClipIgnore *ci = canvas_item->alloc_command<Item::CommandClipIgnore>();
 	ERR_FAIL_NULL(ci);
@@ -1805,6 +2031,7 @@ void RendererCanvasCull::canvas_item_add_clip_ignore(RID p_item, bool p_ignore)
 void RendererCanvasCull::canvas_item_add_animation_slice(RID p_item, double p_animation_length, double p_slice_begin, double p_slice_end, double p_offset) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	Item::CommandAnimationSlice *as = canvas_item->alloc_command<Item::CommandAnimationSlice>();
 	ERR_FAIL_NULL(as);
@@ -1817,6 +2044,7 @@ void RendererCanvasCull::canvas_item_add_animation_slice(RID p_item, double p_an
 void RendererCanvasCull::canvas_item_set_sort_children_by_y(RID p_item, bool p_enable) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	canvas_item->sort_y = p_enable;
 
@@ -1842,6 +2070,7 @@ void RendererCanvasCull::canvas_item_set_z_as_relative_to_parent(RID p_item, boo
 void RendererCanvasCull::canvas_item_attach_skeleton(RID p_item, RID p_skeleton) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 	if (canvas_item->skeleton == p_skeleton) {
 		return;
 	}
@@ -1871,6 +2100,7 @@ void RendererCanvasCull::canvas_item_attach_skeleton(RID p_item, RID p_skeleton)
 void RendererCanvasCull::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_enable, const Rect2 &p_rect) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 	if (p_enable && (canvas_item->copy_back_buffer == nullptr)) {
 		canvas_item->copy_back_buffer = memnew(RendererCanvasRender::Item::CopyBackBuffer);
 	}
@@ -1888,6 +2118,7 @@ void RendererCanvasCull::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_e
 void RendererCanvasCull::canvas_item_clear(RID p_item) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	canvas_item->clear();
 
@@ -1966,6 +2197,7 @@ void RendererCanvasCull::canvas_item_get_instance_shader_parameter_list(RID p_it
 void RendererCanvasCull::canvas_item_set_visibility_notifier(RID p_item, bool p_enable, const Rect2 &p_area, const Callable &p_enter_callable, const Callable &p_exit_callable) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	if (p_enable) {
 		if (!canvas_item->visibility_notifier) {
@@ -2001,6 +2233,7 @@ void RendererCanvasCull::canvas_item_set_interpolated(RID p_item, bool p_interpo
 void RendererCanvasCull::canvas_item_reset_physics_interpolation(RID p_item) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 	canvas_item->xform_prev = canvas_item->xform_curr;
 }
 
@@ -2008,6 +2241,7 @@ void RendererCanvasCull::canvas_item_reset_physics_interpolation(RID p_item) {
 void RendererCanvasCull::canvas_item_transform_physics_interpolation(RID p_item, const Transform2D &p_transform) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 	canvas_item->xform_prev = p_transform * canvas_item->xform_prev;
 	canvas_item->xform_curr = p_transform * canvas_item->xform_curr;
 }
@@ -2015,6 +2249,7 @@ void RendererCanvasCull::canvas_item_transform_physics_interpolation(RID p_item,
 void RendererCanvasCull::canvas_item_set_canvas_group_mode(RID p_item, RS::CanvasGroupMode p_mode, float p_clear_margin, bool p_fit_empty, float p_fit_margin, bool p_blur_mipmaps) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_bounds_changed(canvas_item);
 
 	if (p_mode == RS::CANVAS_GROUP_MODE_DISABLED) {
 		if (canvas_item->canvas_group != nullptr) {
@@ -2564,7 +2799,14 @@ bool RendererCanvasCull::free(RID p_rid) {
 		}
 
 		for (int i = 0; i < canvas->child_items.size(); i++) {
-			canvas->child_items[i].item->parent = RID();
+			Item *child = canvas->child_items[i].item;
+			child->parent = RID();
+			child->child_index_id = DynamicBVH::ID();
+			child->child_index_dirty = -1;
+		}
+
+		if (canvas->child_index) {
+			memdelete(canvas->child_index);
 		}
 
 		for (RendererCanvasRender::Light *E : canvas->lights) {
@@ -2583,12 +2825,15 @@ bool RendererCanvasCull::free(RID p_rid) {
 		_interpolation_data.notify_free_canvas_item(p_rid, *canvas_item);
 
 		if (canvas_item->parent.is_valid()) {
+			_child_index_remove(_get_parent_child_index(canvas_item), canvas_item);
+
 			if (canvas_owner.owns(canvas_item->parent)) {
 				Canvas *canvas = canvas_owner.get_or_null(canvas_item->parent);
 				canvas->erase_item(canvas_item);
 			} else if (canvas_item_owner.owns(canvas_item->parent)) {
 				Item *item_owner = canvas_item_owner.get_or_null(canvas_item->parent);
 				item_owner->child_items.erase(canvas_item);
+				_item_bounds_changed(item_owner);
 
 				if (item_owner->sort_y) {
 					_mark_ysort_dirty(item_owner);
@@ -2600,6 +2845,11 @@ bool RendererCanvasCull::free(RID p_rid) {
 			canvas_item->child_items[i]->parent = RID();
 		}
 
+		if (canvas_item->child_index) {
+			_child_index_free(canvas_item->child_index, canvas_item->child_items.ptr(), canvas_item->child_items.size());
+			canvas_item->child_index = nullptr;
+		}
+
 		if (canvas_item->visibility_notifier != nullptr) {
 			visibility_notifier_allocator.free(canvas_item->visibility_notifier);
 		}
@@ -2776,6 +3026,7 @@ RendererCanvasCull::RendererCanvasCull() {
 
 	debug_redraw_time = GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "debug/canvas_items/debug_redraw_time", PROPERTY_HINT_RANGE, "0.1,2,0.001,or_greater"), 1.0);
 	debug_redraw_color = GLOBAL_DEF(PropertyInfo(Variant::COLOR, "debug/canvas_items/debug_redraw_color"), Color(1.0, 0.2, 0.2, 0.5));
+	child_index_min_children = GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/2d/culling/spatial_index_min_children", PROPERTY_HINT_RANGE, "0,65536,1"), 1024);
 }
 
 RendererCanvasCull::~RendererCanvasCull() {
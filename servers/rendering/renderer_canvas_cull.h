@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include "core/math/dynamic_bvh.h"
+#include "core/templates/frame_vector.h"
 #include "core/templates/paged_allocator.h"
 #include "renderer_compositor.h"
 #include "renderer_viewport.h"
@@ -40,6 +42,8 @@ class RendererCanvasCull {
 	static void _dependency_deleted(const RID &p_dependency, DependencyTracker *p_tracker);
 
 public:
+	struct ChildIndex;
+
 	struct Item : public RendererCanvasRender::Item {
 		RID parent; // canvas it belongs to
 		RID self;
@@ -61,6 +65,20 @@ public:
 
 		Vector<Item *> child_items;
 
+		// Spatial index of the children, only created when there are many of them.
+		ChildIndex *child_index = nullptr;
+		// Entry in the parent's child index, and position in its dirty list.
+		DynamicBVH::ID child_index_id;
+		int32_t child_index_dirty = -1;
+		// Position in the parent's sorted children, to restore draw order after index queries.
+		int child_order = 0;
+
+		// Bounds of this item and all its descendants in local space.
+		// Unbounded subtrees contain items that can draw outside of their rect.
+		Rect2 subtree_rect;
+		bool subtree_rect_dirty = true;
+		bool subtree_unbounded = false;
+
 		struct VisibilityNotifierData {
 			Rect2 area;
 			Callable enter_callable;
@@ -112,6 +130,12 @@ public:
 		}
 	};
 
+	struct ItemChildOrderSort {
+		_FORCE_INLINE_ bool operator()(const Item *p_left, const Item *p_right) const {
+			return p_left->child_order < p_right->child_order;
+		}
+	};
+
 	struct ItemYSort {
 		_FORCE_INLINE_ bool operator()(const Item *p_left, const Item *p_right) const {
 			const real_t left_y = p_left->ysort_xform.columns[2].y;
@@ -124,6 +148,11 @@ public:
 		}
 	};
 
+	struct ChildIndex {
+		DynamicBVH bvh;
+		LocalVector<Item *> dirty_children;
+	};
+
 	struct LightOccluderPolygon {
 		bool active;
 		Rect2 aabb;
@@ -157,6 +186,7 @@ public:
 
 		bool children_order_dirty;
 		Vector<ChildItem> child_items;
+		ChildIndex *child_index = nullptr;
 		Color modulate;
 		RID parent;
 		float parent_scale;
@@ -211,6 +241,18 @@ private:
 	int _count_ysort_children(RendererCanvasCull::Item *p_canvas_item);
 	void _mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner);
 
+	int child_index_min_children = 0;
+
+	const Rect2 &_get_subtree_rect(Item *p_item);
+	AABB _get_child_index_aabb(Item *p_item);
+	ChildIndex *_get_parent_child_index(Item *p_item);
+	void _item_bounds_changed(Item *p_item);
+	void _child_index_queue(ChildIndex *p_index, Item *p_item);
+	void _child_index_remove(ChildIndex *p_index, Item *p_item);
+	ChildIndex *_child_index_create(Item *const *p_children, int p_child_count);
+	void _child_index_free(ChildIndex *p_index, Item *const *p_children, int p_child_count);
+	bool _child_index_cull(ChildIndex *p_index, const Transform2D &p_xform, const Rect2 &p_clip_rect, FrameVector<Item *> &r_children);
+
 	static constexpr int z_range = RS::CANVAS_ITEM_Z_MAX - RS::CANVAS_ITEM_Z_MIN + 1;
 
 	RendererCanvasRender::Item **z_list;
@@ -374,6 +416,10 @@ public:
 	void update_visibility_notifiers();
 	void update_dirty_items();
 
+	// Number of children from which they are culled through a spatial index, 0 disables it.
+	void set_child_index_min_children(int p_count) { child_index_min_children = p_count; }
+	int get_child_index_min_children() const { return child_index_min_children; }
+
 	void _update_dirty_item(Item *p_item);
 
 	Rect2 _debug_canvas_item_get_rect(RID p_item);
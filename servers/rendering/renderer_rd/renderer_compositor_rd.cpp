@@ -35,6 +35,7 @@
 
 #include "servers/rendering/renderer_rd/forward_clustered/render_forward_clustered.h"
 #include "servers/rendering/renderer_rd/forward_mobile/render_forward_mobile.h"
+#include "servers/rendering/shader_compiler.h"
 
 void RendererCompositorRD::blit_render_targets_to_screen(DisplayServer::WindowID p_screen, const BlitToScreen *p_render_targets, int p_amount) {
 	Error err = RD::get_singleton()->screen_prepare_for_drawing(p_screen);
@@ -305,6 +306,7 @@ RendererCompositorRD::RendererCompositorRD() {
 			} else {
 				shader_cache_user_dir = shader_cache_user_dir.path_join("shader_cache");
 				ShaderRD::set_shader_cache_user_dir(shader_cache_user_dir);
+				ShaderCompiler::set_cache_dir(shader_cache_user_dir);
 			}
 		}
 
@@ -353,4 +355,5 @@ RendererCompositorRD::~RendererCompositorRD() {
 	memdelete(framebuffer_cache);
 	ShaderRD::set_shader_cache_user_dir(String());
 	ShaderRD::set_shader_cache_res_dir(String());
+	ShaderCompiler::set_cache_dir(String());
 }
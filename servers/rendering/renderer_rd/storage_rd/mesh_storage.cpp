@@ -2125,6 +2125,59 @@ void MeshStorage::_multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_
 	}
 }
 
+float *MeshStorage::_multimesh_begin_partial_update(MultiMesh *multimesh) {
+	// Partial updates go through the data cache, the dirty regions are uploaded in _update_dirty_multimeshes().
+	_multimesh_make_local(multimesh);
+
+	bool uses_motion_vectors = (RSG::viewport->get_num_viewports_with_motion_vectors() > 0) || (RendererCompositorStorage::get_singleton()->get_num_compositor_effects_with_motion_vectors() > 0);
+	if (uses_motion_vectors) {
+		_multimesh_enable_motion_vectors(multimesh);
+	}
+
+	_multimesh_update_motion_vectors_data_cache(multimesh);
+
+	return multimesh->data_cache.ptrw() + multimesh->motion_vectors_current_offset * multimesh->stride_cache;
+}
+
+void MeshStorage::_multimesh_set_buffer_range(RID p_multimesh, int p_first_instance, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	ERR_FAIL_COND(multimesh->stride_cache == 0);
+	ERR_FAIL_COND_MSG(p_buffer.size() % multimesh->stride_cache != 0, vformat("Buffer size must be a multiple of %d elements, got %d instead.", multimesh->stride_cache, p_buffer.size()));
+	const int instance_count = p_buffer.size() / multimesh->stride_cache;
+	ERR_FAIL_COND(p_first_instance < 0 || p_first_instance + instance_count > multimesh->instances);
+	if (instance_count == 0) {
+		return;
+	}
+
+	float *w = _multimesh_begin_partial_update(multimesh);
+	memcpy(w + p_first_instance * multimesh->stride_cache, p_buffer.ptr(), p_buffer.size() * sizeof(float));
+
+	const int last_instance = p_first_instance + instance_count - 1;
+	for (int i = p_first_instance; i <= last_instance; i += MULTIMESH_DIRTY_REGION_SIZE) {
+		_multimesh_mark_dirty(multimesh, i, true);
+	}
+	_multimesh_mark_dirty(multimesh, last_instance, true);
+}
+
+void MeshStorage::_multimesh_set_buffer_instances(RID p_multimesh, const Vector<int32_t> &p_instances, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	ERR_FAIL_COND_MSG(p_buffer.size() != p_instances.size() * (int)multimesh->stride_cache, vformat("Buffer should have %d elements, got %d instead.", p_instances.size() * (int)multimesh->stride_cache, p_buffer.size()));
+	if (p_instances.is_empty()) {
+		return;
+	}
+
+	float *w = _multimesh_begin_partial_update(multimesh);
+	const int32_t *instances = p_instances.ptr();
+	const float *r = p_buffer.ptr();
+	for (int i = 0; i < p_instances.size(); i++) {
+		ERR_FAIL_INDEX(instances[i], multimesh->instances);
+		memcpy(w + instances[i] * multimesh->stride_cache, r + i * multimesh->stride_cache, multimesh->stride_cache * sizeof(float));
+		_multimesh_mark_dirty(multimesh, instances[i], true);
+	}
+}
+
 RID MeshStorage::_multimesh_get_command_buffer_rd_rid(RID p_multimesh) const {
 	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL_V(multimesh, RID());
@@ -2386,6 +2439,22 @@ void MeshStorage::skeleton_bone_set_transform(RID p_skeleton, int p_bone, const
 	_skeleton_make_dirty(skeleton);
 }
 
+void MeshStorage::skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) {
+	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+
+	ERR_FAIL_NULL(skeleton);
+	ERR_FAIL_COND(skeleton->use_2d);
+	ERR_FAIL_COND(p_buffer.size() != skeleton->size * 12);
+
+	if (skeleton->size == 0) {
+		return;
+	}
+
+	memcpy(skeleton->data.ptr(), p_buffer.ptr(), p_buffer.size() * sizeof(float));
+
+	_skeleton_make_dirty(skeleton);
+}
+
 Transform3D MeshStorage::skeleton_bone_get_transform(RID p_skeleton, int p_bone) const {
 	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
 
@@ -32,6 +32,9 @@
 
 #include "core/config/project_settings.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/templates/frame_vector.h"
+#include "modules/modules_enabled.gen.h" // For raycast.
+#include "renderer_scene_occlusion_raster.h"
 #include "rendering_light_culler.h"
 #include "rendering_server_default.h"
 
@@ -162,6 +165,44 @@ void RendererSceneCull::occluder_set_mesh(RID p_occluder, const PackedVector3Arr
 	RendererSceneOcclusionCull::get_singleton()->occluder_set_mesh(p_occluder, p_vertices, p_indices);
 }
 
+/* ROOM AND PORTAL API */
+
+RID RendererSceneCull::room_allocate() {
+	return portal_cull.room_allocate();
+}
+
+void RendererSceneCull::room_initialize(RID p_room) {
+	portal_cull.room_initialize(p_room);
+}
+
+void RendererSceneCull::room_set_scenario(RID p_room, RID p_scenario) {
+	portal_cull.room_set_scenario(p_room, p_scenario);
+}
+
+void RendererSceneCull::room_set_points(RID p_room, const PackedVector3Array &p_points) {
+	portal_cull.room_set_points(p_room, p_points);
+}
+
+RID RendererSceneCull::portal_allocate() {
+	return portal_cull.portal_allocate();
+}
+
+void RendererSceneCull::portal_initialize(RID p_portal) {
+	portal_cull.portal_initialize(p_portal);
+}
+
+void RendererSceneCull::portal_set_scenario(RID p_portal, RID p_scenario) {
+	portal_cull.portal_set_scenario(p_portal, p_scenario);
+}
+
+void RendererSceneCull::portal_set_points(RID p_portal, const PackedVector3Array &p_points) {
+	portal_cull.portal_set_points(p_portal, p_points);
+}
+
+void RendererSceneCull::portal_set_rooms(RID p_portal, RID p_room_a, RID p_room_b) {
+	portal_cull.portal_set_rooms(p_portal, p_room_a, p_room_b);
+}
+
 /* SCENARIO API */
 
 void RendererSceneCull::_instance_pair(Instance *p_A, Instance *p_B) {
@@ -178,6 +219,9 @@ void RendererSceneCull::_instance_pair(Instance *p_A, Instance *p_B) {
 		InstanceLightData *light = static_cast<InstanceLightData *>(B->base_data);
 		InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(A->base_data);
 
+		// Shadow casters aren't filtered by the cull mask.
+		light->shadow_casters.invalidate();
+
 		if (!(light->cull_mask & A->layer_mask)) {
 			// Early return if the object's layer mask doesn't match the light's cull mask.
 			return;
@@ -303,6 +347,9 @@ void RendererSceneCull::_instance_unpair(Instance *p_A, Instance *p_B) {
 		InstanceLightData *light = static_cast<InstanceLightData *>(B->base_data);
 		InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(A->base_data);
 
+		// Shadow casters aren't filtered by the cull mask.
+		light->shadow_casters.invalidate();
+
 		if (!(light->cull_mask & A->layer_mask)) {
 			// Early return if the object's layer mask doesn't match the light's cull mask.
 			return;
@@ -996,6 +1043,82 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	_instance_queue_update(instance, true);
 }
 
+void RendererSceneCull::instances_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	const RID *rids = p_instances.ptr();
+	const Transform3D *transforms = p_transforms.ptr();
+
+	transform_batch.instances.clear();
+
+	for (int i = 0; i < p_instances.size(); i++) {
+		Instance *instance = instance_owner.get_or_null(rids[i]);
+		ERR_CONTINUE(!instance);
+
+		if (instance->transform == transforms[i]) {
+			continue;
+		}
+
+#ifdef DEBUG_ENABLED
+
+		bool finite = true;
+		for (int j = 0; j < 4; j++) {
+			const Vector3 &v = j < 3 ? transforms[i].basis.rows[j] : transforms[i].origin;
+			finite = finite && v.is_finite();
+		}
+		ERR_CONTINUE(!finite);
+
+#endif
+		instance->transform = transforms[i];
+
+		// Instances with other pending changes, or without bounds to move, take the regular path.
+		if (instance->update_item.in_list() || instance->base_type == RS::INSTANCE_NONE || !instance->aabb.has_surface()) {
+			_instance_queue_update(instance, true);
+			continue;
+		}
+
+		transform_batch.instances.push_back(instance);
+	}
+
+	const uint32_t count = transform_batch.instances.size();
+	if (count == 0) {
+		return;
+	}
+
+	transform_batch.bvh_aabbs.resize(count);
+
+	if (count > thread_cull_threshold) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererSceneCull::_transform_batch_threaded, &transform_batch, WorkerThreadPool::get_singleton()->get_thread_count(), -1, true, SNAME("UpdateInstanceTransforms"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_transform_batch_update(&transform_batch, 0, count);
+	}
+
+	// BVH leaves, pairing and the per-type updates are not thread safe.
+	for (uint32_t i = 0; i < count; i++) {
+		Instance *instance = transform_batch.instances[i];
+		_update_instance(instance, &transform_batch.bvh_aabbs[i]);
+		instance->teleported = false;
+	}
+}
+
+void RendererSceneCull::_transform_batch_threaded(uint32_t p_thread, TransformBatch *p_batch) {
+	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
+	uint32_t count = p_batch->instances.size();
+	uint32_t from = p_thread * count / total_threads;
+	uint32_t to = (p_thread + 1 == total_threads) ? count : ((p_thread + 1) * count / total_threads);
+
+	_transform_batch_update(p_batch, from, to);
+}
+
+void RendererSceneCull::_transform_batch_update(TransformBatch *p_batch, uint32_t p_from, uint32_t p_to) {
+	for (uint32_t i = p_from; i < p_to; i++) {
+		Instance *instance = p_batch->instances[i];
+		instance->transformed_aabb = instance->transform.xform(instance->aabb);
+		p_batch->bvh_aabbs[i] = _get_instance_bvh_aabb(instance);
+	}
+}
+
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_NULL(instance);
@@ -1593,7 +1716,27 @@ void RendererSceneCull::instance_geometry_get_shader_parameter_list(RID p_instan
 	instance->instance_uniforms.get_property_list(*p_parameters);
 }
 
-void RendererSceneCull::_update_instance(Instance *p_instance) const {
+AABB RendererSceneCull::_get_instance_bvh_aabb(const Instance *p_instance) {
+	//quantize to improve moving object performance
+	AABB bvh_aabb = p_instance->transformed_aabb;
+
+	if (p_instance->indexer_id.is_valid() && bvh_aabb != p_instance->prev_transformed_aabb) {
+		//assume motion, see if bounds need to be quantized
+		AABB motion_aabb = bvh_aabb.merge(p_instance->prev_transformed_aabb);
+		float motion_longest_axis = motion_aabb.get_longest_axis_size();
+		float longest_axis = p_instance->transformed_aabb.get_longest_axis_size();
+
+		if (motion_longest_axis < longest_axis * 2) {
+			//moved but not a lot, use motion aabb quantizing
+			float quantize_size = Math::pow(2.0, Math::ceil(Math::log(motion_longest_axis) / Math::log(2.0))) * 0.5; //one fifth
+			bvh_aabb.quantize(quantize_size);
+		}
+	}
+
+	return bvh_aabb;
+}
+
+void RendererSceneCull::_update_instance(Instance *p_instance, const AABB *p_bvh_aabb) const {
 	p_instance->version++;
 
 	// When not using interpolation the transform is used straight.
@@ -1613,6 +1756,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) const {
 		RSG::light_storage->light_instance_set_transform(light->instance, *instance_xform);
 		RSG::light_storage->light_instance_set_aabb(light->instance, instance_xform->xform(p_instance->aabb));
 		light->make_shadow_dirty();
+		light->shadow_casters.invalidate();
 
 		RS::LightBakeMode bake_mode = RSG::light_storage->light_get_bake_mode(p_instance->base);
 		if (RSG::light_storage->light_get_type(p_instance->base) != RS::LIGHT_DIRECTIONAL && bake_mode != light->bake_mode) {
@@ -1691,14 +1835,23 @@ void RendererSceneCull::_update_instance(Instance *p_instance) const {
 		}
 	}
 
-	AABB new_aabb;
-	new_aabb = instance_xform->xform(p_instance->aabb);
-	p_instance->transformed_aabb = new_aabb;
+	if (!p_bvh_aabb) {
+		p_instance->transformed_aabb = instance_xform->xform(p_instance->aabb);
+	}
 
 	if ((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) {
 		InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(p_instance->base_data);
 		//make sure lights are updated if it casts shadow
 
+		// Lights cache the shadow casters of every pass, which may have changed even if this one can't cast
+		// shadows right now. Pairs are used, as lights ignore instances outside their cull mask.
+		for (SelfList<InstancePair> *E = p_instance->pairs.first(); E; E = E->next()) {
+			Instance *other = E->self()->a == p_instance ? E->self()->b : E->self()->a;
+			if (other->base_type == RS::INSTANCE_LIGHT) {
+				static_cast<InstanceLightData *>(other->base_data)->shadow_casters.invalidate();
+			}
+		}
+
 		if (geom->can_cast_shadows) {
 			for (const Instance *E : geom->lights) {
 				InstanceLightData *light = static_cast<InstanceLightData *>(E->base_data);
@@ -1732,21 +1885,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) const {
 		return;
 	}
 
-	//quantize to improve moving object performance
-	AABB bvh_aabb = p_instance->transformed_aabb;
-
-	if (p_instance->indexer_id.is_valid() && bvh_aabb != p_instance->prev_transformed_aabb) {
-		//assume motion, see if bounds need to be quantized
-		AABB motion_aabb = bvh_aabb.merge(p_instance->prev_transformed_aabb);
-		float motion_longest_axis = motion_aabb.get_longest_axis_size();
-		float longest_axis = p_instance->transformed_aabb.get_longest_axis_size();
-
-		if (motion_longest_axis < longest_axis * 2) {
-			//moved but not a lot, use motion aabb quantizing
-			float quantize_size = Math::pow(2.0, Math::ceil(Math::log(motion_longest_axis) / Math::log(2.0))) * 0.5; //one fifth
-			bvh_aabb.quantize(quantize_size);
-		}
-	}
+	AABB bvh_aabb = p_bvh_aabb ? *p_bvh_aabb : _get_instance_bvh_aabb(p_instance);
 
 	if (!p_instance->indexer_id.is_valid()) {
 		if ((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) {
@@ -1847,6 +1986,10 @@ void RendererSceneCull::_update_instance(Instance *p_instance) const {
 		p_instance->scenario->instance_aabbs[p_instance->array_index] = InstanceBounds(p_instance->transformed_aabb);
 	}
 
+	if (p_instance->scenario->portal_version != 0) {
+		p_instance->scenario->instance_data[p_instance->array_index].portal_room = _instance_find_portal_room(p_instance);
+	}
+
 	if (p_instance->visibility_index != -1) {
 		p_instance->scenario->instance_visibility[p_instance->visibility_index].position = p_instance->transformed_aabb.get_center();
 	}
@@ -2309,18 +2452,17 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 
 		//now that we know all ranges, we can proceed to make the light frustum planes, for culling octree
 
-		Vector<Plane> light_frustum_planes;
-		light_frustum_planes.resize(6);
+		Plane light_frustum_planes[6];
 
 		//right/left
-		light_frustum_planes.write[0] = Plane(x_vec, x_max);
-		light_frustum_planes.write[1] = Plane(-x_vec, -x_min);
+		light_frustum_planes[0] = Plane(x_vec, x_max);
+		light_frustum_planes[1] = Plane(-x_vec, -x_min);
 		//top/bottom
-		light_frustum_planes.write[2] = Plane(y_vec, y_max);
-		light_frustum_planes.write[3] = Plane(-y_vec, -y_min);
+		light_frustum_planes[2] = Plane(y_vec, y_max);
+		light_frustum_planes[3] = Plane(-y_vec, -y_min);
 		//near/far
-		light_frustum_planes.write[4] = Plane(z_vec, z_max + 1e6);
-		light_frustum_planes.write[5] = Plane(-z_vec, -z_min); // z_min is ok, since casters further than far-light plane are not needed
+		light_frustum_planes[4] = Plane(z_vec, z_max + 1e6);
+		light_frustum_planes[5] = Plane(-z_vec, -z_min); // z_min is ok, since casters further than far-light plane are not needed
 
 		// a pre pass will need to be needed to determine the actual z-near to be used
 
@@ -2339,7 +2481,7 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 			ortho_transform.basis = transform.basis;
 			ortho_transform.origin = x_vec * (x_min_cam + half_x) + y_vec * (y_min_cam + half_y) + z_vec * z_max;
 
-			cull.shadows[p_shadow_index].cascades[i].frustum = Frustum(light_frustum_planes);
+			cull.shadows[p_shadow_index].cascades[i].frustum = Frustum(light_frustum_planes, 6);
 			cull.shadows[p_shadow_index].cascades[i].projection = ortho_camera;
 			cull.shadows[p_shadow_index].cascades[i].transform = ortho_transform;
 			cull.shadows[p_shadow_index].cascades[i].zfar = z_max - z_min_cam;
@@ -2352,6 +2494,39 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 	}
 }
 
+void RendererSceneCull::_light_cull_shadow_casters(Instance *p_instance, uint32_t p_pass, const Vector<Plane> &p_planes, Scenario *p_scenario) {
+	InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
+
+	const LocalVector<Instance *> &casters = light->shadow_casters.get(p_pass, [&](LocalVector<Instance *> &r_casters) {
+		Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&p_planes[0], p_planes.size());
+
+		struct CullConvex {
+			const AABB *light_aabb;
+			LocalVector<Instance *> *result;
+			_FORCE_INLINE_ bool operator()(void *p_data) {
+				Instance *p_instance = (Instance *)p_data;
+				// The BVH bounds are quantized, skip instances that can't be paired with the light.
+				if (light_aabb->intersects(p_instance->transformed_aabb)) {
+					result->push_back(p_instance);
+				}
+				return false;
+			}
+		};
+
+		CullConvex cull_convex;
+		cull_convex.light_aabb = &p_instance->transformed_aabb;
+		cull_convex.result = &r_casters;
+
+		p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(p_planes.ptr(), p_planes.size(), points.ptr(), points.size(), cull_convex);
+	});
+
+	// Copied, as the light culler removes instances from the result.
+	instance_shadow_cull_result.clear();
+	for (Instance *instance : casters) {
+		instance_shadow_cull_result.push_back(instance);
+	}
+}
+
 bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_screen_mesh_lod_threshold, uint32_t p_visible_layers) {
 	InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
 
@@ -2386,23 +2561,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					planes.write[4] = light_transform.xform(Plane(Vector3(0, -1, z).normalized(), radius));
 					planes.write[5] = light_transform.xform(Plane(Vector3(0, 0, -z), 0));
 
-					instance_shadow_cull_result.clear();
-
-					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
-
-					struct CullConvex {
-						PagedArray<Instance *> *result;
-						_FORCE_INLINE_ bool operator()(void *p_data) {
-							Instance *p_instance = (Instance *)p_data;
-							result->push_back(p_instance);
-							return false;
-						}
-					};
-
-					CullConvex cull_convex;
-					cull_convex.result = &instance_shadow_cull_result;
-
-					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
+					_light_cull_shadow_casters(p_instance, i, planes, p_scenario);
 
 					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
 
@@ -2469,23 +2628,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 					Vector<Plane> planes = cm.get_projection_planes(xform);
 
-					instance_shadow_cull_result.clear();
-
-					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
-
-					struct CullConvex {
-						PagedArray<Instance *> *result;
-						_FORCE_INLINE_ bool operator()(void *p_data) {
-							Instance *p_instance = (Instance *)p_data;
-							result->push_back(p_instance);
-							return false;
-						}
-					};
-
-					CullConvex cull_convex;
-					cull_convex.result = &instance_shadow_cull_result;
-
-					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
+					_light_cull_shadow_casters(p_instance, i, planes, p_scenario);
 
 					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
 
@@ -2537,23 +2680,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 			Vector<Plane> planes = cm.get_projection_planes(light_transform);
 
-			instance_shadow_cull_result.clear();
-
-			Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
-
-			struct CullConvex {
-				PagedArray<Instance *> *result;
-				_FORCE_INLINE_ bool operator()(void *p_data) {
-					Instance *p_instance = (Instance *)p_data;
-					result->push_back(p_instance);
-					return false;
-				}
-			};
-
-			CullConvex cull_convex;
-			cull_convex.result = &instance_shadow_cull_result;
-
-			p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
+			_light_cull_shadow_casters(p_instance, 0, planes, p_scenario);
 
 			RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
 
@@ -2804,6 +2931,20 @@ bool RendererSceneCull::_visibility_parent_check(const CullData &p_cull_data, co
 	return ((parent_flags & InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK) == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE) || (parent_flags & InstanceData::FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN);
 }
 
+void RendererSceneCull::_update_portal_rooms(Scenario *p_scenario) {
+	uint64_t version = portal_cull.scenario_get_version(p_scenario->self);
+	if (p_scenario->portal_version == version) {
+		return;
+	}
+
+	// Rooms changed, so every instance needs to be placed again.
+	p_scenario->portal_version = version;
+	for (uint64_t i = 0; i < p_scenario->instance_data.size(); i++) {
+		InstanceData &idata = p_scenario->instance_data[i];
+		idata.portal_room = _instance_find_portal_room(idata.instance);
+	}
+}
+
 void RendererSceneCull::_scene_cull_threaded(uint32_t p_thread, CullData *cull_data) {
 	uint32_t cull_total = cull_data->scenario->instance_data.size();
 	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
@@ -2838,10 +2979,11 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 #define VIS_RANGE_CHECK ((idata.visibility_index == -1) || _visibility_range_check<false>(cull_data.scenario->instance_visibility[idata.visibility_index], cull_data.cam_transform.origin, cull_data.visibility_viewport_mask) == 0)
 #define VIS_PARENT_CHECK (_visibility_parent_check(cull_data, idata))
 #define VIS_CHECK (visibility_check < 0 ? (visibility_check = (visibility_flags != InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK || (VIS_RANGE_CHECK && VIS_PARENT_CHECK))) : visibility_check)
+#define PORTAL_CULLED (cull_data.portal_visibility != nullptr && (idata.flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.portal_visibility->is_culled(idata.portal_room, cull_data.scenario->instance_aabbs[i].bounds))
 #define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded(cull_data.scenario->instance_aabbs[i].bounds, cull_data.cam_transform.origin, inv_cam_transform, *cull_data.camera_matrix, z_near, cull_data.scenario->instance_data[i].occlusion_timeout))
 
 		if (!HIDDEN_BY_VISIBILITY_CHECKS) {
-			if ((LAYER_CHECK && IN_FRUSTUM(cull_data.cull->frustum) && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
+			if ((LAYER_CHECK && IN_FRUSTUM(cull_data.cull->frustum) && VIS_CHECK && !PORTAL_CULLED && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
 				uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 				if (base_type == RS::INSTANCE_LIGHT) {
 					cull_result.lights.push_back(idata.instance);
@@ -3063,6 +3205,7 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 #undef VIS_RANGE_CHECK
 #undef VIS_PARENT_CHECK
 #undef VIS_CHECK
+#undef PORTAL_CULLED
 #undef OCCLUSION_CULLED
 
 		for (uint32_t j = 0; j < cull_data.cull->sdfgi.region_count; j++) {
@@ -3160,7 +3303,7 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 	{
 		cull.shadow_count = 0;
 
-		Vector<Instance *> lights_with_shadow;
+		FrameVector<Instance *> lights_with_shadow;
 
 		for (Instance *E : scenario->directional_lights) {
 			if (!E->visible || !(E->layer_mask & p_visible_layers)) {
@@ -3186,7 +3329,7 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 
 		RSG::light_storage->set_directional_shadow_count(lights_with_shadow.size());
 
-		for (int i = 0; i < lights_with_shadow.size(); i++) {
+		for (uint32_t i = 0; i < lights_with_shadow.size(); i++) {
 			_light_instance_setup_directional_shadow(i, lights_with_shadow[i], p_camera_data->main_transform, p_camera_data->main_projection, p_camera_data->is_orthogonal, p_camera_data->vaspect);
 		}
 	}
@@ -3232,6 +3375,14 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 		cull_data.visible_layers = p_visible_layers;
 		cull_data.render_reflection_probe = render_reflection_probe;
 		cull_data.occlusion_buffer = RendererSceneOcclusionCull::get_singleton()->buffer_get_ptr(p_viewport);
+		cull_data.portal_visibility = nullptr;
+		if (!p_camera_data->is_orthogonal && portal_cull.scenario_has_rooms(scenario->self)) {
+			_update_portal_rooms(scenario);
+			portal_cull.scenario_cull(scenario->self, p_camera_data->main_transform.origin, planes, portal_visibility);
+			if (portal_visibility.active) {
+				cull_data.portal_visibility = &portal_visibility;
+			}
+		}
 		cull_data.camera_matrix = &p_camera_data->main_projection;
 		cull_data.visibility_viewport_mask = scenario->viewport_visibility_masks.has(p_viewport) ? scenario->viewport_visibility_masks[p_viewport] : 0;
 //#define DEBUG_CULL_TIME
@@ -4190,9 +4341,12 @@ bool RendererSceneCull::free(RID p_rid) {
 		RSG::light_storage->reflection_atlas_free(scenario->reflection_atlas);
 		scenario_owner.free(p_rid);
 		RendererSceneOcclusionCull::get_singleton()->remove_scenario(p_rid);
+		portal_cull.remove_scenario(p_rid);
 
 	} else if (RendererSceneOcclusionCull::get_singleton() && RendererSceneOcclusionCull::get_singleton()->is_occluder(p_rid)) {
 		RendererSceneOcclusionCull::get_singleton()->free_occluder(p_rid);
+	} else if (portal_cull.free(p_rid)) {
+		// Room or portal.
 	} else if (instance_owner.owns(p_rid)) {
 		// delete the instance
 
@@ -4298,7 +4452,17 @@ RendererSceneCull::RendererSceneCull() {
 	thread_cull_threshold = MAX(thread_cull_threshold, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count()); //make sure there is at least one thread per CPU
 	RendererSceneOcclusionCull::HZBuffer::occlusion_jitter_enabled = GLOBAL_GET("rendering/occlusion_culling/jitter_projection");
 
-	dummy_occlusion_culling = memnew(RendererSceneOcclusionCull);
+#ifdef MODULE_RAYCAST_ENABLED
+	// The raycast module replaces this with its own backend when it is selected.
+	const bool use_raster_occlusion = int(GLOBAL_GET("rendering/occlusion_culling/backend")) == 1;
+#else
+	const bool use_raster_occlusion = true;
+#endif
+	if (use_raster_occlusion) {
+		default_occlusion_culling = memnew(RendererSceneOcclusionRaster);
+	} else {
+		default_occlusion_culling = memnew(RendererSceneOcclusionCull);
+	}
 
 	light_culler = memnew(RenderingLightCuller);
 
@@ -4324,8 +4488,8 @@ RendererSceneCull::~RendererSceneCull() {
 	}
 	scene_cull_result_threads.clear();
 
-	if (dummy_occlusion_culling) {
-		memdelete(dummy_occlusion_culling);
+	if (default_occlusion_culling) {
+		memdelete(default_occlusion_culling);
 	}
 
 	if (light_culler) {
@@ -41,7 +41,9 @@
 #include "core/templates/self_list.h"
 #include "servers/rendering/instance_uniforms.h"
 #include "servers/rendering/renderer_scene_occlusion_cull.h"
+#include "servers/rendering/renderer_scene_portal_cull.h"
 #include "servers/rendering/renderer_scene_render.h"
+#include "servers/rendering/renderer_shadow_caster_cache.h"
 #include "servers/rendering/rendering_method.h"
 #include "servers/rendering/rendering_server_globals.h"
 #include "servers/rendering/storage/utilities.h"
@@ -123,9 +125,25 @@ public:
 	virtual void occluder_initialize(RID p_occluder);
 	virtual void occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices);
 
+	/* ROOM AND PORTAL API */
+
+	RendererScenePortalCull portal_cull;
+	RendererScenePortalCull::Visibility portal_visibility;
+
+	virtual RID room_allocate();
+	virtual void room_initialize(RID p_room);
+	virtual void room_set_scenario(RID p_room, RID p_scenario);
+	virtual void room_set_points(RID p_room, const PackedVector3Array &p_points);
+
+	virtual RID portal_allocate();
+	virtual void portal_initialize(RID p_portal);
+	virtual void portal_set_scenario(RID p_portal, RID p_scenario);
+	virtual void portal_set_points(RID p_portal, const PackedVector3Array &p_points);
+	virtual void portal_set_rooms(RID p_portal, RID p_room_a, RID p_room_b);
+
 	/* VISIBILITY NOTIFIER API */
 
-	RendererSceneOcclusionCull *dummy_occlusion_culling = nullptr;
+	RendererSceneOcclusionCull *default_occlusion_culling = nullptr;
 
 	/* SCENARIO API */
 
@@ -154,41 +172,38 @@ public:
 		uint32_t signs[3];
 	};
 
+	// Culling frustums are always built from projection planes. Storing them
+	// inline avoids allocating for the camera and every shadow cascade each frame.
 	struct Frustum {
-		Vector<Plane> planes;
-		Vector<PlaneSign> plane_signs;
-		const Plane *planes_ptr;
-		const PlaneSign *plane_signs_ptr;
-		uint32_t plane_count;
+		static constexpr uint32_t MAX_PLANES = 6;
+
+		Plane planes[MAX_PLANES];
+		PlaneSign plane_signs[MAX_PLANES];
+		const Plane *planes_ptr = planes;
+		const PlaneSign *plane_signs_ptr = plane_signs;
+		uint32_t plane_count = 0;
 
 		_ALWAYS_INLINE_ Frustum() {}
 		_ALWAYS_INLINE_ Frustum(const Frustum &p_frustum) {
-			planes = p_frustum.planes;
-			plane_signs = p_frustum.plane_signs;
-
-			planes_ptr = planes.ptr();
-			plane_signs_ptr = plane_signs.ptr();
-			plane_count = p_frustum.plane_count;
+			*this = p_frustum;
 		}
 		_ALWAYS_INLINE_ void operator=(const Frustum &p_frustum) {
-			planes = p_frustum.planes;
-			plane_signs = p_frustum.plane_signs;
-
-			planes_ptr = planes.ptr();
-			plane_signs_ptr = plane_signs.ptr();
 			plane_count = p_frustum.plane_count;
+			for (uint32_t i = 0; i < plane_count; i++) {
+				planes[i] = p_frustum.planes[i];
+				plane_signs[i] = p_frustum.plane_signs[i];
+			}
 		}
-		_ALWAYS_INLINE_ Frustum(const Vector<Plane> &p_planes) {
-			planes = p_planes;
-			planes_ptr = planes.ptrw();
-			plane_count = planes.size();
-			for (int i = 0; i < planes.size(); i++) {
-				PlaneSign ps(p_planes[i]);
-				plane_signs.push_back(ps);
+		_ALWAYS_INLINE_ Frustum(const Plane *p_planes, uint32_t p_plane_count) {
+			CRASH_COND(p_plane_count > MAX_PLANES);
+			plane_count = p_plane_count;
+			for (uint32_t i = 0; i < plane_count; i++) {
+				planes[i] = p_planes[i];
+				plane_signs[i] = PlaneSign(p_planes[i]);
 			}
-
-			plane_signs_ptr = plane_signs.ptr();
 		}
+		_ALWAYS_INLINE_ Frustum(const Vector<Plane> &p_planes) :
+				Frustum(p_planes.ptr(), p_planes.size()) {}
 	};
 
 	struct InstanceBounds {
@@ -288,6 +303,8 @@ public:
 		Instance *instance = nullptr;
 		int32_t parent_array_index = -1;
 		int32_t visibility_index = -1;
+		// Room fully enclosing the instance, used by portal culling.
+		int32_t portal_room = -1;
 
 		// Each time occlusion culling determines an instance is visible,
 		// set this to occlusion_frame plus some delay.
@@ -352,6 +369,9 @@ public:
 		PagedArray<InstanceData> instance_data;
 		VisibilityArray instance_visibility;
 
+		// Portal culling version the instance rooms were assigned with.
+		uint64_t portal_version = 0;
+
 		Scenario() {
 			indexers[INDEXER_GEOMETRY].set_index(INDEXER_GEOMETRY);
 			indexers[INDEXER_VOLUMES].set_index(INDEXER_VOLUMES);
@@ -704,6 +724,9 @@ public:
 		uint32_t max_sdfgi_cascade = 2;
 		uint32_t cull_mask = 0xFFFFFFFF;
 
+		// Only holds instances paired with the light, so it's invalidated whenever they change.
+		RendererShadowCasterCache<Instance *> shadow_casters;
+
 	private:
 		// Instead of a single dirty flag, we maintain a count
 		// so that we can detect lights that are being made dirty
@@ -1025,6 +1048,7 @@ public:
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask);
 	virtual void instance_set_pivot_data(RID p_instance, float p_sorting_offset, bool p_use_aabb_center);
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform);
+	virtual void instances_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms);
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id);
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight);
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material);
@@ -1069,7 +1093,8 @@ public:
 	virtual void mesh_generate_pipelines(RID p_mesh, bool p_background_compilation);
 	virtual uint32_t get_pipeline_compilations(RS::PipelineSource p_source);
 
-	_FORCE_INLINE_ void _update_instance(Instance *p_instance) const;
+	_FORCE_INLINE_ void _update_instance(Instance *p_instance, const AABB *p_bvh_aabb = nullptr) const;
+	_FORCE_INLINE_ static AABB _get_instance_bvh_aabb(const Instance *p_instance);
 	_FORCE_INLINE_ void _update_instance_aabb(Instance *p_instance) const;
 	_FORCE_INLINE_ void _update_dirty_instance(Instance *p_instance) const;
 	_FORCE_INLINE_ void _update_instance_lightmap_captures(Instance *p_instance) const;
@@ -1077,6 +1102,7 @@ public:
 
 	void _light_instance_setup_directional_shadow(int p_shadow_index, Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect);
 
+	void _light_cull_shadow_casters(Instance *p_instance, uint32_t p_pass, const Vector<Plane> &p_planes, Scenario *p_scenario);
 	_FORCE_INLINE_ bool _light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_screen_mesh_lod_threshold, uint32_t p_visible_layers = 0xFFFFFF);
 
 	RID _render_get_environment(RID p_camera, RID p_scenario);
@@ -1131,6 +1157,15 @@ public:
 
 	void _visibility_cull_threaded(uint32_t p_thread, VisibilityCullData *cull_data);
 	void _visibility_cull(const VisibilityCullData &cull_data, uint64_t p_from, uint64_t p_to);
+	// Instances moved by instances_set_transforms(), with their new BVH bounds computed in parallel.
+	struct TransformBatch {
+		LocalVector<Instance *> instances;
+		LocalVector<AABB> bvh_aabbs;
+	} transform_batch;
+
+	void _transform_batch_threaded(uint32_t p_thread, TransformBatch *p_batch);
+	void _transform_batch_update(TransformBatch *p_batch, uint32_t p_from, uint32_t p_to);
+
 	template <bool p_fade_check>
 	_FORCE_INLINE_ int _visibility_range_check(InstanceVisibilityData &r_vis_data, const Vector3 &p_camera_pos, uint64_t p_viewport_mask);
 
@@ -1142,10 +1177,19 @@ public:
 		uint32_t visible_layers;
 		Instance *render_reflection_probe = nullptr;
 		const RendererSceneOcclusionCull::HZBuffer *occlusion_buffer;
+		const RendererScenePortalCull::Visibility *portal_visibility;
 		const Projection *camera_matrix;
 		uint64_t visibility_viewport_mask;
 	};
 
+	void _update_portal_rooms(Scenario *p_scenario);
+	_FORCE_INLINE_ int32_t _instance_find_portal_room(const Instance *p_instance) const {
+		if (!((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK)) {
+			return -1;
+		}
+		return portal_cull.scenario_find_room(p_instance->scenario->self, p_instance->transformed_aabb);
+	}
+
 	void _scene_cull_threaded(uint32_t p_thread, CullData *cull_data);
 	void _scene_cull(CullData &cull_data, InstanceCullResult &cull_result, uint64_t p_from, uint64_t p_to);
 	static void _scene_particles_set_view_axis(RID p_particles, const Vector3 &p_axis, const Vector3 &p_up_axis);
@@ -0,0 +1,512 @@
+/**************************************************************************/
+/*  renderer_scene_occlusion_raster.cpp                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "renderer_scene_occlusion_raster.h"
+
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define RASTER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define RASTER_NEON
+#include <arm_neon.h>
+#endif
+
+// Keeps the nearest depth along a row of pixels. The depth attribute is linear in
+// screen space, so pixels are processed four at a time where SIMD is available.
+// Perspective attributes are 1/z and are clamped, so degenerate values end up far away.
+static _FORCE_INLINE_ void _raster_span(float *p_row, int p_from, int p_to, float p_attr, float p_step, bool p_perspective) {
+	const float min_attr = 1e-20f;
+	int x = p_from;
+
+#if defined(RASTER_SSE2)
+	const __m128 offsets = _mm_setr_ps(0.0f, p_step, p_step * 2.0f, p_step * 3.0f);
+	const __m128 min_attr4 = _mm_set1_ps(min_attr);
+	const __m128 one = _mm_set1_ps(1.0f);
+	for (; x + 3 <= p_to; x += 4) {
+		__m128 depth = _mm_add_ps(_mm_set1_ps(p_attr + p_step * (x - p_from)), offsets);
+		if (p_perspective) {
+			depth = _mm_div_ps(one, _mm_max_ps(depth, min_attr4));
+		}
+		_mm_storeu_ps(p_row + x, _mm_min_ps(_mm_loadu_ps(p_row + x), depth));
+	}
+#elif defined(RASTER_NEON)
+	const float offsets_array[4] = { 0.0f, p_step, p_step * 2.0f, p_step * 3.0f };
+	const float32x4_t offsets = vld1q_f32(offsets_array);
+	const float32x4_t min_attr4 = vdupq_n_f32(min_attr);
+	const float32x4_t one = vdupq_n_f32(1.0f);
+	for (; x + 3 <= p_to; x += 4) {
+		float32x4_t depth = vaddq_f32(vdupq_n_f32(p_attr + p_step * (x - p_from)), offsets);
+		if (p_perspective) {
+			depth = vdivq_f32(one, vmaxq_f32(depth, min_attr4));
+		}
+		vst1q_f32(p_row + x, vminq_f32(vld1q_f32(p_row + x), depth));
+	}
+#endif
+
+	for (; x <= p_to; x++) {
+		float depth = p_attr + p_step * (x - p_from);
+		if (p_perspective) {
+			depth = 1.0f / MAX(depth, min_attr);
+		}
+		p_row[x] = MIN(p_row[x], depth);
+	}
+}
+
+void RendererSceneOcclusionRaster::RasterHZBuffer::clear() {
+	triangles.clear();
+	HZBuffer::clear();
+}
+
+void RendererSceneOcclusionRaster::RasterHZBuffer::begin(bool p_orthogonal, float p_z_far) {
+	orthogonal = p_orthogonal;
+	debug_tex_range = p_z_far;
+	triangles.clear();
+
+	float *depth = mips[0];
+	const int size = sizes[0].x * sizes[0].y;
+	for (int i = 0; i < size; i++) {
+		depth[i] = FLT_MAX;
+	}
+}
+
+void RendererSceneOcclusionRaster::RasterHZBuffer::_add_triangle(const Vector3 p_view[3], const Projection &p_cam_projection, const Vector2 &p_jitter) {
+	const float z_near = p_cam_projection.get_z_near();
+
+	// Clip against the near plane, which can turn the triangle into a quad.
+	Vector3 polygon[4];
+	int count = 0;
+	for (int i = 0; i < 3; i++) {
+		const Vector3 &a = p_view[i];
+		const Vector3 &b = p_view[(i + 1) % 3];
+		const float da = -a.z - z_near;
+		const float db = -b.z - z_near;
+		if (da >= 0) {
+			polygon[count++] = a;
+		}
+		if ((da >= 0) != (db >= 0)) {
+			polygon[count++] = a + (b - a) * (da / (da - db));
+		}
+	}
+
+	if (count < 3) {
+		return;
+	}
+
+	const Size2i &size = sizes[0];
+	Vector2 points[4];
+	float attrs[4];
+	for (int i = 0; i < count; i++) {
+		const Vector4 clip = p_cam_projection.xform(Vector4(polygon[i].x, polygon[i].y, polygon[i].z, 1.0));
+		points[i] = Vector2((clip.x / clip.w * 0.5f + 0.5f) * size.x, (clip.y / clip.w * 0.5f + 0.5f) * size.y) + p_jitter;
+		attrs[i] = orthogonal ? -polygon[i].z : 1.0f / -polygon[i].z;
+	}
+
+	for (int i = 1; i < count - 1; i++) {
+		Vector2 p0 = points[0];
+		Vector2 p1 = points[i];
+		Vector2 p2 = points[i + 1];
+		float d0 = attrs[0];
+		float d1 = attrs[i];
+		float d2 = attrs[i + 1];
+
+		float area = (p1 - p0).cross(p2 - p0);
+		if (Math::abs(area) < 1e-6f) {
+			continue;
+		}
+		if (area < 0) {
+			// Occluders are double sided, flip to counter-clockwise.
+			SWAP(p1, p2);
+			SWAP(d1, d2);
+			area = -area;
+		}
+
+		Triangle t;
+		t.min_x = MIN(p0.x, MIN(p1.x, p2.x));
+		t.max_x = MAX(p0.x, MAX(p1.x, p2.x));
+		const float min_y = MIN(p0.y, MIN(p1.y, p2.y));
+		const float max_y = MAX(p0.y, MAX(p1.y, p2.y));
+
+		// Rows whose pixel centers may be covered.
+		t.min_y = MAX(0, (int)Math::ceil(min_y - 0.5f));
+		t.max_y = MIN(size.y - 1, (int)Math::floor(max_y - 0.5f));
+		if (t.min_y > t.max_y || t.max_x < 0.5f || t.min_x > size.x - 0.5f) {
+			continue;
+		}
+
+		const Vector2 vertices[3] = { p0, p1, p2 };
+		for (int j = 0; j < 3; j++) {
+			const Vector2 &a = vertices[j];
+			const Vector2 &b = vertices[(j + 1) % 3];
+			t.edges[j][0] = a.y - b.y;
+			t.edges[j][1] = b.x - a.x;
+			t.edges[j][2] = -(t.edges[j][0] * a.x + t.edges[j][1] * a.y);
+		}
+
+		t.depth[0] = ((d1 - d0) * (p2.y - p0.y) - (d2 - d0) * (p1.y - p0.y)) / area;
+		t.depth[1] = ((d2 - d0) * (p1.x - p0.x) - (d1 - d0) * (p2.x - p0.x)) / area;
+		t.depth[2] = d0 - t.depth[0] * p0.x - t.depth[1] * p0.y;
+
+		triangles.push_back(t);
+	}
+}
+
+void RendererSceneOcclusionRaster::RasterHZBuffer::setup_triangles(const Vector3 *p_vertices, const uint32_t *p_indices, uint32_t p_index_count, const Transform3D &p_cam_inv_transform, const Projection &p_cam_projection, const Vector2 &p_jitter) {
+	for (uint32_t i = 0; i + 2 < p_index_count; i += 3) {
+		const Vector3 view[3] = {
+			p_cam_inv_transform.xform(p_vertices[p_indices[i]]),
+			p_cam_inv_transform.xform(p_vertices[p_indices[i + 1]]),
+			p_cam_inv_transform.xform(p_vertices[p_indices[i + 2]])
+		};
+		_add_triangle(view, p_cam_projection, p_jitter);
+	}
+}
+
+void RendererSceneOcclusionRaster::RasterHZBuffer::rasterize_rows(int p_from, int p_to) {
+	const Size2i &size = sizes[0];
+	float *depth = mips[0];
+	const bool perspective = !orthogonal;
+
+	for (const Triangle &t : triangles) {
+		const int row_from = MAX(p_from, t.min_y);
+		const int row_to = MIN(p_to, t.max_y);
+
+		for (int y = row_from; y <= row_to; y++) {
+			const float yc = y + 0.5f;
+			float lo = t.min_x;
+			float hi = t.max_x;
+			bool empty = false;
+
+			// Solve each edge function for the covered interval on this row.
+			for (int i = 0; i < 3; i++) {
+				const float a = t.edges[i][0];
+				const float r = t.edges[i][1] * yc + t.edges[i][2];
+				if (a > 1e-8f) {
+					lo = MAX(lo, -r / a);
+				} else if (a < -1e-8f) {
+					hi = MIN(hi, -r / a);
+				} else if (r < 0) {
+					empty = true;
+					break;
+				}
+			}
+
+			if (empty) {
+				continue;
+			}
+
+			const int x_from = MAX(0, (int)Math::ceil(lo - 0.5f));
+			const int x_to = MIN(size.x - 1, (int)Math::floor(hi - 0.5f));
+			if (x_from > x_to) {
+				continue;
+			}
+
+			const float attr = t.depth[0] * (x_from + 0.5f) + t.depth[1] * yc + t.depth[2];
+			_raster_span(&depth[y * size.x], x_from, x_to, attr, t.depth[0], perspective);
+		}
+	}
+}
+
+void RendererSceneOcclusionRaster::RasterHZBuffer::_raster_band(uint32_t p_band, const BandData *p_data) {
+	const int height = sizes[0].y;
+	const int from = p_band * height / p_data->band_count;
+	const int to = (p_band + 1) * height / p_data->band_count - 1;
+	rasterize_rows(from, to);
+}
+
+void RendererSceneOcclusionRaster::RasterHZBuffer::rasterize() {
+	if (triangles.is_empty()) {
+		return;
+	}
+
+	BandData data;
+	data.band_count = MIN((int)WorkerThreadPool::get_singleton()->get_thread_count(), sizes[0].y);
+
+	if (data.band_count <= 1 || triangles.size() < 64) {
+		rasterize_rows(0, sizes[0].y - 1);
+		return;
+	}
+
+	// Bands never share rows, so threads write to disjoint parts of the buffer.
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RasterHZBuffer::_raster_band, &data, data.band_count, -1, true, SNAME("RasterOcclusionCullRasterize"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+////////////////////////////////////////////////////////
+
+bool RendererSceneOcclusionRaster::is_occluder(RID p_rid) {
+	return occluder_owner.owns(p_rid);
+}
+
+RID RendererSceneOcclusionRaster::occluder_allocate() {
+	return occluder_owner.allocate_rid();
+}
+
+void RendererSceneOcclusionRaster::occluder_initialize(RID p_occluder) {
+	Occluder *occluder = memnew(Occluder);
+	occluder_owner.initialize_rid(p_occluder, occluder);
+}
+
+void RendererSceneOcclusionRaster::occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+
+	occluder->vertices = p_vertices;
+	occluder->indices = p_indices;
+
+	for (const InstanceID &E : occluder->users) {
+		Scenario *scenario = scenarios.getptr(E.scenario);
+		ERR_CONTINUE(!scenario);
+		scenario->dirty_instances.insert(E.instance);
+	}
+}
+
+void RendererSceneOcclusionRaster::free_occluder(RID p_occluder) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+	memdelete(occluder);
+	occluder_owner.free(p_occluder);
+}
+
+////////////////////////////////////////////////////////
+
+void RendererSceneOcclusionRaster::add_scenario(RID p_scenario) {
+	ERR_FAIL_COND(scenarios.has(p_scenario));
+	scenarios[p_scenario] = Scenario();
+}
+
+void RendererSceneOcclusionRaster::remove_scenario(RID p_scenario) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	scenarios.erase(p_scenario);
+}
+
+void RendererSceneOcclusionRaster::scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+
+	OccluderInstance &instance = scenario->instances[p_instance];
+
+	if (instance.occluder != p_occluder) {
+		Occluder *old_occluder = occluder_owner.get_or_null(instance.occluder);
+		if (old_occluder) {
+			old_occluder->users.erase(InstanceID(p_scenario, p_instance));
+		}
+
+		instance.occluder = p_occluder;
+
+		if (p_occluder.is_valid()) {
+			Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+			ERR_FAIL_NULL(occluder);
+			occluder->users.insert(InstanceID(p_scenario, p_instance));
+		}
+		scenario->dirty_instances.insert(p_instance);
+	}
+
+	if (instance.xform != p_xform) {
+		instance.xform = p_xform;
+		scenario->dirty_instances.insert(p_instance);
+	}
+
+	instance.enabled = p_enabled;
+}
+
+void RendererSceneOcclusionRaster::scenario_remove_instance(RID p_scenario, RID p_instance) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+
+	OccluderInstance *instance = scenario->instances.getptr(p_instance);
+	if (!instance) {
+		return;
+	}
+
+	Occluder *occluder = occluder_owner.get_or_null(instance->occluder);
+	if (occluder) {
+		occluder->users.erase(InstanceID(p_scenario, p_instance));
+	}
+	scenario->instances.erase(p_instance);
+	scenario->dirty_instances.erase(p_instance);
+}
+
+void RendererSceneOcclusionRaster::_update_instance(OccluderInstance &r_instance) {
+	r_instance.xformed_vertices.clear();
+	r_instance.indices.clear();
+	r_instance.aabb = AABB();
+
+	const Occluder *occluder = occluder_owner.get_or_null(r_instance.occluder);
+	if (!occluder || occluder->vertices.is_empty()) {
+		return;
+	}
+
+	const int vertex_count = occluder->vertices.size();
+	r_instance.xformed_vertices.resize(vertex_count);
+	const Vector3 *read = occluder->vertices.ptr();
+	for (int i = 0; i < vertex_count; i++) {
+		r_instance.xformed_vertices[i] = r_instance.xform.xform(read[i]);
+	}
+
+	r_instance.aabb.position = r_instance.xformed_vertices[0];
+	for (const Vector3 &v : r_instance.xformed_vertices) {
+		r_instance.aabb.expand_to(v);
+	}
+
+	// Drop triangles referencing missing vertices, so rasterizing never needs to check.
+	const int32_t *indices = occluder->indices.ptr();
+	const int index_count = occluder->indices.size() - occluder->indices.size() % 3;
+	r_instance.indices.reserve(index_count);
+	for (int i = 0; i < index_count; i += 3) {
+		if (indices[i] < 0 || indices[i] >= vertex_count || indices[i + 1] < 0 || indices[i + 1] >= vertex_count || indices[i + 2] < 0 || indices[i + 2] >= vertex_count) {
+			continue;
+		}
+		r_instance.indices.push_back(indices[i]);
+		r_instance.indices.push_back(indices[i + 1]);
+		r_instance.indices.push_back(indices[i + 2]);
+	}
+}
+
+////////////////////////////////////////////////////////
+
+void RendererSceneOcclusionRaster::add_buffer(RID p_buffer) {
+	ERR_FAIL_COND(buffers.has(p_buffer));
+	buffers[p_buffer] = RasterHZBuffer();
+}
+
+void RendererSceneOcclusionRaster::remove_buffer(RID p_buffer) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers.erase(p_buffer);
+}
+
+void RendererSceneOcclusionRaster::buffer_set_scenario(RID p_buffer, RID p_scenario) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	ERR_FAIL_COND(p_scenario.is_valid() && !scenarios.has(p_scenario));
+	buffers[p_buffer].scenario_rid = p_scenario;
+}
+
+void RendererSceneOcclusionRaster::buffer_set_size(RID p_buffer, const Vector2i &p_size) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers[p_buffer].resize(p_size);
+}
+
+Vector2 RendererSceneOcclusionRaster::_get_jitter() const {
+	if (!jitter_enabled) {
+		return Vector2();
+	}
+
+	// Same pattern as the raycast backend, in pixels.
+	static const Vector2 pattern[9] = {
+		Vector2(0, 0),
+		Vector2(-1, -1),
+		Vector2(1, -1),
+		Vector2(-1, 1),
+		Vector2(1, 1),
+		Vector2(-0.5f, -0.5f),
+		Vector2(0.5f, -0.5f),
+		Vector2(-0.5f, 0.5f),
+		Vector2(0.5f, 0.5f),
+	};
+	return pattern[Engine::get_singleton()->get_frames_drawn() % 9] * 0.33f;
+}
+
+void RendererSceneOcclusionRaster::buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	RasterHZBuffer *buffer = buffers.getptr(p_buffer);
+	if (!buffer || buffer->is_empty()) {
+		return;
+	}
+
+	Scenario *scenario = scenarios.getptr(buffer->scenario_rid);
+	if (!scenario) {
+		return;
+	}
+
+	for (const RID &instance_rid : scenario->dirty_instances) {
+		OccluderInstance *instance = scenario->instances.getptr(instance_rid);
+		if (instance) {
+			_update_instance(*instance);
+		}
+	}
+	scenario->dirty_instances.clear();
+
+	buffer->begin(p_cam_orthogonal, p_cam_projection.get_z_far());
+
+	const Vector<Plane> planes = p_cam_projection.get_projection_planes(p_cam_transform);
+	const Transform3D cam_inv_transform = p_cam_transform.affine_inverse();
+	const Vector2 jitter = _get_jitter();
+
+	for (const KeyValue<RID, OccluderInstance> &E : scenario->instances) {
+		const OccluderInstance &instance = E.value;
+		if (!instance.enabled || instance.indices.is_empty()) {
+			continue;
+		}
+
+		bool visible = true;
+		const Vector3 begin = instance.aabb.position;
+		const Vector3 end = instance.aabb.get_end();
+		for (const Plane &plane : planes) {
+			// Nearest corner along the plane normal, planes face outwards.
+			const Vector3 corner(
+					plane.normal.x > 0 ? begin.x : end.x,
+					plane.normal.y > 0 ? begin.y : end.y,
+					plane.normal.z > 0 ? begin.z : end.z);
+			if (plane.distance_to(corner) > 0) {
+				visible = false;
+				break;
+			}
+		}
+
+		if (visible) {
+			buffer->setup_triangles(instance.xformed_vertices.ptr(), instance.indices.ptr(), instance.indices.size(), cam_inv_transform, p_cam_projection, jitter);
+		}
+	}
+
+	buffer->rasterize();
+	buffer->update_mips();
+}
+
+RendererSceneOcclusionRaster::HZBuffer *RendererSceneOcclusionRaster::buffer_get_ptr(RID p_buffer) {
+	return buffers.getptr(p_buffer);
+}
+
+RID RendererSceneOcclusionRaster::buffer_get_debug_texture(RID p_buffer) {
+	ERR_FAIL_COND_V(!buffers.has(p_buffer), RID());
+	return buffers[p_buffer].get_debug_texture();
+}
+
+RendererSceneOcclusionRaster::RendererSceneOcclusionRaster() {
+	jitter_enabled = GLOBAL_GET("rendering/occlusion_culling/jitter_projection");
+}
+
+RendererSceneOcclusionRaster::~RendererSceneOcclusionRaster() {
+	LocalVector<RID> occluders = occluder_owner.get_owned_list();
+	for (const RID &rid : occluders) {
+		free_occluder(rid);
+	}
+}
@@ -0,0 +1,468 @@
+/**************************************************************************/
+/*  renderer_scene_portal_cull.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "renderer_scene_portal_cull.h"
+
+#include "core/math/convex_hull.h"
+
+// Distance from the portal plane within which the camera is considered to stand in the opening.
+static const real_t PORTAL_MARGIN = 0.01;
+static const real_t ROOM_MARGIN = 0.001;
+
+static void _clip_polygon(const LocalVector<Vector3> &p_polygon, const Plane &p_plane, LocalVector<Vector3> &r_clipped) {
+	r_clipped.clear();
+	const uint32_t count = p_polygon.size();
+	for (uint32_t i = 0; i < count; i++) {
+		const Vector3 &a = p_polygon[i];
+		const Vector3 &b = p_polygon[(i + 1) % count];
+		const real_t da = p_plane.distance_to(a);
+		const real_t db = p_plane.distance_to(b);
+		if (da <= 0) {
+			r_clipped.push_back(a);
+		}
+		if ((da < 0 && db > 0) || (da > 0 && db < 0)) {
+			r_clipped.push_back(a + (b - a) * (da / (da - db)));
+		}
+	}
+}
+
+bool RendererScenePortalCull::_room_has_point(const Room *p_room, const Vector3 &p_point, real_t p_margin) {
+	if (p_room->planes.is_empty() || !p_room->aabb.grow(p_margin).has_point(p_point)) {
+		return false;
+	}
+	for (const Plane &plane : p_room->planes) {
+		if (plane.distance_to(p_point) > p_margin) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void RendererScenePortalCull::_scenario_changed(RID p_scenario, bool p_rooms_changed) {
+	ScenarioData *data = scenarios.getptr(p_scenario);
+	if (!data) {
+		return;
+	}
+	data->graph_dirty = true;
+	if (p_rooms_changed) {
+		data->version++;
+	}
+}
+
+void RendererScenePortalCull::_room_attach(Room *p_room, RID p_scenario) {
+	if (p_room->scenario == p_scenario) {
+		return;
+	}
+	if (p_room->scenario.is_valid()) {
+		ScenarioData *data = scenarios.getptr(p_room->scenario);
+		if (data) {
+			data->rooms.erase(p_room);
+		}
+		_scenario_changed(p_room->scenario, true);
+	}
+	p_room->scenario = p_scenario;
+	if (p_scenario.is_valid()) {
+		scenarios[p_scenario].rooms.push_back(p_room);
+		_scenario_changed(p_scenario, true);
+	}
+}
+
+void RendererScenePortalCull::_portal_attach(Portal *p_portal, RID p_scenario) {
+	if (p_portal->scenario == p_scenario) {
+		return;
+	}
+	if (p_portal->scenario.is_valid()) {
+		ScenarioData *data = scenarios.getptr(p_portal->scenario);
+		if (data) {
+			data->portals.erase(p_portal);
+		}
+		_scenario_changed(p_portal->scenario, false);
+	}
+	p_portal->scenario = p_scenario;
+	if (p_scenario.is_valid()) {
+		scenarios[p_scenario].portals.push_back(p_portal);
+		_scenario_changed(p_scenario, false);
+	}
+}
+
+/* ROOMS */
+
+RID RendererScenePortalCull::room_allocate() {
+	return room_owner.allocate_rid();
+}
+
+void RendererScenePortalCull::room_initialize(RID p_room) {
+	room_owner.initialize_rid(p_room);
+	room_owner.get_or_null(p_room)->self = p_room;
+}
+
+void RendererScenePortalCull::room_set_scenario(RID p_room, RID p_scenario) {
+	Room *room = room_owner.get_or_null(p_room);
+	ERR_FAIL_NULL(room);
+	_room_attach(room, p_scenario);
+}
+
+void RendererScenePortalCull::room_set_points(RID p_room, const PackedVector3Array &p_points) {
+	Room *room = room_owner.get_or_null(p_room);
+	ERR_FAIL_NULL(room);
+
+	room->planes.clear();
+	room->aabb = AABB();
+
+	if (p_points.size() >= 4) {
+		Geometry3D::MeshData md;
+		Error err = ConvexHullComputer::convex_hull(p_points, md);
+		if (err == OK && md.faces.size() >= 4) {
+			Vector3 center;
+			for (const Vector3 &v : md.vertices) {
+				center += v;
+			}
+			center /= md.vertices.size();
+
+			room->aabb.position = md.vertices[0];
+			for (const Vector3 &v : md.vertices) {
+				room->aabb.expand_to(v);
+			}
+
+			for (const Geometry3D::MeshData::Face &face : md.faces) {
+				// Room planes face outwards, like frustum planes.
+				Plane plane = face.plane;
+				if (plane.distance_to(center) > 0) {
+					plane = -plane;
+				}
+				room->planes.push_back(plane);
+			}
+		} else {
+			ERR_PRINT("Room points do not form a valid convex volume.");
+		}
+	}
+
+	_scenario_changed(room->scenario, true);
+}
+
+bool RendererScenePortalCull::is_room(RID p_rid) const {
+	return room_owner.owns(p_rid);
+}
+
+/* PORTALS */
+
+RID RendererScenePortalCull::portal_allocate() {
+	return portal_owner.allocate_rid();
+}
+
+void RendererScenePortalCull::portal_initialize(RID p_portal) {
+	portal_owner.initialize_rid(p_portal);
+	portal_owner.get_or_null(p_portal)->self = p_portal;
+}
+
+void RendererScenePortalCull::portal_set_scenario(RID p_portal, RID p_scenario) {
+	Portal *portal = portal_owner.get_or_null(p_portal);
+	ERR_FAIL_NULL(portal);
+	_portal_attach(portal, p_scenario);
+}
+
+void RendererScenePortalCull::portal_set_points(RID p_portal, const PackedVector3Array &p_points) {
+	Portal *portal = portal_owner.get_or_null(p_portal);
+	ERR_FAIL_NULL(portal);
+
+	portal->points.clear();
+	portal->plane = Plane();
+
+	const int count = p_points.size();
+	if (count >= 3) {
+		// Newell's method, robust against collinear leading points.
+		Vector3 normal;
+		Vector3 center;
+		for (int i = 0; i < count; i++) {
+			const Vector3 &a = p_points[i];
+			const Vector3 &b = p_points[(i + 1) % count];
+			normal.x += (a.y - b.y) * (a.z + b.z);
+			normal.y += (a.z - b.z) * (a.x + b.x);
+			normal.z += (a.x - b.x) * (a.y + b.y);
+			center += a;
+		}
+		if (normal.is_zero_approx()) {
+			ERR_PRINT("Portal points do not form a valid polygon.");
+		} else {
+			for (const Vector3 &v : p_points) {
+				portal->points.push_back(v);
+			}
+			portal->plane = Plane(normal.normalized(), center / count);
+		}
+	}
+
+	_scenario_changed(portal->scenario, false);
+}
+
+void RendererScenePortalCull::portal_set_rooms(RID p_portal, RID p_room_a, RID p_room_b) {
+	Portal *portal = portal_owner.get_or_null(p_portal);
+	ERR_FAIL_NULL(portal);
+	portal->rooms[0] = p_room_a;
+	portal->rooms[1] = p_room_b;
+	_scenario_changed(portal->scenario, false);
+}
+
+bool RendererScenePortalCull::is_portal(RID p_rid) const {
+	return portal_owner.owns(p_rid);
+}
+
+bool RendererScenePortalCull::free(RID p_rid) {
+	if (room_owner.owns(p_rid)) {
+		_room_attach(room_owner.get_or_null(p_rid), RID());
+		room_owner.free(p_rid);
+		return true;
+	} else if (portal_owner.owns(p_rid)) {
+		_portal_attach(portal_owner.get_or_null(p_rid), RID());
+		portal_owner.free(p_rid);
+		return true;
+	}
+	return false;
+}
+
+void RendererScenePortalCull::remove_scenario(RID p_scenario) {
+	ScenarioData *data = scenarios.getptr(p_scenario);
+	if (!data) {
+		return;
+	}
+	for (Room *room : data->rooms) {
+		room->scenario = RID();
+	}
+	for (Portal *portal : data->portals) {
+		portal->scenario = RID();
+	}
+	scenarios.erase(p_scenario);
+}
+
+/* VISIBILITY */
+
+int32_t RendererScenePortalCull::_room_index(const ScenarioData &p_data, RID p_room) const {
+	for (uint32_t i = 0; i < p_data.rooms.size(); i++) {
+		if (p_data.rooms[i]->self == p_room) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+void RendererScenePortalCull::_update_graph(ScenarioData &p_data) {
+	p_data.graph.resize(p_data.rooms.size());
+	for (LocalVector<ScenarioData::Link> &links : p_data.graph) {
+		links.clear();
+	}
+
+	for (const Portal *portal : p_data.portals) {
+		int32_t a = _room_index(p_data, portal->rooms[0]);
+		int32_t b = _room_index(p_data, portal->rooms[1]);
+		if (a < 0 || b < 0 || a == b || portal->points.is_empty()) {
+			continue;
+		}
+
+		// Orient the portal by the side room A lies on.
+		const real_t side = portal->plane.distance_to(p_data.rooms[a]->aabb.get_center()) <= 0 ? 1.0 : -1.0;
+
+		ScenarioData::Link link;
+		link.portal = portal;
+		link.room = b;
+		link.side = side;
+		p_data.graph[a].push_back(link);
+
+		link.room = a;
+		link.side = -side;
+		p_data.graph[b].push_back(link);
+	}
+
+	p_data.graph_dirty = false;
+}
+
+void RendererScenePortalCull::_flood(const ScenarioData &p_data, uint32_t p_room, const Vector3 &p_camera, uint32_t p_first_plane, uint32_t p_plane_count, uint32_t p_depth, Visibility &r_visibility) {
+	uint32_t &head = r_visibility.room_clips[p_room];
+	if (head != Visibility::CLIP_ALL) {
+		uint32_t count = 0;
+		for (uint32_t clip = head; clip != Visibility::CLIP_NONE; clip = r_visibility.clips[clip].next) {
+			count++;
+		}
+		if (count >= MAX_CLIPS_PER_ROOM) {
+			// Seen through too many chains, stop narrowing this room.
+			head = Visibility::CLIP_ALL;
+		} else if (r_visibility.clips.size() >= MAX_CLIPS) {
+			// Out of budget, disable culling rather than hide anything wrongly.
+			r_visibility.active = false;
+			return;
+		} else {
+			Visibility::Clip clip;
+			clip.first_plane = p_first_plane;
+			clip.plane_count = p_plane_count;
+			clip.next = head;
+			head = r_visibility.clips.size();
+			r_visibility.clips.push_back(clip);
+		}
+	}
+
+	if (p_depth >= MAX_PORTAL_DEPTH) {
+		return;
+	}
+
+	flood_path.push_back(p_room);
+
+	for (const ScenarioData::Link &link : p_data.graph[p_room]) {
+		if (flood_path.has(link.room)) {
+			continue;
+		}
+
+		const Portal *portal = link.portal;
+		const real_t distance = portal->plane.distance_to(p_camera) * link.side;
+		if (distance > PORTAL_MARGIN) {
+			continue; // Camera is behind the portal.
+		}
+
+		if (distance > -PORTAL_MARGIN) {
+			// Camera stands in the opening, the view can't be narrowed.
+			_flood(p_data, link.room, p_camera, p_first_plane, p_plane_count, p_depth + 1, r_visibility);
+		} else {
+			uint32_t current = 0;
+			clip_scratch[0] = portal->points;
+			for (uint32_t i = 0; i < p_plane_count && !clip_scratch[current].is_empty(); i++) {
+				_clip_polygon(clip_scratch[current], r_visibility.planes[p_first_plane + i], clip_scratch[current ^ 1]);
+				current ^= 1;
+			}
+
+			const LocalVector<Vector3> &polygon = clip_scratch[current];
+			if (polygon.size() < 3) {
+				continue; // Portal is out of view.
+			}
+
+			Vector3 center;
+			for (const Vector3 &v : polygon) {
+				center += v;
+			}
+			center /= polygon.size();
+
+			const uint32_t first_plane = r_visibility.planes.size();
+			for (uint32_t i = 0; i < polygon.size(); i++) {
+				Vector3 normal = (polygon[i] - p_camera).cross(polygon[(i + 1) % polygon.size()] - p_camera);
+				if (normal.is_zero_approx()) {
+					continue;
+				}
+				Plane plane(normal.normalized(), p_camera);
+				if (plane.distance_to(center) > 0) {
+					plane = -plane;
+				}
+				r_visibility.planes.push_back(plane);
+			}
+
+			_flood(p_data, link.room, p_camera, first_plane, r_visibility.planes.size() - first_plane, p_depth + 1, r_visibility);
+		}
+
+		if (!r_visibility.active) {
+			return;
+		}
+	}
+
+	flood_path.resize(flood_path.size() - 1);
+}
+
+bool RendererScenePortalCull::scenario_has_rooms(RID p_scenario) const {
+	const ScenarioData *data = scenarios.getptr(p_scenario);
+	return data && !data->rooms.is_empty();
+}
+
+uint64_t RendererScenePortalCull::scenario_get_version(RID p_scenario) const {
+	const ScenarioData *data = scenarios.getptr(p_scenario);
+	return data ? data->version : 0;
+}
+
+int32_t RendererScenePortalCull::scenario_find_room(RID p_scenario, const AABB &p_aabb) const {
+	const ScenarioData *data = scenarios.getptr(p_scenario);
+	if (!data) {
+		return -1;
+	}
+
+	const Vector3 begin = p_aabb.position;
+	const Vector3 end = p_aabb.position + p_aabb.size;
+
+	for (uint32_t i = 0; i < data->rooms.size(); i++) {
+		const Room *room = data->rooms[i];
+		if (room->planes.is_empty() || !room->aabb.grow(ROOM_MARGIN).encloses(p_aabb)) {
+			continue;
+		}
+		bool inside = true;
+		for (const Plane &plane : room->planes) {
+			// Farthest corner along the plane normal.
+			const Vector3 corner(
+					plane.normal.x > 0 ? end.x : begin.x,
+					plane.normal.y > 0 ? end.y : begin.y,
+					plane.normal.z > 0 ? end.z : begin.z);
+			if (plane.distance_to(corner) > ROOM_MARGIN) {
+				inside = false;
+				break;
+			}
+		}
+		if (inside) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+void RendererScenePortalCull::scenario_cull(RID p_scenario, const Vector3 &p_camera_position, const Vector<Plane> &p_frustum, Visibility &r_visibility) {
+	r_visibility.clear();
+
+	ScenarioData *data = scenarios.getptr(p_scenario);
+	if (!data || data->rooms.is_empty()) {
+		return;
+	}
+
+	if (data->graph_dirty) {
+		_update_graph(*data);
+	}
+
+	for (uint32_t i = 0; i < data->rooms.size(); i++) {
+		if (_room_has_point(data->rooms[i], p_camera_position, 0.0)) {
+			r_visibility.camera_room = i;
+			break;
+		}
+	}
+
+	if (r_visibility.camera_room < 0) {
+		return; // Camera is outside, nothing can be culled.
+	}
+
+	r_visibility.active = true;
+	r_visibility.room_clips.resize(data->rooms.size());
+	for (uint32_t &clip : r_visibility.room_clips) {
+		clip = Visibility::CLIP_NONE;
+	}
+	for (const Plane &plane : p_frustum) {
+		r_visibility.planes.push_back(plane);
+	}
+
+	flood_path.clear();
+	_flood(*data, r_visibility.camera_room, p_camera_position, 0, p_frustum.size(), 0, r_visibility);
+}
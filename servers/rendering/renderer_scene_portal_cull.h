@@ -0,0 +1,189 @@
+/**************************************************************************/
+/*  renderer_scene_portal_cull.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/aabb.h"
+#include "core/math/plane.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/rid_owner.h"
+
+// Conservative room and portal visibility.
+//
+// Rooms are convex volumes, portals are convex polygons connecting two rooms.
+// When the camera is inside a room, the portal graph is flooded from that room,
+// narrowing the view through every portal that is seen. Instances that lie
+// completely inside a room which was not reached are known to be hidden.
+// Instances outside of every room (or straddling room bounds) are never culled.
+class RendererScenePortalCull {
+public:
+	enum {
+		MAX_PORTAL_DEPTH = 8,
+		MAX_CLIPS_PER_ROOM = 8,
+		MAX_CLIPS = 1024,
+	};
+
+	struct Visibility {
+		// A room can be seen through several portal chains,
+		// each one narrowing the view to a convex set of planes.
+		struct Clip {
+			uint32_t first_plane = 0;
+			uint32_t plane_count = 0;
+			uint32_t next = CLIP_NONE;
+		};
+
+		enum {
+			CLIP_NONE = 0xFFFFFFFF, // Room not visible.
+			CLIP_ALL = 0xFFFFFFFE, // Room visible, without narrowing.
+		};
+
+		bool active = false;
+		int32_t camera_room = -1;
+		LocalVector<uint32_t> room_clips;
+		LocalVector<Clip> clips;
+		LocalVector<Plane> planes;
+
+		_FORCE_INLINE_ bool is_room_visible(int32_t p_room) const {
+			return !active || p_room < 0 || room_clips[p_room] != CLIP_NONE;
+		}
+
+		// Bounds are stored as in RendererSceneCull::InstanceBounds (min xyz, max xyz).
+		_FORCE_INLINE_ bool is_culled(int32_t p_room, const real_t p_bounds[6]) const {
+			if (!active || p_room < 0) {
+				return false;
+			}
+			uint32_t clip = room_clips[p_room];
+			if (clip == CLIP_ALL) {
+				return false;
+			}
+			while (clip != CLIP_NONE) {
+				const Clip &c = clips[clip];
+				const Plane *p = &planes[c.first_plane];
+				bool inside = true;
+				for (uint32_t i = 0; i < c.plane_count; i++) {
+					const Vector3 min(
+							p[i].normal.x > 0 ? p_bounds[0] : p_bounds[3],
+							p[i].normal.y > 0 ? p_bounds[1] : p_bounds[4],
+							p[i].normal.z > 0 ? p_bounds[2] : p_bounds[5]);
+					if (p[i].distance_to(min) >= 0.0) {
+						inside = false;
+						break;
+					}
+				}
+				if (inside) {
+					return false;
+				}
+				clip = c.next;
+			}
+			return true;
+		}
+
+		void clear() {
+			active = false;
+			camera_room = -1;
+			room_clips.clear();
+			clips.clear();
+			planes.clear();
+		}
+	};
+
+private:
+	struct Room {
+		RID self;
+		RID scenario;
+		LocalVector<Plane> planes;
+		AABB aabb;
+	};
+
+	struct Portal {
+		RID self;
+		RID scenario;
+		RID rooms[2];
+		LocalVector<Vector3> points;
+		Plane plane;
+	};
+
+	struct ScenarioData {
+		LocalVector<Room *> rooms;
+		LocalVector<Portal *> portals;
+
+		struct Link {
+			const Portal *portal = nullptr;
+			uint32_t room = 0;
+			// Sign applied to the portal plane so the source room is on the negative side.
+			real_t side = 1.0;
+		};
+		LocalVector<LocalVector<Link>> graph;
+		bool graph_dirty = true;
+
+		// Bumped every time room indices or shapes change.
+		uint64_t version = 1;
+	};
+
+	mutable RID_Owner<Room, true> room_owner;
+	mutable RID_Owner<Portal, true> portal_owner;
+	HashMap<RID, ScenarioData> scenarios;
+
+	LocalVector<uint32_t> flood_path;
+	LocalVector<Vector3> clip_scratch[2];
+
+	void _room_attach(Room *p_room, RID p_scenario);
+	void _portal_attach(Portal *p_portal, RID p_scenario);
+	void _scenario_changed(RID p_scenario, bool p_rooms_changed);
+	int32_t _room_index(const ScenarioData &p_data, RID p_room) const;
+	void _update_graph(ScenarioData &p_data);
+	void _flood(const ScenarioData &p_data, uint32_t p_room, const Vector3 &p_camera, uint32_t p_first_plane, uint32_t p_plane_count, uint32_t p_depth, Visibility &r_visibility);
+	static bool _room_has_point(const Room *p_room, const Vector3 &p_point, real_t p_margin);
+
+public:
+	RID room_allocate();
+	void room_initialize(RID p_room);
+	void room_set_scenario(RID p_room, RID p_scenario);
+	void room_set_points(RID p_room, const PackedVector3Array &p_points);
+	bool is_room(RID p_rid) const;
+
+	RID portal_allocate();
+	void portal_initialize(RID p_portal);
+	void portal_set_scenario(RID p_portal, RID p_scenario);
+	void portal_set_points(RID p_portal, const PackedVector3Array &p_points);
+	void portal_set_rooms(RID p_portal, RID p_room_a, RID p_room_b);
+	bool is_portal(RID p_rid) const;
+
+	bool free(RID p_rid);
+	void remove_scenario(RID p_scenario);
+
+	bool scenario_has_rooms(RID p_scenario) const;
+	uint64_t scenario_get_version(RID p_scenario) const;
+	// Room index fully enclosing the AABB, or -1.
+	int32_t scenario_find_room(RID p_scenario, const AABB &p_aabb) const;
+	// Only perspective views are supported, as portals are narrowed towards the camera position.
+	void scenario_cull(RID p_scenario, const Vector3 &p_camera_position, const Vector<Plane> &p_frustum, Visibility &r_visibility);
+};
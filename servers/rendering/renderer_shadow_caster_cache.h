@@ -0,0 +1,78 @@
+/**************************************************************************/
+/*  renderer_shadow_caster_cache.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/local_vector.h"
+
+// Shadow casters found for each shadow pass of a positional light.
+//
+// Omni and spot light shadows are redrawn when the shadow atlas moves them
+// around, even if nothing changed in their volume. The spatial query for the
+// casters of each pass is only repeated after the cache is invalidated, which
+// the owner must do whenever the light or an instance intersecting it changes.
+template <typename T>
+class RendererShadowCasterCache {
+public:
+	enum {
+		MAX_PASSES = 6, // Cube map faces.
+	};
+
+private:
+	LocalVector<T> casters[MAX_PASSES];
+	uint32_t valid_passes = 0;
+
+	uint64_t cull_count = 0;
+	uint64_t hit_count = 0;
+
+public:
+	_FORCE_INLINE_ void invalidate() { valid_passes = 0; }
+	_FORCE_INLINE_ bool is_valid(uint32_t p_pass) const { return valid_passes & (1 << p_pass); }
+
+	// Returns the casters of the pass, calling p_cull(LocalVector<T> &) to find them if not cached.
+	template <typename F>
+	const LocalVector<T> &get(uint32_t p_pass, F p_cull) {
+		DEV_ASSERT(p_pass < MAX_PASSES);
+
+		if (is_valid(p_pass)) {
+			hit_count++;
+		} else {
+			casters[p_pass].clear();
+			p_cull(casters[p_pass]);
+			valid_passes |= 1 << p_pass;
+			cull_count++;
+		}
+
+		return casters[p_pass];
+	}
+
+	uint64_t get_cull_count() const { return cull_count; }
+	uint64_t get_hit_count() const { return hit_count; }
+};
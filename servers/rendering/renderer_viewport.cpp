@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/math/transform_interpolator.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/templates/frame_vector.h"
 #include "renderer_canvas_cull.h"
 #include "renderer_scene_cull.h"
 #include "rendering_server_globals.h"
@@ -376,7 +377,15 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 	}
 
 	if (can_draw_2d) {
-		RBMap<Viewport::CanvasKey, Viewport::CanvasData *> canvas_map;
+		struct SortedCanvas {
+			Viewport::CanvasKey key;
+			Viewport::CanvasData *data = nullptr;
+
+			bool operator<(const SortedCanvas &p_other) const { return key < p_other.key; }
+		};
+
+		// Built every frame, so it lives in frame storage and is sorted once instead of being kept in a map.
+		FrameVector<SortedCanvas> sorted_canvases;
 
 		Rect2 clip_rect(0, 0, p_viewport->size.x, p_viewport->size.y);
 		RendererCanvasRender::Light *lights = nullptr;
@@ -505,9 +514,14 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 				}
 			}
 
-			canvas_map[Viewport::CanvasKey(E.key, E.value.layer, E.value.sublayer)] = &E.value;
+			SortedCanvas sorted_canvas;
+			sorted_canvas.key = Viewport::CanvasKey(E.key, E.value.layer, E.value.sublayer);
+			sorted_canvas.data = &E.value;
+			sorted_canvases.push_back(sorted_canvas);
 		}
 
+		sorted_canvases.sort();
+
 		if (lights_with_shadow) {
 			//update shadows if any
 
@@ -638,7 +652,7 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 			RENDER_TIMESTAMP("< Render DirectionalLight2D Shadows");
 		}
 
-		if (scenario_draw_canvas_bg && canvas_map.begin() && canvas_map.begin()->key.get_layer() > scenario_canvas_max_layer) {
+		if (scenario_draw_canvas_bg && !sorted_canvases.is_empty() && sorted_canvases[0].key.get_layer() > scenario_canvas_max_layer) {
 			// There may be an outstanding clear request if a clear was requested, but no 2D elements were drawn.
 			// Clear now otherwise we copy over garbage from the render target.
 			RSG::texture_storage->render_target_do_clear_request(p_viewport->render_target);
@@ -650,17 +664,17 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 			scenario_draw_canvas_bg = false;
 		}
 
-		for (const KeyValue<Viewport::CanvasKey, Viewport::CanvasData *> &E : canvas_map) {
-			RendererCanvasCull::Canvas *canvas = static_cast<RendererCanvasCull::Canvas *>(E.value->canvas);
+		for (const SortedCanvas &E : sorted_canvases) {
+			RendererCanvasCull::Canvas *canvas = static_cast<RendererCanvasCull::Canvas *>(E.data->canvas);
 
-			Transform2D xform = _canvas_get_transform(p_viewport, canvas, E.value, clip_rect.size);
+			Transform2D xform = _canvas_get_transform(p_viewport, canvas, E.data, clip_rect.size);
 
 			RendererCanvasRender::Light *canvas_lights = nullptr;
 			RendererCanvasRender::Light *canvas_directional_lights = nullptr;
 
 			RendererCanvasRender::Light *ptr = lights;
 			while (ptr) {
-				if (E.value->layer >= ptr->layer_min && E.value->layer <= ptr->layer_max) {
+				if (E.data->layer >= ptr->layer_min && E.data->layer <= ptr->layer_max) {
 					ptr->next_ptr = canvas_lights;
 					canvas_lights = ptr;
 				}
@@ -669,7 +683,7 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 
 			ptr = directional_lights;
 			while (ptr) {
-				if (E.value->layer >= ptr->layer_min && E.value->layer <= ptr->layer_max) {
+				if (E.data->layer >= ptr->layer_min && E.data->layer <= ptr->layer_max) {
 					ptr->next_ptr = canvas_directional_lights;
 					canvas_directional_lights = ptr;
 				}
@@ -30,6 +30,7 @@
 
 #include "rendering_server_default.h"
 
+#include "core/os/frame_arena.h"
 #include "core/os/os.h"
 #include "renderer_canvas_cull.h"
 #include "renderer_scene_cull.h"
@@ -178,6 +179,11 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 	}
 
 	RSG::utilities->update_memory_info();
+
+	if (create_thread) {
+		// The render thread has no other frame boundary, the main thread resets in Main::iteration().
+		FrameArena::get_thread_arena().reset();
+	}
 }
 
 void RenderingServerDefault::_run_post_draw_steps() {
@@ -412,6 +412,8 @@ public:
 	FUNC2RC(Color, multimesh_instance_get_custom_data, RID, int)
 
 	FUNC2(multimesh_set_buffer, RID, const Vector<float> &)
+	FUNC3(multimesh_set_buffer_range, RID, int, const Vector<float> &)
+	FUNC3(multimesh_set_buffer_instances, RID, const Vector<int32_t> &, const Vector<float> &)
 	FUNC1RC(RID, multimesh_get_command_buffer_rd_rid, RID)
 	FUNC1RC(RID, multimesh_get_buffer_rd_rid, RID)
 	FUNC1RC(Vector<float>, multimesh_get_buffer, RID)
@@ -430,6 +432,7 @@ public:
 	FUNC3(skeleton_allocate_data, RID, int, bool)
 	FUNC1RC(int, skeleton_get_bone_count, RID)
 	FUNC3(skeleton_bone_set_transform, RID, int, const Transform3D &)
+	FUNC2(skeleton_set_buffer, RID, const Vector<float> &)
 	FUNC2RC(Transform3D, skeleton_bone_get_transform, RID, int)
 	FUNC3(skeleton_bone_set_transform_2d, RID, int, const Transform2D &)
 	FUNC2RC(Transform2D, skeleton_bone_get_transform_2d, RID, int)
@@ -679,6 +682,16 @@ public:
 	FUNCRIDSPLIT(occluder)
 	FUNC3(occluder_set_mesh, RID, const PackedVector3Array &, const PackedInt32Array &)
 
+	/* ROOM AND PORTAL */
+	FUNCRIDSPLIT(room)
+	FUNC2(room_set_scenario, RID, RID)
+	FUNC2(room_set_points, RID, const PackedVector3Array &)
+
+	FUNCRIDSPLIT(portal)
+	FUNC2(portal_set_scenario, RID, RID)
+	FUNC2(portal_set_points, RID, const PackedVector3Array &)
+	FUNC3(portal_set_rooms, RID, RID, RID)
+
 #undef server_name
 #undef ServerName
 //from now on, calls forwarded to this singleton
@@ -890,6 +903,7 @@ public:
 	FUNC2(instance_set_layer_mask, RID, uint32_t)
 	FUNC3(instance_set_pivot_data, RID, float, bool)
 	FUNC2(instance_set_transform, RID, const Transform3D &)
+	FUNC2(instances_set_transforms, const Vector<RID> &, const Vector<Transform3D> &)
 	FUNC2(instance_attach_object_instance_id, RID, ObjectID)
 	FUNC3(instance_set_blend_shape_weight, RID, int, float)
 	FUNC3(instance_set_surface_override_material, RID, int, RID)
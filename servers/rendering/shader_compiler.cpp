@@ -30,6 +30,12 @@
 
 #include "shader_compiler.h"
 
+#include "core/config/engine.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/string/string_builder.h"
+#include "core/version.h"
 #include "servers/rendering/rendering_server_globals.h"
 #include "servers/rendering/shader_types.h"
 
@@ -550,6 +556,7 @@ String ShaderCompiler::_dump_node_code(const SL::Node *p_node, int p_level, Gene
 				if (uniform.scope == SL::ShaderNode::Uniform::SCOPE_INSTANCE) {
 					//insert, but don't generate any code.
 					p_actions.uniforms->insert(uniform_name, uniform);
+					used_uniforms.push_back(uniform_name);
 					continue; // Instances are indexed directly, don't need index uniforms.
 				}
 
@@ -630,6 +637,7 @@ String ShaderCompiler::_dump_node_code(const SL::Node *p_node, int p_level, Gene
 				}
 
 				p_actions.uniforms->insert(uniform_name, uniform);
+				used_uniforms.push_back(uniform_name);
 			}
 
 			for (int i = 0; i < max_uniforms; i++) {
@@ -884,6 +892,7 @@ String ShaderCompiler::_dump_node_code(const SL::Node *p_node, int p_level, Gene
 
 			if (p_assigning && p_actions.write_flag_pointers.has(vnode->name)) {
 				*p_actions.write_flag_pointers[vnode->name] = true;
+				used_write_flags.insert(vnode->name);
 			}
 
 			if (p_default_actions.usage_defines.has(vnode->name) && !used_name_defines.has(vnode->name)) {
@@ -1001,6 +1010,7 @@ String ShaderCompiler::_dump_node_code(const SL::Node *p_node, int p_level, Gene
 
 			if (p_assigning && p_actions.write_flag_pointers.has(anode->name)) {
 				*p_actions.write_flag_pointers[anode->name] = true;
+				used_write_flags.insert(anode->name);
 			}
 
 			if (p_default_actions.usage_defines.has(anode->name) && !used_name_defines.has(anode->name)) {
@@ -1223,6 +1233,7 @@ String ShaderCompiler::_dump_node_code(const SL::Node *p_node, int p_level, Gene
 
 							if (found && p_actions.write_flag_pointers.has(name)) {
 								*p_actions.write_flag_pointers[name] = true;
+								used_write_flags.insert(name);
 							}
 						}
 
@@ -1459,7 +1470,332 @@ ShaderLanguage::DataType ShaderCompiler::_get_global_shader_uniform_type(const S
 	return (ShaderLanguage::DataType)RS::global_shader_uniform_type_get_shader_datatype(gvt);
 }
 
+String ShaderCompiler::cache_dir;
+
+static const char *shader_compiler_cache_header = "GDSL";
+static const uint32_t shader_compiler_cache_version = 1;
+
+void ShaderCompiler::set_cache_dir(const String &p_dir) {
+	cache_dir = String();
+	if (p_dir.is_empty()) {
+		return;
+	}
+
+	Ref<DirAccess> da = DirAccess::open(p_dir);
+	ERR_FAIL_COND_MSG(da.is_null(), vformat("Unable to open shader cache directory at %s.", p_dir));
+	if (da->change_dir("compiler") != OK) {
+		Error err = da->make_dir("compiler");
+		ERR_FAIL_COND_MSG(err != OK, vformat("Unable to create shader compiler cache directory at %s.", p_dir));
+	}
+
+	cache_dir = p_dir.path_join("compiler");
+}
+
+const String &ShaderCompiler::get_cache_dir() {
+	return cache_dir;
+}
+
+String ShaderCompiler::_get_cache_file_path(RS::ShaderMode p_mode, const String &p_code, const IdentifierActions *p_actions) const {
+	StringBuilder hash_build;
+
+	hash_build.append("[engine]");
+	hash_build.append(GODOT_VERSION_FULL_BUILD);
+	hash_build.append(GODOT_VERSION_HASH);
+	hash_build.append("[renderer]");
+	hash_build.append(OS::get_singleton()->get_current_rendering_method());
+	hash_build.append(RS::get_singleton()->is_low_end() ? "1" : "0");
+	hash_build.append(Engine::get_singleton()->is_editor_hint() ? "1" : "0");
+	hash_build.append("[actions]");
+	hash_build.append(actions_sha256);
+	hash_build.append("[mode]");
+	hash_build.append(itos(p_mode));
+
+	hash_build.append("[entry_points]");
+	for (const KeyValue<StringName, Stage> &E : p_actions->entry_point_stages) {
+		hash_build.append(String(E.key) + ":" + itos(E.value) + ";");
+	}
+	hash_build.append("[render_mode_values]");
+	for (const KeyValue<StringName, Pair<int *, int>> &E : p_actions->render_mode_values) {
+		hash_build.append(String(E.key) + ":" + itos(E.value.second) + ";");
+	}
+	hash_build.append("[render_mode_flags]");
+	for (const KeyValue<StringName, bool *> &E : p_actions->render_mode_flags) {
+		hash_build.append(String(E.key) + ";");
+	}
+	hash_build.append("[usage_flags]");
+	for (const KeyValue<StringName, bool *> &E : p_actions->usage_flag_pointers) {
+		hash_build.append(String(E.key) + ";");
+	}
+	hash_build.append("[write_flags]");
+	for (const KeyValue<StringName, bool *> &E : p_actions->write_flag_pointers) {
+		hash_build.append(String(E.key) + ";");
+	}
+
+	// Global uniform types change the code generated for shaders that read them.
+	hash_build.append("[globals]");
+	if (RSG::material_storage) {
+		Vector<StringName> globals = RSG::material_storage->global_shader_parameter_get_list();
+		for (const StringName &E : globals) {
+			hash_build.append(String(E) + ":" + itos(RSG::material_storage->global_shader_parameter_get_type(E)) + ";");
+		}
+	}
+
+	hash_build.append("[code]");
+	hash_build.append(p_code);
+
+	return cache_dir.path_join(hash_build.as_string().sha256_text() + ".cache");
+}
+
+bool ShaderCompiler::_load_from_cache(const String &p_path, IdentifierActions *p_actions, GeneratedCode &r_gen_code) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	if (f.is_null()) {
+		return false;
+	}
+
+	char header[5] = { 0, 0, 0, 0, 0 };
+	f->get_buffer((uint8_t *)header, 4);
+	if (header != String(shader_compiler_cache_header) || f->get_32() != shader_compiler_cache_version) {
+		return false;
+	}
+
+	GeneratedCode gen_code;
+
+	uint32_t define_count = f->get_32();
+	for (uint32_t i = 0; i < define_count; i++) {
+		gen_code.defines.push_back(f->get_pascal_string());
+	}
+
+	uint32_t texture_count = f->get_32();
+	gen_code.texture_uniforms.resize(texture_count);
+	for (uint32_t i = 0; i < texture_count; i++) {
+		GeneratedCode::Texture &texture = gen_code.texture_uniforms.write[i];
+		texture.name = f->get_pascal_string();
+		texture.type = SL::DataType(f->get_32());
+		texture.hint = SL::ShaderNode::Uniform::Hint(f->get_32());
+		texture.use_color = f->get_8();
+		texture.filter = SL::TextureFilter(f->get_32());
+		texture.repeat = SL::TextureRepeat(f->get_32());
+		texture.global = f->get_8();
+		texture.array_size = f->get_32();
+	}
+
+	uint32_t offset_count = f->get_32();
+	gen_code.uniform_offsets.resize(offset_count);
+	for (uint32_t i = 0; i < offset_count; i++) {
+		gen_code.uniform_offsets.write[i] = f->get_32();
+	}
+	gen_code.uniform_total_size = f->get_32();
+	gen_code.uniforms = f->get_pascal_string();
+	for (int i = 0; i < STAGE_MAX; i++) {
+		gen_code.stage_globals[i] = f->get_pascal_string();
+	}
+
+	uint32_t code_count = f->get_32();
+	for (uint32_t i = 0; i < code_count; i++) {
+		String name = f->get_pascal_string();
+		gen_code.code[name] = f->get_pascal_string();
+	}
+
+	gen_code.uses_global_textures = f->get_8();
+	gen_code.uses_fragment_time = f->get_8();
+	gen_code.uses_vertex_time = f->get_8();
+	gen_code.uses_screen_texture_mipmaps = f->get_8();
+	gen_code.uses_screen_texture = f->get_8();
+	gen_code.uses_depth_texture = f->get_8();
+	gen_code.uses_normal_roughness_texture = f->get_8();
+
+	Vector<StringName> render_modes;
+	uint32_t render_mode_count = f->get_32();
+	for (uint32_t i = 0; i < render_mode_count; i++) {
+		render_modes.push_back(f->get_pascal_string());
+	}
+
+	Vector<StringName> usage_flags;
+	uint32_t usage_flag_count = f->get_32();
+	for (uint32_t i = 0; i < usage_flag_count; i++) {
+		usage_flags.push_back(f->get_pascal_string());
+	}
+
+	Vector<StringName> write_flags;
+	uint32_t write_flag_count = f->get_32();
+	for (uint32_t i = 0; i < write_flag_count; i++) {
+		write_flags.push_back(f->get_pascal_string());
+	}
+
+	Vector<Pair<StringName, SL::ShaderNode::Uniform>> uniforms;
+	uint32_t uniform_count = f->get_32();
+	for (uint32_t i = 0; i < uniform_count; i++) {
+		Pair<StringName, SL::ShaderNode::Uniform> uniform;
+		uniform.first = f->get_pascal_string();
+		SL::ShaderNode::Uniform &u = uniform.second;
+		u.order = int32_t(f->get_32());
+		u.prop_order = int32_t(f->get_32());
+		u.texture_order = int32_t(f->get_32());
+		u.texture_binding = int32_t(f->get_32());
+		u.type = SL::DataType(f->get_32());
+		u.precision = SL::DataPrecision(f->get_32());
+		u.array_size = int32_t(f->get_32());
+		uint32_t default_value_count = f->get_32();
+		u.default_value.resize(default_value_count);
+		for (uint32_t j = 0; j < default_value_count; j++) {
+			u.default_value.write[j].uint = f->get_32();
+		}
+		u.scope = SL::ShaderNode::Uniform::Scope(f->get_32());
+		u.hint = SL::ShaderNode::Uniform::Hint(f->get_32());
+		u.use_color = f->get_8();
+		u.filter = SL::TextureFilter(f->get_32());
+		u.repeat = SL::TextureRepeat(f->get_32());
+		for (int j = 0; j < 3; j++) {
+			u.hint_range[j] = f->get_float();
+		}
+		uint32_t enum_name_count = f->get_32();
+		for (uint32_t j = 0; j < enum_name_count; j++) {
+			u.hint_enum_names.push_back(f->get_pascal_string());
+		}
+		u.instance_index = int32_t(f->get_32());
+		u.group = f->get_pascal_string();
+		u.subgroup = f->get_pascal_string();
+		uniforms.push_back(uniform);
+	}
+
+	// A truncated or otherwise damaged entry is treated as a miss and overwritten.
+	if (f->get_error() != OK || f->get_position() != f->get_length()) {
+		return false;
+	}
+
+	r_gen_code = gen_code;
+
+	for (const StringName &E : render_modes) {
+		if (p_actions->render_mode_flags.has(E)) {
+			*p_actions->render_mode_flags[E] = true;
+		}
+		if (p_actions->render_mode_values.has(E)) {
+			Pair<int *, int> &p = p_actions->render_mode_values[E];
+			*p.first = p.second;
+		}
+	}
+	for (const StringName &E : usage_flags) {
+		if (p_actions->usage_flag_pointers.has(E)) {
+			*p_actions->usage_flag_pointers[E] = true;
+		}
+	}
+	for (const StringName &E : write_flags) {
+		if (p_actions->write_flag_pointers.has(E)) {
+			*p_actions->write_flag_pointers[E] = true;
+		}
+	}
+	for (const Pair<StringName, SL::ShaderNode::Uniform> &E : uniforms) {
+		p_actions->uniforms->insert(E.first, E.second);
+	}
+
+	return true;
+}
+
+void ShaderCompiler::_save_to_cache(const String &p_path, const GeneratedCode &p_gen_code) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	ERR_FAIL_COND(f.is_null());
+
+	f->store_buffer((const uint8_t *)shader_compiler_cache_header, 4);
+	f->store_32(shader_compiler_cache_version);
+
+	f->store_32(p_gen_code.defines.size());
+	for (const String &E : p_gen_code.defines) {
+		f->store_pascal_string(E);
+	}
+
+	f->store_32(p_gen_code.texture_uniforms.size());
+	for (const GeneratedCode::Texture &E : p_gen_code.texture_uniforms) {
+		f->store_pascal_string(E.name);
+		f->store_32(E.type);
+		f->store_32(E.hint);
+		f->store_8(E.use_color);
+		f->store_32(E.filter);
+		f->store_32(E.repeat);
+		f->store_8(E.global);
+		f->store_32(E.array_size);
+	}
+
+	f->store_32(p_gen_code.uniform_offsets.size());
+	for (uint32_t E : p_gen_code.uniform_offsets) {
+		f->store_32(E);
+	}
+	f->store_32(p_gen_code.uniform_total_size);
+	f->store_pascal_string(p_gen_code.uniforms);
+	for (int i = 0; i < STAGE_MAX; i++) {
+		f->store_pascal_string(p_gen_code.stage_globals[i]);
+	}
+
+	f->store_32(p_gen_code.code.size());
+	for (const KeyValue<String, String> &E : p_gen_code.code) {
+		f->store_pascal_string(E.key);
+		f->store_pascal_string(E.value);
+	}
+
+	f->store_8(p_gen_code.uses_global_textures);
+	f->store_8(p_gen_code.uses_fragment_time);
+	f->store_8(p_gen_code.uses_vertex_time);
+	f->store_8(p_gen_code.uses_screen_texture_mipmaps);
+	f->store_8(p_gen_code.uses_screen_texture);
+	f->store_8(p_gen_code.uses_depth_texture);
+	f->store_8(p_gen_code.uses_normal_roughness_texture);
+
+	f->store_32(shader->render_modes.size());
+	for (const StringName &E : shader->render_modes) {
+		f->store_pascal_string(E);
+	}
+
+	f->store_32(used_flag_pointers.size());
+	for (const StringName &E : used_flag_pointers) {
+		f->store_pascal_string(E);
+	}
+
+	f->store_32(used_write_flags.size());
+	for (const StringName &E : used_write_flags) {
+		f->store_pascal_string(E);
+	}
+
+	f->store_32(used_uniforms.size());
+	for (const StringName &E : used_uniforms) {
+		const SL::ShaderNode::Uniform &u = shader->uniforms[E];
+		f->store_pascal_string(E);
+		f->store_32(u.order);
+		f->store_32(u.prop_order);
+		f->store_32(u.texture_order);
+		f->store_32(u.texture_binding);
+		f->store_32(u.type);
+		f->store_32(u.precision);
+		f->store_32(u.array_size);
+		f->store_32(u.default_value.size());
+		for (const SL::Scalar &value : u.default_value) {
+			f->store_32(value.uint);
+		}
+		f->store_32(u.scope);
+		f->store_32(u.hint);
+		f->store_8(u.use_color);
+		f->store_32(u.filter);
+		f->store_32(u.repeat);
+		for (int j = 0; j < 3; j++) {
+			f->store_float(u.hint_range[j]);
+		}
+		f->store_32(u.hint_enum_names.size());
+		for (const String &name : u.hint_enum_names) {
+			f->store_pascal_string(name);
+		}
+		f->store_32(u.instance_index);
+		f->store_pascal_string(u.group);
+		f->store_pascal_string(u.subgroup);
+	}
+}
+
 Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
+	String cache_path;
+	if (!cache_dir.is_empty()) {
+		cache_path = _get_cache_file_path(p_mode, p_code, p_actions);
+		if (_load_from_cache(cache_path, p_actions, r_gen_code)) {
+			return OK;
+		}
+	}
+
 	SL::ShaderCompileInfo info;
 	info.functions = ShaderTypes::get_singleton()->get_functions(p_mode);
 	info.render_modes = ShaderTypes::get_singleton()->get_modes(p_mode);
@@ -1559,6 +1895,8 @@ Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, Ident
 	used_name_defines.clear();
 	used_rmode_defines.clear();
 	used_flag_pointers.clear();
+	used_write_flags.clear();
+	used_uniforms.clear();
 	fragment_varyings.clear();
 
 	shader = parser.get_shader();
@@ -1566,12 +1904,40 @@ Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, Ident
 	// Return value only relevant within nested calls.
 	_ALLOW_DISCARD_ _dump_node_code(shader, 1, r_gen_code, *p_actions, actions, false);
 
+	if (!cache_path.is_empty()) {
+		_save_to_cache(cache_path, r_gen_code);
+	}
+
 	return OK;
 }
 
 void ShaderCompiler::initialize(DefaultIdentifierActions p_actions) {
 	actions = p_actions;
 
+	StringBuilder hash_build;
+	hash_build.append("[renames]");
+	for (const KeyValue<StringName, String> &E : actions.renames) {
+		hash_build.append(String(E.key) + "=" + E.value + ";");
+	}
+	hash_build.append("[render_mode_defines]");
+	for (const KeyValue<StringName, String> &E : actions.render_mode_defines) {
+		hash_build.append(String(E.key) + "=" + E.value + ";");
+	}
+	hash_build.append("[usage_defines]");
+	for (const KeyValue<StringName, String> &E : actions.usage_defines) {
+		hash_build.append(String(E.key) + "=" + E.value + ";");
+	}
+	hash_build.append("[custom_samplers]");
+	for (const KeyValue<StringName, String> &E : actions.custom_samplers) {
+		hash_build.append(String(E.key) + "=" + E.value + ";");
+	}
+	hash_build.append("[settings]");
+	hash_build.append(vformat("%d;%d;%d;%d;%d;%d;%d", actions.default_filter, actions.default_repeat, actions.base_texture_binding_index, actions.texture_layout_set, actions.base_varying_index, int(actions.apply_luminance_multiplier), int(actions.check_multiview_samplers)));
+	hash_build.append(actions.base_uniform_string);
+	hash_build.append(actions.global_buffer_array_variable);
+	hash_build.append(actions.instance_uniform_index_variable);
+	actions_sha256 = hash_build.as_string().sha256_text();
+
 	time_name = "TIME";
 
 	List<String> func_list;
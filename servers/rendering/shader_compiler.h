@@ -118,15 +118,28 @@ private:
 
 	HashSet<StringName> used_name_defines;
 	HashSet<StringName> used_flag_pointers;
+	HashSet<StringName> used_write_flags;
 	HashSet<StringName> used_rmode_defines;
+	Vector<StringName> used_uniforms;
 	HashSet<StringName> internal_functions;
 	HashSet<StringName> fragment_varyings;
 
 	DefaultIdentifierActions actions;
+	String actions_sha256;
+
+	static String cache_dir;
 
 	static ShaderLanguage::DataType _get_global_shader_uniform_type(const StringName &p_name);
 
+	String _get_cache_file_path(RS::ShaderMode p_mode, const String &p_code, const IdentifierActions *p_actions) const;
+	bool _load_from_cache(const String &p_path, IdentifierActions *p_actions, GeneratedCode &r_gen_code);
+	void _save_to_cache(const String &p_path, const GeneratedCode &p_gen_code);
+
 public:
+	// Successful front-end compilations are stored in this directory, keyed by shader code and compiler configuration.
+	static void set_cache_dir(const String &p_dir);
+	static const String &get_cache_dir();
+
 	Error compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code);
 
 	void initialize(DefaultIdentifierActions p_actions);
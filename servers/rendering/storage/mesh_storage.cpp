@@ -223,6 +223,41 @@ void RendererMeshStorage::multimesh_set_buffer(RID p_multimesh, const Vector<flo
 	_multimesh_set_buffer(p_multimesh, p_buffer);
 }
 
+void RendererMeshStorage::multimesh_set_buffer_range(RID p_multimesh, int p_first_instance, const Vector<float> &p_buffer) {
+	MultiMeshInterpolator *mmi = _multimesh_get_interpolator(p_multimesh);
+	if (mmi && mmi->interpolated) {
+		ERR_FAIL_COND(mmi->_stride == 0);
+		ERR_FAIL_COND_MSG(p_buffer.size() % mmi->_stride != 0, vformat("Buffer size must be a multiple of %d elements, got %d instead.", mmi->_stride, p_buffer.size()));
+		const int instance_count = p_buffer.size() / mmi->_stride;
+		ERR_FAIL_COND(p_first_instance < 0 || p_first_instance + instance_count > mmi->_num_instances);
+
+		memcpy(mmi->_data_curr.ptrw() + p_first_instance * mmi->_stride, p_buffer.ptr(), p_buffer.size() * sizeof(float));
+		_multimesh_add_to_interpolation_lists(p_multimesh, *mmi);
+		return;
+	}
+
+	_multimesh_set_buffer_range(p_multimesh, p_first_instance, p_buffer);
+}
+
+void RendererMeshStorage::multimesh_set_buffer_instances(RID p_multimesh, const Vector<int32_t> &p_instances, const Vector<float> &p_buffer) {
+	MultiMeshInterpolator *mmi = _multimesh_get_interpolator(p_multimesh);
+	if (mmi && mmi->interpolated) {
+		ERR_FAIL_COND_MSG(p_buffer.size() != p_instances.size() * mmi->_stride, vformat("Buffer should have %d elements, got %d instead.", p_instances.size() * mmi->_stride, p_buffer.size()));
+
+		const int32_t *instances = p_instances.ptr();
+		const float *r = p_buffer.ptr();
+		float *w = mmi->_data_curr.ptrw();
+		for (int i = 0; i < p_instances.size(); i++) {
+			ERR_FAIL_INDEX(instances[i], mmi->_num_instances);
+			memcpy(w + instances[i] * mmi->_stride, r + i * mmi->_stride, mmi->_stride * sizeof(float));
+		}
+		_multimesh_add_to_interpolation_lists(p_multimesh, *mmi);
+		return;
+	}
+
+	_multimesh_set_buffer_instances(p_multimesh, p_instances, p_buffer);
+}
+
 RID RendererMeshStorage::multimesh_get_command_buffer_rd_rid(RID p_multimesh) const {
 	return _multimesh_get_command_buffer_rd_rid(p_multimesh);
 }
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/file_access.h"
+#include "core/io/file_access_async.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -220,4 +221,134 @@ TEST_CASE("[FileAccess] Get/Store floating point half precision values") {
 	}
 }
 
+TEST_CASE("[FileAccess] Compressed file spanning many blocks") {
+	const String file_path = TestUtils::get_temp_path("compressed_many_blocks.bin");
+
+	// Enough blocks for reads to be decompressed ahead, with a partial last block.
+	PackedByteArray reference;
+	reference.resize(4096 * 64 + 123);
+	for (int i = 0; i < reference.size(); i++) {
+		reference.write[i] = (i * 7 + i / 4096) % 251;
+	}
+
+	Ref<FileAccess> fw = FileAccess::open_compressed(file_path, FileAccess::WRITE, FileAccess::COMPRESSION_ZSTD);
+	REQUIRE(fw.is_valid());
+	fw->store_buffer(reference);
+	fw->close();
+
+	Ref<FileAccess> f = FileAccess::open_compressed(file_path, FileAccess::READ, FileAccess::COMPRESSION_ZSTD);
+	REQUIRE(f.is_valid());
+	CHECK(f->get_length() == (uint64_t)reference.size());
+
+	PackedByteArray data;
+	while (!f->eof_reached()) {
+		data.append_array(f->get_buffer(1000));
+	}
+	CHECK(data == reference);
+
+	// Jump back behind the blocks decompressed ahead.
+	f->seek(4096 * 3 + 10);
+	CHECK(f->get_buffer(5000) == reference.slice(4096 * 3 + 10, 4096 * 3 + 10 + 5000));
+	f->seek(4096 * 40);
+	CHECK(f->get_buffer(4096 * 2) == reference.slice(4096 * 40, 4096 * 42));
+}
+
+TEST_CASE("[FileAccess] Asynchronous reads") {
+	const String file_path = TestUtils::get_temp_path("async_read.bin");
+
+	PackedByteArray reference;
+	reference.resize(100000);
+	for (int i = 0; i < reference.size(); i++) {
+		reference.write[i] = (i * 13) % 251;
+	}
+
+	Ref<FileAccess> fw = FileAccess::open(file_path, FileAccess::WRITE);
+	REQUIRE(fw.is_valid());
+	fw->store_buffer(reference);
+	fw->close();
+
+	SUBCASE("Awaiting the data") {
+		FileAccessAsync::Batch *batch = FileAccessAsync::open_async_batch({ file_path, file_path });
+		REQUIRE(batch->files.size() == 2);
+		for (const Ref<FileAccessAsync> &f : batch->files) {
+			CHECK(f->wait() == OK);
+			CHECK(f->is_ready());
+			CHECK(f->get_data() == reference);
+		}
+		FileAccessAsync::finish_batch(batch);
+	}
+
+	SUBCASE("Reading through the FileAccess interface") {
+		FileAccessAsync::Batch *batch = FileAccessAsync::open_async_batch({ file_path });
+		Ref<FileAccess> f = batch->files[0];
+		CHECK(f->get_path() == file_path);
+		CHECK(f->get_length() == (uint64_t)reference.size());
+		CHECK(f->get_8() == reference[0]);
+		f->seek(5000);
+		CHECK(f->get_buffer(1000) == reference.slice(5000, 6000));
+		f->seek_end(-10);
+		CHECK(f->get_buffer(100) == reference.slice(reference.size() - 10));
+		CHECK(f->eof_reached());
+		CHECK(f->get_error() == ERR_FILE_EOF);
+
+		// Like `feof()`, only a read that comes up short reaches the end.
+		f->seek_end(-10);
+		CHECK_FALSE(f->eof_reached());
+		CHECK(f->get_buffer(10) == reference.slice(reference.size() - 10));
+		CHECK_FALSE(f->eof_reached());
+		CHECK(f->get_error() == OK);
+		f->get_8();
+		CHECK(f->eof_reached());
+		CHECK(f->get_error() == ERR_FILE_EOF);
+
+		// The handle outlives its batch.
+		FileAccessAsync::finish_batch(batch);
+		CHECK(f->get_length() == (uint64_t)reference.size());
+	}
+
+	SUBCASE("Reading lines") {
+		const String text_path = TestUtils::get_temp_path("async_read_lines.txt");
+		Ref<FileAccess> text = FileAccess::open(text_path, FileAccess::WRITE);
+		REQUIRE(text.is_valid());
+		text->store_string("first\nlast");
+		text->close();
+
+		FileAccessAsync::Batch *batch = FileAccessAsync::open_async_batch({ text_path });
+		Ref<FileAccess> f = batch->files[0];
+		CHECK(f->get_line() == "first");
+		CHECK_FALSE(f->eof_reached());
+		// The last line has no line break, its final character must not be lost.
+		CHECK(f->get_line() == "last");
+		CHECK(f->eof_reached());
+		FileAccessAsync::finish_batch(batch);
+	}
+
+	SUBCASE("Failed reads") {
+		FileAccessAsync::Batch *batch = FileAccessAsync::open_async_batch({ TestUtils::get_temp_path("async_read_missing.bin") });
+		CHECK(batch->files[0]->wait() == ERR_FILE_NOT_FOUND);
+		CHECK(batch->files[0]->get_data().is_empty());
+		FileAccessAsync::finish_batch(batch);
+
+		batch = FileAccessAsync::open_async_batch({ file_path }, 1000);
+		CHECK(batch->files[0]->wait() == ERR_UNAVAILABLE);
+		FileAccessAsync::finish_batch(batch);
+	}
+
+	SUBCASE("Dropping pending reads") {
+		Vector<String> paths;
+		for (int i = 0; i < 64; i++) {
+			paths.push_back(file_path);
+		}
+		FileAccessAsync::Batch *batch = FileAccessAsync::open_async_batch(paths);
+		Ref<FileAccessAsync> kept = batch->files[63];
+		batch->files.clear();
+
+		// Dropping the handles doesn't wait, finishing the batch waits for the whole group once.
+		FileAccessAsync::finish_batch(batch);
+		CHECK(kept->is_ready());
+		const Error err = kept->wait();
+		CHECK((err == OK || err == ERR_SKIP));
+	}
+}
+
 } // namespace TestFileAccess
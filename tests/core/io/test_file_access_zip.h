@@ -0,0 +1,160 @@
+/**************************************************************************/
+/*  test_file_access_zip.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#ifdef MINIZIP_ENABLED
+
+#include "core/io/file_access_zip.h"
+#include "core/io/zip_io.h"
+#include "core/math/random_pcg.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestFileAccessZip {
+
+// Large enough for several inflate checkpoints, which are recorded every MiB.
+static const int ENTRY_SIZE = 3 * 1024 * 1024 + 12345;
+
+static Vector<uint8_t> make_entry_data() {
+	// Compressible, but without long repeats, so it's split into many deflate blocks.
+	RandomPCG rng(1234);
+	Vector<uint8_t> data;
+	data.resize(ENTRY_SIZE);
+	uint8_t *ptr = data.ptrw();
+	for (int i = 0; i < ENTRY_SIZE; i++) {
+		ptr[i] = 'a' + rng.rand() % 16;
+	}
+	return data;
+}
+
+static String pack_entry(const String &p_entry, const Vector<uint8_t> &p_data) {
+	const String zip_path = TestUtils::get_temp_path("file_access_zip_seek.zip");
+
+	Ref<FileAccess> io_fa;
+	zlib_filefunc_def io = zipio_create_io(&io_fa);
+	zipFile zip = zipOpen2(zip_path.utf8().get_data(), APPEND_STATUS_CREATE, nullptr, &io);
+	REQUIRE(zip != nullptr);
+	zipOpenNewFileInZip(zip, p_entry.utf8().get_data(), nullptr, nullptr, 0, nullptr, 0, nullptr, Z_DEFLATED, Z_DEFAULT_COMPRESSION);
+	zipWriteInFileInZip(zip, p_data.ptr(), p_data.size());
+	zipCloseFileInZip(zip);
+	zipClose(zip, nullptr);
+
+	return zip_path;
+}
+
+static void check_read(const Ref<FileAccess> &p_file, const Vector<uint8_t> &p_data, uint64_t p_position, uint64_t p_length) {
+	p_file->seek(p_position);
+	CHECK(p_file->get_position() == p_position);
+
+	const uint64_t expected = MIN(p_length, p_data.size() - p_position);
+	Vector<uint8_t> buffer;
+	buffer.resize(p_length);
+	const uint64_t read = p_file->get_buffer(buffer.ptrw(), p_length);
+	CHECK_MESSAGE(read == expected, vformat("Reading %d bytes at %d.", p_length, p_position));
+	CHECK_MESSAGE(memcmp(buffer.ptr(), p_data.ptr() + p_position, expected) == 0, vformat("Data read at %d doesn't match.", p_position));
+	CHECK(p_file->get_position() == p_position + expected);
+}
+
+TEST_CASE("[FileAccessZip] Seeking in a large deflated entry") {
+	const String entry = "file_access_zip_seek.bin";
+	const Vector<uint8_t> data = make_entry_data();
+	if (!ZipArchive::get_singleton()->file_exists("res://" + entry)) {
+		// Every subcase runs the test case again, but the package only needs to be opened once.
+		REQUIRE(ZipArchive::get_singleton()->try_open_pack(pack_entry(entry, data), false, 0));
+	}
+
+	PackedData::PackedFile packed_file;
+	Ref<FileAccess> file = ZipArchive::get_singleton()->get_file("res://" + entry, &packed_file);
+	REQUIRE(file->is_open());
+	CHECK(file->get_length() == (uint64_t)data.size());
+
+	SUBCASE("Sequential reads") {
+		for (uint64_t position = 0; position < (uint64_t)data.size(); position += 65536) {
+			check_read(file, data, position, 65536);
+		}
+		CHECK(file->eof_reached());
+	}
+
+	SUBCASE("Random backward and forward seeks") {
+		RandomPCG rng(42);
+		for (int i = 0; i < 200; i++) {
+			check_read(file, data, rng.rand() % data.size(), 1 + rng.rand() % 4096);
+		}
+	}
+
+	SUBCASE("Reads across checkpoint boundaries") {
+		// Checkpoints land on the first deflate block boundary after each MiB, read well past it.
+		for (int i = 3; i >= 1; i--) {
+			check_read(file, data, i * 1024 * 1024 - 4096, 256 * 1024);
+		}
+		for (int i = 1; i <= 3; i++) {
+			check_read(file, data, i * 1024 * 1024 - 4096, 256 * 1024);
+		}
+
+		// Another reader of the same entry starts from the shared checkpoints.
+		Ref<FileAccess> other = ZipArchive::get_singleton()->get_file("res://" + entry, &packed_file);
+		REQUIRE(other->is_open());
+		check_read(other, data, data.size() - 300000, 200000);
+		check_read(file, data, 100, 100);
+		check_read(other, data, 2 * 1024 * 1024 + 7, 1024 * 1024);
+	}
+
+	SUBCASE("Seek from the end and EOF") {
+		file->seek_end(-100);
+		CHECK(file->get_position() == (uint64_t)data.size() - 100);
+		uint8_t tail[100];
+		CHECK(file->get_buffer(tail, 100) == 100);
+		CHECK(memcmp(tail, data.ptr() + data.size() - 100, 100) == 0);
+		CHECK_FALSE(file->eof_reached());
+
+		CHECK(file->get_buffer(tail, 100) == 0);
+		CHECK(file->eof_reached());
+
+		// Reading past the end returns what's left.
+		check_read(file, data, data.size() - 10, 100);
+		CHECK(file->eof_reached());
+
+		file->seek_end();
+		CHECK(file->get_position() == (uint64_t)data.size());
+		CHECK(file->get_buffer(tail, 1) == 0);
+		CHECK(file->eof_reached());
+
+		// Seeking clears EOF.
+		file->seek(0);
+		CHECK_FALSE(file->eof_reached());
+		CHECK(file->get_8() == data[0]);
+	}
+}
+
+} // namespace TestFileAccessZip
+
+#endif // MINIZIP_ENABLED
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/marshalls.h"
+#include "core/os/os.h"
 
 #include "tests/test_macros.h"
 
@@ -489,4 +490,173 @@ TEST_CASE("[Marshalls] Typed dictionary decoding") {
 	CHECK(dictionary[Variant(uint64_t(0x0f123456789abcdef))] == Variant(uint64_t(0x0f123456789abcdef)));
 }
 
+static Variant compact_round_trip(const Variant &p_value, Variant::Type p_schema = Variant::VARIANT_MAX, int *r_size = nullptr) {
+	int size = 0;
+	CHECK(encode_variant_compact(p_value, nullptr, size, false, p_schema) == OK);
+	Vector<uint8_t> buffer;
+	buffer.resize(size);
+	int written = 0;
+	CHECK(encode_variant_compact(p_value, buffer.ptrw(), written, false, p_schema) == OK);
+	CHECK(written == size);
+
+	Variant decoded;
+	int read = 0;
+	CHECK(decode_variant_compact(decoded, buffer.ptr(), buffer.size(), &read, false, p_schema) == OK);
+	CHECK(read == size);
+	if (r_size) {
+		*r_size = size;
+	}
+	return decoded;
+}
+
+TEST_CASE("[Marshalls] Compact Variant round trip") {
+	int size = 0;
+
+	CHECK(compact_round_trip(Variant(), Variant::VARIANT_MAX, &size) == Variant());
+	CHECK(size == 1);
+	CHECK(compact_round_trip(true, Variant::VARIANT_MAX, &size) == Variant(true));
+	CHECK(size == 1);
+	CHECK(compact_round_trip(5, Variant::VARIANT_MAX, &size) == Variant(5));
+	CHECK(size == 2);
+	CHECK(compact_round_trip(-64, Variant::VARIANT_MAX, &size) == Variant(-64));
+	CHECK(size == 2);
+	CHECK(compact_round_trip(INT64_MIN) == Variant(INT64_MIN));
+	CHECK(compact_round_trip(INT64_MAX) == Variant(INT64_MAX));
+	CHECK(compact_round_trip(0.5, Variant::VARIANT_MAX, &size) == Variant(0.5));
+	CHECK(size == 5);
+	CHECK(compact_round_trip(0.1, Variant::VARIANT_MAX, &size) == Variant(0.1));
+	CHECK(size == 9);
+	CHECK(compact_round_trip("Godot", Variant::VARIANT_MAX, &size) == Variant("Godot"));
+	CHECK(size == 7);
+	CHECK(compact_round_trip(StringName("name")) == Variant(StringName("name")));
+	CHECK(compact_round_trip(Vector3(1, -2, 3.5)) == Variant(Vector3(1, -2, 3.5)));
+	CHECK(compact_round_trip(Transform3D(Basis(Vector3(0, 1, 0), 0.5), Vector3(1, 2, 3))) == Variant(Transform3D(Basis(Vector3(0, 1, 0), 0.5), Vector3(1, 2, 3))));
+	CHECK(compact_round_trip(Vector2i(-1, 300), Variant::VARIANT_MAX, &size) == Variant(Vector2i(-1, 300)));
+	CHECK(size == 4);
+	CHECK(compact_round_trip(Rect2i(1, 2, 3, 4)) == Variant(Rect2i(1, 2, 3, 4)));
+	CHECK(compact_round_trip(Color(0.1, 0.2, 0.3, 0.4)) == Variant(Color(0.1, 0.2, 0.3, 0.4)));
+	CHECK(compact_round_trip(NodePath("a/b:c")) == Variant(NodePath("a/b:c")));
+
+	Array array = { 1, "two", 3.0, Vector2(4, 5), Variant() };
+	CHECK(compact_round_trip(array) == Variant(array));
+
+	Dictionary dictionary;
+	dictionary["key"] = 1;
+	dictionary[2] = array;
+	CHECK(compact_round_trip(dictionary) == Variant(dictionary));
+
+	PackedInt32Array ints = { 1, -2, 3 };
+	CHECK(compact_round_trip(ints, Variant::VARIANT_MAX, &size) == Variant(ints));
+	CHECK(size == 2 + 12);
+	PackedStringArray strings = { "a", "", "ccc" };
+	CHECK(compact_round_trip(strings) == Variant(strings));
+	PackedVector3Array vectors = { Vector3(1, 2, 3), Vector3(4, 5, 6) };
+	CHECK(compact_round_trip(vectors) == Variant(vectors));
+}
+
+TEST_CASE("[Marshalls] Compact Variant typed arrays and schemas") {
+	Array typed;
+	typed.set_typed(Variant::INT, StringName(), Variant());
+	typed.push_back(1);
+	typed.push_back(200);
+
+	int size = 0;
+	const Variant decoded = compact_round_trip(typed, Variant::VARIANT_MAX, &size);
+	// Tag, element type, count and the elements without tags.
+	CHECK(size == 1 + 1 + 1 + 1 + 2);
+	const Array decoded_array = decoded;
+	CHECK(decoded_array.is_typed());
+	CHECK(decoded_array.get_typed_builtin() == Variant::INT);
+	CHECK(decoded_array == typed);
+
+	// The tag is omitted when both ends know the type.
+	CHECK(compact_round_trip(7, Variant::INT, &size) == Variant(7));
+	CHECK(size == 1);
+	CHECK(compact_round_trip("abc", Variant::STRING, &size) == Variant("abc"));
+	CHECK(size == 4);
+	// Types with flags keep their tag.
+	CHECK(compact_round_trip(false, Variant::BOOL, &size) == Variant(false));
+	CHECK(size == 1);
+
+	int len = 0;
+	ERR_PRINT_OFF;
+	CHECK(encode_variant_compact(7, nullptr, len, false, Variant::STRING) == ERR_INVALID_PARAMETER);
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[Marshalls] Compact Variant decoding rejects truncated data") {
+	Dictionary dictionary;
+	dictionary["position"] = Vector3(1, 2, 3);
+	dictionary["names"] = PackedStringArray({ "a", "b" });
+	int size = 0;
+	CHECK(encode_variant_compact(dictionary, nullptr, size) == OK);
+	Vector<uint8_t> buffer;
+	buffer.resize(size);
+	CHECK(encode_variant_compact(dictionary, buffer.ptrw(), size) == OK);
+
+	ERR_PRINT_OFF;
+	for (int i = 0; i < size; i++) {
+		Variant decoded;
+		CHECK(decode_variant_compact(decoded, buffer.ptr(), i) != OK);
+	}
+	ERR_PRINT_ON;
+}
+
+TEST_CASE_BENCHMARK("[Marshalls][Benchmark] Compact against regular Variant encoding") {
+	const int iterations = 100000;
+
+	// Shaped like typical RPC arguments.
+	Array args = { 42, 0.5, Vector3(1.5, 2, -3), "player_1", true, Vector2i(10, 20) };
+	Dictionary state;
+	state["id"] = 7;
+	state["health"] = 100;
+	state["position"] = Vector3(10, 0, -5);
+	args.push_back(state);
+	PackedByteArray payload;
+	payload.resize(256);
+	args.push_back(payload);
+
+	int regular_size = 0;
+	encode_variant(args, nullptr, regular_size);
+	Vector<uint8_t> regular;
+	regular.resize(regular_size);
+
+	int compact_size = 0;
+	encode_variant_compact(args, nullptr, compact_size);
+	Vector<uint8_t> compact;
+	compact.resize(compact_size);
+
+	int size = 0;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		encode_variant(args, regular.ptrw(), size);
+	}
+	const uint64_t regular_encode = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		encode_variant_compact(args, compact.ptrw(), size);
+	}
+	const uint64_t compact_encode = OS::get_singleton()->get_ticks_usec() - begin;
+
+	Variant decoded;
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		decode_variant(decoded, regular.ptr(), regular.size());
+	}
+	const uint64_t regular_decode = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		decode_variant_compact(decoded, compact.ptr(), compact.size());
+	}
+	const uint64_t compact_decode = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("Size: regular %d bytes, compact %d bytes.", regular_size, compact_size).utf8().get_data());
+	MESSAGE(vformat("Encode: regular %d usec, compact %d usec.", regular_encode, compact_encode).utf8().get_data());
+	MESSAGE(vformat("Decode: regular %d usec, compact %d usec.", regular_decode, compact_decode).utf8().get_data());
+	CHECK(decoded == Variant(args));
+	CHECK(compact_size < regular_size);
+}
+
 } // namespace TestMarshalls
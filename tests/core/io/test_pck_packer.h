@@ -116,4 +116,35 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Pack a PCK file with compressed files") {
+	const String base_dir = OS::get_singleton()->get_executable_path().get_base_dir();
+	const String source_path = base_dir.path_join("../icon.svg");
+
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_uncompressed.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	REQUIRE(pck_packer.add_file("icon.svg", source_path) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	PCKPacker compressed_pck_packer;
+	const String output_compressed_pck_path = TestUtils::get_temp_path("output_compressed.pck");
+	CHECK_MESSAGE(
+			compressed_pck_packer.pck_start(output_compressed_pck_path) == OK,
+			"Starting a PCK file should return an OK error code.");
+	CHECK_MESSAGE(
+			compressed_pck_packer.add_file("icon.svg", source_path, false, true) == OK,
+			"Adding a compressed file to the PCK should return an OK error code.");
+	CHECK_MESSAGE(
+			compressed_pck_packer.flush() == OK,
+			"Flushing the PCK should return an OK error code.");
+
+	Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ);
+	Ref<FileAccess> fc = FileAccess::open(output_compressed_pck_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	REQUIRE(fc.is_valid());
+	CHECK_MESSAGE(
+			fc->get_length() < f->get_length(),
+			"The PCK with a compressed SVG file should be smaller than the uncompressed one.");
+}
 } // namespace TestPCKPacker
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/io/file_access_async.h"
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
@@ -579,6 +580,46 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Loading read ahead dependencies") {
+	const String save_path_parent = TestUtils::get_temp_path("prefetch_parent.res");
+	const String save_path_a = TestUtils::get_temp_path("prefetch_a.res");
+	const String save_path_b = TestUtils::get_temp_path("prefetch_b.tres");
+	{
+		Ref<Resource> child_a = memnew(Resource);
+		child_a->set_name("Child A");
+		ResourceSaver::save(child_a, save_path_a, ResourceSaver::FLAG_CHANGE_PATH);
+		Ref<Resource> child_b = memnew(Resource);
+		child_b->set_name("Child B");
+		ResourceSaver::save(child_b, save_path_b, ResourceSaver::FLAG_CHANGE_PATH);
+
+		Ref<Resource> parent = memnew(Resource);
+		parent->set_meta("a", child_a);
+		parent->set_meta("b", child_b);
+		ResourceSaver::save(parent, save_path_parent);
+	}
+
+#ifdef THREADS_ENABLED
+	// Nothing is cached anymore, so both dependencies can be read ahead.
+	FileAccessAsync::Batch *prefetched = ResourceLoader::prefetch_files({ save_path_a, save_path_b, save_path_a });
+	REQUIRE(prefetched != nullptr);
+	CHECK(prefetched->files.size() == 2);
+	Ref<FileAccess> f = ResourceLoader::open_prefetched(save_path_a);
+	CHECK(Object::cast_to<FileAccessAsync>(f.ptr()) != nullptr);
+	CHECK(f->get_length() == (uint64_t)FileAccess::get_file_as_bytes(save_path_a).size());
+	ResourceLoader::release_prefetched_files(prefetched);
+	CHECK(Object::cast_to<FileAccessAsync>(ResourceLoader::open_prefetched(save_path_b).ptr()) == nullptr);
+#endif
+
+	// The parent reads its dependencies ahead while loading them one by one.
+
+	const Ref<Resource> parent = ResourceLoader::load(save_path_parent);
+	REQUIRE(parent.is_valid());
+	const Ref<Resource> loaded_a = parent->get_meta("a");
+	const Ref<Resource> loaded_b = parent->get_meta("b");
+	CHECK(loaded_a->get_name() == "Child A");
+	CHECK(loaded_b->get_name() == "Child B");
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
@@ -0,0 +1,160 @@
+/**************************************************************************/
+/*  test_message_queue.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/message_queue.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMessageQueue {
+
+class CallRecorder : public Object {
+public:
+	LocalVector<int> calls;
+	CallQueue *queue = nullptr;
+
+	void record(int p_value) {
+		calls.push_back(p_value);
+	}
+
+	void record_and_push(int p_value) {
+		calls.push_back(p_value);
+		if (p_value > 0) {
+			queue->push_callable(callable_mp(this, &CallRecorder::record_and_push), p_value - 1);
+		}
+	}
+};
+
+TEST_CASE("[CallQueue] Calls run in push order") {
+	for (bool multi_producer : { false, true }) {
+		CallQueue queue(nullptr, 8192, String(), multi_producer);
+		CallRecorder recorder;
+
+		CHECK_FALSE(queue.has_messages());
+		for (int i = 0; i < 1000; i++) {
+			CHECK(queue.push_callable(callable_mp(&recorder, &CallRecorder::record), i) == OK);
+		}
+		CHECK(queue.has_messages());
+
+		CHECK(queue.flush() == OK);
+		CHECK_FALSE(queue.has_messages());
+		REQUIRE(recorder.calls.size() == 1000);
+		for (int i = 0; i < 1000; i++) {
+			CHECK(recorder.calls[i] == i);
+		}
+	}
+}
+
+TEST_CASE("[CallQueue] Calls pushed while flushing run in the same flush") {
+	for (bool multi_producer : { false, true }) {
+		CallQueue queue(nullptr, 8192, String(), multi_producer);
+		CallRecorder recorder;
+		recorder.queue = &queue;
+
+		queue.push_callable(callable_mp(&recorder, &CallRecorder::record_and_push), 3);
+		CHECK(queue.flush() == OK);
+		CHECK_FALSE(queue.has_messages());
+		REQUIRE(recorder.calls.size() == 4);
+		CHECK(recorder.calls[0] == 3);
+		CHECK(recorder.calls[3] == 0);
+	}
+}
+
+TEST_CASE("[CallQueue] Clear drops pending calls") {
+	for (bool multi_producer : { false, true }) {
+		CallQueue queue(nullptr, 8192, String(), multi_producer);
+		CallRecorder recorder;
+
+		queue.push_callable(callable_mp(&recorder, &CallRecorder::record), 1);
+		queue.clear();
+		CHECK_FALSE(queue.has_messages());
+		CHECK(queue.flush() == OK);
+		CHECK(recorder.calls.is_empty());
+	}
+}
+
+#ifdef THREADS_ENABLED
+struct ProducerData {
+	CallQueue *queue = nullptr;
+	CallRecorder *recorder = nullptr;
+	int index = 0;
+};
+
+static const int PRODUCER_COUNT = 4;
+static const int CALLS_PER_PRODUCER = 2000;
+
+static void _producer_func(void *p_userdata) {
+	ProducerData *data = (ProducerData *)p_userdata;
+	for (int i = 0; i < CALLS_PER_PRODUCER; i++) {
+		data->queue->push_callable(callable_mp(data->recorder, &CallRecorder::record), data->index * CALLS_PER_PRODUCER + i);
+	}
+}
+
+TEST_CASE("[CallQueue] Multi-producer queue keeps the order of each thread") {
+	CallQueue queue(nullptr, 8192, String(), true);
+	CallRecorder recorder;
+
+	ProducerData data[PRODUCER_COUNT];
+	Thread threads[PRODUCER_COUNT];
+	for (int i = 0; i < PRODUCER_COUNT; i++) {
+		data[i].queue = &queue;
+		data[i].recorder = &recorder;
+		data[i].index = i;
+		threads[i].start(_producer_func, &data[i]);
+	}
+
+	// Flush while the producers are still pushing.
+	while (recorder.calls.size() < uint32_t(PRODUCER_COUNT * CALLS_PER_PRODUCER)) {
+		CHECK(queue.flush() == OK);
+	}
+	for (int i = 0; i < PRODUCER_COUNT; i++) {
+		threads[i].wait_to_finish();
+	}
+	CHECK(queue.flush() == OK);
+
+	REQUIRE(recorder.calls.size() == uint32_t(PRODUCER_COUNT * CALLS_PER_PRODUCER));
+	int last[PRODUCER_COUNT];
+	for (int i = 0; i < PRODUCER_COUNT; i++) {
+		last[i] = -1;
+	}
+	bool ordered = true;
+	for (int value : recorder.calls) {
+		int producer = value / CALLS_PER_PRODUCER;
+		int index = value % CALLS_PER_PRODUCER;
+		ordered = ordered && index == last[producer] + 1;
+		last[producer] = index;
+	}
+	CHECK(ordered);
+}
+#endif // THREADS_ENABLED
+
+} // namespace TestMessageQueue
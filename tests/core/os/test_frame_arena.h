@@ -0,0 +1,215 @@
+/**************************************************************************/
+/*  test_frame_arena.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/frame_arena.h"
+#include "core/string/ustring.h"
+#include "core/templates/frame_vector.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFrameArena {
+
+TEST_CASE("[FrameArena] Memory freed in reverse order is reclaimed") {
+	FrameArena arena;
+
+	uint8_t *a = (uint8_t *)arena.alloc(100);
+	uint8_t *b = (uint8_t *)arena.alloc(100);
+	CHECK(b > a);
+	CHECK(arena.get_live_allocations() == 2);
+
+	arena.free(b, 100);
+	uint8_t *c = (uint8_t *)arena.alloc(50);
+	CHECK(c == b);
+
+	arena.free(c, 50);
+	arena.free(a, 100);
+	CHECK(arena.get_live_allocations() == 0);
+	CHECK(arena.alloc(10) == a);
+}
+
+TEST_CASE("[FrameArena] Latest allocation grows in place") {
+	FrameArena arena;
+
+	int *a = (int *)arena.alloc(4 * sizeof(int));
+	for (int i = 0; i < 4; i++) {
+		a[i] = i;
+	}
+	int *b = (int *)arena.realloc(a, 4 * sizeof(int), 64 * sizeof(int));
+	CHECK(b == a);
+
+	arena.alloc(16);
+	int *c = (int *)arena.realloc(b, 64 * sizeof(int), 128 * sizeof(int));
+	CHECK(c != b);
+	for (int i = 0; i < 4; i++) {
+		CHECK(c[i] == i);
+	}
+}
+
+TEST_CASE("[FrameArena] Reset merges blocks and skips live allocations") {
+	FrameArena arena;
+
+	const size_t size = 48 * 1024;
+	void *a = arena.alloc(size);
+	void *b = arena.alloc(size);
+	void *c = arena.alloc(size);
+	const size_t total_size = arena.get_total_size();
+	CHECK(total_size >= 3 * size);
+
+	arena.reset();
+	CHECK_MESSAGE(arena.get_total_size() == total_size, "Reset must do nothing while allocations are alive.");
+
+	arena.free(c, size);
+	arena.free(b, size);
+	arena.free(a, size);
+	arena.reset();
+	CHECK(arena.get_total_size() == total_size);
+
+	// The next frame fits into the merged block.
+	uint8_t *d = (uint8_t *)arena.alloc(size);
+	uint8_t *e = (uint8_t *)arena.alloc(size);
+	uint8_t *f = (uint8_t *)arena.alloc(size);
+	CHECK(e == d + size);
+	CHECK(f == e + size);
+	CHECK(arena.get_total_size() == total_size);
+}
+
+TEST_CASE("[FrameArena] Allocations outliving the frame don't make the arena grow") {
+	FrameArena arena;
+
+	// Kept for many frames, so reset() always sees a live allocation.
+	int *kept = (int *)arena.alloc(sizeof(int));
+	*kept = 42;
+
+	const size_t size = 48 * 1024;
+	size_t total_size = 0;
+	for (int frame = 0; frame < 100; frame++) {
+		void *a = arena.alloc(size);
+		void *b = arena.alloc(size);
+		// Not released in reverse order, so nothing is reclaimed until the whole block is free.
+		arena.free(a, size);
+		arena.free(b, size);
+		arena.reset();
+
+		if (frame == 10) {
+			total_size = arena.get_total_size();
+		}
+	}
+	CHECK(arena.get_total_size() == total_size);
+	CHECK(arena.get_live_allocations() == 1);
+	CHECK(*kept == 42);
+
+	arena.free(kept, sizeof(int));
+	arena.reset();
+	CHECK(arena.get_total_size() == total_size);
+}
+
+TEST_CASE("[FrameVector] Push back, resize and nested vectors") {
+	const uint32_t live_before = FrameArena::get_thread_arena().get_live_allocations();
+	{
+		FrameVector<String> outer;
+		for (int i = 0; i < 100; i++) {
+			FrameVector<int> inner;
+			for (int j = 0; j <= i; j++) {
+				inner.push_back(j);
+			}
+			CHECK(inner.size() == uint32_t(i + 1));
+			outer.push_back(itos(inner[i]));
+		}
+		REQUIRE(outer.size() == 100);
+		CHECK(outer[0] == "0");
+		CHECK(outer[99] == "99");
+
+		outer.resize(10);
+		CHECK(outer.size() == 10);
+		outer.resize(20);
+		CHECK(outer[19].is_empty());
+
+		int count = 0;
+		for (const String &s : outer) {
+			count += s.is_empty() ? 0 : 1;
+		}
+		CHECK(count == 10);
+	}
+	CHECK(FrameArena::get_thread_arena().get_live_allocations() == live_before);
+}
+
+TEST_CASE("[FrameVector] Sorting") {
+	FrameVector<int> list;
+	for (int i = 0; i < 50; i++) {
+		list.push_back((i * 37) % 50);
+	}
+	list.sort();
+	for (int i = 0; i < 50; i++) {
+		CHECK(list[i] == i);
+	}
+
+	struct Descending {
+		bool operator()(int p_a, int p_b) const { return p_a > p_b; }
+	};
+	list.sort_custom<Descending>();
+	CHECK(list[0] == 49);
+	CHECK(list[49] == 0);
+}
+
+TEST_CASE_BENCHMARK("[FrameArena][Benchmark] Heap allocations of temporary lists per frame") {
+	const int frames = 1000;
+	const int lists_per_frame = 64;
+
+	uint64_t begin = Memory::get_alloc_count();
+	for (int frame = 0; frame < frames; frame++) {
+		for (int i = 0; i < lists_per_frame; i++) {
+			LocalVector<int> list;
+			for (int j = 0; j < 100; j++) {
+				list.push_back(j);
+			}
+		}
+	}
+	const uint64_t local_vector_allocs = Memory::get_alloc_count() - begin;
+
+	begin = Memory::get_alloc_count();
+	for (int frame = 0; frame < frames; frame++) {
+		for (int i = 0; i < lists_per_frame; i++) {
+			FrameVector<int> list;
+			for (int j = 0; j < 100; j++) {
+				list.push_back(j);
+			}
+		}
+		FrameArena::get_thread_arena().reset();
+	}
+	const uint64_t frame_vector_allocs = Memory::get_alloc_count() - begin;
+
+	MESSAGE(vformat("Heap allocations per frame: LocalVector %d, FrameVector %d.", local_vector_allocs / frames, frame_vector_allocs / frames).utf8().get_data());
+	CHECK(frame_vector_allocs <= local_vector_allocs);
+}
+
+} // namespace TestFrameArena
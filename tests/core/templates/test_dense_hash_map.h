@@ -0,0 +1,170 @@
+/**************************************************************************/
+/*  test_dense_hash_map.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/dense_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestDenseHashMap {
+
+TEST_CASE("[DenseHashMap] List initialization") {
+	DenseHashMap<int, String> map{ { 0, "A" }, { 1, "B" }, { 2, "C" }, { 3, "D" }, { 4, "E" } };
+
+	CHECK(map.size() == 5);
+	CHECK(map[0] == "A");
+	CHECK(map[1] == "B");
+	CHECK(map[2] == "C");
+	CHECK(map[3] == "D");
+	CHECK(map[4] == "E");
+}
+
+TEST_CASE("[DenseHashMap] Insert and overwrite element") {
+	DenseHashMap<int, int> map;
+	DenseHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+
+	map.insert(42, 1234);
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+}
+
+TEST_CASE("[DenseHashMap] Erase via key") {
+	DenseHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(43, 85);
+	CHECK(map.erase(42));
+	CHECK_FALSE(map.erase(42));
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+	CHECK(map.has(43));
+	CHECK(map.size() == 1);
+}
+
+TEST_CASE("[DenseHashMap] Insertion order is kept across erase") {
+	DenseHashMap<int, int> map;
+	for (int i = 0; i < 100; i++) {
+		map.insert(i, i * 2);
+	}
+	// Erase enough entries to trigger compaction.
+	for (int i = 0; i < 100; i++) {
+		if (i % 3 != 0) {
+			map.erase(i);
+		}
+	}
+	map.insert(-1, -2);
+
+	int expected = 0;
+	for (const KeyValue<int, int> &E : map) {
+		if (expected == 102) {
+			CHECK(E.key == -1);
+			CHECK(E.value == -2);
+			break;
+		}
+		CHECK(E.key == expected);
+		CHECK(E.value == expected * 2);
+		expected += 3;
+	}
+	CHECK(expected == 102);
+	CHECK(map.size() == 35);
+
+	for (int i = 0; i < 100; i++) {
+		CHECK(map.has(i) == (i % 3 == 0));
+	}
+}
+
+TEST_CASE("[DenseHashMap] Small maps use linear scan") {
+	DenseHashMap<String, int> map;
+	for (int i = 0; i < (int)DenseHashMap<String, int>::LINEAR_SCAN_LIMIT; i++) {
+		map[itos(i)] = i;
+	}
+	for (int i = 0; i < (int)DenseHashMap<String, int>::LINEAR_SCAN_LIMIT; i++) {
+		CHECK(map[itos(i)] == i);
+	}
+
+	// Growing past the limit builds the index.
+	map["last"] = -1;
+	CHECK(map.size() == DenseHashMap<String, int>::LINEAR_SCAN_LIMIT + 1);
+	CHECK(map["last"] == -1);
+	CHECK(map["0"] == 0);
+}
+
+TEST_CASE("[DenseHashMap] Pointers stay valid when growing") {
+	DenseHashMap<int, int> map;
+	map[0] = 42;
+	const int *value = map.getptr(0);
+	for (int i = 1; i < 1000; i++) {
+		map[i] = i;
+	}
+	CHECK(value == map.getptr(0));
+	CHECK(*value == 42);
+}
+
+TEST_CASE("[DenseHashMap] Reverse iteration") {
+	DenseHashMap<int, int> map;
+	map.insert(1, 1);
+	map.insert(2, 2);
+	map.insert(3, 3);
+	map.erase(2);
+
+	DenseHashMap<int, int>::Iterator it = map.last();
+	CHECK(it->key == 3);
+	--it;
+	CHECK(it->key == 1);
+	--it;
+	CHECK(!it);
+}
+
+TEST_CASE("[DenseHashMap] Copy and clear") {
+	DenseHashMap<int, int> map;
+	for (int i = 0; i < 20; i++) {
+		map.insert(i, i);
+	}
+	map.erase(5);
+
+	DenseHashMap<int, int> copy = map;
+	CHECK(copy.size() == 19);
+	CHECK(!copy.has(5));
+	CHECK(copy[19] == 19);
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(!map.begin());
+	CHECK(copy.size() == 19);
+}
+
+} // namespace TestDenseHashMap
@@ -0,0 +1,328 @@
+/**************************************************************************/
+/*  test_variant_call_site.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/resource.h"
+#include "core/object/ref_counted.h"
+#include "core/os/os.h"
+#include "core/variant/variant_call_site.h"
+
+#include "tests/test_macros.h"
+
+namespace TestVariantCallSite {
+
+TEST_CASE("[VariantCallSite] Builtin method calls") {
+	VariantCallSite length("length");
+	Callable::CallError ce;
+	Variant ret;
+
+	Variant str = "Godot";
+	length.call(str, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(ret == Variant(5));
+
+	// Repeated call on the same type uses the cached method.
+	Variant other_str = "Engine!";
+	length.call(other_str, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(ret == Variant(7));
+
+	// Switching receiver type resolves the method again.
+	Variant vec = Vector2(3, 4);
+	length.call(vec, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(ret == Variant(5.0));
+
+	length.call(str, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(ret == Variant(5));
+}
+
+TEST_CASE("[VariantCallSite] Default arguments and errors") {
+	VariantCallSite pad("pad_zeros");
+	Callable::CallError ce;
+	Variant ret;
+
+	Variant str = "1.5";
+	Variant digits = 3;
+	const Variant *args[1] = { &digits };
+	pad.call(str, args, 1, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(ret == Variant("001.5"));
+
+	pad.call(str, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_ERROR_TOO_FEW_ARGUMENTS);
+
+	VariantCallSite missing("this_method_does_not_exist");
+	missing.call(str, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD);
+
+	Variant null_object = (Object *)nullptr;
+	missing.call(null_object, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_ERROR_INSTANCE_IS_NULL);
+}
+
+TEST_CASE("[VariantCallSite] Object method calls") {
+	VariantCallSite get_class("get_class");
+	Callable::CallError ce;
+	Variant ret;
+
+	Object *object = memnew(Object);
+	Variant object_var = object;
+	get_class.call(object_var, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(ret == Variant("Object"));
+
+	// Derived class with a different class name must not reuse the cached entry blindly.
+	Ref<RefCounted> ref_counted;
+	ref_counted.instantiate();
+	Variant ref_counted_var = ref_counted;
+	get_class.call(ref_counted_var, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(ret == Variant("RefCounted"));
+
+	VariantCallSite get_reference_count("get_reference_count");
+	get_reference_count.call(object_var, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD);
+	get_reference_count.call(ref_counted_var, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(ret == Variant(2)); // One from the Ref, one from the Variant.
+
+	// "free" is never cached and goes through Object::callp().
+	VariantCallSite free_site("free");
+	free_site.call(object_var, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+}
+
+// Like JavaScriptObject or JavaObject, it resolves its own methods before the ones in ClassDB.
+class CustomCallObject : public RefCounted {
+	GDSOFTCLASS(CustomCallObject, RefCounted);
+
+public:
+	virtual Variant callp(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error) override {
+		if (p_method == SNAME("get_class")) {
+			r_error.error = Callable::CallError::CALL_OK;
+			return "Custom";
+		}
+		return RefCounted::callp(p_method, p_args, p_argcount, r_error);
+	}
+};
+
+class DerivedCustomCallObject : public CustomCallObject {
+	GDSOFTCLASS(DerivedCustomCallObject, CustomCallObject);
+};
+
+TEST_CASE("[VariantCallSite] Objects overriding callp()") {
+	VariantCallSite get_class("get_class");
+	Callable::CallError ce;
+	Variant ret;
+
+	// Cache the MethodBind of RefCounted first. The overrides report the same class name, but must not reuse it.
+	Ref<RefCounted> ref_counted;
+	ref_counted.instantiate();
+	CHECK_FALSE(ref_counted->_has_custom_callp());
+	Variant ref_counted_var = ref_counted;
+	get_class.call(ref_counted_var, nullptr, 0, ret, ce);
+	CHECK(ret == Variant("RefCounted"));
+
+	Ref<CustomCallObject> custom;
+	custom.instantiate();
+	CHECK(custom->_has_custom_callp());
+	Variant custom_var = custom;
+	get_class.call(custom_var, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(ret == Variant("Custom"));
+
+	// Inherited overrides are detected too.
+	Ref<DerivedCustomCallObject> derived;
+	derived.instantiate();
+	CHECK(derived->_has_custom_callp());
+	Variant derived_var = derived;
+	get_class.call(derived_var, nullptr, 0, ret, ce);
+	CHECK(ret == Variant("Custom"));
+
+	// Methods the override doesn't handle still reach ClassDB through it.
+	VariantCallSite get_reference_count("get_reference_count");
+	get_reference_count.call(custom_var, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(ret == Variant(2));
+}
+
+TEST_CASE("[VariantCallSite] Polymorphic receivers") {
+	VariantCallSite length("length");
+	Callable::CallError ce;
+	Variant ret;
+
+	// More receiver types than cache entries, so the oldest ones are replaced.
+	Variant receivers[] = { "abc", Vector2(3, 4), Vector3(0, 0, 2), Vector4(0, 0, 0, 1), Vector2i(0, 6), Vector3i(0, 3, 4), String("abcdef") };
+	const Variant expected[] = { 3, 5.0, 2.0, 1.0, 6.0, 5.0, 6 };
+	for (int round = 0; round < 3; round++) {
+		for (int i = 0; i < 7; i++) {
+			length.call(receivers[i], nullptr, 0, ret, ce);
+			CHECK(ce.error == Callable::CallError::CALL_OK);
+			CHECK(ret == expected[i]);
+		}
+	}
+}
+
+TEST_CASE("[VariantPropertySite] Object properties") {
+	VariantPropertySite resource_name("resource_name");
+	bool valid = false;
+	Variant ret;
+
+	Ref<Resource> resource;
+	resource.instantiate();
+	Variant resource_var = resource;
+	resource_name.set(resource_var, "first", valid);
+	CHECK(valid);
+	CHECK(resource->get_name() == "first");
+
+	resource_name.get(resource_var, ret, valid);
+	CHECK(valid);
+	CHECK(ret == Variant("first"));
+
+	// Cached setter and getter are used for another object of the same class.
+	Ref<Resource> other;
+	other.instantiate();
+	Variant other_var = other;
+	resource_name.set(other_var, "second", valid);
+	CHECK(valid);
+	resource_name.get(other_var, ret, valid);
+	CHECK(valid);
+	CHECK(ret == Variant("second"));
+	resource_name.get(resource_var, ret, valid);
+	CHECK(ret == Variant("first"));
+
+	// Classes without the property report it as invalid.
+	Ref<RefCounted> ref_counted;
+	ref_counted.instantiate();
+	Variant ref_counted_var = ref_counted;
+	resource_name.get(ref_counted_var, ret, valid);
+	CHECK_FALSE(valid);
+	resource_name.set(ref_counted_var, "third", valid);
+	CHECK_FALSE(valid);
+
+	// Methods are not properties, but can be read as a Callable.
+	VariantPropertySite get_name("get_name");
+	get_name.get(resource_var, ret, valid);
+	CHECK(valid);
+	CHECK(ret.get_type() == Variant::CALLABLE);
+
+	Variant null_object = (Object *)nullptr;
+	resource_name.get(null_object, ret, valid);
+	CHECK_FALSE(valid);
+}
+
+TEST_CASE("[VariantPropertySite] Builtin members and dictionary keys") {
+	VariantPropertySite x("x");
+	bool valid = false;
+	Variant ret;
+
+	Variant vec = Vector2(1, 2);
+	x.get(vec, ret, valid);
+	CHECK(valid);
+	CHECK(ret == Variant(1.0));
+	x.set(vec, 5.0, valid);
+	CHECK(valid);
+	CHECK(vec == Variant(Vector2(5, 2)));
+
+	Dictionary dict;
+	dict["x"] = 3;
+	Variant dict_var = dict;
+	x.get(dict_var, ret, valid);
+	CHECK(valid);
+	CHECK(ret == Variant(3));
+}
+
+TEST_CASE_BENCHMARK("[VariantCallSite][Benchmark] Cached calls against Variant::callp()") {
+	const int iterations = 1000000;
+	const StringName length_name = "length";
+	const StringName get_class_name = "get_class";
+	Callable::CallError ce;
+	Variant ret;
+
+	Variant vec = Vector3(1, 2, 3);
+	Ref<RefCounted> ref_counted;
+	ref_counted.instantiate();
+	Variant object_var = ref_counted;
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		vec.callp(length_name, nullptr, 0, ret, ce);
+	}
+	const uint64_t builtin_callp = OS::get_singleton()->get_ticks_usec() - begin;
+
+	VariantCallSite length_site(length_name);
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		length_site.call(vec, nullptr, 0, ret, ce);
+	}
+	const uint64_t builtin_site = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		object_var.callp(get_class_name, nullptr, 0, ret, ce);
+	}
+	const uint64_t object_callp = OS::get_singleton()->get_ticks_usec() - begin;
+
+	VariantCallSite get_class_site(get_class_name);
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		get_class_site.call(object_var, nullptr, 0, ret, ce);
+	}
+	const uint64_t object_site = OS::get_singleton()->get_ticks_usec() - begin;
+
+	const StringName resource_name = "resource_name";
+	Ref<Resource> resource;
+	resource.instantiate();
+	Variant resource_var = resource;
+	bool valid = false;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		ret = resource_var.get_named(resource_name, valid);
+	}
+	const uint64_t property_get_named = OS::get_singleton()->get_ticks_usec() - begin;
+
+	VariantPropertySite resource_name_site(resource_name);
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		resource_name_site.get(resource_var, ret, valid);
+	}
+	const uint64_t property_site = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("Builtin Vector3.length(): callp %d usec, call site %d usec.", builtin_callp, builtin_site).utf8().get_data());
+	MESSAGE(vformat("Resource.resource_name: get_named %d usec, property site %d usec.", property_get_named, property_site).utf8().get_data());
+	MESSAGE(vformat("Object get_class(): callp %d usec, call site %d usec.", object_callp, object_site).utf8().get_data());
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+}
+
+} // namespace TestVariantCallSite
@@ -0,0 +1,135 @@
+/**************************************************************************/
+/*  test_cpu_particles_2d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/2d/cpu_particles_2d.h"
+#include "scene/main/window.h"
+#include "scene/resources/gradient.h"
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCPUParticles2D {
+
+static const int particle_amount = 3000;
+static const int buffer_stride = 16;
+
+static RID get_multimesh(CPUParticles2D *p_particles) {
+	const RendererCanvasCull::Item *item = RSG::canvas->canvas_item_owner.get_or_null(p_particles->get_canvas_item());
+	for (const RendererCanvasRender::Item::Command *c = item ? item->commands : nullptr; c; c = c->next) {
+		if (c->type == RendererCanvasRender::Item::Command::TYPE_MULTIMESH) {
+			return static_cast<const RendererCanvasRender::Item::CommandMultiMesh *>(c)->multimesh;
+		}
+	}
+	return RID();
+}
+
+// Runs the same seeded emitter for a number of frames and returns the uploaded particle buffer.
+static Vector<float> simulate(bool p_threaded, bool p_fractional_delta, bool p_local_coords) {
+	const int previous_threshold = CPUParticles2D::get_threaded_process_threshold();
+	CPUParticles2D::set_threaded_process_threshold(p_threaded ? particle_amount : particle_amount + 1);
+
+	CPUParticles2D *particles = memnew(CPUParticles2D);
+	particles->set_amount(particle_amount);
+	particles->set_lifetime(0.5);
+	particles->set_lifetime_randomness(0.5);
+	particles->set_use_fixed_seed(true);
+	particles->set_seed(1234);
+	particles->set_fractional_delta(p_fractional_delta);
+	particles->set_use_local_coordinates(p_local_coords);
+	particles->set_emission_shape(CPUParticles2D::EMISSION_SHAPE_SPHERE);
+	particles->set_emission_sphere_radius(20);
+	particles->set_spread(60);
+	particles->set_param_min(CPUParticles2D::PARAM_INITIAL_LINEAR_VELOCITY, 50);
+	particles->set_param_max(CPUParticles2D::PARAM_INITIAL_LINEAR_VELOCITY, 150);
+	Ref<Gradient> color_ramp;
+	color_ramp.instantiate();
+	color_ramp->add_point(0.5, Color(1, 0, 0));
+	particles->set_color_ramp(color_ramp);
+	SceneTree::get_singleton()->get_root()->add_child(particles);
+
+	// The emitter moves, so world and local coordinates give different particles.
+	for (int i = 0; i < 40; i++) {
+		particles->set_position(Vector2(100 + i * 5, 50));
+		SceneTree::get_singleton()->process(1.0 / 60.0);
+	}
+	RS::get_singleton()->emit_signal(SNAME("frame_pre_draw"));
+
+	const Vector<float> buffer = RS::get_singleton()->multimesh_get_buffer(get_multimesh(particles));
+	memdelete(particles);
+	CPUParticles2D::set_threaded_process_threshold(previous_threshold);
+	return buffer;
+}
+
+static int count_alive(const Vector<float> &p_buffer) {
+	// Inactive particles are uploaded with a zero transform.
+	int alive = 0;
+	for (int i = 0; i < p_buffer.size(); i += buffer_stride) {
+		alive += (p_buffer[i] != 0.0f || p_buffer[i + 4] != 0.0f) ? 1 : 0;
+	}
+	return alive;
+}
+
+static void check_threaded_matches_serial(bool p_fractional_delta, bool p_local_coords) {
+	const Vector<float> serial = simulate(false, p_fractional_delta, p_local_coords);
+	const Vector<float> threaded = simulate(true, p_fractional_delta, p_local_coords);
+	REQUIRE(serial.size() == particle_amount * buffer_stride);
+	REQUIRE(threaded.size() == serial.size());
+
+	const int alive = count_alive(serial);
+	CHECK(alive > 0);
+	CHECK(alive < particle_amount);
+	CHECK(count_alive(threaded) == alive);
+
+	int mismatches = 0;
+	for (int i = 0; i < serial.size(); i++) {
+		mismatches += serial[i] != threaded[i] ? 1 : 0;
+	}
+	CHECK_MESSAGE(mismatches == 0, "Threaded particles must match the serial simulation exactly.");
+}
+
+TEST_CASE("[SceneTree][CPUParticles2D] Threaded simulation matches the serial one") {
+	SUBCASE("Fractional delta, global coordinates") {
+		check_threaded_matches_serial(true, false);
+	}
+	SUBCASE("Fractional delta, local coordinates") {
+		check_threaded_matches_serial(true, true);
+	}
+	SUBCASE("Whole frames, global coordinates") {
+		check_threaded_matches_serial(false, false);
+	}
+	SUBCASE("Whole frames, local coordinates") {
+		check_threaded_matches_serial(false, true);
+	}
+}
+
+} // namespace TestCPUParticles2D
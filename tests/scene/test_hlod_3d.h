@@ -0,0 +1,160 @@
+/**************************************************************************/
+/*  test_hlod_3d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/3d/hlod_3d.h"
+#include "scene/3d/mesh_instance_3d.h"
+#include "scene/main/window.h"
+#include "scene/resources/3d/primitive_meshes.h"
+#include "scene/resources/surface_tool.h"
+
+#include "tests/test_macros.h"
+
+namespace TestHLOD3D {
+
+static MeshInstance3D *add_source(HLOD3D *p_hlod, const Ref<Mesh> &p_mesh, const Vector3 &p_position) {
+	MeshInstance3D *mi = memnew(MeshInstance3D);
+	mi->set_mesh(p_mesh);
+	mi->set_position(p_position);
+	p_hlod->add_child(mi);
+	return mi;
+}
+
+static int get_index_count(const Ref<Mesh> &p_mesh) {
+	int count = 0;
+	for (int i = 0; i < p_mesh->get_surface_count(); i++) {
+		count += PackedInt32Array(p_mesh->surface_get_arrays(i)[Mesh::ARRAY_INDEX]).size();
+	}
+	return count;
+}
+
+TEST_CASE("[SceneTree][HLOD3D] Bake merges sources into proxies") {
+	HLOD3D *hlod = memnew(HLOD3D);
+	SceneTree::get_singleton()->get_root()->add_child(hlod);
+
+	Ref<BoxMesh> box;
+	box.instantiate();
+	MeshInstance3D *a = add_source(hlod, box, Vector3(-5, 0, 0));
+	MeshInstance3D *b = add_source(hlod, box, Vector3(5, 0, 0));
+
+	hlod->set_distance(50.0);
+	hlod->set_simplify_ratio(1.0);
+
+	SUBCASE("Single cluster") {
+		CHECK(hlod->bake() == OK);
+		TypedArray<NodePath> proxies = hlod->get_proxies();
+		REQUIRE(proxies.size() == 1);
+
+		MeshInstance3D *proxy = Object::cast_to<MeshInstance3D>(hlod->get_node(proxies[0]));
+		REQUIRE(proxy != nullptr);
+		CHECK(proxy->get_visibility_range_begin() == doctest::Approx(50.0));
+		CHECK(a->get_node(a->get_visibility_parent()) == proxy);
+		CHECK(b->get_node(b->get_visibility_parent()) == proxy);
+
+		const AABB aabb = proxy->get_mesh()->get_aabb();
+		CHECK(aabb.position.is_equal_approx(Vector3(-5.5, -0.5, -0.5)));
+		CHECK(aabb.size.is_equal_approx(Vector3(11, 1, 1)));
+		CHECK(get_index_count(proxy->get_mesh()) == get_index_count(box) * 2);
+
+		hlod->set_distance(20.0);
+		CHECK(proxy->get_visibility_range_begin() == doctest::Approx(20.0));
+	}
+
+	SUBCASE("Cluster size splits distant sources") {
+		hlod->set_cluster_size(8.0);
+		CHECK(hlod->bake() == OK);
+		REQUIRE(hlod->get_proxies().size() == 2);
+		CHECK(a->get_node(a->get_visibility_parent()) != b->get_node(b->get_visibility_parent()));
+	}
+
+	SUBCASE("Rebaking replaces previous proxies") {
+		CHECK(hlod->bake() == OK);
+		CHECK(hlod->bake() == OK);
+		CHECK(hlod->get_proxies().size() == 1);
+		CHECK(hlod->get_child_count() == 3);
+	}
+
+	SUBCASE("Clear restores sources") {
+		CHECK(hlod->bake() == OK);
+		hlod->clear();
+		CHECK(hlod->get_proxies().is_empty());
+		CHECK(hlod->get_child_count() == 2);
+		CHECK(a->get_visibility_parent().is_empty());
+		CHECK(b->get_visibility_parent().is_empty());
+	}
+
+	SUBCASE("Sources using visibility ranges are skipped") {
+		a->set_visibility_range_end(10.0);
+		CHECK(hlod->bake() == OK);
+		CHECK(a->get_visibility_parent().is_empty());
+		CHECK_FALSE(b->get_visibility_parent().is_empty());
+	}
+
+	memdelete(hlod);
+}
+
+TEST_CASE("[SceneTree][HLOD3D] Bake simplifies proxies") {
+	if (!SurfaceTool::simplify_func) {
+		return;
+	}
+
+	HLOD3D *hlod = memnew(HLOD3D);
+	SceneTree::get_singleton()->get_root()->add_child(hlod);
+
+	Ref<SphereMesh> sphere;
+	sphere.instantiate();
+	add_source(hlod, sphere, Vector3());
+
+	hlod->set_simplify_ratio(0.25);
+	hlod->set_simplify_error(1.0);
+	CHECK(hlod->bake() == OK);
+	REQUIRE(hlod->get_proxies().size() == 1);
+
+	MeshInstance3D *proxy = Object::cast_to<MeshInstance3D>(hlod->get_node(hlod->get_proxies()[0]));
+	REQUIRE(proxy != nullptr);
+	const int index_count = get_index_count(proxy->get_mesh());
+	CHECK(index_count > 0);
+	CHECK(index_count <= get_index_count(sphere) / 4);
+
+	memdelete(hlod);
+}
+
+TEST_CASE("[SceneTree][HLOD3D] Bake without sources") {
+	HLOD3D *hlod = memnew(HLOD3D);
+	SceneTree::get_singleton()->get_root()->add_child(hlod);
+
+	CHECK(hlod->bake() == ERR_CANT_CREATE);
+	CHECK(hlod->get_proxies().is_empty());
+
+	memdelete(hlod);
+}
+
+} // namespace TestHLOD3D
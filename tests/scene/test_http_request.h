@@ -0,0 +1,336 @@
+/**************************************************************************/
+/*  test_http_request.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/dir_access.h"
+#include "core/io/stream_peer_tcp.h"
+#include "core/io/tcp_server.h"
+#include "scene/main/http_request.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestHTTPRequest {
+
+const int PORT = 12346;
+const uint64_t MAX_WAIT_USEC = 10000000;
+
+// Minimal non-blocking HTTP/1.1 server serving a single payload, with support for byte ranges.
+class TestHTTPServer {
+	struct Connection {
+		Ref<StreamPeerTCP> peer;
+		String request;
+		PackedByteArray response;
+		int sent = 0;
+		bool cut = false;
+	};
+
+	Ref<TCPServer> server;
+	LocalVector<Connection> connections;
+
+	void _respond(Connection &p_connection) {
+		int64_t start = 0;
+		int64_t end = payload.size() - 1;
+		bool partial = false;
+		for (const String &line : p_connection.request.split("\r\n")) {
+			if (line.to_lower().begins_with("range: bytes=")) {
+				const String spec = line.substr(13);
+				start = spec.get_slicec('-', 0).to_int();
+				if (!spec.get_slicec('-', 1).is_empty()) {
+					end = spec.get_slicec('-', 1).to_int();
+				}
+				partial = true;
+				range_requests++;
+			}
+		}
+
+		String header;
+		if (partial && start >= payload.size()) {
+			header = "HTTP/1.1 416 Range Not Satisfiable\r\n";
+			header += vformat("Content-Range: bytes */%d\r\n", payload.size());
+			start = 0;
+			end = -1;
+		} else if (partial) {
+			header = "HTTP/1.1 206 Partial Content\r\n";
+			header += vformat("Content-Range: bytes %d-%d/%d\r\n", start, end, payload.size());
+		} else {
+			header = "HTTP/1.1 200 OK\r\n";
+		}
+		if (accept_ranges) {
+			header += "Accept-Ranges: bytes\r\n";
+		}
+		header += vformat("Content-Length: %d\r\n\r\n", end - start + 1);
+
+		int64_t body_size = end - start + 1;
+		p_connection.cut = max_body_bytes >= 0 && body_size > max_body_bytes;
+		if (p_connection.cut) {
+			body_size = max_body_bytes;
+		}
+
+		const CharString header_utf8 = header.utf8();
+		p_connection.response.resize(header_utf8.length() + body_size);
+		memcpy(p_connection.response.ptrw(), header_utf8.get_data(), header_utf8.length());
+		if (body_size > 0) {
+			memcpy(p_connection.response.ptrw() + header_utf8.length(), payload.ptr() + start, body_size);
+		}
+		p_connection.sent = 0;
+	}
+
+public:
+	PackedByteArray payload;
+	bool accept_ranges = true;
+	int64_t max_body_bytes = -1; // Drop the connection after sending this many body bytes.
+	int connection_count = 0;
+	int range_requests = 0;
+
+	void listen() {
+		server.instantiate();
+		REQUIRE_EQ(server->listen(PORT, IPAddress("127.0.0.1")), OK);
+	}
+
+	void poll() {
+		while (server->is_connection_available()) {
+			Connection connection;
+			connection.peer = server->take_connection();
+			connections.push_back(connection);
+			connection_count++;
+		}
+
+		for (uint32_t i = 0; i < connections.size(); i++) {
+			Connection &connection = connections[i];
+			connection.peer->poll();
+			if (connection.peer->get_status() != StreamPeerTCP::STATUS_CONNECTED) {
+				connections.remove_at(i--);
+				continue;
+			}
+
+			if (connection.response.is_empty()) {
+				uint8_t buffer[1024];
+				int received = 0;
+				connection.peer->get_partial_data(buffer, sizeof(buffer), received);
+				if (received > 0) {
+					connection.request += String::utf8((const char *)buffer, received);
+					if (connection.request.contains("\r\n\r\n")) {
+						_respond(connection);
+					}
+				}
+				continue;
+			}
+
+			int sent = 0;
+			connection.peer->put_partial_data(connection.response.ptr() + connection.sent, connection.response.size() - connection.sent, sent);
+			connection.sent += sent;
+			if (connection.sent == connection.response.size()) {
+				if (connection.cut) {
+					connection.peer->disconnect_from_host();
+					connections.remove_at(i--);
+				} else {
+					// Keep-alive, wait for the next request.
+					connection.request = String();
+					connection.response.clear();
+				}
+			}
+		}
+	}
+
+	void stop() {
+		connections.clear();
+		server->stop();
+	}
+};
+
+class RequestWatcher : public Object {
+public:
+	bool completed = false;
+	int result = -1;
+	int response_code = 0;
+	PackedByteArray body;
+
+	void _on_request_completed(int p_result, int p_response_code, const PackedStringArray &p_headers, const PackedByteArray &p_body) {
+		completed = true;
+		result = p_result;
+		response_code = p_response_code;
+		body = p_body;
+	}
+};
+
+static PackedByteArray make_payload(int p_size) {
+	PackedByteArray payload;
+	payload.resize(p_size);
+	for (int i = 0; i < p_size; i++) {
+		payload.write[i] = (i * 7 + (i >> 8)) & 0xFF;
+	}
+	return payload;
+}
+
+static void run_request(TestHTTPServer &p_server, HTTPRequest *p_request, RequestWatcher *p_watcher) {
+	p_watcher->completed = false;
+	REQUIRE_EQ(p_request->request(vformat("http://127.0.0.1:%d/payload.bin", PORT)), OK);
+
+	const uint64_t start = OS::get_singleton()->get_ticks_usec();
+	while (!p_watcher->completed && OS::get_singleton()->get_ticks_usec() - start < MAX_WAIT_USEC) {
+		p_server.poll();
+		SceneTree::get_singleton()->process(0);
+		OS::get_singleton()->delay_usec(100);
+	}
+	REQUIRE_MESSAGE(p_watcher->completed, "The request should complete in time.");
+}
+
+static PackedByteArray read_file(const String &p_path) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	return f->get_buffer(f->get_length());
+}
+
+TEST_CASE("[SceneTree][HTTPRequest] Download into the body and into a file") {
+	TestHTTPServer server;
+	server.payload = make_payload(300000);
+	server.listen();
+
+	HTTPRequest *request = memnew(HTTPRequest);
+	SceneTree::get_singleton()->get_root()->add_child(request);
+	RequestWatcher *watcher = memnew(RequestWatcher);
+	request->connect("request_completed", callable_mp(watcher, &RequestWatcher::_on_request_completed));
+
+	run_request(server, request, watcher);
+	CHECK_EQ(watcher->result, HTTPRequest::RESULT_SUCCESS);
+	CHECK_EQ(watcher->response_code, 200);
+	CHECK_MESSAGE(watcher->body == server.payload, "The body should match the payload.");
+
+	const String path = TestUtils::get_temp_path("http_request_download.bin");
+	request->set_download_file(path);
+	run_request(server, request, watcher);
+	CHECK_EQ(watcher->result, HTTPRequest::RESULT_SUCCESS);
+	CHECK(watcher->body.is_empty());
+	CHECK_MESSAGE(read_file(path) == server.payload, "The downloaded file should match the payload.");
+
+	memdelete(request);
+	memdelete(watcher);
+	server.stop();
+}
+
+TEST_CASE("[SceneTree][HTTPRequest] Resume an interrupted download") {
+	TestHTTPServer server;
+	server.payload = make_payload(300000);
+	server.max_body_bytes = 100000;
+	server.listen();
+
+	HTTPRequest *request = memnew(HTTPRequest);
+	SceneTree::get_singleton()->get_root()->add_child(request);
+	RequestWatcher *watcher = memnew(RequestWatcher);
+	request->connect("request_completed", callable_mp(watcher, &RequestWatcher::_on_request_completed));
+
+	const String path = TestUtils::get_temp_path("http_request_resume.bin");
+	request->set_download_file(path);
+	request->set_download_resume(true);
+	DirAccess::remove_absolute(path);
+
+	run_request(server, request, watcher);
+	CHECK_NE(watcher->result, HTTPRequest::RESULT_SUCCESS);
+	CHECK_EQ(read_file(path).size(), 100000);
+	CHECK_EQ(server.range_requests, 0);
+
+	server.max_body_bytes = -1;
+	run_request(server, request, watcher);
+	CHECK_EQ(watcher->result, HTTPRequest::RESULT_SUCCESS);
+	CHECK_EQ(watcher->response_code, 206);
+	CHECK_EQ(server.range_requests, 1);
+	CHECK_EQ(request->get_downloaded_bytes(), 200000);
+	CHECK_MESSAGE(read_file(path) == server.payload, "The resumed file should match the payload.");
+
+	// Nothing left to download.
+	run_request(server, request, watcher);
+	CHECK_EQ(watcher->result, HTTPRequest::RESULT_SUCCESS);
+	CHECK_EQ(watcher->response_code, 416);
+	CHECK_MESSAGE(read_file(path) == server.payload, "The complete file should be left untouched.");
+
+	memdelete(request);
+	memdelete(watcher);
+	server.stop();
+}
+
+TEST_CASE("[SceneTree][HTTPRequest] Download with several connections") {
+	TestHTTPServer server;
+	server.payload = make_payload(1000000);
+	server.listen();
+
+	HTTPRequest *request = memnew(HTTPRequest);
+	SceneTree::get_singleton()->get_root()->add_child(request);
+	RequestWatcher *watcher = memnew(RequestWatcher);
+	request->connect("request_completed", callable_mp(watcher, &RequestWatcher::_on_request_completed));
+
+	const String path = TestUtils::get_temp_path("http_request_ranges.bin");
+	request->set_download_file(path);
+	request->set_download_connections(4);
+
+	SUBCASE("Ranges are fetched concurrently") {
+		run_request(server, request, watcher);
+		CHECK_EQ(watcher->result, HTTPRequest::RESULT_SUCCESS);
+		CHECK_EQ(server.connection_count, 4);
+		CHECK_EQ(server.range_requests, 3);
+		CHECK_EQ(request->get_downloaded_bytes(), 1000000);
+		CHECK_MESSAGE(read_file(path) == server.payload, "The downloaded file should match the payload.");
+	}
+
+	SUBCASE("Servers without range support use a single connection") {
+		server.accept_ranges = false;
+		run_request(server, request, watcher);
+		CHECK_EQ(watcher->result, HTTPRequest::RESULT_SUCCESS);
+		CHECK_EQ(server.connection_count, 1);
+		CHECK_EQ(server.range_requests, 0);
+		CHECK_MESSAGE(read_file(path) == server.payload, "The downloaded file should match the payload.");
+	}
+
+	SUBCASE("Failed ranges leave a file that can be resumed") {
+		// Every connection drops after 50 KB, so the ranges run out of retries.
+		server.max_body_bytes = 50000;
+		run_request(server, request, watcher);
+		CHECK_NE(watcher->result, HTTPRequest::RESULT_SUCCESS);
+
+		const PackedByteArray partial = read_file(path);
+		CHECK(partial.size() > 0);
+		CHECK(partial.size() < server.payload.size());
+		CHECK_MESSAGE(partial == server.payload.slice(0, partial.size()), "Only the contiguous start of the download should be kept.");
+
+		server.max_body_bytes = -1;
+		request->set_download_resume(true);
+		run_request(server, request, watcher);
+		CHECK_EQ(watcher->result, HTTPRequest::RESULT_SUCCESS);
+		CHECK_MESSAGE(read_file(path) == server.payload, "The resumed file should match the payload.");
+	}
+
+	memdelete(request);
+	memdelete(watcher);
+	server.stop();
+}
+
+} // namespace TestHTTPRequest
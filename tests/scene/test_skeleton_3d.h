@@ -33,6 +33,8 @@
 #include "tests/test_macros.h"
 
 #include "scene/3d/skeleton_3d.h"
+#include "scene/main/window.h"
+#include "scene/resources/3d/skin.h"
 
 namespace TestSkeleton3D {
 
@@ -72,4 +74,67 @@ TEST_CASE("[Skeleton3D] Test per-bone meta") {
 	skeleton->set_bone_meta(0, "non-existing-key", Variant());
 	memdelete(skeleton);
 }
+
+TEST_CASE("[SceneTree][Skeleton3D] Skeletons updated in the same frame are prepared together") {
+	const int skeleton_count = 8;
+	const int bone_count = 16;
+
+	Window *root = SceneTree::get_singleton()->get_root();
+	Vector<Skeleton3D *> skeletons;
+	Vector<Ref<SkinReference>> skin_refs;
+	for (int i = 0; i < skeleton_count; i++) {
+		Skeleton3D *skeleton = memnew(Skeleton3D);
+		Ref<Skin> skin;
+		skin.instantiate();
+		for (int j = 0; j < bone_count; j++) {
+			skeleton->add_bone(vformat("bone_%d", j));
+			if (j > 0) {
+				skeleton->set_bone_parent(j, j - 1);
+			}
+			skeleton->set_bone_rest(j, Transform3D(Basis(), Vector3(0, 1, 0)));
+			skin->add_named_bind(vformat("bone_%d", j), Transform3D(Basis(), Vector3(0, 0, 1)));
+		}
+		root->add_child(skeleton);
+		skin_refs.push_back(skeleton->register_skin(skin));
+		skeletons.push_back(skeleton);
+	}
+	SceneTree::get_singleton()->process(0);
+
+	SIGNAL_WATCH(skeletons[0], "skeleton_updated");
+	for (int i = 0; i < skeleton_count; i++) {
+		for (int j = 0; j < bone_count; j++) {
+			skeletons[i]->set_bone_pose_position(j, Vector3(i, 1, 0));
+		}
+	}
+	const uint64_t prepared_before = Skeleton3D::get_prepared_update_count();
+	SceneTree::get_singleton()->process(0);
+	Array empty_signal_args = { {} };
+	SIGNAL_CHECK("skeleton_updated", empty_signal_args);
+	SIGNAL_UNWATCH(skeletons[0], "skeleton_updated");
+
+	CHECK_MESSAGE(Skeleton3D::get_prepared_update_count() - prepared_before == (uint64_t)skeleton_count, "All skeletons should take the batched path.");
+
+	// The skin buffers sent to the renderer were computed on worker threads. Check them before
+	// get_bone_global_pose(), which would update any pose the batch left dirty.
+	for (int i = 0; i < skeleton_count; i++) {
+		const Vector<float> &buffer = skin_refs[i]->get_skin_buffer();
+		REQUIRE(buffer.size() == bone_count * 12);
+		for (int j = 0; j < bone_count; j++) {
+			// Bone origin plus the bind pose offset, with identity bases.
+			const float *bone = buffer.ptr() + j * 12;
+			CHECK(Vector3(bone[3], bone[7], bone[11]).is_equal_approx(Vector3(i * (j + 1), j + 1, 1)));
+			CHECK(Vector3(bone[0], bone[5], bone[10]).is_equal_approx(Vector3(1, 1, 1)));
+		}
+	}
+
+	for (int i = 0; i < skeleton_count; i++) {
+		const Transform3D tip = skeletons[i]->get_bone_global_pose(bone_count - 1);
+		CHECK_MESSAGE(tip.origin.is_equal_approx(Vector3(i * bone_count, bone_count, 0)), "Global pose should accumulate the posed chain.");
+	}
+
+	skin_refs.clear();
+	for (Skeleton3D *skeleton : skeletons) {
+		memdelete(skeleton);
+	}
+}
 } // namespace TestSkeleton3D
@@ -0,0 +1,282 @@
+/**************************************************************************/
+/*  test_canvas_cull.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/hash_set.h"
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCanvasCull {
+
+static const Rect2 screen_rect = Rect2(0, 0, 100, 100);
+
+// Draws a canvas directly through RendererCanvasCull. The dummy renderer has no
+// render targets, so viewports never draw, but culling runs the same way.
+struct CanvasScene {
+	RID canvas;
+	LocalVector<RID> items;
+	int previous_min_children = 0;
+
+	CanvasScene(int p_min_children) {
+		previous_min_children = RSG::canvas->get_child_index_min_children();
+		RSG::canvas->set_child_index_min_children(p_min_children);
+		canvas = RenderingServer::get_singleton()->canvas_create();
+	}
+
+	~CanvasScene() {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		for (int i = items.size() - 1; i >= 0; i--) {
+			rs->free(items[i]);
+		}
+		rs->free(canvas);
+		RSG::canvas->set_child_index_min_children(previous_min_children);
+	}
+
+	// Items draw a 10x10 rect. The visibility notifier records the frames they are drawn in.
+	RID add_item(RID p_parent, const Vector2 &p_position) {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		RID item = rs->canvas_item_create();
+		rs->canvas_item_set_parent(item, p_parent);
+		rs->canvas_item_set_transform(item, Transform2D(0, p_position));
+		rs->canvas_item_add_rect(item, Rect2(0, 0, 10, 10), Color(1, 1, 1));
+		rs->canvas_item_set_visibility_notifier(item, true, Rect2(0, 0, 10, 10), Callable(), Callable());
+		items.push_back(item);
+		return item;
+	}
+
+	RendererCanvasCull::Item *get_item(RID p_item) const {
+		return RSG::canvas->canvas_item_owner.get_or_null(p_item);
+	}
+
+	void draw() {
+		RSG::rasterizer->begin_frame(0);
+		RSG::canvas->render_canvas(RID(), RSG::canvas->canvas_owner.get_or_null(canvas), Transform2D(), nullptr, nullptr, screen_rect, RS::CANVAS_ITEM_TEXTURE_FILTER_LINEAR, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED, false, false, 0xFFFFFFFF);
+	}
+
+	bool is_drawn(RID p_item) const {
+		return get_item(p_item)->visibility_notifier->visible_in_frame == RSG::rasterizer->get_frame_number();
+	}
+
+	// Follows the render list built by the last draw, from its first item.
+	LocalVector<RID> get_draw_order() const {
+		HashSet<RendererCanvasRender::Item *> drawn;
+		for (const RID &rid : items) {
+			if (is_drawn(rid)) {
+				drawn.insert(get_item(rid));
+			}
+		}
+
+		HashSet<RendererCanvasRender::Item *> followers;
+		for (RendererCanvasRender::Item *item : drawn) {
+			if (item->next) {
+				followers.insert(item->next);
+			}
+		}
+
+		LocalVector<RID> order;
+		for (RendererCanvasRender::Item *item : drawn) {
+			if (!followers.has(item)) {
+				for (RendererCanvasRender::Item *E = item; E; E = E->next) {
+					order.push_back(static_cast<RendererCanvasCull::Item *>(E)->self);
+				}
+				break;
+			}
+		}
+		return order;
+	}
+};
+
+TEST_CASE("[SceneTree][CanvasCull] Spatial index skips off-screen children") {
+	CanvasScene scene(16);
+
+	// An 8x8 grid with 60 pixel spacing, both on the canvas and under an item.
+	RID parent = scene.add_item(scene.canvas, Vector2(0, 0));
+	LocalVector<RID> canvas_children;
+	LocalVector<RID> item_children;
+	for (int i = 0; i < 64; i++) {
+		const Vector2 position = Vector2(i % 8, i / 8) * 60;
+		canvas_children.push_back(scene.add_item(scene.canvas, position));
+		item_children.push_back(scene.add_item(parent, position));
+	}
+
+	scene.draw();
+	REQUIRE(RSG::canvas->canvas_owner.get_or_null(scene.canvas)->child_index != nullptr);
+	REQUIRE(scene.get_item(parent)->child_index != nullptr);
+
+	int drawn = 0;
+	for (int i = 0; i < 64; i++) {
+		const Vector2 position = Vector2(i % 8, i / 8) * 60;
+		const bool on_screen = screen_rect.intersects(Rect2(position, Size2(10, 10)), true);
+		CHECK(scene.is_drawn(canvas_children[i]) == on_screen);
+		CHECK(scene.is_drawn(item_children[i]) == on_screen);
+		drawn += on_screen ? 1 : 0;
+	}
+	CHECK(drawn == 4);
+	CHECK(scene.is_drawn(parent));
+}
+
+TEST_CASE("[SceneTree][CanvasCull] Spatial index keeps draw order") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	CanvasScene scene(0);
+
+	// Overlapping children with mixed z-indices, some drawn behind their parent,
+	// with grandchildren and interleaved off-screen siblings.
+	RID parent = scene.add_item(scene.canvas, Vector2(10, 10));
+	for (int i = 0; i < 40; i++) {
+		const bool on_screen = i % 3 != 0;
+		RID child = scene.add_item(parent, on_screen ? Vector2(i % 7, i % 5) : Vector2(500 + i * 20, 0));
+		rs->canvas_item_set_z_index(child, i % 3 - 1);
+		rs->canvas_item_set_draw_behind_parent(child, i % 5 == 0);
+		scene.add_item(child, Vector2(2, 2));
+	}
+	for (int i = 0; i < 20; i++) {
+		scene.add_item(scene.canvas, i % 2 ? Vector2(i, i) : Vector2(-500, i * 20));
+	}
+
+	scene.draw();
+	CHECK(scene.get_item(parent)->child_index == nullptr);
+	const LocalVector<RID> linear_order = scene.get_draw_order();
+
+	RSG::canvas->set_child_index_min_children(16);
+	scene.draw();
+	CHECK(scene.get_item(parent)->child_index != nullptr);
+	const LocalVector<RID> indexed_order = scene.get_draw_order();
+
+	REQUIRE(linear_order.size() > 40);
+	REQUIRE(indexed_order.size() == linear_order.size());
+	for (uint32_t i = 0; i < linear_order.size(); i++) {
+		CHECK(indexed_order[i] == linear_order[i]);
+	}
+}
+
+TEST_CASE("[SceneTree][CanvasCull] Spatial index follows item changes") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	CanvasScene scene(16);
+
+	RID parent = scene.add_item(scene.canvas, Vector2(0, 0));
+	LocalVector<RID> children;
+	for (int i = 0; i < 32; i++) {
+		children.push_back(scene.add_item(parent, i == 0 ? Vector2(0, 0) : Vector2(200 + i * 20, 0)));
+	}
+
+	scene.draw();
+	REQUIRE(scene.get_item(parent)->child_index != nullptr);
+	CHECK(scene.is_drawn(children[0]));
+	CHECK_FALSE(scene.is_drawn(children[1]));
+
+	SUBCASE("Transforms") {
+		rs->canvas_item_set_transform(children[1], Transform2D(0, Vector2(20, 20)));
+		rs->canvas_item_set_transform(children[0], Transform2D(0, Vector2(500, 500)));
+		scene.draw();
+		CHECK(scene.is_drawn(children[1]));
+		CHECK_FALSE(scene.is_drawn(children[0]));
+	}
+
+	SUBCASE("Draw commands") {
+		// Children 2 and 3 are at x = 240 and x = 260.
+		rs->canvas_item_add_rect(children[2], Rect2(-200, 40, 10, 10), Color(1, 1, 1));
+		rs->canvas_item_add_circle(children[3], Vector2(-200, 60), 5, Color(1, 1, 1));
+		scene.draw();
+		CHECK(scene.is_drawn(children[2]));
+		CHECK(scene.is_drawn(children[3]));
+		CHECK_FALSE(scene.is_drawn(children[4]));
+	}
+
+	SUBCASE("Reparenting") {
+		// Child 3 is off-screen at x = 260.
+		RID moved = scene.add_item(children[3], Vector2(0, 0));
+		scene.draw();
+		CHECK_FALSE(scene.is_drawn(moved));
+
+		rs->canvas_item_set_parent(moved, children[0]);
+		scene.draw();
+		CHECK(scene.is_drawn(moved));
+
+		// A new grandchild brings an off-screen child's subtree on screen.
+		RID grandchild = scene.add_item(RID(), Vector2(-210, 50));
+		rs->canvas_item_set_parent(grandchild, children[3]);
+		scene.draw();
+		CHECK(scene.is_drawn(grandchild));
+		CHECK_FALSE(scene.is_drawn(children[3]));
+
+		rs->canvas_item_set_parent(grandchild, children[4]);
+		rs->canvas_item_set_transform(grandchild, Transform2D());
+		scene.draw();
+		CHECK_FALSE(scene.is_drawn(grandchild));
+	}
+}
+
+TEST_CASE("[SceneTree][CanvasCull] Spatial index always visits unbounded children") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	CanvasScene scene(16);
+
+	RID parent = scene.add_item(scene.canvas, Vector2(0, 0));
+	for (int i = 0; i < 32; i++) {
+		scene.add_item(parent, Vector2(1000 + i * 20, 0));
+	}
+
+	// Items with an identity transform draw relative to the canvas, not to their parent.
+	RID identity = scene.add_item(parent, Vector2(1000, 1000));
+	rs->canvas_item_set_use_identity_transform(identity, true);
+
+	// Canvas groups draw the area of their children.
+	RID group = scene.add_item(parent, Vector2(1000, 0));
+	rs->canvas_item_set_canvas_group_mode(group, RS::CANVAS_GROUP_MODE_CLIP_AND_DRAW, 5.0, true);
+	RID group_child = scene.add_item(group, Vector2(-970, 30));
+
+	RID ysort = scene.add_item(parent, Vector2(1000, 0));
+	rs->canvas_item_set_sort_children_by_y(ysort, true);
+	RID ysort_child = scene.add_item(ysort, Vector2(-950, 50));
+
+	// The dummy renderer does not allocate skeletons, any valid RID marks the item as deformed.
+	RID skeleton = scene.add_item(parent, Vector2(1000, 0));
+	rs->canvas_item_attach_skeleton(skeleton, parent);
+
+	scene.draw();
+	REQUIRE(scene.get_item(parent)->child_index != nullptr);
+
+	CHECK(scene.get_item(identity)->subtree_unbounded);
+	CHECK(scene.get_item(group)->subtree_unbounded);
+	CHECK(scene.get_item(ysort)->subtree_unbounded);
+	CHECK(scene.get_item(skeleton)->subtree_unbounded);
+	CHECK(scene.get_item(parent)->subtree_unbounded);
+
+	CHECK(scene.is_drawn(identity));
+	CHECK(scene.is_drawn(group_child));
+	CHECK(scene.is_drawn(ysort_child));
+
+	// Detach the skeleton before the item it points to is freed.
+	rs->canvas_item_attach_skeleton(skeleton, RID());
+}
+
+} // namespace TestCanvasCull
@@ -0,0 +1,153 @@
+/**************************************************************************/
+/*  test_instance_transforms.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/os.h"
+#include "servers/rendering_server.h"
+
+#include "tests/test_macros.h"
+
+namespace TestInstanceTransforms {
+
+struct Instances {
+	RID scenario;
+	RID mesh;
+	Vector<RID> rids;
+
+	Instances(int p_count) {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		scenario = rs->scenario_create();
+		mesh = rs->mesh_create();
+		for (int i = 0; i < p_count; i++) {
+			RID instance = rs->instance_create2(mesh, scenario);
+			rs->instance_set_custom_aabb(instance, AABB(Vector3(-0.5, -0.5, -0.5), Vector3(1, 1, 1)));
+			rs->instance_attach_object_instance_id(instance, ObjectID(uint64_t(i + 1)));
+			rs->instance_set_transform(instance, Transform3D(Basis(), Vector3(i * 10, 0, 0)));
+			rids.push_back(instance);
+		}
+	}
+
+	~Instances() {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		for (const RID &rid : rids) {
+			rs->free(rid);
+		}
+		rs->free(mesh);
+		rs->free(scenario);
+	}
+
+	Vector<Transform3D> make_transforms(real_t p_height) const {
+		Vector<Transform3D> transforms;
+		for (int i = 0; i < rids.size(); i++) {
+			transforms.push_back(Transform3D(Basis(), Vector3(i * 10, p_height, 0)));
+		}
+		return transforms;
+	}
+
+	int count_at(real_t p_height) const {
+		const AABB area(Vector3(-10, p_height - 1, -1), Vector3(rids.size() * 10 + 10, 2, 2));
+		return RenderingServer::get_singleton()->instances_cull_aabb(area, scenario).size();
+	}
+};
+
+TEST_CASE("[SceneTree][RenderingServer] Batched instance transforms") {
+	SUBCASE("Few instances") {
+		Instances instances(10);
+		CHECK(instances.count_at(0) == 10);
+
+		RenderingServer::get_singleton()->instances_set_transforms(instances.rids, instances.make_transforms(100));
+		CHECK(instances.count_at(0) == 0);
+		CHECK(instances.count_at(100) == 10);
+	}
+
+	SUBCASE("Many instances update in parallel") {
+		Instances instances(5000);
+		CHECK(instances.count_at(0) == 5000);
+
+		RenderingServer::get_singleton()->instances_set_transforms(instances.rids, instances.make_transforms(100));
+		CHECK(instances.count_at(0) == 0);
+		CHECK(instances.count_at(100) == 5000);
+
+		// Small moves quantize the BVH bounds, which must still contain the instances.
+		RenderingServer::get_singleton()->instances_set_transforms(instances.rids, instances.make_transforms(100.25));
+		CHECK(instances.count_at(100.25) == 5000);
+	}
+
+	SUBCASE("Pending changes take the regular path") {
+		Instances instances(10);
+		CHECK(instances.count_at(0) == 10);
+
+		RenderingServer::get_singleton()->instance_set_custom_aabb(instances.rids[0], AABB(Vector3(-2, -2, -2), Vector3(4, 4, 4)));
+		RenderingServer::get_singleton()->instances_set_transforms(instances.rids, instances.make_transforms(100));
+		CHECK(instances.count_at(100) == 10);
+	}
+
+	SUBCASE("Mismatched sizes are rejected") {
+		Instances instances(10);
+		Vector<Transform3D> transforms = instances.make_transforms(100);
+		transforms.resize(5);
+
+		ERR_PRINT_OFF;
+		RenderingServer::get_singleton()->instances_set_transforms(instances.rids, transforms);
+		ERR_PRINT_ON;
+		CHECK(instances.count_at(0) == 10);
+	}
+}
+
+TEST_CASE_BENCHMARK("[SceneTree][RenderingServer][Benchmark] Batched instance transforms") {
+	const int iterations = 20;
+	Instances instances(50000);
+	instances.count_at(0);
+
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		Vector<Transform3D> transforms = instances.make_transforms(i + 1);
+		for (int j = 0; j < instances.rids.size(); j++) {
+			rs->instance_set_transform(instances.rids[j], transforms[j]);
+		}
+		instances.count_at(i + 1);
+	}
+	const uint64_t single_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		rs->instances_set_transforms(instances.rids, instances.make_transforms(-i - 1));
+		instances.count_at(-i - 1);
+	}
+	const uint64_t batch_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("%d instances, %d updates: single %d usec, batched %d usec.", instances.rids.size(), iterations, single_usec, batch_usec).utf8().get_data());
+	CHECK(instances.count_at(-iterations) == instances.rids.size());
+}
+
+} // namespace TestInstanceTransforms
@@ -0,0 +1,143 @@
+/**************************************************************************/
+/*  test_multimesh_buffer.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/os.h"
+#include "servers/rendering_server.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMultiMeshBuffer {
+
+// 3D transform and color.
+static const int STRIDE = 16;
+
+static Vector<float> _make_buffer(int p_instances, float p_base) {
+	Vector<float> buffer;
+	buffer.resize(p_instances * STRIDE);
+	float *w = buffer.ptrw();
+	for (int i = 0; i < buffer.size(); i++) {
+		w[i] = p_base + i;
+	}
+	return buffer;
+}
+
+TEST_CASE("[SceneTree][RenderingServer] MultiMesh ranged buffer updates") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RID multimesh = rs->multimesh_create();
+	rs->multimesh_allocate_data(multimesh, 10, RS::MULTIMESH_TRANSFORM_3D, true);
+	rs->multimesh_set_buffer(multimesh, _make_buffer(10, 0));
+
+	SUBCASE("Range") {
+		rs->multimesh_set_buffer_range(multimesh, 4, _make_buffer(3, 1000));
+		Vector<float> result = rs->multimesh_get_buffer(multimesh);
+		REQUIRE(result.size() == 10 * STRIDE);
+		CHECK(result[4 * STRIDE - 1] == 4 * STRIDE - 1);
+		CHECK(result[4 * STRIDE] == 1000);
+		CHECK(result[7 * STRIDE - 1] == 1000 + 3 * STRIDE - 1);
+		CHECK(result[7 * STRIDE] == 7 * STRIDE);
+	}
+
+	SUBCASE("Instance list") {
+		Vector<int32_t> instances = { 9, 2 };
+		rs->multimesh_set_buffer_instances(multimesh, instances, _make_buffer(2, 1000));
+		Vector<float> result = rs->multimesh_get_buffer(multimesh);
+		REQUIRE(result.size() == 10 * STRIDE);
+		CHECK(result[9 * STRIDE] == 1000);
+		CHECK(result[2 * STRIDE] == 1000 + STRIDE);
+		CHECK(result[3 * STRIDE] == 3 * STRIDE);
+	}
+
+	SUBCASE("Invalid updates are rejected") {
+		ERR_PRINT_OFF;
+		rs->multimesh_set_buffer_range(multimesh, 8, _make_buffer(3, 1000));
+		rs->multimesh_set_buffer_range(multimesh, 0, Vector<float>({ 1, 2, 3 }));
+		rs->multimesh_set_buffer_instances(multimesh, Vector<int32_t>({ 0 }), _make_buffer(2, 1000));
+		ERR_PRINT_ON;
+		CHECK(rs->multimesh_get_buffer(multimesh) == _make_buffer(10, 0));
+	}
+
+	rs->free(multimesh);
+}
+
+TEST_CASE_BENCHMARK("[SceneTree][RenderingServer][Benchmark] MultiMesh partial updates") {
+	const int instance_count = 200000;
+	const int changed_count = instance_count / 10;
+	const int iterations = 20;
+
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RID multimesh = rs->multimesh_create();
+	rs->multimesh_allocate_data(multimesh, instance_count, RS::MULTIMESH_TRANSFORM_3D, true);
+	Vector<float> full_buffer = _make_buffer(instance_count, 0);
+	rs->multimesh_set_buffer(multimesh, full_buffer);
+
+	// Every tenth instance changes.
+	Vector<int32_t> changed;
+	for (int i = 0; i < changed_count; i++) {
+		changed.push_back(i * 10);
+	}
+	Vector<float> changed_buffer = _make_buffer(changed_count, 1);
+	Vector<float> range_buffer = _make_buffer(changed_count, 2);
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		full_buffer.write[0] = i;
+		rs->multimesh_set_buffer(multimesh, full_buffer);
+	}
+	const uint64_t full_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		for (int j = 0; j < changed_count; j++) {
+			rs->multimesh_instance_set_transform(multimesh, changed[j], Transform3D());
+		}
+	}
+	const uint64_t per_instance_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		rs->multimesh_set_buffer_instances(multimesh, changed, changed_buffer);
+	}
+	const uint64_t instances_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		rs->multimesh_set_buffer_range(multimesh, 0, range_buffer);
+	}
+	const uint64_t range_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("%d of %d instances, %d updates: full buffer %d usec, per instance %d usec, instance list %d usec, range %d usec.", changed_count, instance_count, iterations, full_usec, per_instance_usec, instances_usec, range_usec).utf8().get_data());
+	CHECK(rs->multimesh_get_buffer(multimesh).size() == instance_count * STRIDE);
+
+	rs->free(multimesh);
+}
+
+} // namespace TestMultiMeshBuffer
@@ -0,0 +1,165 @@
+/**************************************************************************/
+/*  test_occlusion_raster.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/projection.h"
+#include "servers/rendering/renderer_scene_occlusion_raster.h"
+
+#include "tests/test_macros.h"
+
+namespace TestOcclusionRaster {
+
+struct OcclusionScene {
+	RendererSceneOcclusionRaster cull;
+	RID scenario = RID::from_uint64(1);
+	RID buffer = RID::from_uint64(2);
+	LocalVector<RID> occluders;
+	LocalVector<RID> instances;
+
+	Transform3D camera;
+	Projection projection;
+	bool orthogonal = false;
+
+	OcclusionScene() {
+		cull.add_scenario(scenario);
+		cull.add_buffer(buffer);
+		cull.buffer_set_scenario(buffer, scenario);
+		cull.buffer_set_size(buffer, Vector2i(64, 64));
+		projection.set_perspective(90, 1.0, 0.05, 100);
+	}
+
+	~OcclusionScene() {
+		for (const RID &instance : instances) {
+			cull.scenario_remove_instance(scenario, instance);
+		}
+		for (const RID &occluder : occluders) {
+			cull.free_occluder(occluder);
+		}
+		cull.remove_buffer(buffer);
+		cull.remove_scenario(scenario);
+	}
+
+	// Quad on the local XY plane.
+	void add_quad(const Transform3D &p_xform, const Vector2 &p_half_size) {
+		RID occluder = cull.occluder_allocate();
+		cull.occluder_initialize(occluder);
+		const PackedVector3Array vertices = {
+			Vector3(-p_half_size.x, -p_half_size.y, 0),
+			Vector3(p_half_size.x, -p_half_size.y, 0),
+			Vector3(p_half_size.x, p_half_size.y, 0),
+			Vector3(-p_half_size.x, p_half_size.y, 0)
+		};
+		cull.occluder_set_mesh(occluder, vertices, { 0, 1, 2, 0, 2, 3 });
+		occluders.push_back(occluder);
+
+		RID instance = RID::from_uint64(100 + instances.size());
+		cull.scenario_set_instance(scenario, instance, occluder, p_xform, true);
+		instances.push_back(instance);
+	}
+
+	void update() {
+		cull.buffer_update(buffer, camera, projection, orthogonal);
+	}
+
+	bool is_occluded(const AABB &p_aabb) {
+		const Vector3 end = p_aabb.get_end();
+		const real_t bounds[6] = { p_aabb.position.x, p_aabb.position.y, p_aabb.position.z, end.x, end.y, end.z };
+		uint64_t timeout = 0;
+		return cull.buffer_get_ptr(buffer)->is_occluded(bounds, camera.origin, camera.affine_inverse(), projection, projection.get_z_near(), timeout);
+	}
+};
+
+TEST_CASE("[OcclusionRaster] Quad occludes objects behind it") {
+	OcclusionScene scene;
+	scene.add_quad(Transform3D(Basis(), Vector3(0, 0, -5)), Vector2(2, 2));
+	scene.update();
+
+	CHECK_MESSAGE(scene.is_occluded(AABB(Vector3(-0.5, -0.5, -10.5), Vector3(1, 1, 1))), "Objects behind the quad should be occluded.");
+	CHECK_FALSE_MESSAGE(scene.is_occluded(AABB(Vector3(-0.5, -0.5, -2.5), Vector3(1, 1, 1))), "Objects in front of the quad should be visible.");
+	CHECK_FALSE_MESSAGE(scene.is_occluded(AABB(Vector3(7.5, -0.5, -10.5), Vector3(1, 1, 1))), "Objects beside the quad should be visible.");
+
+	// Rotated quads are rasterized regardless of their winding.
+	OcclusionScene flipped;
+	flipped.add_quad(Transform3D(Basis(Vector3(0, 1, 0), Math::PI), Vector3(0, 0, -5)), Vector2(2, 2));
+	flipped.update();
+	CHECK(flipped.is_occluded(AABB(Vector3(-0.5, -0.5, -10.5), Vector3(1, 1, 1))));
+}
+
+TEST_CASE("[OcclusionRaster] Occluders crossing the near plane") {
+	OcclusionScene scene;
+	// Floor extending behind the camera, so its triangles must be clipped.
+	scene.add_quad(Transform3D(Basis(Vector3(1, 0, 0), -Math::PI / 2), Vector3(0, -1, -40)), Vector2(50, 50));
+	scene.update();
+
+	CHECK_MESSAGE(scene.is_occluded(AABB(Vector3(-0.5, -4, -6.5), Vector3(1, 1, 1))), "Objects under the floor should be occluded.");
+	CHECK_FALSE_MESSAGE(scene.is_occluded(AABB(Vector3(-0.5, 0, -6.5), Vector3(1, 1, 1))), "Objects above the floor should be visible.");
+}
+
+TEST_CASE("[OcclusionRaster] Orthogonal projection") {
+	OcclusionScene scene;
+	scene.orthogonal = true;
+	scene.projection.set_orthogonal(20, 1.0, 0.05, 100, false);
+	scene.camera.origin = Vector3(0, 0, 20);
+	scene.add_quad(Transform3D(Basis(), Vector3(0, 0, 0)), Vector2(4, 4));
+	scene.update();
+
+	CHECK(scene.is_occluded(AABB(Vector3(-1, -1, -10), Vector3(2, 2, 2))));
+	CHECK_FALSE(scene.is_occluded(AABB(Vector3(6, -1, -10), Vector3(2, 2, 2))));
+}
+
+TEST_CASE("[OcclusionRaster] Occluder updates") {
+	OcclusionScene scene;
+	scene.add_quad(Transform3D(Basis(), Vector3(0, 0, -5)), Vector2(2, 2));
+	scene.update();
+	const AABB behind(Vector3(-0.5, -0.5, -10.5), Vector3(1, 1, 1));
+	REQUIRE(scene.is_occluded(behind));
+
+	// Moving the occluder out of the way.
+	scene.cull.scenario_set_instance(scene.scenario, scene.instances[0], scene.occluders[0], Transform3D(Basis(), Vector3(20, 0, -5)), true);
+	scene.update();
+	CHECK_FALSE(scene.is_occluded(behind));
+
+	// Disabled occluders are ignored.
+	scene.cull.scenario_set_instance(scene.scenario, scene.instances[0], scene.occluders[0], Transform3D(Basis(), Vector3(0, 0, -5)), false);
+	scene.update();
+	CHECK_FALSE(scene.is_occluded(behind));
+
+	scene.cull.scenario_set_instance(scene.scenario, scene.instances[0], scene.occluders[0], Transform3D(Basis(), Vector3(0, 0, -5)), true);
+	scene.update();
+	CHECK(scene.is_occluded(behind));
+
+	// Triangles with invalid indices are skipped.
+	scene.cull.occluder_set_mesh(scene.occluders[0], { Vector3(-2, -2, 0), Vector3(2, -2, 0), Vector3(2, 2, 0) }, { 0, 1, 5 });
+	scene.update();
+	CHECK_FALSE(scene.is_occluded(behind));
+}
+
+} // namespace TestOcclusionRaster
@@ -0,0 +1,191 @@
+/**************************************************************************/
+/*  test_portal_cull.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/projection.h"
+#include "servers/rendering/renderer_scene_portal_cull.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPortalCull {
+
+// Rooms A, B and C are lined up along +X, connected by doorways around z = 5.
+// Room D lies next to A without any portal.
+struct PortalScene {
+	RendererScenePortalCull cull;
+	RID scenario = RID::from_uint64(1);
+	RID rooms[4];
+	RID portals[2];
+
+	static PackedVector3Array box(const Vector3 &p_from, const Vector3 &p_to) {
+		PackedVector3Array points;
+		for (int i = 0; i < 8; i++) {
+			points.push_back(Vector3(i & 1 ? p_to.x : p_from.x, i & 2 ? p_to.y : p_from.y, i & 4 ? p_to.z : p_from.z));
+		}
+		return points;
+	}
+
+	static PackedVector3Array doorway(real_t p_x) {
+		return { Vector3(p_x, 0, 4), Vector3(p_x, 0, 6), Vector3(p_x, 3, 6), Vector3(p_x, 3, 4) };
+	}
+
+	PortalScene() {
+		const Vector3 room_from[4] = { Vector3(0, 0, 0), Vector3(10, 0, 0), Vector3(20, 0, 0), Vector3(0, 0, -10) };
+		for (int i = 0; i < 4; i++) {
+			rooms[i] = cull.room_allocate();
+			cull.room_initialize(rooms[i]);
+			cull.room_set_scenario(rooms[i], scenario);
+			cull.room_set_points(rooms[i], box(room_from[i], room_from[i] + Vector3(10, 3, 10)));
+		}
+		for (int i = 0; i < 2; i++) {
+			portals[i] = cull.portal_allocate();
+			cull.portal_initialize(portals[i]);
+			cull.portal_set_scenario(portals[i], scenario);
+			cull.portal_set_points(portals[i], doorway(10 * (i + 1)));
+			cull.portal_set_rooms(portals[i], rooms[i], rooms[i + 1]);
+		}
+	}
+
+	~PortalScene() {
+		for (const RID &portal : portals) {
+			cull.free(portal);
+		}
+		for (const RID &room : rooms) {
+			cull.free(room);
+		}
+	}
+
+	void look(const Vector3 &p_from, const Vector3 &p_target, RendererScenePortalCull::Visibility &r_visibility) {
+		Transform3D camera = Transform3D().looking_at(p_target - p_from).translated(p_from);
+		Projection projection;
+		projection.set_perspective(75, 16.0 / 9.0, 0.05, 100);
+		cull.scenario_cull(scenario, p_from, projection.get_projection_planes(camera), r_visibility);
+	}
+
+	bool culled(const RendererScenePortalCull::Visibility &p_visibility, const AABB &p_aabb) {
+		const real_t bounds[6] = { p_aabb.position.x, p_aabb.position.y, p_aabb.position.z, p_aabb.get_end().x, p_aabb.get_end().y, p_aabb.get_end().z };
+		return p_visibility.is_culled(cull.scenario_find_room(scenario, p_aabb), bounds);
+	}
+};
+
+TEST_CASE("[PortalCull] Instances are assigned to enclosing rooms") {
+	PortalScene scene;
+	CHECK(scene.cull.scenario_has_rooms(scene.scenario));
+	CHECK(scene.cull.scenario_find_room(scene.scenario, AABB(Vector3(4, 1, 4), Vector3(1, 1, 1))) == 0);
+	CHECK(scene.cull.scenario_find_room(scene.scenario, AABB(Vector3(14, 1, 4), Vector3(1, 1, 1))) == 1);
+	// Crossing from A into B.
+	CHECK(scene.cull.scenario_find_room(scene.scenario, AABB(Vector3(9, 1, 4), Vector3(2, 1, 1))) == -1);
+	// Outside of every room.
+	CHECK(scene.cull.scenario_find_room(scene.scenario, AABB(Vector3(50, 1, 4), Vector3(1, 1, 1))) == -1);
+}
+
+TEST_CASE("[PortalCull] Nothing is culled from outside the rooms") {
+	PortalScene scene;
+	RendererScenePortalCull::Visibility visibility;
+	scene.look(Vector3(-5, 1.5, 5), Vector3(30, 1.5, 5), visibility);
+
+	CHECK_FALSE(visibility.active);
+	CHECK_FALSE(scene.culled(visibility, AABB(Vector3(4, 1, -5), Vector3(1, 1, 1))));
+	CHECK_FALSE(scene.culled(visibility, AABB(Vector3(14, 1, 9), Vector3(0.5, 0.5, 0.5))));
+}
+
+TEST_CASE("[PortalCull] Rooms are seen through portals") {
+	PortalScene scene;
+	RendererScenePortalCull::Visibility visibility;
+	scene.look(Vector3(5, 1.5, 5), Vector3(30, 1.5, 5), visibility);
+
+	REQUIRE(visibility.active);
+	CHECK(visibility.camera_room == 0);
+	CHECK(visibility.is_room_visible(0));
+	CHECK(visibility.is_room_visible(1));
+	CHECK(visibility.is_room_visible(2));
+	CHECK_FALSE(visibility.is_room_visible(3));
+
+	// Camera room.
+	CHECK_FALSE(scene.culled(visibility, AABB(Vector3(8, 1, 1), Vector3(1, 1, 1))));
+	// In line with the doorways.
+	CHECK_FALSE(scene.culled(visibility, AABB(Vector3(14, 1, 4.5), Vector3(1, 1, 1))));
+	CHECK_FALSE(scene.culled(visibility, AABB(Vector3(25, 1, 4.5), Vector3(1, 1, 1))));
+	// Behind the walls of room B.
+	CHECK(scene.culled(visibility, AABB(Vector3(11, 1, 9), Vector3(0.5, 0.5, 0.5))));
+	CHECK(scene.culled(visibility, AABB(Vector3(11, 1, 0.5), Vector3(0.5, 0.5, 0.5))));
+	// Room without portals.
+	CHECK(scene.culled(visibility, AABB(Vector3(4, 1, -5), Vector3(1, 1, 1))));
+	// Instances crossing rooms are never culled.
+	CHECK_FALSE(scene.culled(visibility, AABB(Vector3(9, 1, -1), Vector3(2, 1, 2))));
+}
+
+TEST_CASE("[PortalCull] Portals out of view are not followed") {
+	PortalScene scene;
+	RendererScenePortalCull::Visibility visibility;
+	scene.look(Vector3(5, 1.5, 5), Vector3(-10, 1.5, 5), visibility);
+
+	REQUIRE(visibility.active);
+	CHECK(visibility.is_room_visible(0));
+	CHECK_FALSE(visibility.is_room_visible(1));
+	CHECK_FALSE(visibility.is_room_visible(2));
+	CHECK(scene.culled(visibility, AABB(Vector3(14, 1, 4.5), Vector3(1, 1, 1))));
+}
+
+TEST_CASE("[PortalCull] Standing in a doorway sees both rooms") {
+	PortalScene scene;
+	RendererScenePortalCull::Visibility visibility;
+	scene.look(Vector3(10, 1.5, 5), Vector3(10, 1.5, 30), visibility);
+
+	REQUIRE(visibility.active);
+	CHECK(visibility.is_room_visible(0));
+	CHECK(visibility.is_room_visible(1));
+	CHECK_FALSE(scene.culled(visibility, AABB(Vector3(11, 1, 8), Vector3(0.5, 0.5, 0.5))));
+}
+
+TEST_CASE("[PortalCull] Graph follows portal changes") {
+	PortalScene scene;
+	RendererScenePortalCull::Visibility visibility;
+	const uint64_t version = scene.cull.scenario_get_version(scene.scenario);
+
+	scene.cull.portal_set_scenario(scene.portals[0], RID());
+	scene.look(Vector3(5, 1.5, 5), Vector3(30, 1.5, 5), visibility);
+	CHECK_FALSE(visibility.is_room_visible(1));
+	// Portals don't move rooms, so instances keep their room.
+	CHECK(scene.cull.scenario_get_version(scene.scenario) == version);
+
+	scene.cull.portal_set_scenario(scene.portals[0], scene.scenario);
+	scene.look(Vector3(5, 1.5, 5), Vector3(30, 1.5, 5), visibility);
+	CHECK(visibility.is_room_visible(1));
+
+	scene.cull.room_set_scenario(scene.rooms[3], RID());
+	CHECK(scene.cull.scenario_get_version(scene.scenario) != version);
+
+	scene.cull.remove_scenario(scene.scenario);
+	CHECK_FALSE(scene.cull.scenario_has_rooms(scene.scenario));
+}
+
+} // namespace TestPortalCull
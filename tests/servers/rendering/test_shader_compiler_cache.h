@@ -0,0 +1,282 @@
+/**************************************************************************/
+/*  test_shader_compiler_cache.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "servers/rendering/shader_compiler.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestShaderCompilerCache {
+
+static const char *canvas_shader_code = R"(
+shader_type canvas_item;
+render_mode blend_add;
+
+uniform vec4 tint : source_color = vec4(1.0, 0.5, 0.25, 1.0);
+uniform float strength : hint_range(0.0, 4.0) = 2.0;
+uniform sampler2D noise : filter_nearest;
+
+void fragment() {
+	COLOR = texture(noise, UV) * tint * strength * sin(TIME * %d.0);
+}
+)";
+
+struct CompileResult {
+	ShaderCompiler::GeneratedCode gen_code;
+	HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> uniforms;
+	int blend_mode = 0;
+	bool uses_time = false;
+};
+
+static void initialize_compiler(ShaderCompiler &r_compiler, const String &p_uniform_prefix = "material.") {
+	ShaderCompiler::DefaultIdentifierActions actions;
+	actions.renames["COLOR"] = "color";
+	actions.renames["UV"] = "uv";
+	actions.renames["TIME"] = "time";
+	actions.base_uniform_string = p_uniform_prefix;
+	r_compiler.initialize(actions);
+}
+
+static Error compile(ShaderCompiler &p_compiler, const String &p_code, CompileResult &r_result) {
+	ShaderCompiler::IdentifierActions actions;
+	actions.entry_point_stages["vertex"] = ShaderCompiler::STAGE_VERTEX;
+	actions.entry_point_stages["fragment"] = ShaderCompiler::STAGE_FRAGMENT;
+	actions.render_mode_values["blend_add"] = Pair<int *, int>(&r_result.blend_mode, 1);
+	actions.usage_flag_pointers["TIME"] = &r_result.uses_time;
+	actions.uniforms = &r_result.uniforms;
+	return p_compiler.compile(RS::SHADER_CANVAS_ITEM, p_code, &actions, "", r_result.gen_code);
+}
+
+static void check_same_result(const CompileResult &p_a, const CompileResult &p_b) {
+	CHECK(p_a.gen_code.defines == p_b.gen_code.defines);
+	CHECK(p_a.gen_code.uniforms == p_b.gen_code.uniforms);
+	CHECK(p_a.gen_code.uniform_offsets == p_b.gen_code.uniform_offsets);
+	CHECK(p_a.gen_code.uniform_total_size == p_b.gen_code.uniform_total_size);
+	CHECK(p_a.gen_code.uses_fragment_time == p_b.gen_code.uses_fragment_time);
+	for (int i = 0; i < ShaderCompiler::STAGE_MAX; i++) {
+		CHECK(p_a.gen_code.stage_globals[i] == p_b.gen_code.stage_globals[i]);
+	}
+
+	REQUIRE(p_a.gen_code.code.size() == p_b.gen_code.code.size());
+	for (const KeyValue<String, String> &E : p_a.gen_code.code) {
+		REQUIRE(p_b.gen_code.code.has(E.key));
+		CHECK(p_b.gen_code.code[E.key] == E.value);
+	}
+
+	REQUIRE(p_a.gen_code.texture_uniforms.size() == p_b.gen_code.texture_uniforms.size());
+	for (int i = 0; i < p_a.gen_code.texture_uniforms.size(); i++) {
+		CHECK(p_a.gen_code.texture_uniforms[i].name == p_b.gen_code.texture_uniforms[i].name);
+		CHECK(p_a.gen_code.texture_uniforms[i].filter == p_b.gen_code.texture_uniforms[i].filter);
+	}
+
+	CHECK(p_a.blend_mode == p_b.blend_mode);
+	CHECK(p_a.uses_time == p_b.uses_time);
+
+	REQUIRE(p_a.uniforms.size() == p_b.uniforms.size());
+	for (const KeyValue<StringName, ShaderLanguage::ShaderNode::Uniform> &E : p_a.uniforms) {
+		REQUIRE(p_b.uniforms.has(E.key));
+		const ShaderLanguage::ShaderNode::Uniform &uniform = p_b.uniforms[E.key];
+		CHECK(uniform.order == E.value.order);
+		CHECK(uniform.type == E.value.type);
+		CHECK(uniform.hint == E.value.hint);
+		CHECK(uniform.hint_range[1] == E.value.hint_range[1]);
+		REQUIRE(uniform.default_value.size() == E.value.default_value.size());
+		for (int i = 0; i < uniform.default_value.size(); i++) {
+			CHECK(uniform.default_value[i].uint == E.value.default_value[i].uint);
+		}
+	}
+}
+
+// Points the compiler at a fresh directory for the duration of a test and removes it afterwards,
+// so entries left behind by earlier runs can't be mistaken for ones written by this test.
+struct ScopedCacheDir {
+	String path;
+
+	ScopedCacheDir(const String &p_name) {
+		path = TestUtils::get_temp_path(vformat("%s_%d_%d", p_name, OS::get_singleton()->get_process_id(), OS::get_singleton()->get_ticks_usec()));
+		DirAccess::make_dir_recursive_absolute(path);
+		ShaderCompiler::set_cache_dir(path);
+	}
+
+	~ScopedCacheDir() {
+		ShaderCompiler::set_cache_dir(String());
+		Ref<DirAccess> da = DirAccess::open(path);
+		if (da.is_valid()) {
+			da->erase_contents_recursive();
+		}
+		DirAccess::remove_absolute(path);
+	}
+};
+
+TEST_CASE("[SceneTree][ShaderCompiler] Cached compilation matches a full compilation") {
+	ScopedCacheDir scoped_cache_dir("shader_compiler_cache_match");
+	const String cache_dir = ShaderCompiler::get_cache_dir();
+	REQUIRE_FALSE(cache_dir.is_empty());
+	const String code = vformat(canvas_shader_code, 3);
+
+	ShaderCompiler compiler;
+	initialize_compiler(compiler);
+	CompileResult compiled;
+	REQUIRE(compile(compiler, code, compiled) == OK);
+	CHECK(compiled.blend_mode == 1);
+	CHECK(compiled.uses_time);
+	CHECK(compiled.uniforms.size() == 3);
+	CHECK(DirAccess::get_files_at(cache_dir).size() == 1);
+
+	// A fresh compiler with the same configuration is served from the cache.
+	ShaderCompiler cached_compiler;
+	initialize_compiler(cached_compiler);
+	CompileResult cached;
+	REQUIRE(compile(cached_compiler, code, cached) == OK);
+	CHECK(DirAccess::get_files_at(cache_dir).size() == 1);
+	check_same_result(compiled, cached);
+
+	// Rename the texture uniform inside the stored entry. Only a compilation served from the cache
+	// can return the renamed value, a recompilation would produce the original name again.
+	PackedStringArray files = DirAccess::get_files_at(cache_dir);
+	REQUIRE(files.size() == 1);
+	const String entry_path = cache_dir.path_join(files[0]);
+	Vector<uint8_t> entry = FileAccess::get_file_as_bytes(entry_path);
+	int renamed = 0;
+	for (int i = 0; i + 5 <= entry.size(); i++) {
+		if (memcmp(entry.ptr() + i, "noise", 5) == 0) {
+			entry.write[i + 1] = 'O';
+			renamed++;
+		}
+	}
+	REQUIRE(renamed > 0);
+	{
+		Ref<FileAccess> f = FileAccess::open(entry_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(entry);
+	}
+
+	ShaderCompiler tampered_compiler;
+	initialize_compiler(tampered_compiler);
+	CompileResult tampered;
+	REQUIRE(compile(tampered_compiler, code, tampered) == OK);
+	REQUIRE(tampered.gen_code.texture_uniforms.size() == 1);
+	CHECK(tampered.gen_code.texture_uniforms[0].name == "nOise");
+	CHECK(tampered.uniforms.has("nOise"));
+	CHECK_FALSE(tampered.uniforms.has("noise"));
+
+	// A different compiler configuration gets its own entry.
+	ShaderCompiler other_compiler;
+	initialize_compiler(other_compiler, "params.");
+	CompileResult other;
+	REQUIRE(compile(other_compiler, code, other) == OK);
+	CHECK(DirAccess::get_files_at(cache_dir).size() == 2);
+}
+
+TEST_CASE("[SceneTree][ShaderCompiler] Damaged cache entries are recompiled") {
+	ScopedCacheDir scoped_cache_dir("shader_compiler_cache_damaged");
+	const String cache_dir = ShaderCompiler::get_cache_dir();
+	REQUIRE_FALSE(cache_dir.is_empty());
+	const String code = vformat(canvas_shader_code, 5);
+
+	ShaderCompiler compiler;
+	initialize_compiler(compiler);
+	CompileResult compiled;
+	REQUIRE(compile(compiler, code, compiled) == OK);
+
+	PackedStringArray files = DirAccess::get_files_at(cache_dir);
+	REQUIRE(files.size() == 1);
+	const String entry_path = cache_dir.path_join(files[0]);
+	Vector<uint8_t> entry = FileAccess::get_file_as_bytes(entry_path);
+	REQUIRE(entry.size() > 16);
+	{
+		Ref<FileAccess> f = FileAccess::open(entry_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(entry.ptr(), entry.size() / 2);
+	}
+
+	CompileResult recompiled;
+	REQUIRE(compile(compiler, code, recompiled) == OK);
+	check_same_result(compiled, recompiled);
+	CHECK(FileAccess::get_file_as_bytes(entry_path).size() == entry.size());
+}
+
+TEST_CASE("[SceneTree][ShaderCompiler] Failed compilations are not cached") {
+	ScopedCacheDir scoped_cache_dir("shader_compiler_cache_errors");
+	const String cache_dir = ShaderCompiler::get_cache_dir();
+	REQUIRE_FALSE(cache_dir.is_empty());
+
+	ShaderCompiler compiler;
+	initialize_compiler(compiler);
+	CompileResult result;
+	ERR_PRINT_OFF;
+	CHECK(compile(compiler, "shader_type canvas_item;\nvoid fragment() { COLOR = undefined_value; }\n", result) != OK);
+	ERR_PRINT_ON;
+	CHECK(DirAccess::get_files_at(cache_dir).is_empty());
+}
+
+TEST_CASE_BENCHMARK("[SceneTree][ShaderCompiler][Benchmark] Startup compilation with a warm cache") {
+	const int shader_count = 500;
+	Vector<String> codes;
+	for (int i = 0; i < shader_count; i++) {
+		codes.push_back(vformat(canvas_shader_code, i + 1));
+	}
+
+	ShaderCompiler::set_cache_dir(String());
+	ShaderCompiler compiler;
+	initialize_compiler(compiler);
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (const String &code : codes) {
+		CompileResult result;
+		compile(compiler, code, result);
+	}
+	const uint64_t uncached_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	ScopedCacheDir scoped_cache_dir("shader_compiler_cache_benchmark");
+	for (const String &code : codes) {
+		CompileResult result;
+		compile(compiler, code, result);
+	}
+
+	// Simulate the next run: a new compiler reading the entries written above.
+	ShaderCompiler warm_compiler;
+	initialize_compiler(warm_compiler);
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (const String &code : codes) {
+		CompileResult result;
+		compile(warm_compiler, code, result);
+	}
+	const uint64_t cached_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("%d shaders: compiled in %d usec, loaded from cache in %d usec.", shader_count, uncached_usec, cached_usec).utf8().get_data());
+	CHECK(DirAccess::get_files_at(ShaderCompiler::get_cache_dir()).size() == shader_count);
+}
+
+} // namespace TestShaderCompilerCache
@@ -0,0 +1,268 @@
+/**************************************************************************/
+/*  test_shadow_caster_cache.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "servers/rendering/renderer_scene_cull.h"
+#include "servers/rendering/renderer_shadow_caster_cache.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+#include "tests/test_macros.h"
+
+namespace TestShadowCasterCache {
+
+// Stands in for the BVH query of a cube map shadow, one caster per face.
+struct CountingCull {
+	uint32_t pass = 0;
+	int *calls = nullptr;
+
+	void operator()(LocalVector<int> &r_casters) const {
+		(*calls)++;
+		r_casters.push_back(int(pass) * 10);
+	}
+};
+
+static void draw_cube_shadow(RendererShadowCasterCache<int> &p_cache, int *r_calls) {
+	for (uint32_t i = 0; i < RendererShadowCasterCache<int>::MAX_PASSES; i++) {
+		const LocalVector<int> &casters = p_cache.get(i, CountingCull{ i, r_calls });
+		CHECK(casters.size() == 1);
+		CHECK(casters[0] == int(i) * 10);
+	}
+}
+
+TEST_CASE("[ShadowCasterCache] Static lights only cull once") {
+	RendererShadowCasterCache<int> cache;
+	int calls = 0;
+
+	// A static light redrawn every frame, for example when the shadow atlas moves it.
+	const int frames = 60;
+	for (int i = 0; i < frames; i++) {
+		draw_cube_shadow(cache, &calls);
+	}
+
+	CHECK(calls == RendererShadowCasterCache<int>::MAX_PASSES);
+	CHECK(cache.get_cull_count() == RendererShadowCasterCache<int>::MAX_PASSES);
+	CHECK(cache.get_hit_count() == (frames - 1) * RendererShadowCasterCache<int>::MAX_PASSES);
+}
+
+TEST_CASE("[ShadowCasterCache] Invalidation culls every pass again") {
+	RendererShadowCasterCache<int> cache;
+	int calls = 0;
+
+	draw_cube_shadow(cache, &calls);
+	CHECK(cache.is_valid(0));
+	CHECK(cache.is_valid(5));
+
+	// An instance intersecting the light moved.
+	cache.invalidate();
+	CHECK_FALSE(cache.is_valid(0));
+	CHECK_FALSE(cache.is_valid(5));
+
+	draw_cube_shadow(cache, &calls);
+	draw_cube_shadow(cache, &calls);
+	CHECK(calls == 2 * RendererShadowCasterCache<int>::MAX_PASSES);
+	CHECK(cache.get_hit_count() == RendererShadowCasterCache<int>::MAX_PASSES);
+}
+
+TEST_CASE("[ShadowCasterCache] Passes are cached separately") {
+	RendererShadowCasterCache<int> cache;
+	int calls = 0;
+
+	// Spot lights only use the first pass.
+	cache.get(0, CountingCull{ 0, &calls });
+	CHECK(cache.is_valid(0));
+	CHECK_FALSE(cache.is_valid(1));
+
+	cache.get(1, CountingCull{ 1, &calls });
+	cache.get(0, CountingCull{ 0, &calls });
+	CHECK(calls == 2);
+	CHECK(cache.get(1, CountingCull{ 1, &calls })[0] == 10);
+}
+
+// An omni light with instances around it. The dummy rasterizer never draws shadows,
+// so cull_shadow() culls the casters of both paraboloid halves the way a shadow redraw does.
+struct LightScene {
+	RID scenario;
+	RID mesh;
+	RID light;
+	RID light_instance;
+	Vector<RID> instances;
+
+	LightScene() {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		scenario = rs->scenario_create();
+		mesh = rs->mesh_create();
+		light = rs->omni_light_create();
+		rs->light_set_param(light, RS::LIGHT_PARAM_RANGE, 5);
+		light_instance = rs->instance_create2(light, scenario);
+	}
+
+	~LightScene() {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		for (const RID &rid : instances) {
+			rs->free(rid);
+		}
+		rs->free(light_instance);
+		rs->free(light);
+		rs->free(mesh);
+		rs->free(scenario);
+	}
+
+	RID add_instance(const Vector3 &p_position) {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		RID instance = rs->instance_create2(mesh, scenario);
+		rs->instance_set_custom_aabb(instance, AABB(Vector3(-0.5, -0.5, -0.5), Vector3(1, 1, 1)));
+		rs->instance_set_transform(instance, Transform3D(Basis(), p_position));
+		instances.push_back(instance);
+		return instance;
+	}
+
+	void remove_instance(RID p_instance) {
+		instances.erase(p_instance);
+		RenderingServer::get_singleton()->free(p_instance);
+	}
+
+	static RendererSceneCull *get_scene() {
+		RendererSceneCull *scene = static_cast<RendererSceneCull *>(RSG::scene);
+		scene->update_dirty_instances();
+		return scene;
+	}
+
+	const RendererShadowCasterCache<RendererSceneCull::Instance *> &get_cache() const {
+		RendererSceneCull::Instance *instance = get_scene()->instance_owner.get_or_null(light_instance);
+		return static_cast<RendererSceneCull::InstanceLightData *>(instance->base_data)->shadow_casters;
+	}
+
+	// Returns the number of casters found over both passes.
+	int cull_shadow() const {
+		RendererSceneCull *scene = get_scene();
+		RendererSceneCull::Instance *instance = scene->instance_owner.get_or_null(light_instance);
+		RendererSceneCull::Scenario *scenario_data = scene->scenario_owner.get_or_null(scenario);
+
+		const AABB &bounds = instance->transformed_aabb;
+		const Vector3 end = bounds.get_end();
+		const Vector<Plane> planes = {
+			Plane(Vector3(1, 0, 0), end.x),
+			Plane(Vector3(-1, 0, 0), -bounds.position.x),
+			Plane(Vector3(0, 1, 0), end.y),
+			Plane(Vector3(0, -1, 0), -bounds.position.y),
+			Plane(Vector3(0, 0, 1), end.z),
+			Plane(Vector3(0, 0, -1), -bounds.position.z),
+		};
+
+		int count = 0;
+		for (uint32_t pass = 0; pass < 2; pass++) {
+			scene->_light_cull_shadow_casters(instance, pass, planes, scenario_data);
+			count += scene->instance_shadow_cull_result.size();
+		}
+		return count;
+	}
+};
+
+TEST_CASE("[SceneTree][ShadowCasterCache] Instances moving outside the light keep the cache") {
+	LightScene scene;
+	scene.add_instance(Vector3(1, 0, 0));
+	const RID outside = scene.add_instance(Vector3(50, 0, 0));
+
+	CHECK(scene.cull_shadow() == 2);
+	CHECK(scene.get_cache().get_cull_count() == 2);
+
+	RenderingServer::get_singleton()->instance_set_transform(outside, Transform3D(Basis(), Vector3(60, 0, 0)));
+	CHECK(scene.get_cache().is_valid(0));
+	CHECK(scene.get_cache().is_valid(1));
+	CHECK(scene.cull_shadow() == 2);
+	CHECK(scene.get_cache().get_cull_count() == 2);
+	CHECK(scene.get_cache().get_hit_count() == 2);
+
+	// A new instance outside of the light doesn't pair with it either.
+	scene.add_instance(Vector3(-50, 0, 0));
+	CHECK(scene.cull_shadow() == 2);
+	CHECK(scene.get_cache().get_cull_count() == 2);
+}
+
+TEST_CASE("[SceneTree][ShadowCasterCache] Casters and the light invalidate the cache") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	LightScene scene;
+	const RID caster = scene.add_instance(Vector3(1, 0, 0));
+	const RID other = scene.add_instance(Vector3(50, 0, 0));
+	CHECK(scene.cull_shadow() == 2);
+
+	SUBCASE("Caster moving inside the light") {
+		rs->instance_set_transform(caster, Transform3D(Basis(), Vector3(0, 2, 0)));
+		CHECK_FALSE(scene.get_cache().is_valid(0));
+		CHECK(scene.cull_shadow() == 2);
+		CHECK(scene.get_cache().get_cull_count() == 4);
+	}
+
+	SUBCASE("Instances pairing and unpairing") {
+		rs->instance_set_transform(other, Transform3D(Basis(), Vector3(-2, 0, 0)));
+		CHECK_FALSE(scene.get_cache().is_valid(0));
+		CHECK(scene.cull_shadow() == 4);
+
+		rs->instance_set_transform(other, Transform3D(Basis(), Vector3(50, 0, 0)));
+		CHECK_FALSE(scene.get_cache().is_valid(0));
+		CHECK(scene.cull_shadow() == 2);
+
+		// Freed casters unpair, so they never linger in the cache.
+		scene.remove_instance(caster);
+		CHECK_FALSE(scene.get_cache().is_valid(0));
+		CHECK(scene.cull_shadow() == 0);
+		CHECK(scene.get_cache().get_cull_count() == 8);
+	}
+
+	SUBCASE("Light moving") {
+		rs->instance_set_transform(scene.light_instance, Transform3D(Basis(), Vector3(48, 0, 0)));
+		CHECK_FALSE(scene.get_cache().is_valid(0));
+		CHECK(scene.cull_shadow() == 2); // Only the other instance is in range now.
+	}
+}
+
+TEST_CASE("[SceneTree][ShadowCasterCache] Shadow culls saved by static lights") {
+	LightScene scene;
+	for (int i = 0; i < 10; i++) {
+		scene.add_instance(Vector3(i * 0.4 - 2, 0, 0));
+	}
+	const RID outside = scene.add_instance(Vector3(50, 0, 0));
+
+	// The shadow atlas may redraw a static light on any frame, while things move elsewhere.
+	const int redraws = 60;
+	for (int i = 0; i < redraws; i++) {
+		RenderingServer::get_singleton()->instance_set_transform(outside, Transform3D(Basis(), Vector3(50, i, 0)));
+		CHECK(scene.cull_shadow() == 20);
+	}
+
+	const uint64_t culls = scene.get_cache().get_cull_count();
+	const uint64_t saved = scene.get_cache().get_hit_count();
+	CHECK(culls == 2);
+	CHECK(saved == (redraws - 1) * 2);
+	MESSAGE(vformat("%d shadow redraws of a static omni light: %d caster culls, %d saved.", redraws, culls, saved).utf8().get_data());
+}
+
+} // namespace TestShadowCasterCache